@@ -619,6 +619,48 @@ PORT_CONFIG_VS_0_PB \
 */
 #define PORT_SET_PIN_DIRECTION_API           (STD_ON)
 
+/**
+* @brief Use/remove Port_SetPinGroupDirection function from the compiled driver
+*/
+#define PORT_SET_PIN_GROUP_DIRECTION_API     (STD_ON)
+
+/**
+* @brief Use/remove Port_VerifyPortDirection function from the compiled driver
+*/
+#define PORT_VERIFY_PORT_DIRECTION_API       (STD_ON)
+
+/**
+* @brief Use/remove Port_ApplyModeProfile function from the compiled driver
+*/
+#define PORT_APPLY_MODE_PROFILE_API          (STD_ON)
+
+/**
+* @brief Use/remove Port_SwitchProfile function from the compiled driver
+*/
+#define PORT_SWITCH_PROFILE_API              (STD_ON)
+
+/**
+* @brief Use/remove Port_ReadChannelGroup/Port_WriteChannelGroup functions from the compiled driver
+*/
+#define PORT_CHANNEL_GROUP_API               (STD_ON)
+
+/**
+* @brief Use/remove Port_DebounceMainFunction and its getters from the compiled driver
+*/
+#define PORT_DEBOUNCE_API                    (STD_ON)
+
+/**
+* @brief Use/remove Port_EnablePinNotification/Port_DisablePinNotification functions from the compiled driver
+* @details Needs Board/Driver/HW_Port/Port_Hw_Irq.c, which also provides the PORTx interrupt handlers.
+*/
+#define PORT_PIN_NOTIFICATION_API            (STD_ON)
+
+/**
+* @brief Use/remove Port_EnableDigitalFilter/Port_DisableDigitalFilter functions from the compiled driver
+* @details When STD_ON, Port_Init also configures the digital input filters of the configuration.
+*/
+#define PORT_DIGITAL_FILTER_API              (STD_ON)
+
 /**
 * @brief Enable/Disable multicore function from the driver
 */
@@ -669,6 +711,51 @@ PORT_CONFIG_VS_0_PB \
 */
 #define PortConfigSet_PortContainer_0_PortPin_0 0
 
+/**
+* @brief Port Pin Group symbolic names
+* @details Get All Symbolic Names from configuration tool
+*
+*/
+#define PortConfigSet_PortPinGroup_0 0
+
+/**
+* @brief Port Mode Profile symbolic names
+* @details Get All Symbolic Names from configuration tool
+*
+*/
+#define PortConfigSet_PortModeProfile_Gpio 0
+#define PortConfigSet_PortModeProfile_Ftm0 1
+
+/**
+* @brief Port Pin Profile symbolic names
+* @details Get All Symbolic Names from configuration tool. Profile 0 is the one set up by
+*          Port_Init.
+*
+*/
+#define PortConfigSet_PortProfile_Run 0
+#define PortConfigSet_PortProfile_Sleep 1
+
+/**
+* @brief Port Channel Group symbolic names
+* @details Get All Symbolic Names from configuration tool
+*
+*/
+#define PortConfigSet_PortChannelGroup_Led 0
+
+/**
+* @brief Port Debounce Port symbolic names
+* @details Get All Symbolic Names from configuration tool
+*
+*/
+#define PortConfigSet_PortDebounce_Buttons 0
+
+/**
+* @brief Port Digital Filter Port symbolic names
+* @details Get All Symbolic Names from configuration tool
+*
+*/
+#define PortConfigSet_PortDigitalFilter_Buttons 0
+
 /**
 * @brief Number of available pad modes options
 * @details Platform constant
@@ -694,6 +781,54 @@ PORT_CONFIG_VS_0_PB \
 */
 #define PORT_MAX_UNUSED_PADS_U16    (83U)
 
+/**
+* @brief The maximum number of configured pin groups
+*/
+#define PORT_MAX_CONFIGURED_PIN_GROUPS_U16   ((uint16)1)
+
+/**
+* @brief The maximum number of configured mode profiles
+*/
+#define PORT_MAX_CONFIGURED_MODE_PROFILES_U16   ((uint16)2)
+
+/**
+* @brief The maximum number of configured pin profile switches
+*/
+#define PORT_MAX_CONFIGURED_PROFILE_SWITCHES_U16   ((uint16)2)
+
+/**
+* @brief The maximum number of configured channel groups
+*/
+#define PORT_MAX_CONFIGURED_CHANNEL_GROUPS_U16   ((uint16)1)
+
+/**
+* @brief The maximum number of configured debounce ports
+*/
+#define PORT_MAX_CONFIGURED_DEBOUNCE_PORTS_U16   ((uint16)1)
+
+/**
+* @brief Enable/Disable replay of the generated init script in Port_Init
+* @details When STD_ON, Port_Init writes the (address, value) table generated by
+*          Tools/Port_InitScriptGen instead of running PortHw_Init. Only valid from reset.
+*/
+#define PORT_INIT_SCRIPT_REPLAY             (STD_OFF)
+
+/**
+* @brief Enable/Disable the warm initialization of Port_Init
+* @details When STD_ON, Port_Init runs PortHw_InitWarm: registers already holding their
+*          configuration (warm reset, wakeup) are not rewritten. The number of skipped
+*          writes is returned by Port_GetInitSkippedWrites.
+*/
+#define PORT_WARM_INIT_SKIP                 (STD_OFF)
+
+/**
+* @brief Enable/Disable the phased initialization API
+* @details When STD_ON, Port_InitCritical() configures the critical pins only and
+*          Port_InitMainFunction() configures the remaining pins and the unused pads in
+*          bounded slices.
+*/
+#define PORT_PHASED_INIT_API                (STD_ON)
+
 /**
 * @brief Port driver Pre-Compile configuration switch
 */
@@ -0,0 +1,75 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Generated by Tools/Port_InitScriptGen, do not edit.
+==================================================================================================*/
+
+/**
+*   @file    Port_Hw_InitScript_VS_0_PBcfg.c
+*
+*   @brief   Register write sequence equivalent to PortHw_Init() for Port_Config_VS_0
+*   @details Replayed by PortHw_InitScriptReplay() when PORT_INIT_SCRIPT_REPLAY is STD_ON.
+*
+*   @addtogroup Port_CFG
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                                         LOCAL CONSTANTS
+==================================================================================================*/
+#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief Register writes, in order (PDOR, PDDR, then PCRs of each port)
+*/
+static const PortHw_InitScriptEntryType PortHw_aInitScriptEntries_VS_0[11] =
+{
+    { (volatile uint32*)&IP_PORTA->GPCLR, (uint32)0xFBCF0100U },
+    { (volatile uint32*)&IP_PORTA->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTB->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTB->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTC->GPCLR, (uint32)0xFFCF0100U },
+    { (volatile uint32*)&IP_PORTC->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PTD->PDDR, (uint32)0x00000001U },
+    { (volatile uint32*)&IP_PORTD->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTD->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTE->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTE->GPCHR, (uint32)0x00010100U }
+};
+
+/*==================================================================================================
+*                                        GLOBAL CONSTANTS
+==================================================================================================*/
+/**
+* @brief Init script of Port_Config_VS_0
+*/
+const PortHw_InitScriptType PortHw_g_InitScript_VS_0 =
+{
+    (uint32)11U,
+    PortHw_aInitScriptEntries_VS_0
+};
+
+#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
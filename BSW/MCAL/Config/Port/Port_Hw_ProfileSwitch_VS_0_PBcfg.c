@@ -0,0 +1,103 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Generated by Tools/Port_InitScriptGen, do not edit.
+==================================================================================================*/
+
+/**
+*   @file    Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*
+*   @brief   Register write deltas between the pin profiles of Port_Config_VS_0
+*   @details Each script holds only the PDOR, PDDR and PCR writes that differ between two
+*            profiles and is replayed by Port_SwitchProfile().
+*
+*   @addtogroup Port_CFG
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                          INCLUDE FILES
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                                         LOCAL CONSTANTS
+==================================================================================================*/
+#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief Register writes of RunToSleep, in order (PDOR, PDDR, then PCRs of each port)
+*/
+static const PortHw_InitScriptEntryType PortHw_aProfileSwitchEntries_VS_0_RunToSleep[11] =
+{
+    { (volatile uint32*)&IP_PORTA->GPCLR, (uint32)0xFBCF0000U },
+    { (volatile uint32*)&IP_PORTA->GPCHR, (uint32)0x00030000U },
+    { (volatile uint32*)&IP_PORTB->GPCLR, (uint32)0xFFFF0000U },
+    { (volatile uint32*)&IP_PORTB->GPCHR, (uint32)0x00030000U },
+    { (volatile uint32*)&IP_PORTC->GPCLR, (uint32)0xFFCF0000U },
+    { (volatile uint32*)&IP_PORTC->GPCHR, (uint32)0x00030000U },
+    { (volatile uint32*)&IP_PTD->PDDR, (uint32)0x00000000U },
+    { (volatile uint32*)&IP_PORTD->GPCLR, (uint32)0xFFFF0000U },
+    { (volatile uint32*)&IP_PORTD->GPCHR, (uint32)0x00030000U },
+    { (volatile uint32*)&IP_PORTE->GPCLR, (uint32)0xFFFF0000U },
+    { (volatile uint32*)&IP_PORTE->GPCHR, (uint32)0x00010000U }
+};
+
+/**
+* @brief Register writes of SleepToRun, in order (PDOR, PDDR, then PCRs of each port)
+*/
+static const PortHw_InitScriptEntryType PortHw_aProfileSwitchEntries_VS_0_SleepToRun[11] =
+{
+    { (volatile uint32*)&IP_PORTA->GPCLR, (uint32)0xFBCF0100U },
+    { (volatile uint32*)&IP_PORTA->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTB->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTB->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTC->GPCLR, (uint32)0xFFCF0100U },
+    { (volatile uint32*)&IP_PORTC->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PTD->PDDR, (uint32)0x00000001U },
+    { (volatile uint32*)&IP_PORTD->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTD->GPCHR, (uint32)0x00030100U },
+    { (volatile uint32*)&IP_PORTE->GPCLR, (uint32)0xFFFF0100U },
+    { (volatile uint32*)&IP_PORTE->GPCHR, (uint32)0x00010100U }
+};
+
+/*==================================================================================================
+*                                        GLOBAL CONSTANTS
+==================================================================================================*/
+/**
+* @brief Profile switch RunToSleep of Port_Config_VS_0
+*/
+const PortHw_InitScriptType PortHw_g_ProfileSwitch_VS_0_RunToSleep =
+{
+    (uint32)11U,
+    PortHw_aProfileSwitchEntries_VS_0_RunToSleep
+};
+
+/**
+* @brief Profile switch SleepToRun of Port_Config_VS_0
+*/
+const PortHw_InitScriptType PortHw_g_ProfileSwitch_VS_0_SleepToRun =
+{
+    (uint32)11U,
+    PortHw_aProfileSwitchEntries_VS_0_SleepToRun
+};
+
+#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
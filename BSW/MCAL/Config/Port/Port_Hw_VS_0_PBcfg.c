@@ -106,21 +106,78 @@ extern "C"{
 *                                        GLOBAL VARIABLES
 ==================================================================================================*/
 
+#define PORT_START_SEC_CONFIG_DATA_32
+#include "Port_MemMap.h"
+/**
+* @brief PCR word of the configured pins
+*/
+static const uint32 PortHw_au32PinPcr_VS_0[NUM_OF_CONFIGURED_PINS] =
+{
+    (uint32)0x00000100U     /* PTD0: MUX = GPIO, no pull, DSE low, unlocked */
+};
+
+/**
+* @brief Sleep profile PCR word of the configured pins, parked before low-power entry
+*/
+static const uint32 PortHw_au32PinSleepPcr_VS_0[NUM_OF_CONFIGURED_PINS] =
+{
+    (uint32)0x00000000U     /* PTD0: MUX = ALT0 (disabled), no pull, DSE low, unlocked */
+};
+#define PORT_STOP_SEC_CONFIG_DATA_32
+#include "Port_MemMap.h"
+
+#define PORT_START_SEC_CONFIG_DATA_8
+#include "Port_MemMap.h"
+/**
+* @brief Pad of the configured pins, shared by both profiles
+*/
+static const uint8 PortHw_au8PinPad_VS_0[NUM_OF_CONFIGURED_PINS] =
+{
+    PORT_HW_PAD_ID_U8(3U, 0U)                   /* PTD0 */
+};
+
+/**
+* @brief Flags of the configured pins: GPIO, direction and level, then the Port layer flags
+*/
+static const uint8 PortHw_au8PinFlags_VS_0[NUM_OF_CONFIGURED_PINS] =
+{
+    (uint8)0x3AU    /* PTD0: GPIO, output, low, direction and mode changeable, critical */
+};
+
+/**
+* @brief Sleep profile flags of the configured pins
+*/
+static const uint8 PortHw_au8PinSleepFlags_VS_0[NUM_OF_CONFIGURED_PINS] =
+{
+    (uint8)0x01U    /* PTD0: ALT0, input */
+};
+#define PORT_STOP_SEC_CONFIG_DATA_8
+#include "Port_MemMap.h"
+
 #define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
 #include "Port_MemMap.h"
-const PortHw_PinSettingsConfigType PortHw_g_Pin_Mux_InitConfigArr_VS_0[NUM_OF_CONFIGURED_PINS] = 
+/**
+* @brief Run profile of the configured pins
+*/
+const PortHw_PinTableType PortHw_g_PinTable_VS_0 =
+{
+    PortHw_au32PinPcr_VS_0, PortHw_au8PinPad_VS_0, PortHw_au8PinFlags_VS_0
+};
+
+/**
+* @brief Sleep profile of the configured pins, parked before low-power entry
+*/
+const PortHw_PinTableType PortHw_g_PinSleepTable_VS_0 =
+{
+    PortHw_au32PinSleepPcr_VS_0, PortHw_au8PinPad_VS_0, PortHw_au8PinSleepFlags_VS_0
+};
+
+/**
+* @brief Sleep profile of the unused pads: ALT0 (disabled), no pull, input
+*/
+const PortHw_UnusedPinConfigType PortHw_g_UnusedPinSleepConfig_VS_0 =
 {
-    {
-        .PortBase_ptr              = IP_PORTD,
-        .GpioBase_ptr              = IP_PTD,
-        .PinPortIndex_u32          = 0,
-        .Mux_en                   = PORT_HW_MUX_AS_GPIO,
-        .Direction_en             = PORT_HW_PIN_OUT,
-        .PullConfig_en            = PORT_HW_PULL_NOT_ENABLED,
-        .DriveStrength_en         = PORT_HW_DRIVE_STRENGTH_LOW,
-        .LockRegister_en          = PORT_HW_LOCK_DISABLED,
-        .InitValue_u8                = 0
-    }
+    (uint32)0x00000000U, PORT_HW_PIN_IN, (uint8)0U
 };
 #define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED
 #include "Port_MemMap.h"
@@ -85,7 +85,12 @@ extern "C"{
 ==================================================================================================*/
 /*! @brief User configuration structure */
 #define PORT_HW_CONFIG_VS_0_PB \
-extern const PortHw_PinSettingsConfigType PortHw_g_Pin_Mux_InitConfigArr_VS_0[NUM_OF_CONFIGURED_PINS];
+extern const PortHw_PinTableType PortHw_g_PinTable_VS_0; \
+extern const PortHw_InitScriptType PortHw_g_InitScript_VS_0; \
+extern const PortHw_PinTableType PortHw_g_PinSleepTable_VS_0; \
+extern const PortHw_UnusedPinConfigType PortHw_g_UnusedPinSleepConfig_VS_0; \
+extern const PortHw_InitScriptType PortHw_g_ProfileSwitch_VS_0_RunToSleep; \
+extern const PortHw_InitScriptType PortHw_g_ProfileSwitch_VS_0_SleepToRun;
 
 /*==================================================================================================
 *                                    FUNCTION PROTOTYPES
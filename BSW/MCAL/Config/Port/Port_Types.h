@@ -129,9 +129,58 @@ typedef enum
 } Port_PinDirectionType;
 
 
+/**
+* @brief Symbolic name of a configured pin group.
+* @details Index of the group in the configuration set, used with Port_SetPinGroupDirection.
+*/
+typedef uint16 Port_PinGroupType;
+
 /*=================================================================================================
 *                                      DEFINES AND MACROS
 =================================================================================================*/
+/**
+* @brief   Pin flag: direction changeable at runtime.
+* @details Bits 3..0 of the pin flags are the PortHw_PinTableType flags (PORT_HW_PIN_FLAGS_U8),
+*          bits 6..4 are set by the configuration tool for the Port layer.
+*/
+#define PORT_PIN_FLAG_DIR_CHANGEABLE_U8     ((uint8)0x10U)
+
+/**
+* @brief   Pin flag: mode changeable at runtime.
+*/
+#define PORT_PIN_FLAG_MODE_CHANGEABLE_U8    ((uint8)0x20U)
+
+/**
+* @brief   Pin flag: init priority (PORT_PIN_PRIORITY_...).
+*/
+#define PORT_PIN_FLAG_PRIORITY_MASK_U8      ((uint8)0x40U)
+
+/**
+* @brief   Init priority of a pin configured by Port_InitCritical().
+* @details Pins with this priority are configured before Port_InitCritical() returns.
+*/
+#define PORT_PIN_PRIORITY_CRITICAL_U8       ((uint8)0x00U)
+
+/**
+* @brief   Init priority of a pin configured by Port_InitMainFunction().
+* @details Pins with this priority are left in their reset state by Port_InitCritical().
+*/
+#define PORT_PIN_PRIORITY_DEFERRED_U8       ((uint8)0x40U)
+
+/**
+* @brief   Port_PinHandleType flag: direction changeable at runtime.
+*/
+#define PORT_PIN_HANDLE_DIR_CHANGEABLE_U8   ((uint8)0x01U)
+
+/**
+* @brief   Port_PinHandleType flag: mode changeable at runtime.
+*/
+#define PORT_PIN_HANDLE_MODE_CHANGEABLE_U8  ((uint8)0x02U)
+
+/**
+* @brief   Port_PinHandleType flag: configured direction is output.
+*/
+#define PORT_PIN_HANDLE_DIR_OUT_U8          ((uint8)0x04U)
 
 
 /*=================================================================================================
@@ -150,20 +199,116 @@ typedef struct
 } Port_UnUsedPinConfigType;
 
 /**
-* @brief   Single pin configuration.
-* @details This structure contains all configuration parameters of a single pin
-*          identified by @p SIUPin.
+* @brief   Runtime handle of a configured pin.
+* @details Built by Port_Init() in RAM from the pin table (PCR word, pad and flags of the pin).
+*          16 bytes on the target: two base addresses, the pin mask and four uint8 fields,
+*          without padding, so the runtime services neither decode the pad nor search the
+*          base address tables.
+*          AllowedModes_u8 is taken from Port_au16PinDescription, so Port_SetPinMode() rejects
+*          a mode the pad does not support with a single AND.
+*/
+typedef struct
+{
+    GPIO_Type * GpioBase_ptr;                           /**< @brief GPIO base address */
+    PORT_Type * PortBase_ptr;                           /**< @brief PORT base address */
+    uint32 PinMask_u32;                                 /**< @brief Pin mask within the port */
+    uint8 PinPortIndex_u8;                              /**< @brief Pin index within the port */
+    uint8 Flags_u8;                                     /**< @brief PORT_PIN_HANDLE_... flags */
+    uint8 InitMux_u8;                                   /**< @brief Mux mode set by Port_Init */
+    uint8 AllowedModes_u8;                              /**< @brief Modes supported by the pad (bit n = mode n) */
+} Port_PinHandleType;
+
+/**
+* @brief   Pin group configuration.
+* @details Pins changed together by Port_SetPinGroupDirection(), resolved by the configuration
+*          tool to one (GPIO base, pin mask) entry per port.
 */
 typedef struct
 {
-    uint16 PinIndex_u16;                                /**< @brief Index of the pin's Mscr */
-    uint32 PinControlRegister_u32;                      /**< @brief Pad Control Register */
-    uint8 PinOutputValue_u8;                            /**< @brief Pad Data Output */
-    Port_PinDirectionType PinDirection_en;              /**< @brief Pad Data Direction */
-    boolean IsGpioMode_bool;                            /**< @brief GPIO initial mode*/
-    boolean DirectionChangeable_bool;                   /**< @brief Direction changebility*/
-    boolean ModeChangeable_bool;                        /**< @brief Mode changebility*/
-} Port_PinConfigType;
+    const PortHw_PinMaskType * PinMasks_ptr;            /**< @brief Pins of the group, one entry per port */
+    uint8 NumPinMasks_u8;                               /**< @brief Number of entries of PinMasks_ptr */
+    boolean DirectionChangeable_bool;                   /**< @brief All pins of the group have a changeable direction */
+} Port_PinGroupConfigType;
+
+/**
+* @brief   Mode profile ID, symbolic name from the configuration.
+*/
+typedef uint16 Port_ModeProfileType;
+
+/**
+* @brief   Mode profile configuration.
+* @details Pin modes switched together by Port_ApplyModeProfile(), resolved by the configuration
+*          tool to one GPCLR/GPCHR write per port half and PCR[15:0] value. The value keeps the
+*          configured pad settings of the pins, only the MUX field differs from Port_Init().
+*/
+typedef struct
+{
+    const PortHw_GlobalPinControlType * Controls_ptr;   /**< @brief Global pin control writes */
+    uint8 NumControls_u8;                               /**< @brief Number of entries of Controls_ptr */
+} Port_ModeProfileConfigType;
+
+/**
+* @brief   Pin profile ID, symbolic name from the configuration.
+*/
+typedef uint8 Port_ProfileType;
+
+/**
+* @brief   Pin profile switch configuration.
+* @details Register delta between two pin profiles, computed by Tools/Port_InitScriptGen from
+*          both variants of the configuration. The script holds only the PDOR, PDDR and PCR
+*          writes that differ, PCRs grouped through GPCLR/GPCHR.
+*/
+typedef struct
+{
+    Port_ProfileType From_u8;                           /**< @brief Profile the script starts from */
+    Port_ProfileType To_u8;                             /**< @brief Profile the script switches to */
+    const PortHw_InitScriptType * Script_ptr;           /**< @brief Generated register delta */
+} Port_ProfileSwitchConfigType;
+
+/**
+* @brief   Channel group ID, symbolic name from the configuration.
+*/
+typedef uint16 Port_ChannelGroupType;
+
+/**
+* @brief   Level of a channel group, bit 0 = lowest pin of the group.
+*/
+typedef uint32 Port_ChannelGroupLevelType;
+
+/**
+* @brief   Debounce port ID, symbolic name from the configuration.
+*/
+typedef uint16 Port_DebouncePortType;
+
+/**
+* @brief   Debounced level or edges of a debounce port, bit n = pin n of the port.
+*/
+typedef uint32 Port_DebounceLevelType;
+
+/**
+* @brief   Digital filter port ID, symbolic name from the configuration.
+*/
+typedef uint8 Port_DigitalFilterPortType;
+
+/**
+* @brief   Pins of a digital filter port, bit n = pin n of the port.
+*/
+typedef uint32 Port_DigitalFilterPinsType;
+
+/**
+* @brief   Edge notified by Port_EnablePinNotification().
+*/
+typedef enum
+{
+    PORT_NOTIFICATION_RISING_EDGE = 0,      /**< @brief Rising edge. */
+    PORT_NOTIFICATION_FALLING_EDGE,         /**< @brief Falling edge. */
+    PORT_NOTIFICATION_BOTH_EDGES            /**< @brief Rising and falling edges. */
+} Port_PinNotificationEdgeType;
+
+/**
+* @brief   Pin notification, called from the port interrupt.
+*/
+typedef void (*Port_PinNotificationType)(void);
 
 /**
 * @brief   Structure needed by @p Port_Init().
@@ -178,10 +323,24 @@ typedef struct
 {
     uint16 NumPins_u16;                                                       /**< @brief Number of used pads (to be configured) */
     uint16 NumUnusedPins_u16;                                                 /**< @brief Number of unused pads */
-    const uint16 * UnusedPads_ptr;                                              /**< @brief Unused pad id's array */
+    const uint32 * UnusedPadMask_ptr;                                           /**< @brief Unused pads, one pin mask per port */
     const Port_UnUsedPinConfigType * UnusedPadConfig_ptr;                       /**< @brief Unused pad configuration */
-    const Port_PinConfigType * UsedPadConfig_ptr;                               /**< @brief Used pads data configuration */
-    const PortHw_PinSettingsConfigType *IpConfig_ptr;                    /**< @brief Ip configuration */
+    const PortHw_PinTableType * PinTable_ptr;                                   /**< @brief Used pads: PCR words, pads and flags (PORT_PIN_FLAG_...) */
+    const PortHw_InitScriptType *InitScript_ptr;                                /**< @brief Generated init script (PORT_INIT_SCRIPT_REPLAY) */
+    Port_PinHandleType *PinHandle_ptr;                                          /**< @brief RAM handle table (NumPins_u16 entries), filled by Port_Init */
+    uint16 NumPinGroups_u16;                                                  /**< @brief Number of pin groups */
+    const Port_PinGroupConfigType *PinGroupConfig_ptr;                          /**< @brief Pin groups (PORT_SET_PIN_GROUP_DIRECTION_API) */
+    uint16 NumModeProfiles_u16;                                               /**< @brief Number of mode profiles */
+    const Port_ModeProfileConfigType *ModeProfileConfig_ptr;                    /**< @brief Mode profiles (PORT_APPLY_MODE_PROFILE_API) */
+    uint16 NumProfileSwitches_u16;                                            /**< @brief Number of pin profile switches */
+    const Port_ProfileSwitchConfigType *ProfileSwitchConfig_ptr;                /**< @brief Pin profile switches (PORT_SWITCH_PROFILE_API) */
+    uint16 NumChannelGroups_u16;                                              /**< @brief Number of channel groups */
+    const PortHw_ChannelGroupType *ChannelGroupConfig_ptr;                      /**< @brief Channel groups (PORT_CHANNEL_GROUP_API) */
+    uint16 NumDebouncePorts_u16;                                              /**< @brief Number of debounce ports */
+    const PortHw_PinMaskType *DebounceConfig_ptr;                               /**< @brief Debounce ports (PORT_DEBOUNCE_API) */
+    PortHw_DebounceStateType *DebounceState_ptr;                                /**< @brief RAM debounce state (NumDebouncePorts_u16 entries), seeded by Port_Init */
+    uint8 NumDigitalFilterPorts_u8;                                           /**< @brief Number of digital filter ports */
+    const PortHw_DigitalFilterConfigType *DigitalFilterConfig_ptr;              /**< @brief Digital filters, configured by Port_Init (PORT_DIGITAL_FILTER_API) */
 } Port_ConfigType;
 
 
@@ -91,7 +91,7 @@ extern "C" {
 /**
 * @brief The number of configured Digital Filter Ports
 */
-#define PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8         (0U)
+#define PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8         (1U)
 
 /*=================================================================================================
 *                                      LOCAL CONSTANTS
@@ -102,106 +102,43 @@ extern "C" {
 *                                      LOCAL VARIABLES
 =================================================================================================*/
 
+#define PORT_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief Runtime pin handles, filled by Port_Init
+*/
+static Port_PinHandleType Port_aPinHandle_VS_0[PORT_MAX_CONFIGURED_PADS_U16];
+
+/**
+* @brief Debounce state of the debounce ports, updated by Port_DebounceMainFunction
+*/
+static PortHw_DebounceStateType Port_aDebounceState_VS_0[PORT_MAX_CONFIGURED_DEBOUNCE_PORTS_U16];
+
+#define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
 
 /*=================================================================================================
 *                                      GLOBAL CONSTANTS
 =================================================================================================*/
-#define PORT_START_SEC_CONFIG_DATA_16
+#define PORT_START_SEC_CONFIG_DATA_32
 #include "Port_MemMap.h"
 
 #if (0UL != PORT_MAX_UNUSED_PADS_U16)
 /**
-* @brief NoDefaultPadsArray is an array containing Unimplemented pads and User pads
+* @brief Unimplemented pads and user pads, one pin mask per port (bit n = pin n)
 */
-static const uint16 Port_au16NoUnUsedPadsArrayDefault_VS_0[PORT_MAX_UNUSED_PADS_U16]=
+static const uint32 Port_au32UnUsedPadsMask_VS_0[PORT_HW_PORT_COUNT_U8]=
 {
-    (uint16)0,
-    (uint16)1,
-    (uint16)2,
-    (uint16)3,
-    (uint16)6,
-    (uint16)7,
-    (uint16)8,
-    (uint16)9,
-    (uint16)11,
-    (uint16)12,
-    (uint16)13,
-    (uint16)14,
-    (uint16)15,
-    (uint16)16,
-    (uint16)17,
-    (uint16)32,
-    (uint16)33,
-    (uint16)34,
-    (uint16)35,
-    (uint16)36,
-    (uint16)37,
-    (uint16)38,
-    (uint16)39,
-    (uint16)40,
-    (uint16)41,
-    (uint16)42,
-    (uint16)43,
-    (uint16)44,
-    (uint16)45,
-    (uint16)46,
-    (uint16)47,
-    (uint16)48,
-    (uint16)49,
-    (uint16)64,
-    (uint16)65,
-    (uint16)66,
-    (uint16)67,
-    (uint16)70,
-    (uint16)71,
-    (uint16)72,
-    (uint16)73,
-    (uint16)74,
-    (uint16)75,
-    (uint16)76,
-    (uint16)77,
-    (uint16)78,
-    (uint16)79,
-    (uint16)80,
-    (uint16)81,
-    (uint16)97,
-    (uint16)98,
-    (uint16)99,
-    (uint16)100,
-    (uint16)101,
-    (uint16)102,
-    (uint16)103,
-    (uint16)104,
-    (uint16)105,
-    (uint16)106,
-    (uint16)107,
-    (uint16)108,
-    (uint16)109,
-    (uint16)110,
-    (uint16)111,
-    (uint16)112,
-    (uint16)113,
-    (uint16)128,
-    (uint16)129,
-    (uint16)130,
-    (uint16)131,
-    (uint16)132,
-    (uint16)133,
-    (uint16)134,
-    (uint16)135,
-    (uint16)136,
-    (uint16)137,
-    (uint16)138,
-    (uint16)139,
-    (uint16)140,
-    (uint16)141,
-    (uint16)142,
-    (uint16)143,
-    (uint16)144
+    (uint32)0x0003FBCFU,    /* PORTA: 0-3, 6-9, 11-17 */
+    (uint32)0x0003FFFFU,    /* PORTB: 0-17 */
+    (uint32)0x0003FFCFU,    /* PORTC: 0-3, 6-17 */
+    (uint32)0x0003FFFEU,    /* PORTD: 1-17 */
+    (uint32)0x0001FFFFU     /* PORTE: 0-16 */
 };
 #endif
 
-#define PORT_STOP_SEC_CONFIG_DATA_16
+#define PORT_STOP_SEC_CONFIG_DATA_32
 #include "Port_MemMap.h"
 
 #define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
@@ -216,17 +153,87 @@ static const Port_UnUsedPinConfigType Port_UnUsedPin_VS_0 =
 };
 
 /**
-* @brief Pin default configuration data for configPB
+* @brief Pins of pin group PortConfigSet_PortPinGroup_0, one entry per port
 */
-static const Port_PinConfigType Port_aPinConfigDefault_VS_0[PORT_MAX_CONFIGURED_PADS_U16]=
+static const PortHw_PinMaskType Port_aPinGroup0Masks_VS_0[1]=
 {
-    /* PCR Id, PCR Value, Output Level, Direction, IsGpio, Direction Configurable, Mode Changeable */
-    { (uint16)96, (uint32)0x00000100, (uint8)0, (Port_PinDirectionType)2, (boolean)TRUE, (boolean)TRUE, (boolean)TRUE }
+    /* GPIO Base, Pin Mask */
+    { IP_PTD, (uint32)0x00000001U }     /* PTD0 */
+};
+
+/**
+* @brief Pin group configuration data for configPB
+*/
+static const Port_PinGroupConfigType Port_aPinGroupConfig_VS_0[PORT_MAX_CONFIGURED_PIN_GROUPS_U16]=
+{
+    /* Pin Masks, Number of Ports, Direction Configurable */
+    { Port_aPinGroup0Masks_VS_0, (uint8)1, (boolean)TRUE }
+};
+
+/**
+* @brief GPCLR/GPCHR writes of mode profile PortConfigSet_PortModeProfile_Gpio
+*/
+static const PortHw_GlobalPinControlType Port_aModeProfileGpioControls_VS_0[1]=
+{
+    /* PORT Base, Pins, PCR[15:0], Port Half */
+    { IP_PORTD, (uint16)0x0001U, (uint16)0x0100U, PORT_HW_GLOBAL_LOWER_HALF }  /* PTD0: GPIO */
+};
+
+/**
+* @brief GPCLR/GPCHR writes of mode profile PortConfigSet_PortModeProfile_Ftm0
+*/
+static const PortHw_GlobalPinControlType Port_aModeProfileFtm0Controls_VS_0[1]=
+{
+    /* PORT Base, Pins, PCR[15:0], Port Half */
+    { IP_PORTD, (uint16)0x0001U, (uint16)0x0200U, PORT_HW_GLOBAL_LOWER_HALF }  /* PTD0: ALT2 FTM0_CH2 */
+};
+
+/**
+* @brief Mode profile configuration data for configPB
+*/
+static const Port_ModeProfileConfigType Port_aModeProfileConfig_VS_0[PORT_MAX_CONFIGURED_MODE_PROFILES_U16]=
+{
+    /* Global Pin Control Writes, Number of Writes */
+    { Port_aModeProfileGpioControls_VS_0, (uint8)1 },
+    { Port_aModeProfileFtm0Controls_VS_0, (uint8)1 }
+};
+
+/**
+* @brief Pin profile switches, scripts generated in Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*/
+static const Port_ProfileSwitchConfigType Port_aProfileSwitchConfig_VS_0[PORT_MAX_CONFIGURED_PROFILE_SWITCHES_U16]=
+{
+    /* From Profile, To Profile, Register Delta */
+    { (Port_ProfileType)PortConfigSet_PortProfile_Run, (Port_ProfileType)PortConfigSet_PortProfile_Sleep, &PortHw_g_ProfileSwitch_VS_0_RunToSleep },
+    { (Port_ProfileType)PortConfigSet_PortProfile_Sleep, (Port_ProfileType)PortConfigSet_PortProfile_Run, &PortHw_g_ProfileSwitch_VS_0_SleepToRun }
+};
+
+/**
+* @brief Channel group configuration data for configPB
+*/
+static const PortHw_ChannelGroupType Port_aChannelGroupConfig_VS_0[PORT_MAX_CONFIGURED_CHANNEL_GROUPS_U16]=
+{
+    /* GPIO Base, Pin Mask, Offset */
+    { IP_PTD, (uint32)0x00000001U, (uint8)0 }     /* PortConfigSet_PortChannelGroup_Led: PTD0 */
+};
+
+/**
+* @brief Debounce port configuration data for configPB
+*/
+static const PortHw_PinMaskType Port_aDebounceConfig_VS_0[PORT_MAX_CONFIGURED_DEBOUNCE_PORTS_U16]=
+{
+    /* GPIO Base, Pin Mask */
+    { IP_PTC, (uint32)0x00003000U }     /* PortConfigSet_PortDebounce_Buttons: PTC12, PTC13 */
 };
 
 #if (0UL != PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8)
-static const Port_Ci_Port_Ip_DigitalFilterConfigType Port_aDigitalFilter_VS_0[PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8]=
+/**
+* @brief Digital filter configuration data for configPB
+*/
+static const PortHw_DigitalFilterConfigType Port_aDigitalFilter_VS_0[PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8]=
 {
+    /* PORT Base, Pin Mask, Clock, Width */
+    { IP_PORTC, (uint32)0x00003000U, PORT_HW_DIGITAL_FILTER_LPO_CLOCK, (uint8)31U }    /* PortConfigSet_PortDigitalFilter_Buttons: PTC12, PTC13, 31 LPO_CLK cycles */
 };
 #endif /* (0UL != PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8) */
 
@@ -240,13 +247,31 @@ const Port_ConfigType Port_Config_VS_0 =
     PORT_MAX_UNUSED_PADS_U16,
 
 #if (PORT_MAX_UNUSED_PADS_U16 != 0U)
-    Port_au16NoUnUsedPadsArrayDefault_VS_0,
+    Port_au32UnUsedPadsMask_VS_0,
 #else
     NULL_PTR,
 #endif
     &Port_UnUsedPin_VS_0,
-    Port_aPinConfigDefault_VS_0,
-	PortHw_g_Pin_Mux_InitConfigArr_VS_0
+    &PortHw_g_PinTable_VS_0,
+    &PortHw_g_InitScript_VS_0,
+    Port_aPinHandle_VS_0,
+    PORT_MAX_CONFIGURED_PIN_GROUPS_U16,
+    Port_aPinGroupConfig_VS_0,
+    PORT_MAX_CONFIGURED_MODE_PROFILES_U16,
+    Port_aModeProfileConfig_VS_0,
+    PORT_MAX_CONFIGURED_PROFILE_SWITCHES_U16,
+    Port_aProfileSwitchConfig_VS_0,
+    PORT_MAX_CONFIGURED_CHANNEL_GROUPS_U16,
+    Port_aChannelGroupConfig_VS_0,
+    PORT_MAX_CONFIGURED_DEBOUNCE_PORTS_U16,
+    Port_aDebounceConfig_VS_0,
+    Port_aDebounceState_VS_0,
+    PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8,
+#if (0UL != PORT_MAX_CONFIGURED_DIGITAL_FILTER_PORTS_VS_0_U8)
+    Port_aDigitalFilter_VS_0
+#else
+    NULL_PTR
+#endif
 };
 
 
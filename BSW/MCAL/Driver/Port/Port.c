@@ -39,6 +39,10 @@ extern "C"{
     #include "Det.h"
 #endif
 
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+    #include "Port_Hw_Irq.h"
+#endif
+
 /*=================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
 =================================================================================================*/
@@ -95,6 +99,12 @@ extern "C"{
 /*=================================================================================================
 *                                       LOCAL MACROS
 =================================================================================================*/
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief Pin profile set up by Port_Init
+*/
+#define PORT_INIT_PROFILE_U8                ((Port_ProfileType)0U)
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
 
 /*=================================================================================================
 *                                      LOCAL CONSTANTS
@@ -116,147 +126,1157 @@ extern "C"{
 
 static const Port_ConfigType * Port_pConfigPtr = NULL_PTR;
 
+#if (STD_ON == PORT_PHASED_INIT_API)
+/**
+* @brief Configuration being initialized by Port_InitMainFunction() (NULL_PTR when none)
+*/
+static const Port_ConfigType * Port_pPendingConfigPtr = NULL_PTR;
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+
  #define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED_NO_CACHEABLE
  #include "Port_MemMap.h"
 
-#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
-#include "Port_MemMap.h"
+#if (STD_ON == PORT_PHASED_INIT_API)
+#define PORT_START_SEC_VAR_CLEARED_16
+#include "Port_MemMap.h"
+
+/**
+* @brief Next init step of Port_InitMainFunction(): deferred pins first, then unused ports
+*/
+static uint16 Port_u16PendingStep = 0U;
+
+#define PORT_STOP_SEC_VAR_CLEARED_16
+#include "Port_MemMap.h"
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+
+#define PORT_START_SEC_VAR_CLEARED_32
+#include "Port_MemMap.h"
+
+/**
+* @brief Fixed direction pins of each port, refreshed by Port_RefreshPortDirection()
+*/
+static uint32 Port_au32RefreshMask[PORT_HW_PORT_COUNT_U8];
+
+/**
+* @brief Configured direction of the fixed direction pins (bit set = output)
+*/
+static uint32 Port_au32RefreshValue[PORT_HW_PORT_COUNT_U8];
+
+#define PORT_STOP_SEC_VAR_CLEARED_32
+#include "Port_MemMap.h"
+
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+#define PORT_START_SEC_VAR_CLEARED_8
+#include "Port_MemMap.h"
+
+/**
+* @brief Active pin profile, changed by Port_SwitchProfile()
+*/
+static Port_ProfileType Port_u8ActiveProfile = PORT_INIT_PROFILE_U8;
+
+#define PORT_STOP_SEC_VAR_CLEARED_8
+#include "Port_MemMap.h"
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+
+#if (STD_ON == PORT_WARM_INIT_SKIP)
+#define PORT_START_SEC_VAR_CLEARED_32
+#include "Port_MemMap.h"
+
+/**
+* @brief Register writes skipped by the last warm Port_Init
+*/
+static uint32 Port_u32InitSkippedWrites = 0U;
+
+#define PORT_STOP_SEC_VAR_CLEARED_32
+#include "Port_MemMap.h"
+#endif /* (STD_ON == PORT_WARM_INIT_SKIP) */
+
+#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+
+#if (STD_ON == PORT_PRECOMPILE_SUPPORT)
+    extern const Port_ConfigType Port_Config;
+#endif
+
+#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED
+#include "Port_MemMap.h"
+/*=================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+=================================================================================================*/
+static void Port_InitPinHandle
+(
+    const Port_ConfigType * pConfigPtr,
+    uint16 u16PinIndex
+);
+
+static void Port_InitRefreshMasks
+(
+    const Port_ConfigType * pConfigPtr
+);
+
+#if (STD_ON == PORT_DEBOUNCE_API)
+static void Port_InitDebounce
+(
+    const Port_ConfigType * pConfigPtr
+);
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+static void Port_InitDigitalFilter
+(
+    const Port_ConfigType * pConfigPtr
+);
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+
+
+/*=================================================================================================
+*                                      LOCAL FUNCTIONS
+=================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+/**
+* @brief   Builds the runtime handle of a configured pin.
+* @details Copies the base addresses, the pin mask and the flags the runtime services need
+*          into the RAM handle table of the configuration, and gathers the modes of the pad
+*          from Port_au16PinDescription into one byte.
+*
+* @param[in] pConfigPtr    Configuration being initialized.
+* @param[in] u16PinIndex   Index of the pin in the configuration.
+*/
+static void Port_InitPinHandle
+(
+    const Port_ConfigType * pConfigPtr,
+    uint16 u16PinIndex
+)
+{
+    const PortHw_PinTableType * pTable = pConfigPtr->PinTable_ptr;
+    Port_PinHandleType * pHandle = &pConfigPtr->PinHandle_ptr[u16PinIndex];
+    uint8 u8PinFlags = pTable->Flags_ptr[u16PinIndex];
+    uint16 u16Pad = pTable->PadId_ptr[u16PinIndex];
+    uint8 u8Port = (uint8)PORT_HW_GET_PORT_U32(u16Pad);
+    uint8 u8Pin = (uint8)PORT_HW_GET_PIN_U32(u16Pad);
+    uint8 u8Flags = 0U;
+    uint8 u8AllowedModes = 0U;
+#if (STD_ON == PORT_SET_PIN_MODE_API)
+    uint8 u8Mode;
+#endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
+
+    if (0U != (u8PinFlags & PORT_PIN_FLAG_DIR_CHANGEABLE_U8))
+    {
+        u8Flags |= PORT_PIN_HANDLE_DIR_CHANGEABLE_U8;
+    }
+    else
+    {
+        /* Direction is fixed */
+    }
+    if (0U != (u8PinFlags & PORT_PIN_FLAG_MODE_CHANGEABLE_U8))
+    {
+        u8Flags |= PORT_PIN_HANDLE_MODE_CHANGEABLE_U8;
+    }
+    else
+    {
+        /* Mode is fixed */
+    }
+    if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(u8PinFlags))
+    {
+        u8Flags |= PORT_PIN_HANDLE_DIR_OUT_U8;
+    }
+    else
+    {
+        /* Input or disabled */
+    }
+
+#if (STD_ON == PORT_SET_PIN_MODE_API)
+    for (u8Mode = 0U; u8Mode < PAD_MODE_OPTIONS_U8; u8Mode++)
+    {
+        if (0U != (Port_au16PinDescription[u8Mode][u16Pad >> 4U] & SHL_PAD_U16(u16Pad & 0x0FU)))
+        {
+            u8AllowedModes |= (uint8)(1U << u8Mode);
+        }
+        else
+        {
+            /* Mode not supported by the pad */
+        }
+    }
+#endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
+
+    pHandle->GpioBase_ptr = PortHw_g_GpioBaseAddr_ptr[u8Port];
+    pHandle->PortBase_ptr = PortHw_g_PortBaseAddr_ptr[u8Port];
+    pHandle->PinMask_u32 = (uint32)1UL << u8Pin;
+    pHandle->PinPortIndex_u8 = u8Pin;
+    pHandle->Flags_u8 = u8Flags;
+    pHandle->InitMux_u8 = (uint8)PORT_HW_PCR_MUX_U32(pTable->Pcr_ptr[u16PinIndex]);
+    pHandle->AllowedModes_u8 = u8AllowedModes;
+}
+
+/**
+* @brief   Builds the refresh masks of the ports.
+* @details Collects, per port, the pins configured with a fixed direction and their
+*          configured direction, so the direction refresh is one masked PDDR update per port.
+*
+* @param[in] pConfigPtr    Configuration being initialized.
+*/
+static void Port_InitRefreshMasks
+(
+    const Port_ConfigType * pConfigPtr
+)
+{
+    const PortHw_PinTableType * pTable = pConfigPtr->PinTable_ptr;
+    uint16 u16PinIndex;
+    uint8 u8PinFlags;
+    uint8 u8Port;
+    uint32 u32PinMask;
+
+    for (u8Port = 0U; u8Port < PORT_HW_PORT_COUNT_U8; u8Port++)
+    {
+        Port_au32RefreshMask[u8Port] = 0U;
+        Port_au32RefreshValue[u8Port] = 0U;
+    }
+
+    for (u16PinIndex = 0U; u16PinIndex < pConfigPtr->NumPins_u16; u16PinIndex++)
+    {
+        u8PinFlags = pTable->Flags_ptr[u16PinIndex];
+        if (0U == (u8PinFlags & PORT_PIN_FLAG_DIR_CHANGEABLE_U8))
+        {
+            u8Port = (uint8)PORT_HW_GET_PORT_U32(pTable->PadId_ptr[u16PinIndex]);
+            u32PinMask = pConfigPtr->PinHandle_ptr[u16PinIndex].PinMask_u32;
+            Port_au32RefreshMask[u8Port] |= u32PinMask;
+            if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(u8PinFlags))
+            {
+                Port_au32RefreshValue[u8Port] |= u32PinMask;
+            }
+            else
+            {
+                /* Input or disabled */
+            }
+        }
+        else
+        {
+            /* Direction changeable, not refreshed */
+        }
+    }
+}
+
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief   Starts debouncing the debounce ports of a configuration.
+* @details Seeds the RAM debounce state of every debounce port with its current input, so
+*          no edge is reported for the levels present at initialization.
+*
+* @param[in] pConfigPtr    Configuration being initialized.
+*/
+static void Port_InitDebounce
+(
+    const Port_ConfigType * pConfigPtr
+)
+{
+    uint16 u16PortIndex;
+
+    for (u16PortIndex = 0U; u16PortIndex < pConfigPtr->NumDebouncePorts_u16; u16PortIndex++)
+    {
+        PortHw_DebounceInit(&pConfigPtr->DebounceConfig_ptr[u16PortIndex], &pConfigPtr->DebounceState_ptr[u16PortIndex]);
+    }
+}
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/**
+* @brief   Configures the digital filters of a configuration.
+* @details Writes the clock, the width and the filtered pins of every digital filter port.
+*
+* @param[in] pConfigPtr    Configuration being initialized.
+*/
+static void Port_InitDigitalFilter
+(
+    const Port_ConfigType * pConfigPtr
+)
+{
+    uint8 u8PortIndex;
+
+    for (u8PortIndex = 0U; u8PortIndex < pConfigPtr->NumDigitalFilterPorts_u8; u8PortIndex++)
+    {
+        PortHw_SetDigitalFilter(&pConfigPtr->DigitalFilterConfig_ptr[u8PortIndex]);
+    }
+}
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+
+/*=================================================================================================
+*                                      GLOBAL FUNCTIONS
+=================================================================================================*/
+
+/**
+* @brief   Initializes the Port Driver module.
+* @details The function @p Port_Init() will initialize ALL ports and port pins
+*          with the configuration set pointed to by the parameter @p pConfigPtr.
+* @post    Port_Init() must be called before all other Port Driver module's functions
+*          otherwise no operation can occur on the MCU ports and port pins.
+*
+* @param[in] ConfigPtr     A pointer to the structure which contains
+*                          initialization parameters.
+*/
+void Port_Init
+(
+    const Port_ConfigType * ConfigPtr
+)
+{
+    const Port_ConfigType * pLocalConfigPtr = ConfigPtr;
+    uint16 u16PinIndex;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+#if (STD_OFF == PORT_PRECOMPILE_SUPPORT)
+    if (NULL_PTR == ConfigPtr)
+#else /*(STD_OFF == PORT_PRECOMPILE_SUPPORT) */
+    if (NULL_PTR != ConfigPtr)
+#endif /* (STD_OFF == PORT_PRECOMPILE_SUPPORT) */
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INIT_ID, (uint8)PORT_E_INIT_FAILED);
+    }
+    else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+    {
+#if (STD_ON == PORT_PRECOMPILE_SUPPORT)
+        pLocalConfigPtr = &Port_Config;
+#endif /* (STD_ON == PORT_PRECOMPILE_SUPPORT) */
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+        /* Validate configuration pointer */
+        if ((NULL_PTR == pLocalConfigPtr->PinTable_ptr) || \
+            (NULL_PTR == pLocalConfigPtr->PinHandle_ptr) || (0U == pLocalConfigPtr->NumPins_u16))
+        {
+            (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INIT_ID, (uint8)PORT_E_PARAM_CONFIG);
+        }
+#if (STD_ON == PORT_INIT_SCRIPT_REPLAY)
+        else if (NULL_PTR == pLocalConfigPtr->InitScript_ptr)
+        {
+            (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INIT_ID, (uint8)PORT_E_PARAM_CONFIG);
+        }
+#endif /* (STD_ON == PORT_INIT_SCRIPT_REPLAY) */
+        else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+        {
+#if (STD_ON == PORT_INIT_SCRIPT_REPLAY)
+            /* Replay the register writes generated off-line from this configuration */
+            PortHw_InitScriptReplay(pLocalConfigPtr->InitScript_ptr);
+#elif (STD_ON == PORT_WARM_INIT_SKIP)
+            /* Rewrite only the registers that do not hold their configuration */
+            Port_u32InitSkippedWrites = PortHw_InitWarm(pLocalConfigPtr->NumPins_u16, pLocalConfigPtr->PinTable_ptr, \
+                                                        pLocalConfigPtr->NumUnusedPins_u16, pLocalConfigPtr->UnusedPadMask_ptr, \
+                                                        (const PortHw_UnusedPinConfigType *)pLocalConfigPtr->UnusedPadConfig_ptr);
+#else
+            /* Initialize Port using Hardware driver */
+            (void)PortHw_Init(pLocalConfigPtr->NumPins_u16, pLocalConfigPtr->PinTable_ptr, \
+            				  pLocalConfigPtr->NumUnusedPins_u16, pLocalConfigPtr->UnusedPadMask_ptr,\
+							  (const PortHw_UnusedPinConfigType *)pLocalConfigPtr->UnusedPadConfig_ptr);
+#endif /* (STD_ON == PORT_INIT_SCRIPT_REPLAY) */
+
+            /* Runtime handles of the configured pins */
+            for (u16PinIndex = 0U; u16PinIndex < pLocalConfigPtr->NumPins_u16; u16PinIndex++)
+            {
+                Port_InitPinHandle(pLocalConfigPtr, u16PinIndex);
+            }
+            Port_InitRefreshMasks(pLocalConfigPtr);
+#if (STD_ON == PORT_DEBOUNCE_API)
+            Port_InitDebounce(pLocalConfigPtr);
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+            Port_InitDigitalFilter(pLocalConfigPtr);
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+            Port_u8ActiveProfile = PORT_INIT_PROFILE_U8;
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+
+            /*  Save configuration pointer in global variable */
+            Port_pConfigPtr = pLocalConfigPtr;
+#if (STD_ON == PORT_PHASED_INIT_API)
+            /* A full initialization completes any pending phased one */
+            Port_pPendingConfigPtr = NULL_PTR;
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+        }
+    }
+}
+
+#if (STD_ON == PORT_WARM_INIT_SKIP)
+/**
+* @brief   Returns the register writes skipped by the last Port_Init.
+* @details Counts one write per PCR already holding its configured value and one per
+*          PSOR, PCOR, PDDR or PIDR access that was not needed.
+*
+* @return  Number of skipped register writes.
+*/
+uint32 Port_GetInitSkippedWrites(void)
+{
+    return Port_u32InitSkippedWrites;
+}
+#endif /* (STD_ON == PORT_WARM_INIT_SKIP) */
+
+#if (STD_ON == PORT_PHASED_INIT_API)
+/**
+* @brief   Initializes the critical pins of the Port Driver module.
+* @details The function @p Port_InitCritical() configures the pins with
+*          PORT_PIN_PRIORITY_CRITICAL_U8 of the configuration set pointed to by
+*          @p ConfigPtr and arms Port_InitMainFunction() for the rest of it.
+* @post    Port_InitMainFunction() must be called until it returns TRUE before the
+*          other Port Driver services can be used.
+*
+* @param[in] ConfigPtr     A pointer to the structure which contains
+*                          initialization parameters.
+*/
+void Port_InitCritical
+(
+    const Port_ConfigType * ConfigPtr
+)
+{
+    const Port_ConfigType * pLocalConfigPtr = ConfigPtr;
+    uint16 u16PinIndex;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+#if (STD_OFF == PORT_PRECOMPILE_SUPPORT)
+    if (NULL_PTR == ConfigPtr)
+#else /*(STD_OFF == PORT_PRECOMPILE_SUPPORT) */
+    if (NULL_PTR != ConfigPtr)
+#endif /* (STD_OFF == PORT_PRECOMPILE_SUPPORT) */
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INITCRITICAL_ID, (uint8)PORT_E_INIT_FAILED);
+    }
+    else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+    {
+#if (STD_ON == PORT_PRECOMPILE_SUPPORT)
+        pLocalConfigPtr = &Port_Config;
+#endif /* (STD_ON == PORT_PRECOMPILE_SUPPORT) */
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+        /* Validate configuration pointer */
+        if ((NULL_PTR == pLocalConfigPtr->PinTable_ptr) || \
+            (NULL_PTR == pLocalConfigPtr->PinHandle_ptr) || (0U == pLocalConfigPtr->NumPins_u16))
+        {
+            (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INITCRITICAL_ID, (uint8)PORT_E_PARAM_CONFIG);
+        }
+        else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+        {
+            /* The driver is not initialized until the deferred part is done */
+            Port_pConfigPtr = NULL_PTR;
+
+            for (u16PinIndex = 0U; u16PinIndex < pLocalConfigPtr->NumPins_u16; u16PinIndex++)
+            {
+                if (PORT_PIN_PRIORITY_CRITICAL_U8 == (pLocalConfigPtr->PinTable_ptr->Flags_ptr[u16PinIndex] & PORT_PIN_FLAG_PRIORITY_MASK_U8))
+                {
+                    PortHw_InitPin(pLocalConfigPtr->PinTable_ptr, u16PinIndex);
+                    Port_InitPinHandle(pLocalConfigPtr, u16PinIndex);
+                }
+                else
+                {
+                    /* Deferred pin */
+                }
+            }
+
+            /* Deferred pins and unused pads are left to Port_InitMainFunction */
+            Port_u16PendingStep = 0U;
+            Port_pPendingConfigPtr = pLocalConfigPtr;
+        }
+    }
+}
+
+/**
+* @brief   Runs a bounded slice of the phased initialization.
+* @details The function @p Port_InitMainFunction() continues the initialization started by
+*          Port_InitCritical(). Steps are taken in configuration order: the deferred pins
+*          first, then the unused pads of PORTA to PORTE. Critical pins are skipped without
+*          using the budget. When the last step is done the configuration becomes the
+*          driver configuration, as after Port_Init().
+*
+* @param[in] Budget        Maximum number of init steps of this call.
+*
+* @return    TRUE once the driver is initialized, FALSE while init steps remain.
+*/
+boolean Port_InitMainFunction
+(
+    uint16 Budget
+)
+{
+    const Port_ConfigType * pLocalConfigPtr = Port_pPendingConfigPtr;
+    uint16 u16StepCount = 0U;
+    uint16 u16LastStep;
+    uint16 u16PortStep;
+    boolean bInitDone = FALSE;
+
+    if (NULL_PTR == pLocalConfigPtr)
+    {
+        /* Nothing pending: done if the driver is initialized (idle loop may keep calling) */
+        if (NULL_PTR != Port_pConfigPtr)
+        {
+            bInitDone = TRUE;
+        }
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+        else
+        {
+            (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INITMAINFUNCTION_ID, (uint8)PORT_E_UNINIT);
+        }
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+    }
+    else
+    {
+        u16LastStep = pLocalConfigPtr->NumPins_u16 + (uint16)PORT_HW_PORT_COUNT_U8;
+
+        while ((Port_u16PendingStep < u16LastStep) && (u16StepCount < Budget))
+        {
+            if (Port_u16PendingStep < pLocalConfigPtr->NumPins_u16)
+            {
+                /* Deferred pin */
+                if (PORT_PIN_PRIORITY_CRITICAL_U8 != (pLocalConfigPtr->PinTable_ptr->Flags_ptr[Port_u16PendingStep] & PORT_PIN_FLAG_PRIORITY_MASK_U8))
+                {
+                    PortHw_InitPin(pLocalConfigPtr->PinTable_ptr, Port_u16PendingStep);
+                    Port_InitPinHandle(pLocalConfigPtr, Port_u16PendingStep);
+                    u16StepCount++;
+                }
+                else
+                {
+                    /* Already configured by Port_InitCritical */
+                }
+            }
+            else
+            {
+                /* Unused pads of one port */
+                u16PortStep = Port_u16PendingStep - pLocalConfigPtr->NumPins_u16;
+                if ((0U != pLocalConfigPtr->NumUnusedPins_u16) && (NULL_PTR != pLocalConfigPtr->UnusedPadMask_ptr) && \
+                    (NULL_PTR != pLocalConfigPtr->UnusedPadConfig_ptr) && (0U != pLocalConfigPtr->UnusedPadMask_ptr[u16PortStep]))
+                {
+                    PortHw_InitUnusedPort((uint8)u16PortStep, pLocalConfigPtr->UnusedPadMask_ptr[u16PortStep],
+                                          (const PortHw_UnusedPinConfigType *)pLocalConfigPtr->UnusedPadConfig_ptr);
+                    u16StepCount++;
+                }
+                else
+                {
+                    /* No unused pads on this port */
+                }
+            }
+            Port_u16PendingStep++;
+        }
+
+        if (Port_u16PendingStep >= u16LastStep)
+        {
+            Port_InitRefreshMasks(pLocalConfigPtr);
+#if (STD_ON == PORT_DEBOUNCE_API)
+            Port_InitDebounce(pLocalConfigPtr);
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+            Port_InitDigitalFilter(pLocalConfigPtr);
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+            Port_u8ActiveProfile = PORT_INIT_PROFILE_U8;
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+            /*  Save configuration pointer in global variable */
+            Port_pConfigPtr = pLocalConfigPtr;
+            Port_pPendingConfigPtr = NULL_PTR;
+            bInitDone = TRUE;
+        }
+        else
+        {
+            /* Init steps remain for the next call */
+        }
+    }
+
+    return bInitDone;
+}
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+
+#if (STD_ON == PORT_SET_PIN_DIRECTION_API)
+/**
+* @brief   Sets the port pin direction.
+* @details The function @p Port_SetPinDirection() will set the port pin direction
+*          during runtime.
+* @pre     @p Port_Init() must have been called first. In order to change the
+*          pin direction the PortPinDirectionChangeable flag must have been set
+*          to @p TRUE.
+*
+* @param[in] Pin            Pin ID number.
+* @param[in] Direction     Port Pin direction.
+*
+*/
+void Port_SetPinDirection
+(
+    Port_PinType Pin,
+    Port_PinDirectionType Direction
+)
+{
+    const Port_PinHandleType * pHandle;
+    PortHw_DirectionType HwDirection_en;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if pin is valid */
+    else if (Pin >= Port_pConfigPtr->NumPins_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_PARAM_PIN);
+    }
+    /* Check if direction is changeable */
+    else if (0U == (Port_pConfigPtr->PinHandle_ptr[Pin].Flags_u8 & PORT_PIN_HANDLE_DIR_CHANGEABLE_U8))
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_DIRECTION_UNCHANGEABLE);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        pHandle = &Port_pConfigPtr->PinHandle_ptr[Pin];
+
+        /* Convert AUTOSAR direction to HW direction */
+        if (PORT_PIN_OUT == Direction)
+        {
+            HwDirection_en = PORT_HW_PIN_OUT;
+        }
+        else
+        {
+            HwDirection_en = PORT_HW_PIN_IN;
+        }
+
+        /* Set pin direction using Hardware driver */
+        PortHw_SetPinDirection(pHandle->GpioBase_ptr, pHandle->PinPortIndex_u8, HwDirection_en);
+    }
+}
+#endif /* (STD_ON == PORT_SET_PIN_DIRECTION_API) */
+
+#ifdef PORT_SET_PIN_GROUP_DIRECTION_API
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/**
+* @brief   Sets the direction of a pin group.
+* @details The function @p Port_SetPinGroupDirection() will set the direction of all pins
+*          of a configured group during runtime. The group is stored as one
+*          (GPIO base, pin mask) entry per port, so each port takes one masked PDDR
+*          update. With per-port exclusive areas or atomic register updates (the
+*          default) the ports are updated one after the other, so a group spanning
+*          several ports is not switched atomically as a whole; with the module-wide
+*          exclusive areas all PDDR updates share one critical section.
+* @pre     @p Port_Init() must have been called first. In order to change the
+*          group direction the PortPinDirectionChangeable flag must have been set
+*          to @p TRUE for all pins of the group.
+*
+* @param[in] Group          Pin group ID number.
+* @param[in] Direction     Port Pin direction.
+*
+*/
+void Port_SetPinGroupDirection
+(
+    Port_PinGroupType Group,
+    Port_PinDirectionType Direction
+)
+{
+    const Port_PinGroupConfigType * pGroup;
+    PortHw_DirectionType HwDirection_en;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINGROUPDIRECTION_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if group is valid */
+    else if (Group >= Port_pConfigPtr->NumPinGroups_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINGROUPDIRECTION_ID, (uint8)PORT_E_PARAM_GROUP);
+    }
+    /* Check if direction is changeable */
+    else if (TRUE != Port_pConfigPtr->PinGroupConfig_ptr[Group].DirectionChangeable_bool)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINGROUPDIRECTION_ID, (uint8)PORT_E_DIRECTION_UNCHANGEABLE);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        pGroup = &Port_pConfigPtr->PinGroupConfig_ptr[Group];
+
+        /* Convert AUTOSAR direction to HW direction */
+        if (PORT_PIN_OUT == Direction)
+        {
+            HwDirection_en = PORT_HW_PIN_OUT;
+        }
+        else
+        {
+            HwDirection_en = PORT_HW_PIN_IN;
+        }
+
+        /* Set the direction of all ports of the group using Hardware driver */
+        PortHw_SetPinMasksDirection(pGroup->PinMasks_ptr, (uint32)pGroup->NumPinMasks_u8, HwDirection_en);
+    }
+}
+#endif /* (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API) */
+#endif
+
+#ifdef PORT_APPLY_MODE_PROFILE_API
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/**
+* @brief   Applies a mode profile.
+* @details The function @p Port_ApplyModeProfile() will switch the mode of all pins of a
+*          configured profile during runtime. The profile is stored as one GPCLR/GPCHR write
+*          per port half, so the whole pin set changes in O(ports) single register stores
+*          without critical section.
+* @pre     @p Port_Init() must have been called first. The PortPinModeChangeable flag
+*          must have been set to @p TRUE for all pins of the profile.
+*
+* @param[in] Profile        Mode profile ID number.
+*
+*/
+void Port_ApplyModeProfile
+(
+    Port_ModeProfileType Profile
+)
+{
+    const Port_ModeProfileConfigType * pProfile;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_APPLYMODEPROFILE_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if profile is valid */
+    else if (Profile >= Port_pConfigPtr->NumModeProfiles_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_APPLYMODEPROFILE_ID, (uint8)PORT_E_PARAM_PROFILE);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        pProfile = &Port_pConfigPtr->ModeProfileConfig_ptr[Profile];
+
+        /* Write all port halves of the profile using Hardware driver */
+        PortHw_SetGlobalPinControls(pProfile->Controls_ptr, (uint32)pProfile->NumControls_u8);
+    }
+}
+#endif /* (STD_ON == PORT_APPLY_MODE_PROFILE_API) */
+#endif
+
+#ifdef PORT_SWITCH_PROFILE_API
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief   Switches the pins to another pin profile.
+* @details The function @p Port_SwitchProfile() will replay the register delta generated
+*          off-line between the profiles @p From and @p To: only the PDOR, PDDR and PCR
+*          contents that differ are written, PCRs grouped by port half and value through
+*          GPCLR/GPCHR. The result is the register state Port_Init() gives for @p To.
+*          Port_RefreshPortDirection() and Port_VerifyPortDirection() do nothing while a
+*          profile other than the one of Port_Init() is active.
+* @pre     @p Port_Init() must have been called first. @p From must be the active profile.
+*
+* @param[in] From           Active pin profile ID number.
+* @param[in] To             Pin profile ID number to switch to.
+*
+*/
+void Port_SwitchProfile
+(
+    Port_ProfileType From,
+    Port_ProfileType To
+)
+{
+    const Port_ProfileSwitchConfigType * pSwitch = NULL_PTR;
+    uint16 u16SwitchIndex;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SWITCHPROFILE_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* The delta is only valid from the active profile */
+    else if (From != Port_u8ActiveProfile)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SWITCHPROFILE_ID, (uint8)PORT_E_PARAM_PROFILE_SWITCH);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* First matching switch entry */
+        for (u16SwitchIndex = 0U; (NULL_PTR == pSwitch) && (u16SwitchIndex < Port_pConfigPtr->NumProfileSwitches_u16); u16SwitchIndex++)
+        {
+            if ((From == Port_pConfigPtr->ProfileSwitchConfig_ptr[u16SwitchIndex].From_u8) &&
+                (To == Port_pConfigPtr->ProfileSwitchConfig_ptr[u16SwitchIndex].To_u8))
+            {
+                pSwitch = &Port_pConfigPtr->ProfileSwitchConfig_ptr[u16SwitchIndex];
+            }
+        }
+
+        if (NULL_PTR != pSwitch)
+        {
+            /* Write the changed registers using Hardware driver */
+            PortHw_InitScriptReplay(pSwitch->Script_ptr);
+            Port_u8ActiveProfile = To;
+        }
+        else
+        {
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+            /* No switch configured between the two profiles */
+            (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SWITCHPROFILE_ID, (uint8)PORT_E_PARAM_PROFILE_SWITCH);
+#endif /* PORT_DEV_ERROR_DETECT */
+        }
+    }
+}
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+#endif
+
+#ifdef PORT_CHANNEL_GROUP_API
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/**
+* @brief   Reads a channel group.
+* @details The function @p Port_ReadChannelGroup() will read all pins of a configured
+*          channel group with one PDIR read, masked and shifted down to the lowest pin of the
+*          group, so the value is coherent.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] Group          Channel group ID number.
+*
+* @return  Input level of the group, 0 if the group is invalid.
+*
+*/
+Port_ChannelGroupLevelType Port_ReadChannelGroup
+(
+    Port_ChannelGroupType Group
+)
+{
+    Port_ChannelGroupLevelType Level = 0U;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_READCHANNELGROUP_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if channel group is valid */
+    else if (Group >= Port_pConfigPtr->NumChannelGroups_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_READCHANNELGROUP_ID, (uint8)PORT_E_PARAM_CHANNEL_GROUP);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* Read the group using Hardware driver */
+        Level = (Port_ChannelGroupLevelType)PortHw_ReadChannelGroup(&Port_pConfigPtr->ChannelGroupConfig_ptr[Group]);
+    }
+
+    return Level;
+}
 
-#if (STD_ON == PORT_PRECOMPILE_SUPPORT)
-    extern const Port_ConfigType Port_Config;
+/**
+* @brief   Writes a channel group.
+* @details The function @p Port_WriteChannelGroup() will write all pins of a configured
+*          channel group with one PSOR and one PCOR write. No other pin of the port is touched,
+*          so no critical section is needed.
+* @pre     @p Port_Init() must have been called first. The pins of the group must be GPIO
+*          outputs.
+*
+* @param[in] Group          Channel group ID number.
+* @param[in] Level          Output level of the group, bit 0 = lowest pin.
+*
+*/
+void Port_WriteChannelGroup
+(
+    Port_ChannelGroupType Group,
+    Port_ChannelGroupLevelType Level
+)
+{
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_WRITECHANNELGROUP_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if channel group is valid */
+    else if (Group >= Port_pConfigPtr->NumChannelGroups_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_WRITECHANNELGROUP_ID, (uint8)PORT_E_PARAM_CHANNEL_GROUP);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* Write the group using Hardware driver */
+        PortHw_WriteChannelGroup(&Port_pConfigPtr->ChannelGroupConfig_ptr[Group], (uint32)Level);
+    }
+}
+#endif /* (STD_ON == PORT_CHANNEL_GROUP_API) */
 #endif
 
-#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-#include "Port_MemMap.h"
-/*=================================================================================================
-*                                   LOCAL FUNCTION PROTOTYPES
-=================================================================================================*/
-
-
-/*=================================================================================================
-*                                      LOCAL FUNCTIONS
-=================================================================================================*/
-#define PORT_START_SEC_CODE
-#include "Port_MemMap.h"
+#ifdef PORT_DEBOUNCE_API
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief   Debounces the configured debounce ports.
+* @details The function @p Port_DebounceMainFunction() will read every configured debounce
+*          port once and debounce all its pins together with vertical counters, so one call
+*          costs one PDIR read and a few word operations per port, whatever the number of
+*          pins. The debounced levels and the edges of this call are kept for
+*          @p Port_GetDebouncedState() and @p Port_GetDebouncedEdges().
+* @pre     @p Port_Init() must have been called first, the call is ignored before.
+*
+*/
+void Port_DebounceMainFunction(void)
+{
+    const Port_ConfigType * pLocalConfigPtr = Port_pConfigPtr;
+    uint16 u16PortIndex;
 
-/*=================================================================================================
-*                                      GLOBAL FUNCTIONS
-=================================================================================================*/
+    if (NULL_PTR != pLocalConfigPtr)
+    {
+        for (u16PortIndex = 0U; u16PortIndex < pLocalConfigPtr->NumDebouncePorts_u16; u16PortIndex++)
+        {
+            PortHw_DebounceUpdate(&pLocalConfigPtr->DebounceConfig_ptr[u16PortIndex], &pLocalConfigPtr->DebounceState_ptr[u16PortIndex]);
+        }
+    }
+    else
+    {
+        /* Not initialized, nothing to debounce */
+    }
+}
 
 /**
-* @brief   Initializes the Port Driver module.
-* @details The function @p Port_Init() will initialize ALL ports and port pins
-*          with the configuration set pointed to by the parameter @p pConfigPtr.
-* @post    Port_Init() must be called before all other Port Driver module's functions
-*          otherwise no operation can occur on the MCU ports and port pins.
+* @brief   Returns the debounced level of a debounce port.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] Port           Debounce port ID number.
+*
+* @return  Debounced level, bit n = pin n of the port, 0 if the port is invalid.
 *
-* @param[in] ConfigPtr     A pointer to the structure which contains
-*                          initialization parameters.
 */
-void Port_Init
+Port_DebounceLevelType Port_GetDebouncedState
 (
-    const Port_ConfigType * ConfigPtr
+    Port_DebouncePortType Port
 )
 {
-    const Port_ConfigType * pLocalConfigPtr = ConfigPtr;
+    Port_DebounceLevelType Level = 0U;
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
-#if (STD_OFF == PORT_PRECOMPILE_SUPPORT)
-    if (NULL_PTR == ConfigPtr)
-#else /*(STD_OFF == PORT_PRECOMPILE_SUPPORT) */
-    if (NULL_PTR != ConfigPtr)
-#endif /* (STD_OFF == PORT_PRECOMPILE_SUPPORT) */
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
     {
-        (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INIT_ID, (uint8)PORT_E_INIT_FAILED);
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_GETDEBOUNCEDSTATE_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if debounce port is valid */
+    else if (Port >= Port_pConfigPtr->NumDebouncePorts_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_GETDEBOUNCEDSTATE_ID, (uint8)PORT_E_PARAM_DEBOUNCE_PORT);
     }
     else
-#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+#endif /* PORT_DEV_ERROR_DETECT */
     {
-#if (STD_ON == PORT_PRECOMPILE_SUPPORT)
-        pLocalConfigPtr = &Port_Config;
-#endif /* (STD_ON == PORT_PRECOMPILE_SUPPORT) */
+        Level = (Port_DebounceLevelType)Port_pConfigPtr->DebounceState_ptr[Port].State_u32;
+    }
 
-#if (STD_ON == PORT_DEV_ERROR_DETECT)
-        /* Validate configuration pointer */
-        if ((NULL_PTR == pLocalConfigPtr->IpConfig_ptr) || (0U == pLocalConfigPtr->NumPins_u16))
-        {
-            (void)Det_ReportError((uint16)PORT_MODULE_ID, PORT_INSTANCE_ID, (uint8)PORT_INIT_ID, (uint8)PORT_E_PARAM_CONFIG);
-        }
-        else
-#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
-        {
-            /* Initialize Port using Hardware driver */
-            (void)PortHw_Init(pLocalConfigPtr->NumPins_u16, pLocalConfigPtr->IpConfig_ptr, \
-            				  pLocalConfigPtr->NumUnusedPins_u16, pLocalConfigPtr->UnusedPads_ptr,\
-							  pLocalConfigPtr->UnusedPadConfig_ptr);
+    return Level;
+}
 
-            /*  Save configuration pointer in global variable */
-            Port_pConfigPtr = pLocalConfigPtr;
-        }
+/**
+* @brief   Returns the edges of a debounce port.
+* @details The pins whose debounced level changed on the last @p Port_DebounceMainFunction()
+*          call; the word is rewritten by every call.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] Port           Debounce port ID number.
+*
+* @return  Changed pins, bit n = pin n of the port, 0 if the port is invalid.
+*
+*/
+Port_DebounceLevelType Port_GetDebouncedEdges
+(
+    Port_DebouncePortType Port
+)
+{
+    Port_DebounceLevelType Edges = 0U;
+
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_GETDEBOUNCEDEDGES_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if debounce port is valid */
+    else if (Port >= Port_pConfigPtr->NumDebouncePorts_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_GETDEBOUNCEDEDGES_ID, (uint8)PORT_E_PARAM_DEBOUNCE_PORT);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        Edges = (Port_DebounceLevelType)Port_pConfigPtr->DebounceState_ptr[Port].Edge_u32;
     }
+
+    return Edges;
 }
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#endif
 
-#if (STD_ON == PORT_SET_PIN_DIRECTION_API)
+#ifdef PORT_PIN_NOTIFICATION_API
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
 /**
-* @brief   Sets the port pin direction.
-* @details The function @p Port_SetPinDirection() will set the port pin direction
-*          during runtime.
-* @pre     @p Port_Init() must have been called first. In order to change the
-*          pin direction the PortPinDirectionChangeable flag must have been set
-*          to @p TRUE.
+* @brief   Enables the notification of a pin.
+* @details The function @p Port_EnablePinNotification() will program the interrupt event of a
+*          configured pin and store its notification for the PORTx interrupt handler. The
+*          notification is called from interrupt context, once per latched event.
+* @pre     @p Port_Init() must have been called first. The NVIC line of the port must be
+*          enabled by the integrator.
 *
-* @param[in] Pin            Pin ID number.
-* @param[in] Direction     Port Pin direction.
+* @param[in] Pin            Port Pin ID number.
+* @param[in] Edge           Edge notified.
+* @param[in] Notification   Function called on every notified edge.
 *
 */
-void Port_SetPinDirection
+void Port_EnablePinNotification
 (
     Port_PinType Pin,
-    Port_PinDirectionType Direction
+    Port_PinNotificationEdgeType Edge,
+    Port_PinNotificationType Notification
 )
 {
-    uint32 PinIndex_u32;
-    PortHw_DirectionType HwDirection_en;
-    GPIO_Type* GpioBase_ptr;
+    static const PortHw_InterruptConfigType Port_aEdgeIrqc[3U] =
+    {
+        PORT_HW_INT_RISING_EDGE,
+        PORT_HW_INT_FALLING_EDGE,
+        PORT_HW_INT_EITHER_EDGE
+    };
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     /* Check if Port module is initialized */
     if (NULL_PTR == Port_pConfigPtr)
     {
-        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_UNINIT);
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEPINNOTIFICATION_ID, (uint8)PORT_E_UNINIT);
     }
     /* Check if pin is valid */
     else if (Pin >= Port_pConfigPtr->NumPins_u16)
     {
-        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_PARAM_PIN);
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEPINNOTIFICATION_ID, (uint8)PORT_E_PARAM_PIN);
     }
-    /* Check if direction is changeable */
-    else if ((boolean)FALSE == Port_pConfigPtr->UsedPadConfig_ptr[Pin].DirectionChangeable_bool)
+    /* Check if edge is valid */
+    else if ((uint32)Edge > (uint32)PORT_NOTIFICATION_BOTH_EDGES)
     {
-        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINDIRECTION_ID, (uint8)PORT_E_DIRECTION_UNCHANGEABLE);
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEPINNOTIFICATION_ID, (uint8)PORT_E_PARAM_EDGE);
+    }
+    /* Check if notification is valid */
+    else if (NULL_PTR == Notification)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEPINNOTIFICATION_ID, (uint8)PORT_E_PARAM_POINTER);
     }
     else
 #endif /* PORT_DEV_ERROR_DETECT */
     {
-        /* Get GPIO base address and pin index */
-        GpioBase_ptr = Port_pConfigPtr->IpConfig_ptr[Pin].GpioBase_ptr;
-        PinIndex_u32 = Port_pConfigPtr->IpConfig_ptr[Pin].PinPortIndex_u32;
+        /* Enable the pin interrupt using Hardware driver */
+        PortHw_EnablePinInterrupt((uint8)PORT_HW_GET_PORT_U32(Port_pConfigPtr->PinTable_ptr->PadId_ptr[Pin]),
+                                  Port_pConfigPtr->PinHandle_ptr[Pin].PinPortIndex_u8, Port_aEdgeIrqc[Edge],
+                                  Notification);
+    }
+}
 
-        /* Convert AUTOSAR direction to HW direction */
-        if (PORT_PIN_OUT == Direction)
-        {
-            HwDirection_en = PORT_HW_PIN_OUT;
-        }
-        else
-        {
-            HwDirection_en = PORT_HW_PIN_IN;
-        }
+/**
+* @brief   Disables the notification of a pin.
+* @details The function @p Port_DisablePinNotification() will disable the interrupt event of a
+*          configured pin, drop an event already latched and remove its notification.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] Pin            Port Pin ID number.
+*
+*/
+void Port_DisablePinNotification
+(
+    Port_PinType Pin
+)
+{
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_DISABLEPINNOTIFICATION_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if pin is valid */
+    else if (Pin >= Port_pConfigPtr->NumPins_u16)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_DISABLEPINNOTIFICATION_ID, (uint8)PORT_E_PARAM_PIN);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* Disable the pin interrupt using Hardware driver */
+        PortHw_DisablePinInterrupt((uint8)PORT_HW_GET_PORT_U32(Port_pConfigPtr->PinTable_ptr->PadId_ptr[Pin]),
+                                   Port_pConfigPtr->PinHandle_ptr[Pin].PinPortIndex_u8);
+    }
+}
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) */
+#endif
 
-        /* Set pin direction using Hardware driver */
-        PortHw_SetPinDirection(GpioBase_ptr, PinIndex_u32, HwDirection_en);
+#ifdef PORT_DIGITAL_FILTER_API
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/**
+* @brief   Enables the digital filter of pins.
+* @details The function @p Port_EnableDigitalFilter() will enable the hardware digital filter
+*          of pins of a digital filter port, with the clock and width configured by
+*          @p Port_Init(). The other pins of the port keep their filter setting.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] FilterPort     Digital filter port ID number.
+* @param[in] Pins           Pins to filter, within the configured pins of the port.
+*
+*/
+void Port_EnableDigitalFilter
+(
+    Port_DigitalFilterPortType FilterPort,
+    Port_DigitalFilterPinsType Pins
+)
+{
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEDIGITALFILTER_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if digital filter port and pins are valid */
+    else if ((FilterPort >= Port_pConfigPtr->NumDigitalFilterPorts_u8) || \
+             (0U != (Pins & ~Port_pConfigPtr->DigitalFilterConfig_ptr[FilterPort].PinMask_u32)))
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_ENABLEDIGITALFILTER_ID, (uint8)PORT_E_PARAM_DIGITAL_FILTER);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* Enable the filters using Hardware driver */
+        PortHw_EnableDigitalFilter(Port_pConfigPtr->DigitalFilterConfig_ptr[FilterPort].PortBase_ptr, (uint32)Pins);
     }
 }
-#endif /* (STD_ON == PORT_SET_PIN_DIRECTION_API) */
+
+/**
+* @brief   Disables the digital filter of pins.
+* @details The function @p Port_DisableDigitalFilter() will disable the hardware digital filter
+*          of pins of a digital filter port, their input is passed unfiltered. The other pins
+*          of the port keep their filter setting.
+* @pre     @p Port_Init() must have been called first.
+*
+* @param[in] FilterPort     Digital filter port ID number.
+* @param[in] Pins           Pins to pass unfiltered, within the configured pins of the port.
+*
+*/
+void Port_DisableDigitalFilter
+(
+    Port_DigitalFilterPortType FilterPort,
+    Port_DigitalFilterPinsType Pins
+)
+{
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_DISABLEDIGITALFILTER_ID, (uint8)PORT_E_UNINIT);
+    }
+    /* Check if digital filter port and pins are valid */
+    else if ((FilterPort >= Port_pConfigPtr->NumDigitalFilterPorts_u8) || \
+             (0U != (Pins & ~Port_pConfigPtr->DigitalFilterConfig_ptr[FilterPort].PinMask_u32)))
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_DISABLEDIGITALFILTER_ID, (uint8)PORT_E_PARAM_DIGITAL_FILTER);
+    }
+    else
+#endif /* PORT_DEV_ERROR_DETECT */
+    {
+        /* Disable the filters using Hardware driver */
+        PortHw_DisableDigitalFilter(Port_pConfigPtr->DigitalFilterConfig_ptr[FilterPort].PortBase_ptr, (uint32)Pins);
+    }
+}
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+#endif
 
 
 
@@ -277,8 +1297,7 @@ void Port_SetPinMode
     Port_PinModeType Mode
 )
 {
-    uint32 PinIndex_u32;
-    PORT_Type* PortBase_ptr;
+    const Port_PinHandleType * pHandle;
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     /* Check if port is initialized */
@@ -292,7 +1311,7 @@ void Port_SetPinMode
         (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINMODE_ID, (uint8)PORT_E_PARAM_PIN);
     }
     /* Check if mode is changeable */
-    else if ((boolean)FALSE == Port_pConfigPtr->UsedPadConfig_ptr[Pin].ModeChangeable_bool)
+    else if (0U == (Port_pConfigPtr->PinHandle_ptr[Pin].Flags_u8 & PORT_PIN_HANDLE_MODE_CHANGEABLE_U8))
     {
         (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINMODE_ID, (uint8)PORT_E_MODE_UNCHANGEABLE);
     }
@@ -301,15 +1320,18 @@ void Port_SetPinMode
     {
         (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINMODE_ID, (uint8)PORT_E_PARAM_INVALID_MODE);
     }
+    /* Check if the pad supports the mode */
+    else if (0U == (Port_pConfigPtr->PinHandle_ptr[Pin].AllowedModes_u8 & (uint8)(1U << Mode)))
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_SETPINMODE_ID, (uint8)PORT_E_MODE_UNSUPPORTED);
+    }
     else
 #endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
     {
-        /* Get PORT base address and pin index */
-        PortBase_ptr = Port_pConfigPtr->IpConfig_ptr[Pin].PortBase_ptr;
-        PinIndex_u32 = Port_pConfigPtr->IpConfig_ptr[Pin].PinPortIndex_u32;
+        pHandle = &Port_pConfigPtr->PinHandle_ptr[Pin];
 
         /* Set pin mode using Hardware driver */
-        PortHw_SetMuxModeSel(PortBase_ptr, PinIndex_u32, (PortHw_MuxType)Mode);
+        PortHw_SetMuxModeSel(pHandle->PortBase_ptr, pHandle->PinPortIndex_u8, (PortHw_MuxType)Mode);
     }
 }
 #endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
@@ -320,15 +1342,14 @@ void Port_SetPinMode
 *          the configured direction.
 *          The PORT driver will exclude from refreshing those port pins that
 *          are configured as "pin direction changeable during runtime".
+*          The pins are refreshed with the per-port masks built by Port_Init(), at most
+*          one masked PDDR update per port whatever the number of pins.
 * @pre     @p Port_Init() must have been called first.
 *
 */
 void Port_RefreshPortDirection( void )
 {
-    uint16 PinIndex_u16;
-    uint32 PinPortIndex_u32;
-    GPIO_Type* GpioBase_ptr;
-    PortHw_DirectionType HwDirection_en;
+    uint8 u8Port;
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     /* Check if Port module is initialized */
@@ -338,33 +1359,81 @@ void Port_RefreshPortDirection( void )
     }
     else
 #endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+    /* The directions of another pin profile are owned by that profile */
+    if (PORT_INIT_PROFILE_U8 != Port_u8ActiveProfile)
     {
-        /* Loop through all configured pins */
-        for (PinIndex_u16 = 0U; PinIndex_u16 < Port_pConfigPtr->NumPins_u16; PinIndex_u16++)
+        /* Nothing to refresh */
+    }
+    else
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+    {
+        /* One masked update per port holding fixed direction pins */
+        for (u8Port = 0U; u8Port < PORT_HW_PORT_COUNT_U8; u8Port++)
         {
-            /* Only refresh pins that are NOT direction changeable */
-            if ((boolean)FALSE == Port_pConfigPtr->UsedPadConfig_ptr[PinIndex_u16].DirectionChangeable_bool)
+            if (0U != Port_au32RefreshMask[u8Port])
+            {
+                PortHw_WritePinsDirection(PortHw_g_GpioBaseAddr_ptr[u8Port], Port_au32RefreshMask[u8Port], Port_au32RefreshValue[u8Port]);
+            }
+            else
             {
-                /* Get GPIO base address and pin index */
-                GpioBase_ptr = Port_pConfigPtr->IpConfig_ptr[PinIndex_u16].GpioBase_ptr;
-                PinPortIndex_u32 = Port_pConfigPtr->IpConfig_ptr[PinIndex_u16].PinPortIndex_u32;
+                /* No fixed direction pin on this port */
+            }
+        }
+    }
+}
 
-                /* Convert AUTOSAR direction to HW direction */
-                if (PORT_PIN_OUT == Port_pConfigPtr->UsedPadConfig_ptr[PinIndex_u16].PinDirection_en)
-                {
-                    HwDirection_en = PORT_HW_PIN_OUT;
-                }
-                else
-                {
-                    HwDirection_en = PORT_HW_PIN_IN;
-                }
+#ifdef PORT_VERIFY_PORT_DIRECTION_API
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+/**
+* @brief   Verifies port direction.
+* @details Same as Port_RefreshPortDirection(), but the PDDR of a port is written only
+*          when one of its fixed direction pins has lost the configured direction.
+* @pre     @p Port_Init() must have been called first.
+*
+* @return  Number of ports whose direction register had to be rewritten.
+*
+*/
+uint8 Port_VerifyPortDirection( void )
+{
+    uint8 u8Port;
+    uint8 u8Rewritten = 0U;
 
-                /* Refresh pin direction using Hardware driver */
-                PortHw_SetPinDirection(GpioBase_ptr, PinPortIndex_u32, HwDirection_en);
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfigPtr)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_VERIFYPORTDIRECTION_ID, (uint8)PORT_E_UNINIT);
+    }
+    else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+    /* The directions of another pin profile are owned by that profile */
+    if (PORT_INIT_PROFILE_U8 != Port_u8ActiveProfile)
+    {
+        /* Nothing to verify */
+    }
+    else
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+    {
+        for (u8Port = 0U; u8Port < PORT_HW_PORT_COUNT_U8; u8Port++)
+        {
+            if ((0U != Port_au32RefreshMask[u8Port]) &&
+                ((boolean)TRUE == PortHw_VerifyPinsDirection(PortHw_g_GpioBaseAddr_ptr[u8Port], Port_au32RefreshMask[u8Port], Port_au32RefreshValue[u8Port])))
+            {
+                u8Rewritten++;
+            }
+            else
+            {
+                /* No fixed direction pin on this port or directions as configured */
             }
         }
     }
+
+    return u8Rewritten;
 }
+#endif /* (STD_ON == PORT_VERIFY_PORT_DIRECTION_API) */
+#endif
 
 
 #if  (STD_ON == PORT_VERSION_INFO_API)
@@ -417,9 +1486,7 @@ void Port_SetAsUnusedPin
     Port_PinType Pin
 )
 {
-    uint32 PinPortIndex_u32;
-    PORT_Type* PortBase_ptr;
-    GPIO_Type* GpioBase_ptr;
+    const Port_PinHandleType * pHandle;
     PortHw_DirectionType HwDirection_en;
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
@@ -436,29 +1503,26 @@ void Port_SetAsUnusedPin
     else
 #endif
     {
-        /* Get base addresses and pin index */
-        PortBase_ptr = Port_pConfigPtr->IpConfig_ptr[Pin].PortBase_ptr;
-        GpioBase_ptr = Port_pConfigPtr->IpConfig_ptr[Pin].GpioBase_ptr;
-        PinPortIndex_u32 = Port_pConfigPtr->IpConfig_ptr[Pin].PinPortIndex_u32;
+        pHandle = &Port_pConfigPtr->PinHandle_ptr[Pin];
 
         /* Configure pin with unused pin settings */
         if (Port_pConfigPtr->UnusedPadConfig_ptr != NULL_PTR)
         {
             /* Set mux mode from unused pin configuration */
-            PortHw_SetMuxModeSel(PortBase_ptr, PinPortIndex_u32, PORT_HW_MUX_AS_GPIO);
+            PortHw_SetMuxModeSel(pHandle->PortBase_ptr, pHandle->PinPortIndex_u8, PORT_HW_MUX_AS_GPIO);
 
             /* Convert and set direction */
             if (PORT_PIN_OUT == Port_pConfigPtr->UnusedPadConfig_ptr->PinDirection_en)
             {
                 HwDirection_en = PORT_HW_PIN_OUT;
                 /* Set output value */
-                PortHw_WritePin(GpioBase_ptr, PinPortIndex_u32, Port_pConfigPtr->UnusedPadConfig_ptr->PinOutputValue_u8);
+                PortHw_WritePins(pHandle->GpioBase_ptr, pHandle->PinMask_u32, Port_pConfigPtr->UnusedPadConfig_ptr->PinOutputValue_u8);
             }
             else
             {
                 HwDirection_en = PORT_HW_PIN_IN;
             }
-            PortHw_SetPinDirection(GpioBase_ptr, PinPortIndex_u32, HwDirection_en);
+            PortHw_SetPinDirection(pHandle->GpioBase_ptr, pHandle->PinPortIndex_u8, HwDirection_en);
         }
     }
 }
@@ -490,8 +1554,8 @@ void Port_SetAsUsedPin
     else
 #endif
     {
-        /* Re-initialize pin with original configuration */
-        (void)PortHw_Init(1U, &Port_pConfigPtr->IpConfig_ptr[Pin]);
+        /* Re-initialize pin with original configuration (precomputed PCR word) */
+        PortHw_InitPin(Port_pConfigPtr->PinTable_ptr, Pin);
     }
 }
 #endif /* (STD_ON == PORT_SET_AS_UNUSED_PIN_API) */
@@ -511,9 +1575,7 @@ void Port_ResetPinMode
     Port_PinType Pin
 )
 {
-    uint32 PinPortIndex_u32;
-    PORT_Type* PortBase_ptr;
-    PortHw_MuxType OriginalMux_en;
+    const Port_PinHandleType * pHandle;
 
 #if (STD_ON == PORT_DEV_ERROR_DETECT)
     /* Check if port is initialized */
@@ -527,22 +1589,17 @@ void Port_ResetPinMode
         (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_RESETPINMODE_ID, (uint8)PORT_E_PARAM_PIN);
     }
     /* Check if mode is changeable */
-    else if ((boolean)FALSE == Port_pConfigPtr->UsedPadConfig_ptr[Pin].ModeChangeable_bool)
+    else if (0U == (Port_pConfigPtr->PinHandle_ptr[Pin].Flags_u8 & PORT_PIN_HANDLE_MODE_CHANGEABLE_U8))
     {
         (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_RESETPINMODE_ID, (uint8)PORT_E_MODE_UNCHANGEABLE);
     }
     else
 #endif
     {
-        /* Get PORT base address and pin index */
-        PortBase_ptr = Port_pConfigPtr->IpConfig_ptr[Pin].PortBase_ptr;
-        PinPortIndex_u32 = Port_pConfigPtr->IpConfig_ptr[Pin].PinPortIndex_u32;
-
-        /* Get original mux mode from configuration */
-        OriginalMux_en = Port_pConfigPtr->IpConfig_ptr[Pin].Mux_en;
+        pHandle = &Port_pConfigPtr->PinHandle_ptr[Pin];
 
         /* Reset pin mode to original value using Hardware driver */
-        PortHw_SetMuxModeSel(PortBase_ptr, PinPortIndex_u32, OriginalMux_en);
+        PortHw_SetMuxModeSel(pHandle->PortBase_ptr, pHandle->PinPortIndex_u8, (PortHw_MuxType)pHandle->InitMux_u8);
     }
 }
 #endif /* (STD_ON == PORT_RESET_PIN_MODE_API) */
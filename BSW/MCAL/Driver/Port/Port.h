@@ -225,6 +225,177 @@ extern "C" {
 #endif /* (STD_ON == PORT_SET_2_PINS_DIRECTION_API) */
 #endif
 
+#ifdef PORT_PHASED_INIT_API
+#if (STD_ON == PORT_PHASED_INIT_API)
+/**
+* @brief   API service ID for PORT init critical pins function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_INITCRITICAL_ID            ((uint8)0x09)
+
+/**
+* @brief   API service ID for PORT init main function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_INITMAINFUNCTION_ID        ((uint8)0x0A)
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+#endif
+
+#ifdef PORT_SET_PIN_GROUP_DIRECTION_API
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/**
+* @brief   API service ID for PORT set pin group direction function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_SETPINGROUPDIRECTION_ID    ((uint8)0x0B)
+#endif /* (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API) */
+#endif
+
+#ifdef PORT_VERIFY_PORT_DIRECTION_API
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+/**
+* @brief   API service ID for PORT verify port direction function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_VERIFYPORTDIRECTION_ID     ((uint8)0x0C)
+#endif /* (STD_ON == PORT_VERIFY_PORT_DIRECTION_API) */
+#endif
+
+#ifdef PORT_APPLY_MODE_PROFILE_API
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/**
+* @brief   API service ID for PORT apply mode profile function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_APPLYMODEPROFILE_ID        ((uint8)0x0D)
+#endif /* (STD_ON == PORT_APPLY_MODE_PROFILE_API) */
+#endif
+
+#ifdef PORT_SWITCH_PROFILE_API
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief   API service ID for PORT switch profile function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_SWITCHPROFILE_ID           ((uint8)0x0E)
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+#endif
+
+#ifdef PORT_CHANNEL_GROUP_API
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/**
+* @brief   API service ID for PORT read channel group function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_READCHANNELGROUP_ID        ((uint8)0x0F)
+
+/**
+* @brief   API service ID for PORT write channel group function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_WRITECHANNELGROUP_ID       ((uint8)0x10)
+#endif /* (STD_ON == PORT_CHANNEL_GROUP_API) */
+#endif
+
+#ifdef PORT_DEBOUNCE_API
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief   API service ID for PORT debounce main function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_DEBOUNCEMAINFUNCTION_ID    ((uint8)0x11)
+
+/**
+* @brief   API service ID for PORT get debounced state function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_GETDEBOUNCEDSTATE_ID       ((uint8)0x12)
+
+/**
+* @brief   API service ID for PORT get debounced edges function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_GETDEBOUNCEDEDGES_ID       ((uint8)0x13)
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#endif
+
+#ifdef PORT_PIN_NOTIFICATION_API
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+/**
+* @brief   API service ID for PORT enable pin notification function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_ENABLEPINNOTIFICATION_ID   ((uint8)0x14)
+
+/**
+* @brief   API service ID for PORT disable pin notification function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_DISABLEPINNOTIFICATION_ID  ((uint8)0x15)
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) */
+#endif
+
+#ifdef PORT_DIGITAL_FILTER_API
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/**
+* @brief   API service ID for PORT enable digital filter function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_ENABLEDIGITALFILTER_ID     ((uint8)0x16)
+
+/**
+* @brief   API service ID for PORT disable digital filter function.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_DISABLEDIGITALFILTER_ID    ((uint8)0x17)
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+#endif
+
 /* Errors IDs */
 /**
 * @brief   Error ID of port driver.
@@ -297,6 +468,78 @@ extern "C" {
 */
 #define PORT_E_PARAM_POINTER            ((uint8)0x10)
 
+/**
+* @brief   Invalid Port Pin Group ID requested.
+* @details Det Error value, returned by Port_SetPinGroupDirection
+*          if a wrong pin group ID is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_GROUP              ((uint8)0x11)
+
+/**
+* @brief   API Port_SetPinMode() service called with a mode the pad does not support.
+* @details Det Error value, returned by Port_SetPinMode function
+*          if the passed PortPinMode is not an alternate function of the pad.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_MODE_UNSUPPORTED         ((uint8)0x12)
+
+/**
+* @brief   Invalid Port Mode Profile ID requested.
+* @details Det Error value, returned by Port_ApplyModeProfile
+*          if a wrong mode profile ID is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_PROFILE            ((uint8)0x13)
+
+/**
+* @brief   Invalid Port Pin Profile switch requested.
+* @details Det Error value, returned by Port_SwitchProfile if the source profile is not the
+*          active one or no switch is configured between the two profiles.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_PROFILE_SWITCH     ((uint8)0x14)
+
+/**
+* @brief   Invalid Port Channel Group ID requested.
+* @details Det Error value, returned by Port_ReadChannelGroup and Port_WriteChannelGroup
+*          if a wrong channel group ID is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_CHANNEL_GROUP      ((uint8)0x15)
+
+/**
+* @brief   Invalid Port Debounce Port ID requested.
+* @details Det Error value, returned by Port_GetDebouncedState and Port_GetDebouncedEdges
+*          if a wrong debounce port ID is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_DEBOUNCE_PORT      ((uint8)0x16)
+
+/**
+* @brief   Invalid notification edge requested.
+* @details Det Error value, returned by Port_EnablePinNotification
+*          if a wrong edge is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_EDGE               ((uint8)0x17)
+
+/**
+* @brief   Invalid Port Digital Filter Port ID or pins requested.
+* @details Det Error value, returned by Port_EnableDigitalFilter and Port_DisableDigitalFilter
+*          if a wrong digital filter port ID or a pin outside its configured pins is passed.
+*
+* @implements Port_ErrorCodes_define
+*/
+#define PORT_E_PARAM_DIGITAL_FILTER     ((uint8)0x18)
+
 /*=================================================================================================
 *                                      DEFINES AND MACROS
 =================================================================================================*/
@@ -350,6 +593,65 @@ void Port_Init
     const Port_ConfigType * ConfigPtr
 );
 
+#ifdef PORT_PHASED_INIT_API
+#if (STD_ON == PORT_PHASED_INIT_API)
+/*!
+ * @brief Port driver critical pins initialization function
+ *
+ * @details First half of a phased Port_Init: configures only the pins with
+ *          PORT_PIN_PRIORITY_CRITICAL_U8 and returns. The other pins and the unused pads
+ *          are configured by Port_InitMainFunction(). The other Port services report
+ *          PORT_E_UNINIT until the phased initialization is complete.
+ *
+ * @param[in] Port_ConfigType * ConfigPtr Pointer to configuration (NULL_PTR if only one variant is used)
+ *
+ * @return void
+ *
+ * @implements Port_InitCritical_Activity
+ **/
+void Port_InitCritical
+(
+    const Port_ConfigType * ConfigPtr
+);
+
+/*!
+ * @brief Port driver incremental initialization function
+ *
+ * @details Second half of a phased Port_Init, called from the idle loop after
+ *          Port_InitCritical(). Every call runs at most Budget init steps, a step being
+ *          one deferred pin or the unused pads of one port.
+ *
+ * @param[in] Budget Maximum number of init steps of this call
+ *
+ * @return boolean
+ * @retval TRUE  Initialization complete, the driver is initialized
+ * @retval FALSE Init steps remain (or Port_InitCritical() was not called)
+ *
+ * @implements Port_InitMainFunction_Activity
+ **/
+boolean Port_InitMainFunction
+(
+    uint16 Budget
+);
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+#endif
+
+#ifdef PORT_WARM_INIT_SKIP
+#if (STD_ON == PORT_WARM_INIT_SKIP)
+/*!
+ * @brief Port_GetInitSkippedWrites
+ *
+ * @details Returns the number of register writes the last Port_Init did not need
+ *          because the registers already held their configuration.
+ *
+ * @return uint32 Number of skipped register writes (0 before Port_Init)
+ *
+ * @implements Port_GetInitSkippedWrites_Activity
+ **/
+uint32 Port_GetInitSkippedWrites(void);
+#endif /* (STD_ON == PORT_WARM_INIT_SKIP) */
+#endif
+
 #if (STD_ON == PORT_SET_PIN_DIRECTION_API)
 /*!
  * @brief Port_SetPinDirection
@@ -397,6 +699,33 @@ void Port_Set2PinsDirection
 #endif /*(STD_ON == PORT_SET_2_PINS_DIRECTION_API) */
 #endif
 
+#ifdef PORT_SET_PIN_GROUP_DIRECTION_API
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/*!
+ * @brief Port_SetPinGroupDirection
+ *
+ * @details Function used for changing the direction of a configured pin group at
+ *          runtime, e.g. to turn a parallel bus around. Each port of the group gets one
+ *          masked PDDR update. Only each port is updated atomically; the ports of a group
+ *          share one critical section only with the module-wide exclusive areas.
+ *
+ * @pre     Port_Init() must have been called first. All pins of the group must have
+ *          been configured with a changeable direction.
+ *
+ * @param[in]Group pin group id (symbolic name from the configuration)
+ * @param[in]Direction new desired direction IN OUT
+ *
+ * @return void
+ * @implements Port_SetPinGroupDirection_Activity
+ **/
+void Port_SetPinGroupDirection
+(
+    Port_PinGroupType Group,
+    Port_PinDirectionType Direction
+);
+#endif /* (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API) */
+#endif
+
 #if (STD_ON == PORT_SET_PIN_MODE_API)
 /*!
  * @brief Port_SetPinMode
@@ -417,6 +746,241 @@ void Port_SetPinMode
 );
 #endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
 
+#ifdef PORT_APPLY_MODE_PROFILE_API
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/*!
+ * @brief Port_ApplyModeProfile
+ *
+ * @details Function used to switch a configured set of pins between modes at runtime, e.g. a
+ *          peripheral's pins between their ALT function and GPIO. The profile is applied
+ *          with one GPCLR/GPCHR write per port half instead of one Port_SetPinMode() per pin.
+ *
+ * @pre     Port_Init() must have been called first. All pins of the profile must have been
+ *          configured with a changeable mode.
+ *
+ * @param[in]Profile mode profile id (symbolic name from the configuration)
+ *
+ * @return void
+ * @implements Port_ApplyModeProfile_Activity
+ **/
+void Port_ApplyModeProfile
+(
+    Port_ModeProfileType Profile
+);
+#endif /* (STD_ON == PORT_APPLY_MODE_PROFILE_API) */
+#endif
+
+#ifdef PORT_SWITCH_PROFILE_API
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/*!
+ * @brief Port_SwitchProfile
+ *
+ * @details Function used to switch all pins between two configured pin profiles, e.g. to park
+ *          the pins before a low-power mode and to restore them on wakeup. Only the registers
+ *          that differ between both profiles are written, as generated off-line. The first
+ *          switch entry from @p From to @p To is used.
+ *
+ * @pre     Port_Init() must have been called first. @p From must be the active profile,
+ *          Port_Init() activates profile 0.
+ *
+ * @param[in]From profile the pins are in (symbolic name from the configuration)
+ * @param[in]To   profile to switch to (symbolic name from the configuration)
+ *
+ * @return void
+ * @implements Port_SwitchProfile_Activity
+ **/
+void Port_SwitchProfile
+(
+    Port_ProfileType From,
+    Port_ProfileType To
+);
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+#endif
+
+#ifdef PORT_CHANNEL_GROUP_API
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/*!
+ * @brief Port_ReadChannelGroup
+ *
+ * @details Function used to read adjoining pins of one port as one value, e.g. an 8- or
+ *          16-bit parallel input. All pins are sampled by one PDIR read.
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]Group channel group id (symbolic name from the configuration)
+ *
+ * @return Port_ChannelGroupLevelType input level of the group, bit 0 = lowest pin
+ * @implements Port_ReadChannelGroup_Activity
+ **/
+Port_ChannelGroupLevelType Port_ReadChannelGroup
+(
+    Port_ChannelGroupType Group
+);
+
+/*!
+ * @brief Port_WriteChannelGroup
+ *
+ * @details Function used to write adjoining output pins of one port as one value. The group
+ *          is written with one PSOR and one PCOR write, other pins of the port are not touched.
+ *
+ * @pre     Port_Init() must have been called first. The pins of the group must be GPIO outputs.
+ *
+ * @param[in]Group channel group id (symbolic name from the configuration)
+ * @param[in]Level output level of the group, bit 0 = lowest pin
+ *
+ * @return void
+ * @implements Port_WriteChannelGroup_Activity
+ **/
+void Port_WriteChannelGroup
+(
+    Port_ChannelGroupType Group,
+    Port_ChannelGroupLevelType Level
+);
+#endif /* (STD_ON == PORT_CHANNEL_GROUP_API) */
+#endif
+
+#ifdef PORT_DEBOUNCE_API
+#if (STD_ON == PORT_DEBOUNCE_API)
+/*!
+ * @brief Port_DebounceMainFunction
+ *
+ * @details Function used to debounce the inputs of the configured debounce ports, to be
+ *          called from a cyclic task (e.g. 1 ms). Every port is read with one PDIR read and
+ *          all its pins are debounced together, so the cost is per port, not per pin. A pin
+ *          takes its new level after PORT_HW_DEBOUNCE_TICKS_U8 calls reading it in a row.
+ *
+ * @pre     Port_Init() must have been called first, nothing is done before.
+ *
+ * @return void
+ * @implements Port_DebounceMainFunction_Activity
+ **/
+void Port_DebounceMainFunction(void);
+
+/*!
+ * @brief Port_GetDebouncedState
+ *
+ * @details Function used to read the debounced level of a debounce port.
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]Port debounce port id (symbolic name from the configuration)
+ *
+ * @return Port_DebounceLevelType debounced level, bit n = pin n of the port
+ * @implements Port_GetDebouncedState_Activity
+ **/
+Port_DebounceLevelType Port_GetDebouncedState
+(
+    Port_DebouncePortType Port
+);
+
+/*!
+ * @brief Port_GetDebouncedEdges
+ *
+ * @details Function used to read the pins of a debounce port whose debounced level changed
+ *          on the last Port_DebounceMainFunction() call. Rising edges are
+ *          (edges & state), falling edges (edges & ~state).
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]Port debounce port id (symbolic name from the configuration)
+ *
+ * @return Port_DebounceLevelType changed pins, bit n = pin n of the port
+ * @implements Port_GetDebouncedEdges_Activity
+ **/
+Port_DebounceLevelType Port_GetDebouncedEdges
+(
+    Port_DebouncePortType Port
+);
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+#endif
+
+#ifdef PORT_PIN_NOTIFICATION_API
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+/*!
+ * @brief Port_EnablePinNotification
+ *
+ * @details Function used to call a notification on every rising, falling or either edge of a
+ *          pin. The notification runs in the PORTx interrupt, which dispatches all pending
+ *          pins of the port with one ISFR read and one ISFR write.
+ *
+ * @pre     Port_Init() must have been called first. The NVIC line of the port must be enabled.
+ *
+ * @param[in]Pin          pin id (symbolic name from the configuration)
+ * @param[in]Edge         notified edge
+ * @param[in]Notification function called from the interrupt
+ *
+ * @return void
+ * @implements Port_EnablePinNotification_Activity
+ **/
+void Port_EnablePinNotification
+(
+    Port_PinType Pin,
+    Port_PinNotificationEdgeType Edge,
+    Port_PinNotificationType Notification
+);
+
+/*!
+ * @brief Port_DisablePinNotification
+ *
+ * @details Function used to stop the notification of a pin, a pending event is dropped.
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]Pin          pin id (symbolic name from the configuration)
+ *
+ * @return void
+ * @implements Port_DisablePinNotification_Activity
+ **/
+void Port_DisablePinNotification
+(
+    Port_PinType Pin
+);
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) */
+#endif
+
+#ifdef PORT_DIGITAL_FILTER_API
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/*!
+ * @brief Port_EnableDigitalFilter
+ *
+ * @details Function used to filter pins of a digital filter port in hardware: input pulses
+ *          shorter than the configured width are not seen by PDIR, the pin interrupt and DMA.
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]FilterPort   digital filter port id (symbolic name from the configuration)
+ * @param[in]Pins         pins to filter, bit n = pin n of the port, within the configured pins
+ *
+ * @return void
+ * @implements Port_EnableDigitalFilter_Activity
+ **/
+void Port_EnableDigitalFilter
+(
+    Port_DigitalFilterPortType FilterPort,
+    Port_DigitalFilterPinsType Pins
+);
+
+/*!
+ * @brief Port_DisableDigitalFilter
+ *
+ * @details Function used to pass pins of a digital filter port unfiltered.
+ *
+ * @pre     Port_Init() must have been called first.
+ *
+ * @param[in]FilterPort   digital filter port id (symbolic name from the configuration)
+ * @param[in]Pins         pins to pass unfiltered, bit n = pin n of the port, within the configured pins
+ *
+ * @return void
+ * @implements Port_DisableDigitalFilter_Activity
+ **/
+void Port_DisableDigitalFilter
+(
+    Port_DigitalFilterPortType FilterPort,
+    Port_DigitalFilterPinsType Pins
+);
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+#endif
+
 #if (STD_ON == PORT_VERSION_INFO_API)
 /*!
  * @brief Port_GetVersionInfo
@@ -447,6 +1011,23 @@ void Port_GetVersionInfo
  **/
 void Port_RefreshPortDirection(void);
 
+#ifdef PORT_VERIFY_PORT_DIRECTION_API
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+/*!
+ * @brief Port_VerifyPortDirection
+ *
+ * @details Verify-only variant of Port_RefreshPortDirection: reads the PDDR of every port
+ *          with fixed direction pins and writes it only if one of those pins has lost its
+ *          configured direction.
+ *
+ * @return uint8 Number of ports whose direction register had to be rewritten
+ *
+ * @implements Port_VerifyPortDirection_Activity
+ **/
+uint8 Port_VerifyPortDirection(void);
+#endif /* (STD_ON == PORT_VERIFY_PORT_DIRECTION_API) */
+#endif
+
 #ifdef PORT_SET_AS_UNUSED_PIN_API
 #if (STD_ON == PORT_SET_AS_UNUSED_PIN_API)
 /*!
@@ -1,85 +1,447 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Exclusive areas of the Port driver
+==================================================================================================*/
+
+/**
+*   @file    SchM_Port.c
+*
+*   @brief   Exclusive areas of the Port driver
+*   @details Every exclusive area uses the lock strategy selected by SCHM_PORT_EXCLUSIVE_AREA_xx_LOCK.
+*            The areas entered through SchM_Enter_Port_PortArea() lock only one port, the
+*            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_xx() entry points lock the module lock slot.
+*
+*            On Cortex-M4 the strategies map to PRIMASK, BASEPRI and LDREX/STREX. On a host build
+*            every strategy other than SCHM_PORT_LOCK_NONE takes a pthread mutex per lock slot,
+*            so the driver can be run from several threads.
+*
+*            Every lock slot is re-entrant for its owner: the spinlock word and the host mutex
+*            are taken on the first entry of a context (exception number on the target, thread
+*            on the host) and released on its last exit, so nested areas of the same slot, e.g.
+*            area 09 inside area 11 with the module lock, do not deadlock.
+*
+*   @addtogroup RTE_MODULE
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
 #include "SchM_Port.h"
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    #define SCHM_PORT_TARGET_LOCKS
+    #include "Mcal.h"
+#else
+    #include <pthread.h>
+#endif
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+/**
+* @brief Lock strategy of every exclusive area
+*/
+static const uint8 SchM_Port_au8AreaLock[SCHM_PORT_NUM_EXCLUSIVE_AREAS] =
+{
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_00_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_01_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_02_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_03_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_04_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_05_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_06_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_07_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_08_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_09_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_10_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_11_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_12_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_13_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_14_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_15_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_16_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_17_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_18_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_19_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_20_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_21_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_22_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_23_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_24_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_25_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_26_LOCK,
+    (uint8)SCHM_PORT_EXCLUSIVE_AREA_27_LOCK
+};
+
+#ifdef SCHM_PORT_TARGET_LOCKS
+/**
+* @brief BASEPRI ceiling of every lock slot
+*/
+static const uint8 SchM_Port_au8BasePriCeiling[SCHM_PORT_NUM_PORT_LOCKS + 1U] =
+{
+    SCHM_PORT_BASEPRI_CEILING_PORTA_U8,
+    SCHM_PORT_BASEPRI_CEILING_PORTB_U8,
+    SCHM_PORT_BASEPRI_CEILING_PORTC_U8,
+    SCHM_PORT_BASEPRI_CEILING_PORTD_U8,
+    SCHM_PORT_BASEPRI_CEILING_PORTE_U8,
+    SCHM_PORT_BASEPRI_CEILING_MODULE_U8
+};
+#endif /* SCHM_PORT_TARGET_LOCKS */
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#ifdef SCHM_PORT_TARGET_LOCKS
+/**
+* @brief PRIMASK / BASEPRI saved on the first entry of a lock slot
+*/
+static volatile uint32 SchM_Port_au32Msr[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+
+/**
+* @brief Nesting depth of the PRIMASK / BASEPRI locks of a lock slot
+*/
+static volatile uint32 SchM_Port_au32ReentryGuard[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+
+/**
+* @brief Spinlock words, 0 = free
+*/
+static volatile uint32 SchM_Port_au32SpinLock[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+
+/**
+* @brief Context (IPSR exception number, 0 = thread mode) holding the spinlock of a lock slot
+*/
+static volatile uint32 SchM_Port_au32SpinOwner[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+
+/**
+* @brief Nesting depth of the spinlock of a lock slot, 0 = free
+*/
+static volatile uint32 SchM_Port_au32SpinDepth[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+#else
+/**
+* @brief Host mutex of every lock slot
+*/
+static pthread_mutex_t SchM_Port_aMutex[SCHM_PORT_NUM_PORT_LOCKS + 1U] =
+{
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER
+};
+
+/**
+* @brief Thread holding the mutex of a lock slot
+*/
+static volatile pthread_t SchM_Port_aMutexOwner[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+
+/**
+* @brief Nesting depth of the mutex of a lock slot, 0 = free
+*/
+static volatile uint32 SchM_Port_au32MutexDepth[SCHM_PORT_NUM_PORT_LOCKS + 1U];
+#endif /* SCHM_PORT_TARGET_LOCKS */
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+#ifdef SCHM_PORT_TARGET_LOCKS
+/**
+* @brief Reads BASEPRI
+*/
+LOCAL_INLINE uint32 SchM_Port_GetBasePri(void)
+{
+    uint32 f_Result_u32;
+    ASM_KEYWORD volatile ("MRS %0, basepri" : "=r" (f_Result_u32));
+    return f_Result_u32;
+}
+
+/**
+* @brief Writes BASEPRI
+*/
+LOCAL_INLINE void SchM_Port_SetBasePri(uint32 BasePri_u32)
+{
+    ASM_KEYWORD volatile ("MSR basepri, %0" :: "r" (BasePri_u32) : "memory");
+}
+
+/**
+* @brief Raises BASEPRI to a ceiling, never lowers it
+*/
+LOCAL_INLINE void SchM_Port_RaiseBasePri(uint32 BasePri_u32)
+{
+    ASM_KEYWORD volatile ("MSR basepri_max, %0" :: "r" (BasePri_u32) : "memory");
+}
+
+/**
+* @brief Reads IPSR: exception number of the running context, 0 in thread mode
+*/
+LOCAL_INLINE uint32 SchM_Port_GetIpsr(void)
+{
+    uint32 f_Result_u32;
+    ASM_KEYWORD volatile ("MRS %0, ipsr" : "=r" (f_Result_u32));
+    return f_Result_u32;
+}
+
+/**
+* @brief Takes a spinlock word with LDREX/STREX
+*/
+LOCAL_INLINE void SchM_Port_SpinLock(volatile uint32* Lock_ptr)
+{
+    uint32 f_Value_u32;
+    uint32 f_Failed_u32 = 1U;
+
+    do
+    {
+        ASM_KEYWORD volatile ("LDREX %0, [%1]" : "=r" (f_Value_u32) : "r" (Lock_ptr) : "memory");
+        if (0U == f_Value_u32)
+        {
+            ASM_KEYWORD volatile ("STREX %0, %2, [%1]" : "=&r" (f_Failed_u32) : "r" (Lock_ptr), "r" (1U) : "memory");
+        }
+        else
+        {
+            /* Lock taken, drop the reservation and retry */
+            ASM_KEYWORD volatile ("CLREX" ::: "memory");
+        }
+    } while (0U != f_Failed_u32);
+
+    ASM_KEYWORD volatile ("DMB" ::: "memory");
+}
+
+/**
+* @brief Releases a spinlock word
+*/
+LOCAL_INLINE void SchM_Port_SpinUnlock(volatile uint32* Lock_ptr)
+{
+    ASM_KEYWORD volatile ("DMB" ::: "memory");
+    *Lock_ptr = 0U;
+}
+#endif /* SCHM_PORT_TARGET_LOCKS */
+
+/**
+* @brief Takes the lock of a lock slot with a strategy
+*/
+static void SchM_Port_EnterLock(uint8 Lock_u8, uint8 Slot_u8)
+{
+#ifdef SCHM_PORT_TARGET_LOCKS
+    uint32 f_Context_u32;
+
+    switch (Lock_u8)
+    {
+        case SCHM_PORT_LOCK_PRIMASK:
+            if (0UL == SchM_Port_au32ReentryGuard[Slot_u8])
+            {
+                SchM_Port_au32Msr[Slot_u8] = Mcal_SuspendAllInterrupts();
+            }
+            SchM_Port_au32ReentryGuard[Slot_u8]++;
+            break;
+
+        case SCHM_PORT_LOCK_BASEPRI:
+            if (0UL == SchM_Port_au32ReentryGuard[Slot_u8])
+            {
+                SchM_Port_au32Msr[Slot_u8] = SchM_Port_GetBasePri();
+                SchM_Port_RaiseBasePri(SchM_Port_au8BasePriCeiling[Slot_u8]);
+            }
+            SchM_Port_au32ReentryGuard[Slot_u8]++;
+            break;
+
+        case SCHM_PORT_LOCK_SPINLOCK:
+            /* Only the owner can see its own context with a non-zero depth */
+            f_Context_u32 = SchM_Port_GetIpsr();
+            if ((0UL == SchM_Port_au32SpinDepth[Slot_u8]) || (f_Context_u32 != SchM_Port_au32SpinOwner[Slot_u8]))
+            {
+                SchM_Port_SpinLock(&SchM_Port_au32SpinLock[Slot_u8]);
+                SchM_Port_au32SpinOwner[Slot_u8] = f_Context_u32;
+            }
+            SchM_Port_au32SpinDepth[Slot_u8]++;
+            break;
+
+        default:
+            /* SCHM_PORT_LOCK_NONE */
+            break;
+    }
+#else
+    pthread_t f_Self = pthread_self();
+
+    if (SCHM_PORT_LOCK_NONE != Lock_u8)
+    {
+        /* Only the owner can see itself with a non-zero depth */
+        if ((0UL == SchM_Port_au32MutexDepth[Slot_u8]) || (0 == pthread_equal(f_Self, SchM_Port_aMutexOwner[Slot_u8])))
+        {
+            (void)pthread_mutex_lock(&SchM_Port_aMutex[Slot_u8]);
+            SchM_Port_aMutexOwner[Slot_u8] = f_Self;
+        }
+        SchM_Port_au32MutexDepth[Slot_u8]++;
+    }
+    else
+    {
+        /* No protection configured */
+    }
+#endif /* SCHM_PORT_TARGET_LOCKS */
+}
+
+/**
+* @brief Releases the lock of a lock slot taken with SchM_Port_EnterLock()
+*/
+static void SchM_Port_ExitLock(uint8 Lock_u8, uint8 Slot_u8)
+{
+#ifdef SCHM_PORT_TARGET_LOCKS
+    switch (Lock_u8)
+    {
+        case SCHM_PORT_LOCK_PRIMASK:
+            SchM_Port_au32ReentryGuard[Slot_u8]--;
+            if (0UL == SchM_Port_au32ReentryGuard[Slot_u8])
+            {
+                Mcal_ResumeAllInterrupts(SchM_Port_au32Msr[Slot_u8]);
+            }
+            break;
+
+        case SCHM_PORT_LOCK_BASEPRI:
+            SchM_Port_au32ReentryGuard[Slot_u8]--;
+            if (0UL == SchM_Port_au32ReentryGuard[Slot_u8])
+            {
+                SchM_Port_SetBasePri(SchM_Port_au32Msr[Slot_u8]);
+            }
+            break;
+
+        case SCHM_PORT_LOCK_SPINLOCK:
+            SchM_Port_au32SpinDepth[Slot_u8]--;
+            if (0UL == SchM_Port_au32SpinDepth[Slot_u8])
+            {
+                SchM_Port_SpinUnlock(&SchM_Port_au32SpinLock[Slot_u8]);
+            }
+            break;
+
+        default:
+            /* SCHM_PORT_LOCK_NONE */
+            break;
+    }
+#else
+    if (SCHM_PORT_LOCK_NONE != Lock_u8)
+    {
+        SchM_Port_au32MutexDepth[Slot_u8]--;
+        if (0UL == SchM_Port_au32MutexDepth[Slot_u8])
+        {
+            (void)pthread_mutex_unlock(&SchM_Port_aMutex[Slot_u8]);
+        }
+    }
+    else
+    {
+        /* No protection configured */
+    }
+#endif /* SCHM_PORT_TARGET_LOCKS */
+}
+
+/*==================================================================================================
+*                                      GLOBAL FUNCTIONS
+==================================================================================================*/
+void SchM_Enter_Port_PortArea(uint8 Area_u8, uint8 PortIndex_u8)
+{
+    SchM_Port_EnterLock(SchM_Port_au8AreaLock[Area_u8], PortIndex_u8);
+}
+
+void SchM_Exit_Port_PortArea(uint8 Area_u8, uint8 PortIndex_u8)
+{
+    SchM_Port_ExitLock(SchM_Port_au8AreaLock[Area_u8], PortIndex_u8);
+}
+
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_00(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_00_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_00(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_00_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_01(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_01_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_01(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_01_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_02(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_02_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_02(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_02_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_00(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_00(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_03(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_03_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_03(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_03_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_01(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_01(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_04(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_04_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_04(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_04_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_02(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_02(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_05(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_05_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_05(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_05_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_03(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_03(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_06(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_06_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_06(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_06_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_04(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_04(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_07(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_07_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_07(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_07_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_05(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_05(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_08(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_08_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_08(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_08_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_06(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_06(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_09_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_09_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_07(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_07(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_10(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_10_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_10(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_10_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_08(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_08(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_11(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_11_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_11(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_11_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_12(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_12_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_12(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_12_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_10(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_10(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_13(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_13_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_13(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_13_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_11(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_11(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_14(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_14_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_14(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_14_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_12(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_12(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_15(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_15_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_15(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_15_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_13(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_13(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_16(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_16_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_16(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_16_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_14(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_14(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_17(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_17_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_17(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_17_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_15(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_15(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_18(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_18_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_18(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_18_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_16(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_16(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_19(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_19_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_19(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_19_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_17(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_17(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_20(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_20_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_20(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_20_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_18(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_18(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_21(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_21_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_21(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_21_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_19(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_19(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_22(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_22_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_22(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_22_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_20(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_20(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_23(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_23_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_23(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_23_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_21(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_21(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_24(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_24_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_24(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_24_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_22(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_22(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_25(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_25_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_25(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_25_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_23(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_23(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_26(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_26_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_26(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_26_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_24(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_24(void){}
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_27(void){ SchM_Port_EnterLock(SCHM_PORT_EXCLUSIVE_AREA_27_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_27(void){ SchM_Port_ExitLock(SCHM_PORT_EXCLUSIVE_AREA_27_LOCK, SCHM_PORT_MODULE_LOCK_U8); }
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_25(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_25(void){}
+#ifdef __cplusplus
+}
+#endif
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_26(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_26(void){}
+/** @} */
 
-void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_27(void){}
-void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_27(void){}
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -41,6 +41,7 @@
 * 2) needed interfaces from  al units
 * 3) internal and  al interfaces from this unit
 ==================================================================================================*/
+#include "Std_Types.h"
 
 /*==================================================================================================
 *                               SOURCE FILE VERSION INFORMATION
@@ -64,6 +65,181 @@
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+/**
+* @brief Lock strategies of an exclusive area
+* @details NONE     - no protection, for areas whose callers never preempt each other.
+*          PRIMASK  - all interrupts suspended (Mcal_SuspendAllInterrupts()).
+*          BASEPRI  - interrupts at or below the priority ceiling of the locked port masked,
+*                     higher priority ISRs keep running.
+*          SPINLOCK - LDREX/STREX lock word per port, interrupts stay enabled. Only for areas
+*                     whose users cannot preempt each other on the same port (deadlock otherwise).
+*          On a host build every strategy other than NONE uses a mutex per port.
+*          Every strategy can be nested by the context that holds the lock slot.
+*/
+#define SCHM_PORT_LOCK_NONE                    (0U)
+#define SCHM_PORT_LOCK_PRIMASK                 (1U)
+#define SCHM_PORT_LOCK_BASEPRI                 (2U)
+#define SCHM_PORT_LOCK_SPINLOCK                (3U)
+
+/**
+* @brief Number of exclusive areas
+*/
+#define SCHM_PORT_NUM_EXCLUSIVE_AREAS          (28U)
+
+/**
+* @brief Lock slots: one per port (PORTA..PORTE) plus the module lock of the areas entered
+*        without a port
+*/
+#define SCHM_PORT_NUM_PORT_LOCKS               (5U)
+#define SCHM_PORT_MODULE_LOCK_U8               ((uint8)SCHM_PORT_NUM_PORT_LOCKS)
+
+/**
+* @brief Exclusive area identifiers for SchM_Enter_Port_PortArea() / SchM_Exit_Port_PortArea()
+*/
+#define SCHM_PORT_EXCLUSIVE_AREA_00          ((uint8)0U)
+#define SCHM_PORT_EXCLUSIVE_AREA_01          ((uint8)1U)
+#define SCHM_PORT_EXCLUSIVE_AREA_02          ((uint8)2U)
+#define SCHM_PORT_EXCLUSIVE_AREA_03          ((uint8)3U)
+#define SCHM_PORT_EXCLUSIVE_AREA_04          ((uint8)4U)
+#define SCHM_PORT_EXCLUSIVE_AREA_05          ((uint8)5U)
+#define SCHM_PORT_EXCLUSIVE_AREA_06          ((uint8)6U)
+#define SCHM_PORT_EXCLUSIVE_AREA_07          ((uint8)7U)
+#define SCHM_PORT_EXCLUSIVE_AREA_08          ((uint8)8U)
+#define SCHM_PORT_EXCLUSIVE_AREA_09          ((uint8)9U)
+#define SCHM_PORT_EXCLUSIVE_AREA_10          ((uint8)10U)
+#define SCHM_PORT_EXCLUSIVE_AREA_11          ((uint8)11U)
+#define SCHM_PORT_EXCLUSIVE_AREA_12          ((uint8)12U)
+#define SCHM_PORT_EXCLUSIVE_AREA_13          ((uint8)13U)
+#define SCHM_PORT_EXCLUSIVE_AREA_14          ((uint8)14U)
+#define SCHM_PORT_EXCLUSIVE_AREA_15          ((uint8)15U)
+#define SCHM_PORT_EXCLUSIVE_AREA_16          ((uint8)16U)
+#define SCHM_PORT_EXCLUSIVE_AREA_17          ((uint8)17U)
+#define SCHM_PORT_EXCLUSIVE_AREA_18          ((uint8)18U)
+#define SCHM_PORT_EXCLUSIVE_AREA_19          ((uint8)19U)
+#define SCHM_PORT_EXCLUSIVE_AREA_20          ((uint8)20U)
+#define SCHM_PORT_EXCLUSIVE_AREA_21          ((uint8)21U)
+#define SCHM_PORT_EXCLUSIVE_AREA_22          ((uint8)22U)
+#define SCHM_PORT_EXCLUSIVE_AREA_23          ((uint8)23U)
+#define SCHM_PORT_EXCLUSIVE_AREA_24          ((uint8)24U)
+#define SCHM_PORT_EXCLUSIVE_AREA_25          ((uint8)25U)
+#define SCHM_PORT_EXCLUSIVE_AREA_26          ((uint8)26U)
+#define SCHM_PORT_EXCLUSIVE_AREA_27          ((uint8)27U)
+
+/**
+* @brief Lock strategy of every exclusive area, can be set from the compiler command line
+*/
+#ifndef SCHM_PORT_LOCK_DEFAULT
+    #define SCHM_PORT_LOCK_DEFAULT             SCHM_PORT_LOCK_PRIMASK
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_00_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_00_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_01_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_01_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_02_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_02_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_03_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_03_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_04_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_04_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_05_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_05_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_06_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_06_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_07_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_07_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_08_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_08_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_09_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_09_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_10_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_10_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_11_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_11_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_12_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_12_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_13_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_13_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_14_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_14_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_15_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_15_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_16_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_16_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_17_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_17_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_18_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_18_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_19_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_19_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_20_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_20_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_21_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_21_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_22_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_22_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_23_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_23_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_24_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_24_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_25_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_25_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_26_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_26_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+#ifndef SCHM_PORT_EXCLUSIVE_AREA_27_LOCK
+    #define SCHM_PORT_EXCLUSIVE_AREA_27_LOCK     SCHM_PORT_LOCK_DEFAULT
+#endif
+
+/**
+* @brief BASEPRI ceiling per port and of the module lock
+* @details Value written to BASEPRI (priority in the upper NVIC_PRIO_BITS bits): every ISR with
+*          this or a numerically higher priority value is masked while the port is locked.
+*          Set the ceiling of a port to the highest priority of the ISRs that use that port.
+*/
+#ifndef SCHM_PORT_BASEPRI_CEILING_PORTA_U8
+    #define SCHM_PORT_BASEPRI_CEILING_PORTA_U8     ((uint8)0x10U)
+#endif
+#ifndef SCHM_PORT_BASEPRI_CEILING_PORTB_U8
+    #define SCHM_PORT_BASEPRI_CEILING_PORTB_U8     ((uint8)0x10U)
+#endif
+#ifndef SCHM_PORT_BASEPRI_CEILING_PORTC_U8
+    #define SCHM_PORT_BASEPRI_CEILING_PORTC_U8     ((uint8)0x10U)
+#endif
+#ifndef SCHM_PORT_BASEPRI_CEILING_PORTD_U8
+    #define SCHM_PORT_BASEPRI_CEILING_PORTD_U8     ((uint8)0x10U)
+#endif
+#ifndef SCHM_PORT_BASEPRI_CEILING_PORTE_U8
+    #define SCHM_PORT_BASEPRI_CEILING_PORTE_U8     ((uint8)0x10U)
+#endif
+#ifndef SCHM_PORT_BASEPRI_CEILING_MODULE_U8
+    #define SCHM_PORT_BASEPRI_CEILING_MODULE_U8    ((uint8)0x10U)
+#endif
 
 
 /*==================================================================================================
@@ -104,6 +280,28 @@
 void SchM_Check_port(void);
 #endif /*MCAL_TESTING_ENVIRONMENT*/
 
+/**
+@brief   Enters an exclusive area for one port
+@details Takes the lock of PortIndex_u8 with the strategy configured for Area_u8
+         (SCHM_PORT_EXCLUSIVE_AREA_xx_LOCK). Users of different ports do not block each other
+         except with SCHM_PORT_LOCK_PRIMASK. The context holding a port may enter it again
+         (same or other area); the lock is released by its last exit.
+
+@param[in]     Area_u8        Exclusive area, SCHM_PORT_EXCLUSIVE_AREA_xx
+@param[in]     PortIndex_u8   Port (0 = PORTA ... 4 = PORTE)
+@return        void
+*/
+void SchM_Enter_Port_PortArea(uint8 Area_u8, uint8 PortIndex_u8);
+
+/**
+@brief   Exits an exclusive area entered with SchM_Enter_Port_PortArea()
+
+@param[in]     Area_u8        Exclusive area, SCHM_PORT_EXCLUSIVE_AREA_xx
+@param[in]     PortIndex_u8   Port (0 = PORTA ... 4 = PORTE)
+@return        void
+*/
+void SchM_Exit_Port_PortArea(uint8 Area_u8, uint8 PortIndex_u8);
+
 void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_00(void);
 void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_00(void);
 
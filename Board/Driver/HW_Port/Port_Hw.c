@@ -37,6 +37,14 @@ extern "C" {
 #include "Port.h"
 #include "S32K144.h"
 #include "SchM_Port.h"
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+#if !defined(__ARM_ARCH_7EM__) && !defined(__ARM_ARCH_7M__)
+    #if defined(__STDC_NO_ATOMICS__) || !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 201112L)
+        #error "PORT_HW_ATOMIC_RMW on a host build needs C11 atomics"
+    #endif
+#include <stdatomic.h>
+#endif
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
 ==================================================================================================*/
@@ -79,10 +87,37 @@ extern "C" {
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (STD_ON == PORT_HW_GROUPED_PCR_INIT)
+/**
+* @brief   PCR group used by the grouped initialization
+* @details All pins of one port in @p PinMask_u32 receive the same @p PcrValue_u32
+*/
+typedef struct PortHw_PcrGroupType_t
+{
+    uint32 PinMask_u32;     /**< @brief Pins of the port sharing the PCR value */
+    uint32 PcrValue_u32;    /**< @brief PCR value of the group */
+} PortHw_PcrGroupType;
+#endif /* (STD_ON == PORT_HW_GROUPED_PCR_INIT) */
 
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+/**
+* @brief Pins of the lower half of a port (GPCLR)
+*/
+#define PORT_HW_LOWER_HALF_MASK_U32        ((uint32)0x0000FFFFU)
+
+/**
+* @brief Shift of the upper half of a port (GPCHR)
+*/
+#define PORT_HW_UPPER_HALF_SHIFT_U32       ((uint32)16U)
+
+#if (STD_ON == PORT_HW_WARM_INIT)
+/**
+* @brief PCR bits compared by the warm initialization (ISF is a status flag)
+*/
+#define PORT_HW_PCR_COMPARE_MASK_U32       (~(uint32)PORT_PCR_ISF_MASK)
+#endif /* (STD_ON == PORT_HW_WARM_INIT) */
 
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
@@ -132,309 +167,1157 @@ GPIO_Type* const PortHw_g_GpioBaseAddr_ptr[PORT_HW_PORT_COUNT_U8] =
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
-/**
-* @brief       Initializes a single pin with the given configuration
-*
-* @details     Internal function to configure one pin with all its settings
-*
-* @param[in]   Config_ptr  Pointer to pin configuration structure
-*
-* @return      void
-*/
 #define PORT_START_SEC_CODE
 #include "Port_MemMap.h"
-static void PortHw_PinInit(const PortHw_PinSettingsConfigType* Config_ptr);
+static void PortHw_PinInitGpio(
+    const PortHw_PinTableType* Table_ptr,
+    uint32 PinIndex_u32
+);
+
+#if (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT)
+static void PortHw_InitGpioAggregated(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr
+);
+#endif /* (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT) */
+
+#if (STD_ON == PORT_HW_GROUPED_PCR_INIT)
+static void PortHw_InitPcrGrouped(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr
+);
+#endif /* (STD_ON == PORT_HW_GROUPED_PCR_INIT) */
 
 static void PortHw_Init_UnusedPins(
-    uint16 NumUnusedPins_u16,
-    const uint16* UnusedPads_ptr,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+);
+
+#if (STD_ON == PORT_HW_WARM_INIT)
+static uint32 PortHw_InitWarmPort(
+    uint8 PortIndex_u8,
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    uint32 UnusedPadMask_u32,
     const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
 );
+#endif /* (STD_ON == PORT_HW_WARM_INIT) */
+
+#if (STD_OFF == PORT_HW_ATOMIC_RMW) && (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS)
+static uint8 PortHw_GetPortIndex(const PORT_Type* Base_ptr);
+static uint8 PortHw_GetGpioPortIndex(const GPIO_Type* Base_ptr);
+#endif /* (STD_OFF == PORT_HW_ATOMIC_RMW) && (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS) */
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
 ==================================================================================================*/
 /**
-* @brief       Initializes a single pin with the given configuration
-* @details     This internal function configures a single pin including:
-*              - Pull configuration
-*              - Drive strength
-*              - Lock register
-*              - Passive filter
-*              - Mux mode
-*              - Digital filter
-*              - GPIO direction and initial value
-*
-* @param[in]   Config_ptr  Pointer to pin configuration structure
+* @brief       Configures the GPIO part of a single pin
+* @details     Sets the initial output level and the direction of a GPIO pin.
+*              Pins not muxed as GPIO are left untouched. Reads the pad id and the flags of
+*              the pin only.
+*
+* @param[in]   Table_ptr     Pointer to the pin table
+* @param[in]   PinIndex_u32  Index of the pin in the table
 *
 * @return      void
 */
-static void PortHw_PinInit(const PortHw_PinSettingsConfigType* Config_ptr)
+static void PortHw_PinInitGpio(
+    const PortHw_PinTableType* Table_ptr,
+    uint32 PinIndex_u32
+)
 {
-    uint32 f_PinsValues_u32 = 0U;
-
-    /* Validate input parameters */
-    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
-    PORT_HW_DEV_ASSERT(Config_ptr->PinPortIndex_u32 < PORT_HW_PINS_PER_PORT_U8);
-    /* Check if pin is not locked before configuring */
-    PORT_HW_DEV_ASSERT((Config_ptr->PortBase_ptr->PCR[Config_ptr->PinPortIndex_u32] & PORT_PCR_LK_MASK) == 0U);
-
-    /* Configure pull resistor */
-    if (Config_ptr->PullConfig_en != PORT_HW_PULL_NOT_ENABLED)
-    {
-        f_PinsValues_u32 |= PORT_PCR_PE(1U);
-        f_PinsValues_u32 |= PORT_PCR_PS(Config_ptr->PullConfig_en);
-    }
-
-    /* Configure drive strength */
-    f_PinsValues_u32 |= PORT_PCR_DSE(Config_ptr->DriveStrength_en);
-
-    /* Configure lock register */
-    f_PinsValues_u32 |= PORT_PCR_LK(Config_ptr->LockRegister_en);
-
-    /* Configure pin mux */
-    f_PinsValues_u32 |= PORT_PCR_MUX(Config_ptr->Mux_en);
+    uint8 f_Flags_u8 = Table_ptr->Flags_ptr[PinIndex_u32];
+    uint32 f_Pad_u32;
+    uint32 f_PinMask_u32;
+    GPIO_Type* f_GpioBase_ptr;
 
     /* Configure GPIO if mux is set to GPIO mode */
-    if (PORT_HW_MUX_AS_GPIO == Config_ptr->Mux_en)
+    if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_GPIO_U8))
     {
+        f_Pad_u32 = Table_ptr->PadId_ptr[PinIndex_u32];
+        f_PinMask_u32 = (1UL << PORT_HW_GET_PIN_U32(f_Pad_u32));
+        f_GpioBase_ptr = PortHw_g_GpioBaseAddr_ptr[PORT_HW_GET_PORT_U32(f_Pad_u32)];
+
         /* Configure output direction */
-        if (PORT_HW_PIN_OUT == Config_ptr->Direction_en)
+        if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(f_Flags_u8))
         {
             /* Set initial output value */
-            if ((uint8)1U == Config_ptr->InitValue_u8)
+            if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_LEVEL_HIGH_U8))
             {
                 SchM_Enter_Port_PORT_EXCLUSIVE_AREA_01();
-                Config_ptr->GpioBase_ptr->PSOR = (1UL << Config_ptr->PinPortIndex_u32);
+                PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PSOR, f_PinMask_u32);
                 SchM_Exit_Port_PORT_EXCLUSIVE_AREA_01();
             }
-            else if((uint8)0U == Config_ptr->InitValue_u8)
+            else
             {
                 SchM_Enter_Port_PORT_EXCLUSIVE_AREA_02();
-                Config_ptr->GpioBase_ptr->PCOR = (1UL << Config_ptr->PinPortIndex_u32);
+                PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PCOR, f_PinMask_u32);
                 SchM_Exit_Port_PORT_EXCLUSIVE_AREA_02();
             }
-            else
-            {
-                /* No action to be done */
-            }
 
             /* Set pin direction as output */
-            Config_ptr->GpioBase_ptr->PDDR |= (1UL << Config_ptr->PinPortIndex_u32);
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR) | f_PinMask_u32);
         }
         /* Configure input or high-z direction */
         else
         {
             /* Clear pin direction (set as input) */
-            Config_ptr->GpioBase_ptr->PDDR &= ~(1UL << Config_ptr->PinPortIndex_u32);
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR) & ~f_PinMask_u32);
 
             /* Enable input for normal input mode */
-            Config_ptr->GpioBase_ptr->PIDR &= ~(1UL << Config_ptr->PinPortIndex_u32);
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PIDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PIDR) & ~f_PinMask_u32);
 
         }
     }
-
-    /* Write configuration to PCR register */
-    Config_ptr->PortBase_ptr->PCR[Config_ptr->PinPortIndex_u32] = f_PinsValues_u32;
 }
 
-/*==================================================================================================
-*                                       GLOBAL FUNCTIONS
-==================================================================================================*/
-/*FUNCTION**********************************************************************
+#if (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT)
+/**
+* @brief       Configures the GPIO part of all configured pins, one port at a time
+* @details     Output levels, output directions and input directions of all GPIO pins are
+*              collected into masks per port in one pass over the pad ids and flags. Every
+*              GPIO block is then written once: PSOR and PCOR with the initial levels, PDDR
+*              and PIDR with one read-modify-write each, so the cost depends on the number of
+*              ports instead of the number of pins.
 *
-* Function Name : PortHw_Init
-* Description   : Initializes multiple pins with the given configuration array
-*                 and unused pins configuration
+* @param[in]   PinCount_u32  Number of pins to configure
+* @param[in]   Table_ptr     Pointer to the pin table
 *
-* @implements PortHw_Init_Activity
-******************************************************************************/
-void PortHw_Init(
+* @return      void
+*/
+static void PortHw_InitGpioAggregated(
     uint32 PinCount_u32,
-    const PortHw_PinSettingsConfigType Config_ptr[],
-    uint16 NumUnusedPins_u16,
-    const uint16* UnusedPads_ptr,
-    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+    const PortHw_PinTableType* Table_ptr
 )
 {
-    uint32 f_Index_u32;
+    uint32 f_SetMask_au32[PORT_HW_PORT_COUNT_U8];
+    uint32 f_ClearMask_au32[PORT_HW_PORT_COUNT_U8];
+    uint32 f_OutputMask_au32[PORT_HW_PORT_COUNT_U8];
+    uint32 f_InputMask_au32[PORT_HW_PORT_COUNT_U8];
+    uint32 f_PinMask_u32;
+    uint32 f_PinIndex_u32;
+    uint32 f_Pad_u32;
+    uint8  f_Flags_u8;
+    uint8  f_PortIndex_u8;
+    GPIO_Type* f_GpioBase_ptr;
+
+    for (f_PortIndex_u8 = 0U; f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8; f_PortIndex_u8++)
+    {
+        f_SetMask_au32[f_PortIndex_u8] = 0U;
+        f_ClearMask_au32[f_PortIndex_u8] = 0U;
+        f_OutputMask_au32[f_PortIndex_u8] = 0U;
+        f_InputMask_au32[f_PortIndex_u8] = 0U;
+    }
 
-    /* Validate input parameters */
-    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
-    PORT_HW_DEV_ASSERT(PinCount_u32 > 0U);
+    /* Collect the GPIO settings of every port */
+    for (f_PinIndex_u32 = 0U; f_PinIndex_u32 < PinCount_u32; f_PinIndex_u32++)
+    {
+        f_Flags_u8 = Table_ptr->Flags_ptr[f_PinIndex_u32];
+        if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_GPIO_U8))
+        {
+            f_Pad_u32 = Table_ptr->PadId_ptr[f_PinIndex_u32];
+            f_PortIndex_u8 = (uint8)PORT_HW_GET_PORT_U32(f_Pad_u32);
+            f_PinMask_u32 = (1UL << PORT_HW_GET_PIN_U32(f_Pad_u32));
+            if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(f_Flags_u8))
+            {
+                f_OutputMask_au32[f_PortIndex_u8] |= f_PinMask_u32;
+                if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_LEVEL_HIGH_U8))
+                {
+                    f_SetMask_au32[f_PortIndex_u8] |= f_PinMask_u32;
+                }
+                else
+                {
+                    f_ClearMask_au32[f_PortIndex_u8] |= f_PinMask_u32;
+                }
+            }
+            else
+            {
+                f_InputMask_au32[f_PortIndex_u8] |= f_PinMask_u32;
+            }
+        }
+    }
 
-    /* Initialize each configured pin with its configuration */
-    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+    /* One access per register of the GPIO block */
+    for (f_PortIndex_u8 = 0U; f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8; f_PortIndex_u8++)
     {
-        PortHw_PinInit(&Config_ptr[f_Index_u32]);
+        if (0U != (f_OutputMask_au32[f_PortIndex_u8] | f_InputMask_au32[f_PortIndex_u8]))
+        {
+            f_GpioBase_ptr = PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u8];
+            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_01();
+            if (0U != f_SetMask_au32[f_PortIndex_u8])
+            {
+                PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PSOR, f_SetMask_au32[f_PortIndex_u8]);
+            }
+            if (0U != f_ClearMask_au32[f_PortIndex_u8])
+            {
+                PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PCOR, f_ClearMask_au32[f_PortIndex_u8]);
+            }
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, (PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR) & ~f_InputMask_au32[f_PortIndex_u8]) |
+                                                       f_OutputMask_au32[f_PortIndex_u8]);
+            if (0U != f_InputMask_au32[f_PortIndex_u8])
+            {
+                /* Enable input for normal input mode */
+                PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PIDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PIDR) & ~f_InputMask_au32[f_PortIndex_u8]);
+            }
+            SchM_Exit_Port_PORT_EXCLUSIVE_AREA_01();
+        }
     }
+}
+#endif /* (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT) */
 
-    /* Initialize All Unused Port Pins */
-    if ((NumUnusedPins_u16 > 0U) && (UnusedPads_ptr != NULL_PTR) && (UnusedPadConfig_ptr != NULL_PTR))
+#if (STD_ON == PORT_HW_GROUPED_PCR_INIT)
+/**
+* @brief       Writes the PCRs of all configured pins grouped by port and value
+* @details     For every port, pins with an identical PCR value are merged into one group.
+*              Each group costs one GPCLR write for pins 0-15 and one GPCHR write for
+*              pins 16-31, instead of one PCR write per pin. Pins whose PCR value uses the
+*              upper half (IRQC) are written through their PCR. Reads the pad ids and the PCR
+*              words only.
+*
+* @param[in]   PinCount_u32  Number of pins to configure
+* @param[in]   Table_ptr     Pointer to the pin table
+*
+* @return      void
+*/
+static void PortHw_InitPcrGrouped(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr
+)
+{
+    PortHw_PcrGroupType f_Groups_ast[PORT_HW_PINS_PER_PORT_U8];
+    uint32 f_GroupCount_u32;
+    uint32 f_GroupIndex_u32;
+    uint32 f_PinIndex_u32;
+    uint32 f_PcrValue_u32;
+    uint32 f_HalfMask_u32;
+    uint32 f_Pad_u32;
+    uint8  f_PortIndex_u8;
+    PORT_Type* f_PortBase_ptr;
+
+    for (f_PortIndex_u8 = 0U; f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8; f_PortIndex_u8++)
     {
-        PortHw_Init_UnusedPins(NumUnusedPins_u16, UnusedPads_ptr, UnusedPadConfig_ptr);
+        f_PortBase_ptr = PortHw_g_PortBaseAddr_ptr[f_PortIndex_u8];
+        f_GroupCount_u32 = 0U;
+
+        /* Collect the pins of this port by PCR value */
+        for (f_PinIndex_u32 = 0U; f_PinIndex_u32 < PinCount_u32; f_PinIndex_u32++)
+        {
+            f_Pad_u32 = Table_ptr->PadId_ptr[f_PinIndex_u32];
+            if (f_PortIndex_u8 != PORT_HW_GET_PORT_U32(f_Pad_u32))
+            {
+                /* Pin of another port */
+            }
+            else if (0U != (Table_ptr->Pcr_ptr[f_PinIndex_u32] >> PORT_HW_UPPER_HALF_SHIFT_U32))
+            {
+                /* IRQC is outside the global pin control data, write the whole PCR */
+                PORT_HW_REG_WRITE32(&f_PortBase_ptr->PCR[PORT_HW_GET_PIN_U32(f_Pad_u32)], Table_ptr->Pcr_ptr[f_PinIndex_u32]);
+            }
+            else
+            {
+                f_PcrValue_u32 = Table_ptr->Pcr_ptr[f_PinIndex_u32];
+                f_GroupIndex_u32 = 0U;
+                while ((f_GroupIndex_u32 < f_GroupCount_u32) && (f_PcrValue_u32 != f_Groups_ast[f_GroupIndex_u32].PcrValue_u32))
+                {
+                    f_GroupIndex_u32++;
+                }
+
+                /* At most one group per pin, so the table cannot overflow */
+                if (f_GroupIndex_u32 == f_GroupCount_u32)
+                {
+                    f_Groups_ast[f_GroupIndex_u32].PcrValue_u32 = f_PcrValue_u32;
+                    f_Groups_ast[f_GroupIndex_u32].PinMask_u32 = 0U;
+                    f_GroupCount_u32++;
+                }
+                else
+                {
+                    /* Pin joins an existing group */
+                }
+                f_Groups_ast[f_GroupIndex_u32].PinMask_u32 |= (1UL << PORT_HW_GET_PIN_U32(f_Pad_u32));
+            }
+        }
+
+        /* One global pin control write per group and port half */
+        for (f_GroupIndex_u32 = 0U; f_GroupIndex_u32 < f_GroupCount_u32; f_GroupIndex_u32++)
+        {
+            f_HalfMask_u32 = f_Groups_ast[f_GroupIndex_u32].PinMask_u32 & PORT_HW_LOWER_HALF_MASK_U32;
+            if (0U != f_HalfMask_u32)
+            {
+                PortHw_SetGlobalPinControl(f_PortBase_ptr, (uint16)f_HalfMask_u32,
+                                           (uint16)f_Groups_ast[f_GroupIndex_u32].PcrValue_u32, PORT_HW_GLOBAL_LOWER_HALF);
+            }
+
+            f_HalfMask_u32 = f_Groups_ast[f_GroupIndex_u32].PinMask_u32 >> PORT_HW_UPPER_HALF_SHIFT_U32;
+            if (0U != f_HalfMask_u32)
+            {
+                PortHw_SetGlobalPinControl(f_PortBase_ptr, (uint16)f_HalfMask_u32,
+                                           (uint16)f_Groups_ast[f_GroupIndex_u32].PcrValue_u32, PORT_HW_GLOBAL_UPPER_HALF);
+            }
+        }
     }
 }
+#endif /* (STD_ON == PORT_HW_GROUPED_PCR_INIT) */
 
-/*FUNCTION**********************************************************************
+#if (STD_ON == PORT_HW_WARM_INIT)
+/**
+* @brief       Warm initialization of one port
+* @details     First pass reads the PCRs of the configured and unused pins of the port and
+*              OR-folds their differences from the configured words into one signature, then
+*              reads PDOR, PDDR and PIDR. The signature is zero exactly when every PCR already
+*              matches, so the common warm case needs no per-pin decision. Otherwise a second
+*              pass rewrites the mismatching PCRs only. GPIO registers are written in the order
+*              of the cold init (level, direction, input disable) and only when they differ.
 *
-* Function Name : PortHw_Init_UnusedPins
-* Description   : Initializes all unused port pins with the configuration
-*                 set pointed to by the parameter UnusedPadConfig_ptr
+* @param[in]   PortIndex_u8        Port index
+* @param[in]   PinCount_u32        Number of pins to configure
+* @param[in]   Table_ptr           Pointer to the pin table
+* @param[in]   UnusedPadMask_u32   Unused pads of the port (0 if none)
+* @param[in]   UnusedPadConfig_ptr Pointer to unused pad configuration
 *
-* @implements PortHw_Init_UnusedPins_Activity
-******************************************************************************/
-static void PortHw_Init_UnusedPins(
-    uint16 NumUnusedPins_u16,
-    const uint16* UnusedPads_ptr,
+* @return      uint32  Number of register writes skipped on this port
+*/
+static uint32 PortHw_InitWarmPort(
+    uint8 PortIndex_u8,
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    uint32 UnusedPadMask_u32,
     const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
 )
 {
-    uint16 f_PinIndex_u16;
-    uint32 f_PortIndex_u32;
-    uint32 f_PinInPort_u32;
-    uint8  f_OutputValue_u8;
+    PORT_Type* f_PortBase_ptr = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+    GPIO_Type* f_GpioBase_ptr = PortHw_g_GpioBaseAddr_ptr[PortIndex_u8];
+    uint32 f_Signature_u32 = 0U;
+    uint32 f_SetMask_u32 = 0U;
+    uint32 f_ClearMask_u32 = 0U;
+    uint32 f_OutputMask_u32 = 0U;
+    uint32 f_InputMask_u32 = 0U;
+    uint32 f_PinMask_u32;
+    uint32 f_Index_u32;
+    uint32 f_Pin_u32;
     uint32 f_PcrValue_u32;
-    PortHw_DirectionType f_Direction_en;
-
-    /* Get unused pin configuration */
-    f_OutputValue_u8 = UnusedPadConfig_ptr->OutputValue_u8;
-    f_PcrValue_u32   = UnusedPadConfig_ptr->PinControlRegister_u32;
-    f_Direction_en   = UnusedPadConfig_ptr->Direction_en;
+    uint32 f_Skipped_u32 = 0U;
+    uint32 f_Pdor_u32;
+    uint32 f_Pddr_u32;
+    uint32 f_Pidr_u32;
+    uint32 f_Pad_u32;
+    uint8  f_Flags_u8;
+
+    /* Burst read: configured pins */
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+    {
+        f_Pad_u32 = Table_ptr->PadId_ptr[f_Index_u32];
+        if (PortIndex_u8 == PORT_HW_GET_PORT_U32(f_Pad_u32))
+        {
+            f_Pin_u32 = PORT_HW_GET_PIN_U32(f_Pad_u32);
+            f_Flags_u8 = Table_ptr->Flags_ptr[f_Index_u32];
+            f_Signature_u32 |= PORT_HW_REG_READ32(&f_PortBase_ptr->PCR[f_Pin_u32]) ^ Table_ptr->Pcr_ptr[f_Index_u32];
+            if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_GPIO_U8))
+            {
+                f_PinMask_u32 = (1UL << f_Pin_u32);
+                if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(f_Flags_u8))
+                {
+                    f_OutputMask_u32 |= f_PinMask_u32;
+                    if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_LEVEL_HIGH_U8))
+                    {
+                        f_SetMask_u32 |= f_PinMask_u32;
+                    }
+                    else
+                    {
+                        f_ClearMask_u32 |= f_PinMask_u32;
+                    }
+                }
+                else
+                {
+                    f_InputMask_u32 |= f_PinMask_u32;
+                }
+            }
+        }
+    }
 
-    /* Initialize All UnUsed pins */
-    for (f_PinIndex_u16 = 0U; f_PinIndex_u16 < NumUnusedPins_u16; f_PinIndex_u16++)
+    /* Burst read: unused pads */
+    if (0U != UnusedPadMask_u32)
     {
-        /* Get port index and pin index within the port */
-        f_PortIndex_u32 = PORT_HW_GET_PORT_U32(UnusedPads_ptr[f_PinIndex_u16]);
-        f_PinInPort_u32 = PORT_HW_GET_PIN_U32(UnusedPads_ptr[f_PinIndex_u16]);
+        for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+        {
+            if (0U != (UnusedPadMask_u32 & (1UL << f_Pin_u32)))
+            {
+                f_Signature_u32 |= PORT_HW_REG_READ32(&f_PortBase_ptr->PCR[f_Pin_u32]) ^ UnusedPadConfig_ptr->PinControlRegister_u32;
+            }
+        }
 
-        /* Check if the direction of the pin is OUTPUT */
-        if (PORT_HW_PIN_OUT == f_Direction_en)
+        if (PORT_HW_PIN_OUT == UnusedPadConfig_ptr->Direction_en)
         {
-            /* Set pin to High value */
-            if ((uint8)1U == f_OutputValue_u8)
+            f_OutputMask_u32 |= UnusedPadMask_u32;
+            if ((uint8)1U == UnusedPadConfig_ptr->OutputValue_u8)
             {
-                SchM_Enter_Port_PORT_EXCLUSIVE_AREA_03();
-                PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u32]->PSOR = ((uint32)1U << f_PinInPort_u32);
-                SchM_Exit_Port_PORT_EXCLUSIVE_AREA_03();
+                f_SetMask_u32 |= UnusedPadMask_u32;
             }
-            else if ((uint8)0U == f_OutputValue_u8)
+            else if ((uint8)0U == UnusedPadConfig_ptr->OutputValue_u8)
             {
-                SchM_Enter_Port_PORT_EXCLUSIVE_AREA_04();
-                PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u32]->PCOR = ((uint32)1U << f_PinInPort_u32);
-                SchM_Exit_Port_PORT_EXCLUSIVE_AREA_04();
+                f_ClearMask_u32 |= UnusedPadMask_u32;
             }
             else
             {
                 /* No action to be done */
             }
+        }
+        else
+        {
+            f_InputMask_u32 |= UnusedPadMask_u32;
+        }
+    }
+
+    f_Pdor_u32 = PORT_HW_REG_READ32(&f_GpioBase_ptr->PDOR);
+    f_Pddr_u32 = PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR);
+    f_Pidr_u32 = PORT_HW_REG_READ32(&f_GpioBase_ptr->PIDR);
 
-            /* Set pin as output */
-            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_05();
-            PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u32]->PDDR |= ((uint32)1U << f_PinInPort_u32);
-            SchM_Exit_Port_PORT_EXCLUSIVE_AREA_05();
+    /* GPIO: level, direction, input disable, each only when it differs */
+    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_01();
+    if (0U != f_SetMask_u32)
+    {
+        if (f_SetMask_u32 != (f_Pdor_u32 & f_SetMask_u32))
+        {
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PSOR, f_SetMask_u32);
+        }
+        else
+        {
+            f_Skipped_u32++;
+        }
+    }
+    if (0U != f_ClearMask_u32)
+    {
+        if (0U != (f_Pdor_u32 & f_ClearMask_u32))
+        {
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PCOR, f_ClearMask_u32);
+        }
+        else
+        {
+            f_Skipped_u32++;
+        }
+    }
+    if (0U != (f_OutputMask_u32 | f_InputMask_u32))
+    {
+        if (f_OutputMask_u32 != (f_Pddr_u32 & (f_OutputMask_u32 | f_InputMask_u32)))
+        {
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, (f_Pddr_u32 & ~f_InputMask_u32) | f_OutputMask_u32);
+        }
+        else
+        {
+            f_Skipped_u32++;
+        }
+    }
+    if (0U != f_InputMask_u32)
+    {
+        if (0U != (f_Pidr_u32 & f_InputMask_u32))
+        {
+            /* Enable input for normal input mode */
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PIDR, f_Pidr_u32 & ~f_InputMask_u32);
         }
-        /* The direction of pin is INPUT */
         else
         {
-            /* Set pin as input */
-            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_06();
-            PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u32]->PDDR &= ~((uint32)1U << f_PinInPort_u32);
-            SchM_Exit_Port_PORT_EXCLUSIVE_AREA_06();
-
-            /* Enable input */
-            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_07();
-            PortHw_g_GpioBaseAddr_ptr[f_PortIndex_u32]->PIDR &= ~((uint32)1U << f_PinInPort_u32);
-            SchM_Exit_Port_PORT_EXCLUSIVE_AREA_07();
+            f_Skipped_u32++;
         }
+    }
+    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_01();
 
-        /* Write PCR configuration from Configuration tool */
-        PortHw_g_PortBaseAddr_ptr[f_PortIndex_u32]->PCR[f_PinInPort_u32] = f_PcrValue_u32;
+    /* PCR: nothing to compare per pin when the port signature matches */
+    if (0U == (f_Signature_u32 & PORT_HW_PCR_COMPARE_MASK_U32))
+    {
+        for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+        {
+            if (PortIndex_u8 == PORT_HW_GET_PORT_U32(Table_ptr->PadId_ptr[f_Index_u32]))
+            {
+                f_Skipped_u32++;
+            }
+        }
+        for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+        {
+            f_Skipped_u32 += (UnusedPadMask_u32 >> f_Pin_u32) & 1UL;
+        }
+    }
+    else
+    {
+        for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+        {
+            f_Pad_u32 = Table_ptr->PadId_ptr[f_Index_u32];
+            if (PortIndex_u8 == PORT_HW_GET_PORT_U32(f_Pad_u32))
+            {
+                f_Pin_u32 = PORT_HW_GET_PIN_U32(f_Pad_u32);
+                f_PcrValue_u32 = Table_ptr->Pcr_ptr[f_Index_u32];
+                if (0U != ((PORT_HW_REG_READ32(&f_PortBase_ptr->PCR[f_Pin_u32]) ^ f_PcrValue_u32) & PORT_HW_PCR_COMPARE_MASK_U32))
+                {
+                    PORT_HW_DEV_ASSERT((f_PortBase_ptr->PCR[f_Pin_u32] & PORT_PCR_LK_MASK) == 0U);
+                    PORT_HW_REG_WRITE32(&f_PortBase_ptr->PCR[f_Pin_u32], f_PcrValue_u32);
+                }
+                else
+                {
+                    f_Skipped_u32++;
+                }
+            }
+        }
+        for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+        {
+            if (0U != (UnusedPadMask_u32 & (1UL << f_Pin_u32)))
+            {
+                f_PcrValue_u32 = UnusedPadConfig_ptr->PinControlRegister_u32;
+                if (0U != ((PORT_HW_REG_READ32(&f_PortBase_ptr->PCR[f_Pin_u32]) ^ f_PcrValue_u32) & PORT_HW_PCR_COMPARE_MASK_U32))
+                {
+                    PORT_HW_REG_WRITE32(&f_PortBase_ptr->PCR[f_Pin_u32], f_PcrValue_u32);
+                }
+                else
+                {
+                    f_Skipped_u32++;
+                }
+            }
+        }
     }
+
+    return f_Skipped_u32;
 }
+#endif /* (STD_ON == PORT_HW_WARM_INIT) */
 
+#if (STD_OFF == PORT_HW_ATOMIC_RMW) && (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS)
 /*FUNCTION**********************************************************************
 *
-* Function Name : PortHw_SetMuxModeSel
-* Description   : Configures the pin multiplexing (alternate function)
-*                 Based on Port_Ipw_SetPinMode
+* Function Name : PortHw_GetPortIndex
+* Description   : Returns the index of a PORT base address (lock slot of the port)
 *
-* @implements PortHw_SetMuxModeSel_Activity
 ******************************************************************************/
-void PortHw_SetMuxModeSel(
-    PORT_Type* const Base_ptr,
-    uint32 Pin_u32,
-    PortHw_MuxType Mux_en
-)
+static uint8 PortHw_GetPortIndex(const PORT_Type* Base_ptr)
 {
-    uint32 f_RegValue_u32;
+    uint8 f_PortIndex_u8 = PORT_HW_PORT_INDEX_U8(Base_ptr);
 
-    /* Validate input parameters */
-    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
-    PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
-    PORT_HW_DEV_ASSERT((Base_ptr->PCR[Pin_u32] & PORT_PCR_LK_MASK) == 0U);
+    PORT_HW_DEV_ASSERT(f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
 
-    /* Enter critical section - Sets the port pin mode */
-    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_08();
+    return f_PortIndex_u8;
+}
 
-    /* Read current PCR value, modify MUX field, write back */
-    f_RegValue_u32 = Base_ptr->PCR[Pin_u32];
-    f_RegValue_u32 &= ~PORT_PCR_MUX_MASK;
-    f_RegValue_u32 |= PORT_PCR_MUX(Mux_en);
-    Base_ptr->PCR[Pin_u32] = f_RegValue_u32;
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_GetGpioPortIndex
+* Description   : Returns the index of a GPIO base address (lock slot of the port)
+*
+******************************************************************************/
+static uint8 PortHw_GetGpioPortIndex(const GPIO_Type* Base_ptr)
+{
+    uint8 f_PortIndex_u8 = PORT_HW_GPIO_INDEX_U8(Base_ptr);
 
-    /* Exit critical section */
-    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_08();
+    PORT_HW_DEV_ASSERT(f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
+
+    return f_PortIndex_u8;
 }
+#endif /* (STD_OFF == PORT_HW_ATOMIC_RMW) && (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS) */
 
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
 /*FUNCTION**********************************************************************
 *
-* Function Name : PortHw_SetPinDirection
-* Description   : Sets the direction of a GPIO pin
-*                 Based on Port_Ipw_SetPinDirection
+* Function Name : PortHw_Init
+* Description   : Initializes multiple pins with the given configuration array
+*                 and unused pins configuration
 *
-* @implements PortHw_SetPinDirection_Activity
+* @implements PortHw_Init_Activity
 ******************************************************************************/
-void PortHw_SetPinDirection(
-    GPIO_Type* const Base_ptr,
-    uint32 Pin_u32,
-    PortHw_DirectionType Direction_en
+void PortHw_Init(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    uint16 NumUnusedPins_u16,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
 )
 {
+    uint32 f_Index_u32;
+
     /* Validate input parameters */
-    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
-    PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
+    PORT_HW_DEV_ASSERT(Table_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(PinCount_u32 > 0U);
 
-    /* Configures Port Pin as Output */
-    if (PORT_HW_PIN_OUT == Direction_en)
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
     {
-        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
-        Base_ptr->PDDR |= ((uint32)1UL << Pin_u32);
-        SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+        PORT_HW_DEV_ASSERT(PORT_HW_GET_PORT_U32(Table_ptr->PadId_ptr[f_Index_u32]) < PORT_HW_PORT_COUNT_U8);
+        /* Check if pin is not locked before configuring */
+        PORT_HW_DEV_ASSERT((PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(Table_ptr->PadId_ptr[f_Index_u32])]->PCR[PORT_HW_GET_PIN_U32(Table_ptr->PadId_ptr[f_Index_u32])] & PORT_PCR_LK_MASK) == 0U);
+        PORT_HW_DEV_ASSERT(((uint32)PORT_HW_MUX_AS_GPIO == PORT_HW_PCR_MUX_U32(Table_ptr->Pcr_ptr[f_Index_u32])) ==
+                           (0U != (Table_ptr->Flags_ptr[f_Index_u32] & PORT_HW_PIN_FLAG_GPIO_U8)));
     }
-    /* Configures Port Pin as Input or High-Z */
-    else if (PORT_HW_PIN_IN == Direction_en)
+
+    /* Output levels and directions first, so outputs do not glitch when they are muxed */
+#if (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT)
+    PortHw_InitGpioAggregated(PinCount_u32, Table_ptr);
+#else
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
     {
-        /* Set pin as input - clear direction bit */
-        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
-        Base_ptr->PDDR &= ~((uint32)1UL << Pin_u32);
-        SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+        PortHw_PinInitGpio(Table_ptr, f_Index_u32);
+    }
+#endif /* (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT) */
+
+    /* Then the precomputed PCR words */
+#if (STD_ON == PORT_HW_GROUPED_PCR_INIT)
+    PortHw_InitPcrGrouped(PinCount_u32, Table_ptr);
+#else
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+    {
+        PORT_HW_REG_WRITE32(&PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(Table_ptr->PadId_ptr[f_Index_u32])]->PCR[PORT_HW_GET_PIN_U32(Table_ptr->PadId_ptr[f_Index_u32])],
+                            Table_ptr->Pcr_ptr[f_Index_u32]);
+    }
+#endif /* (STD_ON == PORT_HW_GROUPED_PCR_INIT) */
+
+    /* Initialize All Unused Port Pins */
+    if ((NumUnusedPins_u16 > 0U) && (UnusedPadMask_ptr != NULL_PTR) && (UnusedPadConfig_ptr != NULL_PTR))
+    {
+        PortHw_Init_UnusedPins(UnusedPadMask_ptr, UnusedPadConfig_ptr);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_InitPin
+* Description   : Initializes one pin of the pin table: GPIO level and direction
+*                 first, then the PCR word
+*
+* @implements PortHw_InitPin_Activity
+******************************************************************************/
+void PortHw_InitPin(
+    const PortHw_PinTableType* Table_ptr,
+    uint32 PinIndex_u32
+)
+{
+    uint32 f_Pad_u32;
+    PORT_Type* f_PortBase_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Table_ptr != NULL_PTR);
+
+    f_Pad_u32 = Table_ptr->PadId_ptr[PinIndex_u32];
+    PORT_HW_DEV_ASSERT(PORT_HW_GET_PORT_U32(f_Pad_u32) < PORT_HW_PORT_COUNT_U8);
+    f_PortBase_ptr = PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(f_Pad_u32)];
+    /* Check if pin is not locked before configuring */
+    PORT_HW_DEV_ASSERT((f_PortBase_ptr->PCR[PORT_HW_GET_PIN_U32(f_Pad_u32)] & PORT_PCR_LK_MASK) == 0U);
+    PORT_HW_DEV_ASSERT(((uint32)PORT_HW_MUX_AS_GPIO == PORT_HW_PCR_MUX_U32(Table_ptr->Pcr_ptr[PinIndex_u32])) ==
+                       (0U != (Table_ptr->Flags_ptr[PinIndex_u32] & PORT_HW_PIN_FLAG_GPIO_U8)));
+
+    /* Output level and direction first, so the output does not glitch when it is muxed */
+    PortHw_PinInitGpio(Table_ptr, PinIndex_u32);
+    PORT_HW_REG_WRITE32(&f_PortBase_ptr->PCR[PORT_HW_GET_PIN_U32(f_Pad_u32)], Table_ptr->Pcr_ptr[PinIndex_u32]);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_Init_UnusedPins
+* Description   : Initializes all unused port pins with the configuration
+*                 set pointed to by the parameter UnusedPadConfig_ptr.
+*                 Unused pads are given as one pin mask per port, so every port
+*                 costs one output/direction update and one GPCLR/GPCHR write.
+*
+* @implements PortHw_Init_UnusedPins_Activity
+******************************************************************************/
+static void PortHw_Init_UnusedPins(
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+)
+{
+    uint8 f_PortIndex_u8;
+
+    /* Initialize All UnUsed pins, one port at a time */
+    for (f_PortIndex_u8 = 0U; f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8; f_PortIndex_u8++)
+    {
+        if (0U != UnusedPadMask_ptr[f_PortIndex_u8])
+        {
+            PortHw_InitUnusedPort(f_PortIndex_u8, UnusedPadMask_ptr[f_PortIndex_u8], UnusedPadConfig_ptr);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_InitUnusedPort
+* Description   : Initializes the unused pads of one port with the configuration
+*                 set pointed to by the parameter UnusedPadConfig_ptr.
+*
+* @implements PortHw_InitUnusedPort_Activity
+******************************************************************************/
+void PortHw_InitUnusedPort(
+    uint8 PortIndex_u8,
+    uint32 PadMask_u32,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+)
+{
+    uint32 f_HalfMask_u32;
+    uint8  f_OutputValue_u8;
+    uint32 f_PcrValue_u32;
+    PortHw_DirectionType f_Direction_en;
+    GPIO_Type* f_GpioBase_ptr;
+    PORT_Type* f_PortBase_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
+    PORT_HW_DEV_ASSERT(UnusedPadConfig_ptr != NULL_PTR);
+
+    /* Get unused pin configuration */
+    f_OutputValue_u8 = UnusedPadConfig_ptr->OutputValue_u8;
+    f_PcrValue_u32   = UnusedPadConfig_ptr->PinControlRegister_u32;
+    f_Direction_en   = UnusedPadConfig_ptr->Direction_en;
+    f_GpioBase_ptr   = PortHw_g_GpioBaseAddr_ptr[PortIndex_u8];
+    f_PortBase_ptr   = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+
+    /* GPCLR/GPCHR only reach the lower PCR half, IRQC of unused pins must stay at reset value */
+    PORT_HW_DEV_ASSERT(0U == (f_PcrValue_u32 >> PORT_HW_UPPER_HALF_SHIFT_U32));
+
+    /* Check if the direction of the pins is OUTPUT */
+    if (PORT_HW_PIN_OUT == f_Direction_en)
+    {
+#if (STD_OFF == PORT_HW_ATOMIC_RMW)
+        PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_03, PortIndex_u8);
+#endif /* (STD_OFF == PORT_HW_ATOMIC_RMW) */
+        /* Set output level of all unused pins of the port */
+        if ((uint8)1U == f_OutputValue_u8)
+        {
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PSOR, PadMask_u32);
+        }
+        else if ((uint8)0U == f_OutputValue_u8)
+        {
+            PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PCOR, PadMask_u32);
+        }
+        else
+        {
+            /* No action to be done */
+        }
+
+        /* Set pins as output */
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+        PortHw_AtomicSetBits32(&f_GpioBase_ptr->PDDR, PadMask_u32);
+#else
+        PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR) | PadMask_u32);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_03, PortIndex_u8);
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+    }
+    /* The direction of pins is INPUT */
+    else
+    {
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+        PortHw_AtomicClearBits32(&f_GpioBase_ptr->PDDR, PadMask_u32);
+        PortHw_AtomicClearBits32(&f_GpioBase_ptr->PIDR, PadMask_u32);
+#else
+        PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_06, PortIndex_u8);
+        /* Set pins as input */
+        PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PDDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PDDR) & ~PadMask_u32);
+
+        /* Enable input */
+        PORT_HW_REG_WRITE32(&f_GpioBase_ptr->PIDR, PORT_HW_REG_READ32(&f_GpioBase_ptr->PIDR) & ~PadMask_u32);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_06, PortIndex_u8);
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+    }
+
+    /* Write PCR configuration from Configuration tool to all unused pins of the port */
+    f_HalfMask_u32 = PadMask_u32 & PORT_HW_LOWER_HALF_MASK_U32;
+    if (0U != f_HalfMask_u32)
+    {
+        PortHw_SetGlobalPinControl(f_PortBase_ptr, (uint16)f_HalfMask_u32, (uint16)f_PcrValue_u32, PORT_HW_GLOBAL_LOWER_HALF);
+    }
+
+    f_HalfMask_u32 = PadMask_u32 >> PORT_HW_UPPER_HALF_SHIFT_U32;
+    if (0U != f_HalfMask_u32)
+    {
+        PortHw_SetGlobalPinControl(f_PortBase_ptr, (uint16)f_HalfMask_u32, (uint16)f_PcrValue_u32, PORT_HW_GLOBAL_UPPER_HALF);
+    }
+}
+
+#if (STD_ON == PORT_HW_WARM_INIT)
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_InitWarm
+* Description   : Initializes the configured and unused pins, writing only the
+*                 PCR and GPIO registers that do not hold their configuration yet
+*
+* @implements PortHw_InitWarm_Activity
+******************************************************************************/
+uint32 PortHw_InitWarm(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    uint16 NumUnusedPins_u16,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+)
+{
+    uint32 f_Index_u32;
+    uint32 f_Skipped_u32 = 0U;
+    uint8  f_PortIndex_u8;
+    boolean f_UnusedValid_boo;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Table_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(PinCount_u32 > 0U);
+
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+    {
+        PORT_HW_DEV_ASSERT(PORT_HW_GET_PORT_U32(Table_ptr->PadId_ptr[f_Index_u32]) < PORT_HW_PORT_COUNT_U8);
+        PORT_HW_DEV_ASSERT(((uint32)PORT_HW_MUX_AS_GPIO == PORT_HW_PCR_MUX_U32(Table_ptr->Pcr_ptr[f_Index_u32])) ==
+                           (0U != (Table_ptr->Flags_ptr[f_Index_u32] & PORT_HW_PIN_FLAG_GPIO_U8)));
+    }
+
+    f_UnusedValid_boo = ((NumUnusedPins_u16 > 0U) && (UnusedPadMask_ptr != NULL_PTR) && (UnusedPadConfig_ptr != NULL_PTR)) ? TRUE : FALSE;
+    if (TRUE == f_UnusedValid_boo)
+    {
+        /* Unused pad PCRs are restored through their PCR, IRQC must stay at reset value as in PortHw_Init */
+        PORT_HW_DEV_ASSERT(0U == (UnusedPadConfig_ptr->PinControlRegister_u32 >> PORT_HW_UPPER_HALF_SHIFT_U32));
+    }
+
+    for (f_PortIndex_u8 = 0U; f_PortIndex_u8 < PORT_HW_PORT_COUNT_U8; f_PortIndex_u8++)
+    {
+        f_Skipped_u32 += PortHw_InitWarmPort(f_PortIndex_u8, PinCount_u32, Table_ptr,
+                                             (TRUE == f_UnusedValid_boo) ? UnusedPadMask_ptr[f_PortIndex_u8] : 0U,
+                                             UnusedPadConfig_ptr);
+    }
+
+    return f_Skipped_u32;
+}
+#endif /* (STD_ON == PORT_HW_WARM_INIT) */
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_InitScriptReplay
+* Description   : Replays a generated (address, value) register write sequence
+*
+* @implements PortHw_InitScriptReplay_Activity
+******************************************************************************/
+void PortHw_InitScriptReplay(const PortHw_InitScriptType* Script_ptr)
+{
+    uint32 f_Index_u32;
+    const PortHw_InitScriptEntryType* f_Entries_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Script_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Script_ptr->Entries_ptr != NULL_PTR) || (0U == Script_ptr->NumEntries_u32));
+
+    f_Entries_ptr = Script_ptr->Entries_ptr;
+    for (f_Index_u32 = 0U; f_Index_u32 < Script_ptr->NumEntries_u32; f_Index_u32++)
+    {
+        PORT_HW_REG_WRITE32(f_Entries_ptr[f_Index_u32].Address_ptr, f_Entries_ptr[f_Index_u32].Value_u32);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetMuxModeSel
+* Description   : Configures the pin multiplexing (alternate function)
+*                 Based on Port_Ipw_SetPinMode
+*
+* @implements PortHw_SetMuxModeSel_Activity
+******************************************************************************/
+void PortHw_SetMuxModeSel(
+    PORT_Type* const Base_ptr,
+    uint32 Pin_u32,
+    PortHw_MuxType Mux_en
+)
+{
+#if (STD_OFF == PORT_HW_ATOMIC_RMW)
+    uint32 f_RegValue_u32;
+#endif /* (STD_OFF == PORT_HW_ATOMIC_RMW) */
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
+    PORT_HW_DEV_ASSERT((Base_ptr->PCR[Pin_u32] & PORT_PCR_LK_MASK) == 0U);
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+    PortHw_AtomicModify32(&Base_ptr->PCR[Pin_u32], PORT_PCR_MUX_MASK | PORT_PCR_ISF_MASK, PORT_PCR_MUX(Mux_en));
+#else
+    /* Enter critical section - Sets the port pin mode */
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_08, PortHw_GetPortIndex(Base_ptr));
+
+    /* Read current PCR value, modify MUX field, write back with ISF 0 (write 1 to clear) */
+    f_RegValue_u32 = PORT_HW_REG_READ32(&Base_ptr->PCR[Pin_u32]);
+    f_RegValue_u32 &= ~(PORT_PCR_MUX_MASK | PORT_PCR_ISF_MASK);
+    f_RegValue_u32 |= PORT_PCR_MUX(Mux_en);
+    PORT_HW_REG_WRITE32(&Base_ptr->PCR[Pin_u32], f_RegValue_u32);
+
+    /* Exit critical section */
+    PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_08, PortHw_GetPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetPinDirection
+* Description   : Sets the direction of a GPIO pin
+*                 Based on Port_Ipw_SetPinDirection
+*
+* @implements PortHw_SetPinDirection_Activity
+******************************************************************************/
+void PortHw_SetPinDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 Pin_u32,
+    PortHw_DirectionType Direction_en
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
+
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+    /* One atomic alias store per bit, no exclusive area needed */
+    if (PORT_HW_PIN_OUT == Direction_en)
+    {
+        PORT_HW_BITBAND_WRITE32(&Base_ptr->PDDR, Pin_u32, 1U);
+    }
+    else if (PORT_HW_PIN_IN == Direction_en)
+    {
+        PORT_HW_BITBAND_WRITE32(&Base_ptr->PDDR, Pin_u32, 0U);
+        /* Enable input */
+        PORT_HW_BITBAND_WRITE32(&Base_ptr->PIDR, Pin_u32, 0U);
+    }
+    else
+    {
+        /* Do nothing for PORT_HW_PIN_DISABLED or invalid direction */
+    }
+#else
+    PortHw_SetPinsDirection(Base_ptr, ((uint32)1UL << Pin_u32), Direction_en);
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetPinsDirection
+* Description   : Sets the direction of the GPIO pins of a pin mask
+*
+* @implements PortHw_SetPinsDirection_Activity
+******************************************************************************/
+void PortHw_SetPinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    PortHw_DirectionType Direction_en
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
+    /* Configures Port Pin as Output */
+    if (PORT_HW_PIN_OUT == Direction_en)
+    {
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+        PortHw_AtomicSetBits32(&Base_ptr->PDDR, PinMask_u32);
+#else
+        PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
+        PORT_HW_REG_WRITE32(&Base_ptr->PDDR, PORT_HW_REG_READ32(&Base_ptr->PDDR) | PinMask_u32);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+    }
+    /* Configures Port Pin as Input or High-Z */
+    else if (PORT_HW_PIN_IN == Direction_en)
+    {
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+        PortHw_AtomicClearBits32(&Base_ptr->PDDR, PinMask_u32);
+        PortHw_AtomicClearBits32(&Base_ptr->PIDR, PinMask_u32);
+#else
+        /* Set pin as input - clear direction bit */
+        PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
+        PORT_HW_REG_WRITE32(&Base_ptr->PDDR, PORT_HW_REG_READ32(&Base_ptr->PDDR) & ~PinMask_u32);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
 
         /* Enable/Disable input based on direction mode */
-        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_10();
+        PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_10, PortHw_GetGpioPortIndex(Base_ptr));
         /* First enable input */
-        Base_ptr->PIDR &= ~((uint32)1UL << Pin_u32);
+        PORT_HW_REG_WRITE32(&Base_ptr->PIDR, PORT_HW_REG_READ32(&Base_ptr->PIDR) & ~PinMask_u32);
 
         /* Check if the pin is HIGH-Z. In this case disable port input in PIDR register */
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_10, PortHw_GetGpioPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+    }
+    else
+    {
+        /* Do nothing for PORT_HW_PIN_DISABLED or invalid direction */
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WritePinsDirection
+* Description   : Writes the direction bits of a pin mask with one masked PDDR update
+*
+* @implements PortHw_WritePinsDirection_Activity
+******************************************************************************/
+void PortHw_WritePinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint32 Direction_u32
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+    PortHw_AtomicModify32(&Base_ptr->PDDR, PinMask_u32, Direction_u32);
+#else
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
+    PORT_HW_REG_WRITE32(&Base_ptr->PDDR, (PORT_HW_REG_READ32(&Base_ptr->PDDR) & ~PinMask_u32) | (Direction_u32 & PinMask_u32));
+    PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_09, PortHw_GetGpioPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_VerifyPinsDirection
+* Description   : Rewrites the direction bits of a pin mask only if they differ
+*
+* @implements PortHw_VerifyPinsDirection_Activity
+******************************************************************************/
+boolean PortHw_VerifyPinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint32 Direction_u32
+)
+{
+    boolean f_Rewritten_boo = FALSE;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
+    if (0U != ((PORT_HW_REG_READ32(&Base_ptr->PDDR) ^ Direction_u32) & PinMask_u32))
+    {
+        PortHw_WritePinsDirection(Base_ptr, PinMask_u32, Direction_u32);
+        f_Rewritten_boo = TRUE;
+    }
+    else
+    {
+        /* Directions as expected, no write */
+    }
+
+    return f_Rewritten_boo;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetPinMasksDirection
+* Description   : Sets the direction of the GPIO pins of several ports
+*
+* @implements PortHw_SetPinMasksDirection_Activity
+******************************************************************************/
+void PortHw_SetPinMasksDirection(
+    const PortHw_PinMaskType PinMasks_ptr[],
+    uint32 NumPinMasks_u32,
+    PortHw_DirectionType Direction_en
+)
+{
+    uint32 f_Index_u32;
+    GPIO_Type* f_Base_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PinMasks_ptr != NULL_PTR);
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW) || (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS)
+    /* Each port is updated atomically or under its own lock, the ports of the group one after the other */
+    for (f_Index_u32 = 0U; f_Index_u32 < NumPinMasks_u32; f_Index_u32++)
+    {
+        f_Base_ptr = PinMasks_ptr[f_Index_u32].GpioBase_ptr;
+        PortHw_SetPinsDirection(f_Base_ptr, PinMasks_ptr[f_Index_u32].PinMask_u32, Direction_en);
+    }
+#else
+    /* Configures Port Pins as Output */
+    if (PORT_HW_PIN_OUT == Direction_en)
+    {
+        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
+        for (f_Index_u32 = 0U; f_Index_u32 < NumPinMasks_u32; f_Index_u32++)
+        {
+            f_Base_ptr = PinMasks_ptr[f_Index_u32].GpioBase_ptr;
+            PORT_HW_REG_WRITE32(&f_Base_ptr->PDDR, PORT_HW_REG_READ32(&f_Base_ptr->PDDR) | PinMasks_ptr[f_Index_u32].PinMask_u32);
+        }
+        SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+    }
+    /* Configures Port Pins as Input */
+    else if (PORT_HW_PIN_IN == Direction_en)
+    {
+        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
+        for (f_Index_u32 = 0U; f_Index_u32 < NumPinMasks_u32; f_Index_u32++)
+        {
+            f_Base_ptr = PinMasks_ptr[f_Index_u32].GpioBase_ptr;
+            PORT_HW_REG_WRITE32(&f_Base_ptr->PDDR, PORT_HW_REG_READ32(&f_Base_ptr->PDDR) & ~PinMasks_ptr[f_Index_u32].PinMask_u32);
+        }
+        SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+
+        /* Enable input */
+        SchM_Enter_Port_PORT_EXCLUSIVE_AREA_10();
+        for (f_Index_u32 = 0U; f_Index_u32 < NumPinMasks_u32; f_Index_u32++)
+        {
+            f_Base_ptr = PinMasks_ptr[f_Index_u32].GpioBase_ptr;
+            PORT_HW_REG_WRITE32(&f_Base_ptr->PIDR, PORT_HW_REG_READ32(&f_Base_ptr->PIDR) & ~PinMasks_ptr[f_Index_u32].PinMask_u32);
+        }
         SchM_Exit_Port_PORT_EXCLUSIVE_AREA_10();
     }
     else
     {
         /* Do nothing for PORT_HW_PIN_DISABLED or invalid direction */
     }
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) || (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS) */
+}
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_AtomicModify32
+* Description   : Lock-free masked register update (LDREX/STREX or C11 atomics)
+*
+* @implements PortHw_AtomicModify32_Activity
+******************************************************************************/
+void PortHw_AtomicModify32(
+    volatile uint32* Address_ptr,
+    uint32 FieldMask_u32,
+    uint32 Value_u32
+)
+{
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    uint32 f_Old_u32;
+    uint32 f_Failed_u32;
+
+    do
+    {
+        __asm volatile ("ldrex %0, [%1]" : "=r" (f_Old_u32) : "r" (Address_ptr) : "memory");
+        __asm volatile ("strex %0, %2, [%1]" : "=&r" (f_Failed_u32)
+                        : "r" (Address_ptr), "r" ((f_Old_u32 & ~FieldMask_u32) | (Value_u32 & FieldMask_u32))
+                        : "memory");
+    } while (0U != f_Failed_u32);
+#else
+    volatile _Atomic uint32* f_Atomic_ptr = (volatile _Atomic uint32*)Address_ptr;
+    uint32 f_Old_u32 = atomic_load(f_Atomic_ptr);
+
+    while (!atomic_compare_exchange_weak(f_Atomic_ptr, &f_Old_u32, (f_Old_u32 & ~FieldMask_u32) | (Value_u32 & FieldMask_u32)))
+    {
+        /* f_Old_u32 holds the value written in between, retry with it */
+    }
+#endif
 }
 
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_AtomicSetBits32
+* Description   : Lock-free register bit set
+*
+* @implements PortHw_AtomicSetBits32_Activity
+******************************************************************************/
+void PortHw_AtomicSetBits32(
+    volatile uint32* Address_ptr,
+    uint32 Mask_u32
+)
+{
+    PortHw_AtomicModify32(Address_ptr, Mask_u32, Mask_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_AtomicClearBits32
+* Description   : Lock-free register bit clear
+*
+* @implements PortHw_AtomicClearBits32_Activity
+******************************************************************************/
+void PortHw_AtomicClearBits32(
+    volatile uint32* Address_ptr,
+    uint32 Mask_u32
+)
+{
+    PortHw_AtomicModify32(Address_ptr, Mask_u32, 0U);
+}
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+
 /*FUNCTION**********************************************************************
 *
 * Function Name : Port_Hw_SetGlobalPinControl
@@ -468,12 +1351,12 @@ void PortHw_SetGlobalPinControl(
     {
         case PORT_HW_GLOBAL_LOWER_HALF:
             /* Configure lower 16 pins (0-15) */
-            Base_ptr->GPCLR = (((uint32)Pins_u16) << PORT_GPCLR_GPWE_SHIFT) | (uint32)f_Mask_u16;
+            PORT_HW_REG_WRITE32(&Base_ptr->GPCLR, (((uint32)Pins_u16) << PORT_GPCLR_GPWE_SHIFT) | (uint32)f_Mask_u16);
             break;
 
         case PORT_HW_GLOBAL_UPPER_HALF:
             /* Configure upper 16 pins (16-31) */
-            Base_ptr->GPCHR = (((uint32)Pins_u16) << PORT_GPCHR_GPWE_SHIFT) | (uint32)f_Mask_u16;
+            PORT_HW_REG_WRITE32(&Base_ptr->GPCHR, (((uint32)Pins_u16) << PORT_GPCHR_GPWE_SHIFT) | (uint32)f_Mask_u16);
             break;
 
         default:
@@ -483,6 +1366,32 @@ void PortHw_SetGlobalPinControl(
     }
 }
 
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetGlobalPinControls
+* Description   : Applies a list of GPCLR/GPCHR writes back to back
+*
+* @implements PortHw_SetGlobalPinControls_Activity
+******************************************************************************/
+void PortHw_SetGlobalPinControls(
+    const PortHw_GlobalPinControlType Controls_ptr[],
+    uint32 NumControls_u32
+)
+{
+    uint32 f_Index_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT((Controls_ptr != NULL_PTR) || (0U == NumControls_u32));
+
+    for (f_Index_u32 = 0U; f_Index_u32 < NumControls_u32; f_Index_u32++)
+    {
+        PortHw_SetGlobalPinControl(Controls_ptr[f_Index_u32].PortBase_ptr,
+                                   Controls_ptr[f_Index_u32].Pins_u16,
+                                   Controls_ptr[f_Index_u32].Value_u16,
+                                   Controls_ptr[f_Index_u32].Half_en);
+    }
+}
+
 /*FUNCTION**********************************************************************
 *
 * Function Name : Port_Hw_WritePin
@@ -500,15 +1409,34 @@ void PortHw_WritePin(
     PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
     PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
 
+    PortHw_WritePins(Base_ptr, (1UL << Pin_u32), Value_u8);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WritePins
+* Description   : Writes a value to the GPIO output pins of a pin mask
+*
+* @implements Port_Hw_WritePins_Activity
+******************************************************************************/
+void PortHw_WritePins(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint8 Value_u8
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
     if (Value_u8 != 0U)
     {
-        /* Set pin high using Port Set Output Register */
-        Base_ptr->PSOR = (1UL << Pin_u32);
+        /* Set pins high using Port Set Output Register */
+        PORT_HW_REG_WRITE32(&Base_ptr->PSOR, PinMask_u32);
     }
     else
     {
-        /* Set pin low using Port Clear Output Register */
-        Base_ptr->PCOR = (1UL << Pin_u32);
+        /* Set pins low using Port Clear Output Register */
+        PORT_HW_REG_WRITE32(&Base_ptr->PCOR, PinMask_u32);
     }
 }
 
@@ -531,7 +1459,7 @@ uint8 PortHw_ReadPin(
     PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
 
     /* Read pin value from Port Data Input Register */
-    f_RetVal_u8 = (uint8)((Base_ptr->PDIR >> Pin_u32) & 1U);
+    f_RetVal_u8 = (uint8)((PORT_HW_REG_READ32(&Base_ptr->PDIR) >> Pin_u32) & 1U);
 
     return f_RetVal_u8;
 }
@@ -553,7 +1481,182 @@ void PortHw_TogglePin(
     PORT_HW_DEV_ASSERT(Pin_u32 < PORT_HW_PINS_PER_PORT_U8);
 
     /* Toggle pin using Port Toggle Output Register */
-    Base_ptr->PTOR = (1UL << Pin_u32);
+    PORT_HW_REG_WRITE32(&Base_ptr->PTOR, (1UL << Pin_u32));
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_ReadChannelGroup
+* Description   : Reads the input level of a channel group with one PDIR read
+*
+* @implements Port_Hw_ReadChannelGroup_Activity
+******************************************************************************/
+uint32 PortHw_ReadChannelGroup(
+    const PortHw_ChannelGroupType* Group_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Group_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Group_ptr->GpioBase_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Group_ptr->Offset_u8 < PORT_HW_PINS_PER_PORT_U8);
+
+    return (PORT_HW_REG_READ32(&Group_ptr->GpioBase_ptr->PDIR) & Group_ptr->Mask_u32) >> Group_ptr->Offset_u8;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WriteChannelGroup
+* Description   : Writes the output level of a channel group with one PSOR/PCOR pair
+*
+* @implements Port_Hw_WriteChannelGroup_Activity
+******************************************************************************/
+void PortHw_WriteChannelGroup(
+    const PortHw_ChannelGroupType* Group_ptr,
+    uint32 Level_u32
+)
+{
+    uint32 f_High_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Group_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Group_ptr->GpioBase_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Group_ptr->Offset_u8 < PORT_HW_PINS_PER_PORT_U8);
+
+    f_High_u32 = (Level_u32 << Group_ptr->Offset_u8) & Group_ptr->Mask_u32;
+
+    /* Set and clear registers only change the written pins, no exclusive area needed */
+    PORT_HW_REG_WRITE32(&Group_ptr->GpioBase_ptr->PSOR, f_High_u32);
+    PORT_HW_REG_WRITE32(&Group_ptr->GpioBase_ptr->PCOR, Group_ptr->Mask_u32 & ~f_High_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_DebounceInit
+* Description   : Seeds the debounced level of a port from its input
+*
+* @implements Port_Hw_DebounceInit_Activity
+******************************************************************************/
+void PortHw_DebounceInit(
+    const PortHw_PinMaskType* Port_ptr,
+    PortHw_DebounceStateType* State_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Port_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Port_ptr->GpioBase_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(State_ptr != NULL_PTR);
+
+    State_ptr->Count0_u32 = 0U;
+    State_ptr->Count1_u32 = 0U;
+    State_ptr->State_u32  = PORT_HW_REG_READ32(&Port_ptr->GpioBase_ptr->PDIR) & Port_ptr->PinMask_u32;
+    State_ptr->Edge_u32   = 0U;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_DebounceUpdate
+* Description   : Debounces all pins of a port by one tick with vertical counters
+*
+* @implements Port_Hw_DebounceUpdate_Activity
+******************************************************************************/
+void PortHw_DebounceUpdate(
+    const PortHw_PinMaskType* Port_ptr,
+    PortHw_DebounceStateType* State_ptr
+)
+{
+    uint32 f_Delta_u32;
+    uint32 f_Count0_u32;
+    uint32 f_Count1_u32;
+    uint32 f_Toggle_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Port_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Port_ptr->GpioBase_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(State_ptr != NULL_PTR);
+
+    /* Pins whose input differs from the debounced level, one PDIR read for the whole port */
+    f_Delta_u32 = (PORT_HW_REG_READ32(&Port_ptr->GpioBase_ptr->PDIR) ^ State_ptr->State_u32) & Port_ptr->PinMask_u32;
+
+    /* Count up the differing pins (0, 1, 2, 3, 0), reset the agreeing ones */
+    f_Count1_u32 = (State_ptr->Count1_u32 ^ State_ptr->Count0_u32) & f_Delta_u32;
+    f_Count0_u32 = ~State_ptr->Count0_u32 & f_Delta_u32;
+
+    /* A differing pin whose counter wrapped to 0 has differed PORT_HW_DEBOUNCE_TICKS_U8 times */
+    f_Toggle_u32 = f_Delta_u32 & ~(f_Count0_u32 | f_Count1_u32);
+
+    State_ptr->Count0_u32 = f_Count0_u32;
+    State_ptr->Count1_u32 = f_Count1_u32;
+    State_ptr->State_u32 ^= f_Toggle_u32;
+    State_ptr->Edge_u32   = f_Toggle_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_SetDigitalFilter
+* Description   : Configures the clock, the width and the pins of a port digital filter
+*
+* @implements Port_Hw_SetDigitalFilter_Activity
+******************************************************************************/
+void PortHw_SetDigitalFilter(const PortHw_DigitalFilterConfigType* Config_ptr)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->PortBase_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Width_u8 <= PORT_HW_DIGITAL_FILTER_WIDTH_MAX_U8);
+
+    /* Clock and width are only changed while every filter of the port is off */
+    PORT_HW_REG_WRITE32(&Config_ptr->PortBase_ptr->DFER, 0U);
+    PORT_HW_REG_WRITE32(&Config_ptr->PortBase_ptr->DFCR, PORT_DFCR_CS(Config_ptr->Clock_en));
+    PORT_HW_REG_WRITE32(&Config_ptr->PortBase_ptr->DFWR, PORT_DFWR_FILT(Config_ptr->Width_u8));
+    PORT_HW_REG_WRITE32(&Config_ptr->PortBase_ptr->DFER, Config_ptr->PinMask_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_EnableDigitalFilter
+* Description   : Enables the digital filter of a pin mask with one masked DFER update
+*
+* @implements Port_Hw_EnableDigitalFilter_Activity
+******************************************************************************/
+void PortHw_EnableDigitalFilter(
+    PORT_Type* const Base_ptr,
+    uint32 PinMask_u32
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+    PortHw_AtomicSetBits32(&Base_ptr->DFER, PinMask_u32);
+#else
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_12, PortHw_GetPortIndex(Base_ptr));
+    PORT_HW_REG_WRITE32(&Base_ptr->DFER, PORT_HW_REG_READ32(&Base_ptr->DFER) | PinMask_u32);
+    PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_12, PortHw_GetPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_DisableDigitalFilter
+* Description   : Disables the digital filter of a pin mask with one masked DFER update
+*
+* @implements Port_Hw_DisableDigitalFilter_Activity
+******************************************************************************/
+void PortHw_DisableDigitalFilter(
+    PORT_Type* const Base_ptr,
+    uint32 PinMask_u32
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Base_ptr != NULL_PTR);
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+    PortHw_AtomicClearBits32(&Base_ptr->DFER, PinMask_u32);
+#else
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_12, PortHw_GetPortIndex(Base_ptr));
+    PORT_HW_REG_WRITE32(&Base_ptr->DFER, PORT_HW_REG_READ32(&Base_ptr->DFER) & ~PinMask_u32);
+    PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_12, PortHw_GetPortIndex(Base_ptr));
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
 }
 
 #define PORT_STOP_SEC_CODE
@@ -92,6 +92,18 @@ extern "C" {
 */
 #define PORT_HW_PORT_COUNT_U8              ((uint8)5U)
 
+/**
+* @brief Samples in a row a pin input must differ from its debounced level to change it
+* @details Fixed by the 2-bit vertical counter of PortHw_DebounceUpdate(): the counter wraps
+*          back to 0 on the fourth sample, which changes the level.
+*/
+#define PORT_HW_DEBOUNCE_TICKS_U8          ((uint8)4U)
+
+/**
+* @brief Largest digital filter width in filter clock cycles (DFWR[FILT])
+*/
+#define PORT_HW_DIGITAL_FILTER_WIDTH_MAX_U8 ((uint8)31U)
+
 /*==================================================================================================
 *                                      DEFINES AND MACROS
 ==================================================================================================*/
@@ -106,6 +118,146 @@ extern "C" {
     #define PORT_HW_DEV_ASSERT(condition)
 #endif
 
+/**
+* @brief Builds a PCR value from the pin settings
+* @details Constant expression, usable by configuration tools and static initializers to
+*          generate the PCR words of PortHw_PinTableType::Pcr_ptr.
+*/
+#define PORT_HW_PCR_VALUE(pull, dse, lk, mux)   \
+    ((((uint32)PORT_HW_PULL_NOT_ENABLED != (uint32)(pull)) ? (PORT_PCR_PE_MASK | PORT_PCR_PS(pull)) : 0UL) | \
+     PORT_PCR_DSE(dse) | PORT_PCR_LK(lk) | PORT_PCR_MUX(mux))
+
+/**
+* @brief Enable or disable grouped PCR initialization
+* @details When STD_ON, PortHw_Init() collects the configured pins of each port by PCR value
+*          and writes every group with one GPCLR/GPCHR access instead of one PCR write per pin.
+*/
+#define PORT_HW_GROUPED_PCR_INIT           (STD_ON)
+
+/**
+* @brief Enable or disable aggregated GPIO initialization
+* @details When STD_ON, PortHw_Init() collects the set, clear and direction masks of all
+*          configured pins and writes each GPIO block once instead of once per pin.
+*/
+#define PORT_HW_AGGREGATED_GPIO_INIT       (STD_ON)
+
+/**
+* @brief Enable or disable the warm initialization service
+* @details When STD_ON, PortHw_InitWarm() is available: it compares the PCR and GPIO
+*          registers with the configuration and only rewrites what differs.
+*/
+#define PORT_HW_WARM_INIT                  (STD_ON)
+
+/**
+* @brief Enable or disable lock-free read-modify-write register updates
+* @details When STD_ON, the read-modify-write sequences of PortHw_SetMuxModeSel(), the
+*          direction services and PortHw_InitUnusedPort() use PortHw_AtomicSetBits32(),
+*          PortHw_AtomicClearBits32() and PortHw_AtomicModify32() instead of exclusive areas
+*          03, 06, 08, 09 and 10: LDREX/STREX on Cortex-M4, C11 atomics on a host build.
+*          Can be set from the compiler command line (host stress test).
+*/
+#ifndef PORT_HW_ATOMIC_RMW
+    #define PORT_HW_ATOMIC_RMW             (STD_OFF)
+#endif
+
+/**
+* @brief Enable or disable per-port exclusive areas
+* @details When STD_ON, the exclusive areas 03, 06, 08, 09 and 10 lock only the port accessed
+*          (SchM_Enter_Port_PortArea()), so services on different ports do not block each other.
+*          When STD_OFF, the module-wide SchM_Enter_Port_PORT_EXCLUSIVE_AREA_xx() are used.
+*          Can be set from the compiler command line (host tests).
+*/
+#ifndef PORT_HW_PER_PORT_EXCLUSIVE_AREAS
+    #define PORT_HW_PER_PORT_EXCLUSIVE_AREAS (STD_ON)
+#endif
+
+/**
+* @brief Enable or disable bit-band direction updates
+* @details When STD_ON, PortHw_SetPinDirection() changes the PDDR and PIDR bit of the pin with
+*          one store to its Cortex-M4 bit-band alias. The store is atomic, so exclusive areas
+*          09 and 10 are not entered. Can be set from the compiler command line (host tests).
+*/
+#ifndef PORT_HW_BITBAND_PDDR
+    #define PORT_HW_BITBAND_PDDR           (STD_ON)
+#endif
+
+/**
+* @brief Start of the peripheral bit-band region and of its alias region
+*/
+#define PORT_HW_BITBAND_PERIPH_BASE_U32    ((uint32)0x40000000UL)
+#define PORT_HW_BITBAND_ALIAS_BASE_U32     ((uint32)0x42000000UL)
+
+/**
+* @brief Bit-band alias address of a bit of a peripheral register
+*/
+#define PORT_HW_BITBAND_ALIAS_U32(address, bit) \
+    (PORT_HW_BITBAND_ALIAS_BASE_U32 + ((((uint32)(address)) - PORT_HW_BITBAND_PERIPH_BASE_U32) << 5U) + (((uint32)(bit)) << 2U))
+
+/**
+* @brief Single bit write through the bit-band alias
+* @details Can be overridden by the test environment, which has no alias region.
+*/
+#ifndef PORT_HW_BITBAND_WRITE32
+    #define PORT_HW_BITBAND_WRITE32(address, bit, value) \
+        ((*(volatile uint32*)PORT_HW_BITBAND_ALIAS_U32((address), (bit))) = (uint32)(value))
+#endif
+
+/**
+* @brief Exclusive areas of the runtime services
+* @details Area is the AUTOSAR area name (PORT_EXCLUSIVE_AREA_xx). The port index is only
+*          evaluated with per-port exclusive areas. Used by Port_Hw.c and Port_Hw_BitBang.c,
+*          which include SchM_Port.h.
+*/
+#if (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS)
+#define PORT_HW_ENTER_EXCLUSIVE_AREA(Area, PortIndex)  SchM_Enter_Port_PortArea(SCHM_##Area, (PortIndex))
+#define PORT_HW_EXIT_EXCLUSIVE_AREA(Area, PortIndex)   SchM_Exit_Port_PortArea(SCHM_##Area, (PortIndex))
+#else
+#define PORT_HW_ENTER_EXCLUSIVE_AREA(Area, PortIndex)  SchM_Enter_Port_##Area()
+#define PORT_HW_EXIT_EXCLUSIVE_AREA(Area, PortIndex)   SchM_Exit_Port_##Area()
+#endif /* (STD_ON == PORT_HW_PER_PORT_EXCLUSIVE_AREAS) */
+
+/**
+* @brief Index of a PORT / GPIO block (lock slot of the port)
+* @details The blocks are evenly spaced (PORTA..PORTE 4 KB, PTA..PTE 64 bytes apart), so the
+*          index is the distance to the first block divided by the spacing: a subtraction and
+*          a shift, both spacings being compile-time constants.
+*/
+#define PORT_HW_PORT_INDEX_U8(Base_ptr) \
+    ((uint8)((uint32)((const volatile uint8*)(Base_ptr) - (const volatile uint8*)IP_PORTA) / \
+             (uint32)((const volatile uint8*)IP_PORTB - (const volatile uint8*)IP_PORTA)))
+#define PORT_HW_GPIO_INDEX_U8(Base_ptr) \
+    ((uint8)((uint32)((const volatile uint8*)(Base_ptr) - (const volatile uint8*)IP_PTA) / \
+             (uint32)((const volatile uint8*)IP_PTB - (const volatile uint8*)IP_PTA)))
+
+/**
+* @brief 32-bit register write used by the Port_Hw layer
+* @details Can be overridden by the test environment to redirect accesses to a simulated
+*          register file.
+*/
+#ifndef PORT_HW_REG_WRITE32
+    #define PORT_HW_REG_WRITE32(address, value)  ((*(volatile uint32*)(address)) = (uint32)(value))
+#endif
+
+/**
+* @brief 32-bit register read used by the Port_Hw layer
+*/
+#ifndef PORT_HW_REG_READ32
+    #define PORT_HW_REG_READ32(address)          (*(const volatile uint32*)(address))
+#endif
+
+/**
+* @brief 16-bit and 8-bit register accesses (eDMA TCD and DMAMUX registers of Port_Hw_Wave)
+*/
+#ifndef PORT_HW_REG_WRITE16
+    #define PORT_HW_REG_WRITE16(address, value)  ((*(volatile uint16*)(address)) = (uint16)(value))
+#endif
+#ifndef PORT_HW_REG_READ16
+    #define PORT_HW_REG_READ16(address)          (*(const volatile uint16*)(address))
+#endif
+#ifndef PORT_HW_REG_WRITE8
+    #define PORT_HW_REG_WRITE8(address, value)   ((*(volatile uint8*)(address)) = (uint8)(value))
+#endif
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -133,13 +285,17 @@ extern GPIO_Type* const PortHw_g_GpioBaseAddr_ptr[PORT_HW_PORT_COUNT_U8];
 /**
 * @brief       Initializes multiple pins with the given configuration array
 *
-* @details     This function configures multiple pins using the provided configuration
-*              structure array. Each element configures one pin. Also initializes unused pins.
+* @details     This function configures the first @p PinCount_u32 pins of the pin table.
+*              Also initializes unused pins.
+*              With PORT_HW_GROUPED_PCR_INIT enabled, pins sharing a port half and a PCR value
+*              are written together through GPCLR/GPCHR.
+*              With PORT_HW_AGGREGATED_GPIO_INIT enabled, the output levels and directions
+*              are written once per GPIO block.
 *
 * @param[in]   PinCount_u32       Number of pins to configure
-* @param[in]   Config_ptr         Pointer to array of pin configuration structures
+* @param[in]   Table_ptr          Pointer to the pin table
 * @param[in]   NumUnusedPins_u16  Number of unused pins to configure
-* @param[in]   UnusedPads_ptr     Pointer to array of unused pad indices
+* @param[in]   UnusedPadMask_ptr  Pointer to the unused pad masks, one per port (bit n = pin n)
 * @param[in]   UnusedPadConfig_ptr Pointer to unused pad configuration
 *
 * @return      PortHw_StatusType
@@ -155,11 +311,110 @@ extern GPIO_Type* const PortHw_g_GpioBaseAddr_ptr[PORT_HW_PORT_COUNT_U8];
 */
 void PortHw_Init(
     uint32 PinCount_u32,
-    const PortHw_PinSettingsConfigType Config_ptr[],
+    const PortHw_PinTableType* Table_ptr,
+    uint16 NumUnusedPins_u16,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+);
+
+#if (STD_ON == PORT_HW_WARM_INIT)
+/**
+* @brief       Initializes pins that may already hold their configuration
+*
+* @details     Warm reset / wakeup variant of PortHw_Init() with the same parameters and the
+*              same resulting register state. Per port, the PCRs of the configured and unused
+*              pins and the GPIO registers are read in one burst and their differences from the
+*              configuration are OR-folded into one port signature, so a port that already
+*              matches costs the reads and a single compare. On a port whose signature differs,
+*              only the mismatching PCRs are rewritten; GPIO registers are written only when
+*              they differ. PCR[ISF] is not compared.
+*
+* @param[in]   PinCount_u32       Number of pins to configure
+* @param[in]   Table_ptr          Pointer to the pin table
+* @param[in]   NumUnusedPins_u16  Number of unused pins to configure
+* @param[in]   UnusedPadMask_ptr  Pointer to the unused pad masks, one per port (bit n = pin n)
+* @param[in]   UnusedPadConfig_ptr Pointer to unused pad configuration
+*
+* @return      uint32  Number of register writes skipped: one per PCR already holding its
+*                      value and one per PSOR, PCOR, PDDR or PIDR write not needed
+*
+* @api
+*
+* @implements  PortHw_InitWarm_Activity
+*/
+uint32 PortHw_InitWarm(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
     uint16 NumUnusedPins_u16,
-    const uint16* UnusedPads_ptr,
+    const uint32* UnusedPadMask_ptr,
     const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
 );
+#endif /* (STD_ON == PORT_HW_WARM_INIT) */
+
+/**
+* @brief       Initializes one pin of the pin table
+*
+* @details     Sets the output level and direction of the pin when it is muxed as GPIO, then
+*              writes its PCR word. Used to configure pins one at a time (phased init, reset
+*              of the pin mode); reads one entry of each array of the table.
+*
+* @param[in]   Table_ptr          Pointer to the pin table
+* @param[in]   PinIndex_u32       Index of the pin in the table
+*
+* @return      void
+*
+* @api
+*
+* @implements  PortHw_InitPin_Activity
+*/
+void PortHw_InitPin(
+    const PortHw_PinTableType* Table_ptr,
+    uint32 PinIndex_u32
+);
+
+/**
+* @brief       Initializes the unused pads of one port
+*
+* @details     Applies the unused pad configuration to all pads of @p PadMask_u32: one output
+*              level and direction update and one GPCLR/GPCHR write per port half. PortHw_Init()
+*              uses it for every port; callers may also spread the ports over several calls.
+*
+* @param[in]   PortIndex_u8        Port index (0 = PORTA ... 4 = PORTE)
+* @param[in]   PadMask_u32         Unused pads of the port (bit n = pin n)
+* @param[in]   UnusedPadConfig_ptr Pointer to unused pad configuration
+*
+* @return      void
+*
+* @api
+*
+* @implements  PortHw_InitUnusedPort_Activity
+*/
+void PortHw_InitUnusedPort(
+    uint8 PortIndex_u8,
+    uint32 PadMask_u32,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr
+);
+
+/**
+* @brief       Replays a generated initialization script
+*
+* @details     Writes every (address, value) pair of the script in order. The script is
+*              generated off-line (Tools/Port_InitScriptGen) from the same configuration
+*              as PortHw_Init() and contains only plain writes, so the registers must be in
+*              their reset state when it is replayed.
+*
+* @param[in]   Script_ptr  Pointer to the initialization script
+*
+* @return      void
+*
+* @api
+*
+* @pre         PORT and GPIO registers are in their reset state
+* @post        Pins are configured as by PortHw_Init() with the same configuration
+*
+* @implements  PortHw_InitScriptReplay_Activity
+*/
+void PortHw_InitScriptReplay(const PortHw_InitScriptType* Script_ptr);
 
 /**
 * @brief       Configures the pin multiplexing (alternate function)
@@ -210,6 +465,161 @@ void PortHw_SetPinDirection(
     PortHw_DirectionType Direction_en
 );
 
+/**
+* @brief       Sets the direction of GPIO pins given by mask
+*
+* @details     Same as PortHw_SetPinDirection() for all pins of @p PinMask_u32, used with
+*              pin masks precomputed at initialization.
+*
+* @param[in]   Base_ptr       Pointer to GPIO peripheral base address
+* @param[in]   PinMask_u32    Pins of the port (bit n = pin n)
+* @param[in]   Direction_en   Desired pin direction
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_SetPinsDirection_Activity
+*/
+void PortHw_SetPinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    PortHw_DirectionType Direction_en
+);
+
+/**
+* @brief       Writes the direction bits of a pin mask
+*
+* @details     PDDR = (PDDR & ~PinMask_u32) | (Direction_u32 & PinMask_u32), inside exclusive
+*              area 09. Pins of the mask go to output where @p Direction_u32 has a one and to
+*              input where it has a zero; the other pins keep their direction.
+*
+* @param[in]   Base_ptr        Pointer to GPIO peripheral base address
+* @param[in]   PinMask_u32     Pins of the port (bit n = pin n)
+* @param[in]   Direction_u32   Direction of the pins (bit n set = pin n output)
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_WritePinsDirection_Activity
+*/
+void PortHw_WritePinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint32 Direction_u32
+);
+
+/**
+* @brief       Checks the direction bits of a pin mask and rewrites them if they differ
+*
+* @details     Reads PDDR once. Only if a pin of @p PinMask_u32 has another direction than
+*              in @p Direction_u32 the bits are written as by PortHw_WritePinsDirection().
+*
+* @param[in]   Base_ptr        Pointer to GPIO peripheral base address
+* @param[in]   PinMask_u32     Pins of the port (bit n = pin n)
+* @param[in]   Direction_u32   Expected direction of the pins (bit n set = pin n output)
+*
+* @return      boolean  TRUE if the direction bits had to be rewritten
+*
+* @api
+*
+* @implements  Port_Hw_VerifyPinsDirection_Activity
+*/
+boolean PortHw_VerifyPinsDirection(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint32 Direction_u32
+);
+
+/**
+* @brief       Sets the direction of the GPIO pins of several ports
+*
+* @details     Same as PortHw_SetPinsDirection() for every entry of @p PinMasks_ptr, one
+*              masked write per port. With PORT_HW_PER_PORT_EXCLUSIVE_AREAS or
+*              PORT_HW_ATOMIC_RMW each port is updated on its own, one after the other.
+*              Otherwise all PDDR updates are done inside one exclusive area 09 section (and
+*              all PIDR updates inside one exclusive area 10 section).
+*
+* @param[in]   PinMasks_ptr      Pins to change, one entry per port
+* @param[in]   NumPinMasks_u32   Number of entries of @p PinMasks_ptr
+* @param[in]   Direction_en      Desired pin direction
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_SetPinMasksDirection_Activity
+*/
+void PortHw_SetPinMasksDirection(
+    const PortHw_PinMaskType PinMasks_ptr[],
+    uint32 NumPinMasks_u32,
+    PortHw_DirectionType Direction_en
+);
+
+
+#if (STD_ON == PORT_HW_ATOMIC_RMW)
+/**
+* @brief       Atomically sets bits of a register
+*
+* @details     *Address_ptr |= Mask_u32 without interrupt lock. The update is retried until
+*              no other access to the register came in between.
+*
+* @param[in]   Address_ptr   Register address
+* @param[in]   Mask_u32      Bits to set
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_AtomicSetBits32_Activity
+*/
+void PortHw_AtomicSetBits32(
+    volatile uint32* Address_ptr,
+    uint32 Mask_u32
+);
+
+/**
+* @brief       Atomically clears bits of a register
+*
+* @details     *Address_ptr &= ~Mask_u32 without interrupt lock, see PortHw_AtomicSetBits32().
+*
+* @param[in]   Address_ptr   Register address
+* @param[in]   Mask_u32      Bits to clear
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_AtomicClearBits32_Activity
+*/
+void PortHw_AtomicClearBits32(
+    volatile uint32* Address_ptr,
+    uint32 Mask_u32
+);
+
+/**
+* @brief       Atomically updates a field of a register
+*
+* @details     *Address_ptr = (*Address_ptr & ~FieldMask_u32) | (Value_u32 & FieldMask_u32)
+*              without interrupt lock, see PortHw_AtomicSetBits32().
+*
+* @param[in]   Address_ptr     Register address
+* @param[in]   FieldMask_u32   Bits of the field
+* @param[in]   Value_u32       New field value, already shifted to the field position
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_AtomicModify32_Activity
+*/
+void PortHw_AtomicModify32(
+    volatile uint32* Address_ptr,
+    uint32 FieldMask_u32,
+    uint32 Value_u32
+);
+#endif /* (STD_ON == PORT_HW_ATOMIC_RMW) */
 
 /**
 * @brief       Quickly configures multiple pins with the same configuration
@@ -236,6 +646,27 @@ void PortHw_SetGlobalPinControl(
     PortHw_GlobalControlPinsType GlobalCtrlPins_en
 );
 
+/**
+* @brief       Applies a list of global pin control writes
+*
+* @details     Writes the entries back to back with PortHw_SetGlobalPinControl(). Each entry is
+*              a single register store, so no exclusive area is needed and the pins of a
+*              peripheral switch their function within a few bus cycles.
+*
+* @param[in]   Controls_ptr      Global pin control writes
+* @param[in]   NumControls_u32   Number of entries of Controls_ptr
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_SetGlobalPinControls_Activity
+*/
+void PortHw_SetGlobalPinControls(
+    const PortHw_GlobalPinControlType Controls_ptr[],
+    uint32 NumControls_u32
+);
+
 /**
 * @brief       Writes a value to GPIO output pin
 *
@@ -259,6 +690,25 @@ void PortHw_WritePin(
     uint8 Value_u8
 );
 
+/**
+* @brief       Writes a value to GPIO output pins given by mask
+*
+* @param[in]   Base_ptr     Pointer to GPIO peripheral base address
+* @param[in]   PinMask_u32  Pins of the port (bit n = pin n)
+* @param[in]   Value_u8     Output value (0 = LOW, 1 = HIGH)
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_WritePins_Activity
+*/
+void PortHw_WritePins(
+    GPIO_Type* const Base_ptr,
+    uint32 PinMask_u32,
+    uint8 Value_u8
+);
+
 /**
 * @brief       Reads the input value of a GPIO pin
 *
@@ -301,6 +751,149 @@ void PortHw_TogglePin(
     uint32 Pin_u32
 );
 
+/**
+* @brief       Reads the input level of a channel group
+*
+* @details     One PDIR read, masked and shifted down to the lowest pin of the group, so all
+*              pins of the group are sampled at the same time.
+*
+* @param[in]   Group_ptr  Channel group
+*
+* @return      uint32  Input level of the group, bit 0 = lowest pin
+*
+* @api
+*
+* @implements  Port_Hw_ReadChannelGroup_Activity
+*/
+uint32 PortHw_ReadChannelGroup(
+    const PortHw_ChannelGroupType* Group_ptr
+);
+
+/**
+* @brief       Writes the output level of a channel group
+*
+* @details     One PSOR write for the pins to set and one PCOR write for the pins to clear.
+*              No pin outside the group is touched and no read or lock is needed; every pin
+*              of the group changes at most once.
+*
+* @param[in]   Group_ptr  Channel group
+* @param[in]   Level_u32  Output level of the group, bit 0 = lowest pin
+*
+* @return      void
+*
+* @api
+*
+* @pre         Pins of the group must be configured as GPIO output
+*
+* @implements  Port_Hw_WriteChannelGroup_Activity
+*/
+void PortHw_WriteChannelGroup(
+    const PortHw_ChannelGroupType* Group_ptr,
+    uint32 Level_u32
+);
+
+/**
+* @brief       Starts debouncing the pins of one port
+*
+* @details     Seeds the debounced level with one PDIR read and clears the counters and
+*              the edges, so the first update reports no edge.
+*
+* @param[in]   Port_ptr   Debounced port and pins
+* @param[out]  State_ptr  Debounce state of the port
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_DebounceInit_Activity
+*/
+void PortHw_DebounceInit(
+    const PortHw_PinMaskType* Port_ptr,
+    PortHw_DebounceStateType* State_ptr
+);
+
+/**
+* @brief       Debounces all pins of one port by one tick
+*
+* @details     One PDIR read, then a vertical (bit-sliced) 2-bit counter per pin: a pin whose
+*              input differs from its debounced level counts up, a pin whose input agrees is
+*              reset. The debounced level of a pin follows its input after
+*              PORT_HW_DEBOUNCE_TICKS_U8 different samples in a row. The cost does not depend
+*              on the number of pins.
+*
+* @param[in]     Port_ptr   Debounced port and pins
+* @param[in,out] State_ptr  Debounce state of the port, Edge_u32 is rewritten every call
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_DebounceUpdate_Activity
+*/
+void PortHw_DebounceUpdate(
+    const PortHw_PinMaskType* Port_ptr,
+    PortHw_DebounceStateType* State_ptr
+);
+
+/**
+* @brief       Configures the digital input filter of one port
+*
+* @details     Disables the filters of the port, writes the clock source and the width, then
+*              enables the filters of the configured pins: DFCR and DFWR may only be changed
+*              while DFER is 0. Four writes, no read. Pins of the port not in the
+*              configuration are left unfiltered.
+*
+* @param[in]   Config_ptr  Digital filter configuration of the port
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_SetDigitalFilter_Activity
+*/
+void PortHw_SetDigitalFilter(const PortHw_DigitalFilterConfigType* Config_ptr);
+
+/**
+* @brief       Enables the digital filter of pins of one port
+*
+* @details     Sets the DFER bits of the pins, the clock and width set by
+*              PortHw_SetDigitalFilter() apply. The other pins of the port keep their
+*              filter setting.
+*
+* @param[in]   Base_ptr     PORT base address
+* @param[in]   PinMask_u32  Pins to filter (bit n = pin n)
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_EnableDigitalFilter_Activity
+*/
+void PortHw_EnableDigitalFilter(
+    PORT_Type* const Base_ptr,
+    uint32 PinMask_u32
+);
+
+/**
+* @brief       Disables the digital filter of pins of one port
+*
+* @details     Clears the DFER bits of the pins, their input is passed unfiltered. The other
+*              pins of the port keep their filter setting.
+*
+* @param[in]   Base_ptr     PORT base address
+* @param[in]   PinMask_u32  Pins to pass unfiltered (bit n = pin n)
+*
+* @return      void
+*
+* @api
+*
+* @implements  Port_Hw_DisableDigitalFilter_Activity
+*/
+void PortHw_DisableDigitalFilter(
+    PORT_Type* const Base_ptr,
+    uint32 PinMask_u32
+);
+
 #ifdef __cplusplus
 }
 #endif
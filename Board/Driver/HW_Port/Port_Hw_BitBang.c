@@ -0,0 +1,837 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_BitBang.c
+*
+*   @brief   Port Hardware bit-bang engine source file
+*   @details SPI, I2C and 1-Wire masters on GPIO pins. Each edge is written at an absolute
+*            deadline: the deadline of a phase is the deadline of the previous phase plus the
+*            phase length of the timing table. When the code between two edges takes longer
+*            than the phase, the phase is stretched and the schedule restarts from the current
+*            cycle, so no phase is ever shorter than the timing table.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw_BitBang.h"
+#include "SchM_Port.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_BITBANG_VENDOR_ID_C                    43
+#define PORT_HW_BITBANG_AR_RELEASE_MAJOR_VERSION_C     21
+#define PORT_HW_BITBANG_AR_RELEASE_MINOR_VERSION_C     11
+#define PORT_HW_BITBANG_AR_RELEASE_REVISION_VERSION_C  0
+#define PORT_HW_BITBANG_SW_MAJOR_VERSION_C             1
+#define PORT_HW_BITBANG_SW_MINOR_VERSION_C             0
+#define PORT_HW_BITBANG_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_BitBang.c and Port_Hw_BitBang.h are of the same vendor */
+#if (PORT_HW_BITBANG_VENDOR_ID_C != PORT_HW_BITBANG_VENDOR_ID_H)
+    #error "Port_Hw_BitBang.c and Port_Hw_BitBang.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_BitBang.c and Port_Hw_BitBang.h are of the same Autosar version */
+#if ((PORT_HW_BITBANG_AR_RELEASE_MAJOR_VERSION_C    != PORT_HW_BITBANG_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_BITBANG_AR_RELEASE_MINOR_VERSION_C    != PORT_HW_BITBANG_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_BITBANG_AR_RELEASE_REVISION_VERSION_C != PORT_HW_BITBANG_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_BitBang.c and Port_Hw_BitBang.h are different"
+#endif
+
+/* Check if Port_Hw_BitBang.c and Port_Hw_BitBang.h are of the same software version */
+#if ((PORT_HW_BITBANG_SW_MAJOR_VERSION_C != PORT_HW_BITBANG_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_BITBANG_SW_MINOR_VERSION_C != PORT_HW_BITBANG_SW_MINOR_VERSION_H) || \
+     (PORT_HW_BITBANG_SW_PATCH_VERSION_C != PORT_HW_BITBANG_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_BitBang.c and Port_Hw_BitBang.h are different"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief CPHA bit of the SPI mode
+*/
+#define PORT_HW_BITBANG_SPI_CPHA_U32       ((uint32)0x1U)
+
+/**
+* @brief CPOL bit of the SPI mode
+*/
+#define PORT_HW_BITBANG_SPI_CPOL_U32       ((uint32)0x2U)
+
+/**
+* @brief Byte sent by the SPI master when no transmit data is given
+*/
+#define PORT_HW_BITBANG_SPI_FILL_U8        ((uint8)0xFFU)
+
+/**
+* @brief Read/write bit of the I2C address byte
+*/
+#define PORT_HW_BITBANG_I2C_READ_U8        ((uint8)0x01U)
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+LOCAL_INLINE void PortHw_BitBangWait(uint32* Deadline_ptr, uint32 Cycles_u32);
+LOCAL_INLINE void PortHw_BitBangPull(const PortHw_BitBangOpenDrainType* Line_ptr);
+LOCAL_INLINE void PortHw_BitBangRelease(const PortHw_BitBangOpenDrainType* Line_ptr);
+LOCAL_INLINE void PortHw_BitBangDriveLocked(const PortHw_BitBangOpenDrainType* Line_ptr, uint32 Pull_u32);
+LOCAL_INLINE uint32 PortHw_BitBangSample(const PortHw_BitBangOpenDrainType* Line_ptr);
+static uint8 PortHw_BitBangSpiByteCpha0(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 FirstPhase_u32,
+    uint8 TxByte_u8
+);
+static uint8 PortHw_BitBangSpiByteCpha1(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 FirstPhase_u32,
+    uint8 TxByte_u8
+);
+static void PortHw_BitBangI2cStart(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    boolean Repeated_boo
+);
+static void PortHw_BitBangI2cStop(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr
+);
+static uint32 PortHw_BitBangI2cBit(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 Bit_u32
+);
+static Std_ReturnType PortHw_BitBangI2cWriteByte(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint8 Byte_u8
+);
+static uint8 PortHw_BitBangI2cReadByte(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    boolean Ack_boo
+);
+static uint32 PortHw_BitBangOneWireSlot(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    uint32 Bit_u32
+);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangWait
+* Description   : Waits for the end of a phase of Cycles_u32 cycles that started at
+*                 *Deadline_ptr and moves *Deadline_ptr to its end
+*
+******************************************************************************/
+LOCAL_INLINE void PortHw_BitBangWait(uint32* Deadline_ptr, uint32 Cycles_u32)
+{
+    uint32 f_Deadline_u32 = *Deadline_ptr + Cycles_u32;
+    uint32 f_Now_u32 = PORT_HW_BITBANG_GET_CYCLES();
+
+    if ((sint32)(f_Now_u32 - f_Deadline_u32) >= 0)
+    {
+        /* Phase overran, it already lasted Cycles_u32: restart the schedule from now */
+        f_Deadline_u32 = f_Now_u32;
+    }
+    else
+    {
+        while ((sint32)(PORT_HW_BITBANG_GET_CYCLES() - f_Deadline_u32) < 0)
+        {
+            /* Busy wait, the edge that follows is written at the deadline */
+        }
+    }
+    *Deadline_ptr = f_Deadline_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangPull
+* Description   : Pulls an open-drain line low (pin to output, PDOR cleared at init)
+*
+******************************************************************************/
+LOCAL_INLINE void PortHw_BitBangPull(const PortHw_BitBangOpenDrainType* Line_ptr)
+{
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+    PORT_HW_BITBAND_WRITE32(&Line_ptr->GpioBase_ptr->PDDR, Line_ptr->Pin_u8, 1U);
+#else
+    PortHw_SetPinsDirection(Line_ptr->GpioBase_ptr, Line_ptr->PinMask_u32, PORT_HW_PIN_OUT);
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangRelease
+* Description   : Releases an open-drain line (pin to input, the pull-up drives it high)
+*
+******************************************************************************/
+LOCAL_INLINE void PortHw_BitBangRelease(const PortHw_BitBangOpenDrainType* Line_ptr)
+{
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+    PORT_HW_BITBAND_WRITE32(&Line_ptr->GpioBase_ptr->PDDR, Line_ptr->Pin_u8, 0U);
+#else
+    PortHw_SetPinsDirection(Line_ptr->GpioBase_ptr, Line_ptr->PinMask_u32, PORT_HW_PIN_IN);
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangDriveLocked
+* Description   : Pulls (Pull_u32 = 1) or releases (Pull_u32 = 0) an open-drain line inside
+*                 exclusive area 11. The area holds the lock of the port, so PDDR is written
+*                 directly rather than through PortHw_SetPinsDirection(), which enters area 09.
+*
+******************************************************************************/
+LOCAL_INLINE void PortHw_BitBangDriveLocked(const PortHw_BitBangOpenDrainType* Line_ptr, uint32 Pull_u32)
+{
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+    PORT_HW_BITBAND_WRITE32(&Line_ptr->GpioBase_ptr->PDDR, Line_ptr->Pin_u8, Pull_u32);
+#elif (STD_ON == PORT_HW_ATOMIC_RMW)
+    PortHw_AtomicModify32(&Line_ptr->GpioBase_ptr->PDDR, Line_ptr->PinMask_u32, (0U != Pull_u32) ? Line_ptr->PinMask_u32 : 0U);
+#else
+    uint32 f_Pddr_u32 = PORT_HW_REG_READ32(&Line_ptr->GpioBase_ptr->PDDR);
+
+    f_Pddr_u32 = (0U != Pull_u32) ? (f_Pddr_u32 | Line_ptr->PinMask_u32) : (f_Pddr_u32 & ~Line_ptr->PinMask_u32);
+    PORT_HW_REG_WRITE32(&Line_ptr->GpioBase_ptr->PDDR, f_Pddr_u32);
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangSample
+* Description   : Samples an open-drain line, returns 0 when low
+*
+******************************************************************************/
+LOCAL_INLINE uint32 PortHw_BitBangSample(const PortHw_BitBangOpenDrainType* Line_ptr)
+{
+    return PORT_HW_REG_READ32(&Line_ptr->GpioBase_ptr->PDIR) & Line_ptr->PinMask_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangSpiByteCpha0
+* Description   : Shifts one byte with CPHA 0: MOSI changes before the leading edge,
+*                 MISO is sampled on the leading edge
+*
+******************************************************************************/
+static uint8 PortHw_BitBangSpiByteCpha0(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 FirstPhase_u32,
+    uint8 TxByte_u8
+)
+{
+    volatile uint32* const f_SckToggle_ptr = &Config_ptr->Sck_st.GpioBase_ptr->PTOR;
+    volatile uint32* const f_MosiSet_ptr = &Config_ptr->Mosi_st.GpioBase_ptr->PSOR;
+    volatile uint32* const f_MosiClear_ptr = &Config_ptr->Mosi_st.GpioBase_ptr->PCOR;
+    const volatile uint32* const f_MisoIn_ptr = &Config_ptr->Miso_st.GpioBase_ptr->PDIR;
+    const uint32 f_SckMask_u32 = Config_ptr->Sck_st.PinMask_u32;
+    const uint32 f_MosiMask_u32 = Config_ptr->Mosi_st.PinMask_u32;
+    const uint32 f_MisoMask_u32 = Config_ptr->Miso_st.PinMask_u32;
+    const uint32 f_Half_u32 = Config_ptr->Timing_ptr->HalfPeriod_u32;
+    uint32 f_Phase_u32 = FirstPhase_u32;
+    uint32 f_Out_u32 = TxByte_u8;
+    uint32 f_In_u32 = 0U;
+    uint32 f_Bit_u32;
+
+    for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+    {
+        PORT_HW_REG_WRITE32((0U != (f_Out_u32 & 0x80U)) ? f_MosiSet_ptr : f_MosiClear_ptr, f_MosiMask_u32);
+        f_Out_u32 <<= 1U;
+        PortHw_BitBangWait(Deadline_ptr, f_Phase_u32);
+        PORT_HW_REG_WRITE32(f_SckToggle_ptr, f_SckMask_u32);
+        f_In_u32 = (f_In_u32 << 1U) | ((0U != (PORT_HW_REG_READ32(f_MisoIn_ptr) & f_MisoMask_u32)) ? 1U : 0U);
+        PortHw_BitBangWait(Deadline_ptr, f_Half_u32);
+        PORT_HW_REG_WRITE32(f_SckToggle_ptr, f_SckMask_u32);
+        f_Phase_u32 = f_Half_u32;
+    }
+
+    return (uint8)f_In_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangSpiByteCpha1
+* Description   : Shifts one byte with CPHA 1: MOSI changes on the leading edge,
+*                 MISO is sampled on the trailing edge
+*
+******************************************************************************/
+static uint8 PortHw_BitBangSpiByteCpha1(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 FirstPhase_u32,
+    uint8 TxByte_u8
+)
+{
+    volatile uint32* const f_SckToggle_ptr = &Config_ptr->Sck_st.GpioBase_ptr->PTOR;
+    volatile uint32* const f_MosiSet_ptr = &Config_ptr->Mosi_st.GpioBase_ptr->PSOR;
+    volatile uint32* const f_MosiClear_ptr = &Config_ptr->Mosi_st.GpioBase_ptr->PCOR;
+    const volatile uint32* const f_MisoIn_ptr = &Config_ptr->Miso_st.GpioBase_ptr->PDIR;
+    const uint32 f_SckMask_u32 = Config_ptr->Sck_st.PinMask_u32;
+    const uint32 f_MosiMask_u32 = Config_ptr->Mosi_st.PinMask_u32;
+    const uint32 f_MisoMask_u32 = Config_ptr->Miso_st.PinMask_u32;
+    const uint32 f_Half_u32 = Config_ptr->Timing_ptr->HalfPeriod_u32;
+    uint32 f_Phase_u32 = FirstPhase_u32;
+    uint32 f_Out_u32 = TxByte_u8;
+    uint32 f_In_u32 = 0U;
+    uint32 f_Bit_u32;
+
+    for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+    {
+        PortHw_BitBangWait(Deadline_ptr, f_Phase_u32);
+        PORT_HW_REG_WRITE32(f_SckToggle_ptr, f_SckMask_u32);
+        PORT_HW_REG_WRITE32((0U != (f_Out_u32 & 0x80U)) ? f_MosiSet_ptr : f_MosiClear_ptr, f_MosiMask_u32);
+        f_Out_u32 <<= 1U;
+        PortHw_BitBangWait(Deadline_ptr, f_Half_u32);
+        PORT_HW_REG_WRITE32(f_SckToggle_ptr, f_SckMask_u32);
+        f_In_u32 = (f_In_u32 << 1U) | ((0U != (PORT_HW_REG_READ32(f_MisoIn_ptr) & f_MisoMask_u32)) ? 1U : 0U);
+        f_Phase_u32 = f_Half_u32;
+    }
+
+    return (uint8)f_In_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cStart
+* Description   : START from an idle bus or repeated START after an acknowledge bit,
+*                 returns with SCL low
+*
+******************************************************************************/
+static void PortHw_BitBangI2cStart(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    boolean Repeated_boo
+)
+{
+    const PortHw_BitBangI2cTimingType* f_Timing_ptr = Config_ptr->Timing_ptr;
+
+    if (TRUE == Repeated_boo)
+    {
+        /* SCL is low, SDA may still be held by the acknowledge */
+        PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->HdDat_u32);
+        PortHw_BitBangRelease(&Config_ptr->Sda_st);
+        PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->Low_u32 - f_Timing_ptr->HdDat_u32);
+        PortHw_BitBangRelease(&Config_ptr->Scl_st);
+        PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->SuSta_u32);
+    }
+    else
+    {
+        /* Bus idle, both lines released */
+    }
+    PortHw_BitBangPull(&Config_ptr->Sda_st);
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->HdSta_u32);
+    PortHw_BitBangPull(&Config_ptr->Scl_st);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cStop
+* Description   : STOP after an acknowledge bit, returns with the bus idle
+*
+******************************************************************************/
+static void PortHw_BitBangI2cStop(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr
+)
+{
+    const PortHw_BitBangI2cTimingType* f_Timing_ptr = Config_ptr->Timing_ptr;
+
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->HdDat_u32);
+    PortHw_BitBangPull(&Config_ptr->Sda_st);
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->Low_u32 - f_Timing_ptr->HdDat_u32);
+    PortHw_BitBangRelease(&Config_ptr->Scl_st);
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->SuSto_u32);
+    PortHw_BitBangRelease(&Config_ptr->Sda_st);
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->Buf_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cBit
+* Description   : One SCL clock with SCL low on entry and exit. SDA is driven with Bit_u32
+*                 (1 releases it) and sampled at the end of the SCL high time.
+*
+******************************************************************************/
+static uint32 PortHw_BitBangI2cBit(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint32 Bit_u32
+)
+{
+    const PortHw_BitBangI2cTimingType* f_Timing_ptr = Config_ptr->Timing_ptr;
+    uint32 f_Sda_u32;
+
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->HdDat_u32);
+    if (0U != Bit_u32)
+    {
+        PortHw_BitBangRelease(&Config_ptr->Sda_st);
+    }
+    else
+    {
+        PortHw_BitBangPull(&Config_ptr->Sda_st);
+    }
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->Low_u32 - f_Timing_ptr->HdDat_u32);
+    PortHw_BitBangRelease(&Config_ptr->Scl_st);
+    PortHw_BitBangWait(Deadline_ptr, f_Timing_ptr->High_u32);
+    f_Sda_u32 = PortHw_BitBangSample(&Config_ptr->Sda_st);
+    PortHw_BitBangPull(&Config_ptr->Scl_st);
+
+    return f_Sda_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cWriteByte
+* Description   : Writes one byte MSB first and reads the acknowledge bit
+*
+******************************************************************************/
+static Std_ReturnType PortHw_BitBangI2cWriteByte(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    uint8 Byte_u8
+)
+{
+    uint32 f_Bit_u32;
+
+    for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+    {
+        (void)PortHw_BitBangI2cBit(Config_ptr, Deadline_ptr, (uint32)Byte_u8 & (0x80UL >> f_Bit_u32));
+    }
+
+    /* The slave acknowledges by holding SDA low */
+    return (0U == PortHw_BitBangI2cBit(Config_ptr, Deadline_ptr, 1U)) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cReadByte
+* Description   : Reads one byte MSB first and sends an acknowledge or a not acknowledge
+*
+******************************************************************************/
+static uint8 PortHw_BitBangI2cReadByte(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint32* Deadline_ptr,
+    boolean Ack_boo
+)
+{
+    uint32 f_Bit_u32;
+    uint32 f_Byte_u32 = 0U;
+
+    for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+    {
+        f_Byte_u32 = (f_Byte_u32 << 1U) | ((0U != PortHw_BitBangI2cBit(Config_ptr, Deadline_ptr, 1U)) ? 1U : 0U);
+    }
+    (void)PortHw_BitBangI2cBit(Config_ptr, Deadline_ptr, (TRUE == Ack_boo) ? 0U : 1U);
+
+    return (uint8)f_Byte_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangOneWireSlot
+* Description   : One 1-Wire time slot: write 0, write 1 or read (written as a 1). The low
+*                 pulse and the sample point are timed with interrupts locked by exclusive
+*                 area 11, the recovery time is not. Returns the sampled line.
+*
+******************************************************************************/
+static uint32 PortHw_BitBangOneWireSlot(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    uint32 Bit_u32
+)
+{
+    const PortHw_BitBangOneWireTimingType* f_Timing_ptr = Config_ptr->Timing_ptr;
+    uint32 f_Deadline_u32;
+    uint32 f_Line_u32;
+
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_11, PORT_HW_GPIO_INDEX_U8(Config_ptr->Line_st.GpioBase_ptr));
+    f_Deadline_u32 = PORT_HW_BITBANG_GET_CYCLES();
+    PortHw_BitBangDriveLocked(&Config_ptr->Line_st, 1U);
+    if (0U != Bit_u32)
+    {
+        PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->WriteOneLow_u32);
+        PortHw_BitBangDriveLocked(&Config_ptr->Line_st, 0U);
+        PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->ReadSample_u32);
+        f_Line_u32 = PortHw_BitBangSample(&Config_ptr->Line_st);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_11, PORT_HW_GPIO_INDEX_U8(Config_ptr->Line_st.GpioBase_ptr));
+        PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->ReadRelease_u32);
+    }
+    else
+    {
+        PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->WriteZeroLow_u32);
+        PortHw_BitBangDriveLocked(&Config_ptr->Line_st, 0U);
+        PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_11, PORT_HW_GPIO_INDEX_U8(Config_ptr->Line_st.GpioBase_ptr));
+        f_Line_u32 = 0U;
+        PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->WriteZeroRelease_u32);
+    }
+
+    return f_Line_u32;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangInit
+* Description   : Starts the cycle counter used by the bit-bang engine
+*
+* @implements Port_Hw_BitBangInit_Activity
+******************************************************************************/
+void PortHw_BitBangInit(void)
+{
+    PORT_HW_BITBANG_START_CYCLES();
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangSpiInit
+* Description   : Drives the SPI lines to their idle level
+*
+* @implements Port_Hw_BitBangSpiInit_Activity
+******************************************************************************/
+void PortHw_BitBangSpiInit(
+    const PortHw_BitBangSpiConfigType* Config_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr != NULL_PTR);
+
+    PORT_HW_REG_WRITE32(&Config_ptr->Cs_st.GpioBase_ptr->PSOR, Config_ptr->Cs_st.PinMask_u32);
+    if (0U != ((uint32)Config_ptr->Mode_en & PORT_HW_BITBANG_SPI_CPOL_U32))
+    {
+        PORT_HW_REG_WRITE32(&Config_ptr->Sck_st.GpioBase_ptr->PSOR, Config_ptr->Sck_st.PinMask_u32);
+    }
+    else
+    {
+        PORT_HW_REG_WRITE32(&Config_ptr->Sck_st.GpioBase_ptr->PCOR, Config_ptr->Sck_st.PinMask_u32);
+    }
+    PORT_HW_REG_WRITE32(&Config_ptr->Mosi_st.GpioBase_ptr->PCOR, Config_ptr->Mosi_st.PinMask_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangSpiTransfer
+* Description   : Full-duplex SPI transfer, MSB first, framed by CS. SCK is toggled through
+*                 PTOR, so both clock polarities share the same code.
+*
+* @implements Port_Hw_BitBangSpiTransfer_Activity
+******************************************************************************/
+void PortHw_BitBangSpiTransfer(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    const uint8* TxData_ptr,
+    uint8* RxData_ptr,
+    uint32 Length_u32
+)
+{
+    const PortHw_BitBangSpiTimingType* f_Timing_ptr;
+    uint32 f_Deadline_u32;
+    uint32 f_Phase_u32;
+    uint32 f_Index_u32;
+    uint8 f_TxByte_u8;
+    uint8 f_RxByte_u8;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr != NULL_PTR);
+
+    f_Timing_ptr = Config_ptr->Timing_ptr;
+    f_Phase_u32 = f_Timing_ptr->CsSetup_u32;
+
+    f_Deadline_u32 = PORT_HW_BITBANG_GET_CYCLES();
+    PORT_HW_REG_WRITE32(&Config_ptr->Cs_st.GpioBase_ptr->PCOR, Config_ptr->Cs_st.PinMask_u32);
+    for (f_Index_u32 = 0U; f_Index_u32 < Length_u32; f_Index_u32++)
+    {
+        f_TxByte_u8 = (NULL_PTR != TxData_ptr) ? TxData_ptr[f_Index_u32] : PORT_HW_BITBANG_SPI_FILL_U8;
+        if (0U != ((uint32)Config_ptr->Mode_en & PORT_HW_BITBANG_SPI_CPHA_U32))
+        {
+            f_RxByte_u8 = PortHw_BitBangSpiByteCpha1(Config_ptr, &f_Deadline_u32, f_Phase_u32, f_TxByte_u8);
+        }
+        else
+        {
+            f_RxByte_u8 = PortHw_BitBangSpiByteCpha0(Config_ptr, &f_Deadline_u32, f_Phase_u32, f_TxByte_u8);
+        }
+        if (NULL_PTR != RxData_ptr)
+        {
+            RxData_ptr[f_Index_u32] = f_RxByte_u8;
+        }
+        f_Phase_u32 = f_Timing_ptr->HalfPeriod_u32;
+    }
+    PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->CsHold_u32);
+    PORT_HW_REG_WRITE32(&Config_ptr->Cs_st.GpioBase_ptr->PSOR, Config_ptr->Cs_st.PinMask_u32);
+    PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->CsIdle_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cInit
+* Description   : Clears the output latch of both lines and releases them
+*
+* @implements Port_Hw_BitBangI2cInit_Activity
+******************************************************************************/
+void PortHw_BitBangI2cInit(
+    const PortHw_BitBangI2cConfigType* Config_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr->HdDat_u32 <= Config_ptr->Timing_ptr->Low_u32);
+
+    PortHw_BitBangRelease(&Config_ptr->Scl_st);
+    PortHw_BitBangRelease(&Config_ptr->Sda_st);
+    /* A pulled line is an output driving 0 */
+    PORT_HW_REG_WRITE32(&Config_ptr->Scl_st.GpioBase_ptr->PCOR, Config_ptr->Scl_st.PinMask_u32);
+    PORT_HW_REG_WRITE32(&Config_ptr->Sda_st.GpioBase_ptr->PCOR, Config_ptr->Sda_st.PinMask_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangI2cTransfer
+* Description   : I2C write, read or write then read of a 7-bit address slave
+*
+* @implements Port_Hw_BitBangI2cTransfer_Activity
+******************************************************************************/
+Std_ReturnType PortHw_BitBangI2cTransfer(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint8 Address_u8,
+    const uint8* TxData_ptr,
+    uint32 TxLength_u32,
+    uint8* RxData_ptr,
+    uint32 RxLength_u32
+)
+{
+    Std_ReturnType f_Result_u8 = (Std_ReturnType)E_OK;
+    boolean f_Written_boo = FALSE;
+    uint32 f_Deadline_u32;
+    uint32 f_Index_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((TxData_ptr != NULL_PTR) || (0U == TxLength_u32));
+    PORT_HW_DEV_ASSERT((RxData_ptr != NULL_PTR) || (0U == RxLength_u32));
+
+    f_Deadline_u32 = PORT_HW_BITBANG_GET_CYCLES();
+    PortHw_BitBangI2cStart(Config_ptr, &f_Deadline_u32, FALSE);
+
+    if ((0U != TxLength_u32) || (0U == RxLength_u32))
+    {
+        f_Result_u8 = PortHw_BitBangI2cWriteByte(Config_ptr, &f_Deadline_u32, (uint8)(Address_u8 << 1U));
+        for (f_Index_u32 = 0U; (f_Index_u32 < TxLength_u32) && ((Std_ReturnType)E_OK == f_Result_u8); f_Index_u32++)
+        {
+            f_Result_u8 = PortHw_BitBangI2cWriteByte(Config_ptr, &f_Deadline_u32, TxData_ptr[f_Index_u32]);
+        }
+        f_Written_boo = TRUE;
+    }
+
+    if (((Std_ReturnType)E_OK == f_Result_u8) && (0U != RxLength_u32))
+    {
+        if (TRUE == f_Written_boo)
+        {
+            PortHw_BitBangI2cStart(Config_ptr, &f_Deadline_u32, TRUE);
+        }
+        f_Result_u8 = PortHw_BitBangI2cWriteByte(Config_ptr, &f_Deadline_u32,
+                                                 (uint8)((uint8)(Address_u8 << 1U) | PORT_HW_BITBANG_I2C_READ_U8));
+        for (f_Index_u32 = 0U; (f_Index_u32 < RxLength_u32) && ((Std_ReturnType)E_OK == f_Result_u8); f_Index_u32++)
+        {
+            /* The last byte is not acknowledged, the slave then releases SDA for the STOP */
+            RxData_ptr[f_Index_u32] = PortHw_BitBangI2cReadByte(Config_ptr, &f_Deadline_u32,
+                                                                 (boolean)((f_Index_u32 + 1U) < RxLength_u32));
+        }
+    }
+
+    PortHw_BitBangI2cStop(Config_ptr, &f_Deadline_u32);
+
+    return f_Result_u8;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangOneWireInit
+* Description   : Clears the output latch of the line and releases it
+*
+* @implements Port_Hw_BitBangOneWireInit_Activity
+******************************************************************************/
+void PortHw_BitBangOneWireInit(
+    const PortHw_BitBangOneWireConfigType* Config_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr != NULL_PTR);
+
+    PortHw_BitBangRelease(&Config_ptr->Line_st);
+    PORT_HW_REG_WRITE32(&Config_ptr->Line_st.GpioBase_ptr->PCOR, Config_ptr->Line_st.PinMask_u32);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangOneWireReset
+* Description   : Reset pulse and presence detection
+*
+* @implements Port_Hw_BitBangOneWireReset_Activity
+******************************************************************************/
+Std_ReturnType PortHw_BitBangOneWireReset(
+    const PortHw_BitBangOneWireConfigType* Config_ptr
+)
+{
+    const PortHw_BitBangOneWireTimingType* f_Timing_ptr;
+    uint32 f_Deadline_u32;
+    uint32 f_Line_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Config_ptr->Timing_ptr != NULL_PTR);
+
+    f_Timing_ptr = Config_ptr->Timing_ptr;
+
+    f_Deadline_u32 = PORT_HW_BITBANG_GET_CYCLES();
+    PortHw_BitBangPull(&Config_ptr->Line_st);
+    PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->ResetLow_u32);
+    /* The presence pulse window starts at the release */
+    PORT_HW_ENTER_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_11, PORT_HW_GPIO_INDEX_U8(Config_ptr->Line_st.GpioBase_ptr));
+    PortHw_BitBangDriveLocked(&Config_ptr->Line_st, 0U);
+    PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->PresenceSample_u32);
+    f_Line_u32 = PortHw_BitBangSample(&Config_ptr->Line_st);
+    PORT_HW_EXIT_EXCLUSIVE_AREA(PORT_EXCLUSIVE_AREA_11, PORT_HW_GPIO_INDEX_U8(Config_ptr->Line_st.GpioBase_ptr));
+    PortHw_BitBangWait(&f_Deadline_u32, f_Timing_ptr->ResetRelease_u32);
+
+    return (0U == f_Line_u32) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangOneWireWrite
+* Description   : Writes bytes on the 1-Wire line, LSB first
+*
+* @implements Port_Hw_BitBangOneWireWrite_Activity
+******************************************************************************/
+void PortHw_BitBangOneWireWrite(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    const uint8* Data_ptr,
+    uint32 Length_u32
+)
+{
+    uint32 f_Index_u32;
+    uint32 f_Bit_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Data_ptr != NULL_PTR) || (0U == Length_u32));
+
+    for (f_Index_u32 = 0U; f_Index_u32 < Length_u32; f_Index_u32++)
+    {
+        for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+        {
+            (void)PortHw_BitBangOneWireSlot(Config_ptr, (uint32)Data_ptr[f_Index_u32] & (1UL << f_Bit_u32));
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_BitBangOneWireRead
+* Description   : Reads bytes from the 1-Wire line, LSB first
+*
+* @implements Port_Hw_BitBangOneWireRead_Activity
+******************************************************************************/
+void PortHw_BitBangOneWireRead(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    uint8* Data_ptr,
+    uint32 Length_u32
+)
+{
+    uint32 f_Index_u32;
+    uint32 f_Bit_u32;
+    uint32 f_Byte_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Data_ptr != NULL_PTR) || (0U == Length_u32));
+
+    for (f_Index_u32 = 0U; f_Index_u32 < Length_u32; f_Index_u32++)
+    {
+        f_Byte_u32 = 0U;
+        for (f_Bit_u32 = 0U; f_Bit_u32 < 8U; f_Bit_u32++)
+        {
+            if (0U != PortHw_BitBangOneWireSlot(Config_ptr, 1U))
+            {
+                f_Byte_u32 |= (1UL << f_Bit_u32);
+            }
+        }
+        Data_ptr[f_Index_u32] = (uint8)f_Byte_u32;
+    }
+}
+
+#define PORT_STOP_SEC_CODE
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,347 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_BitBang.h
+*
+*   @brief   Port Hardware bit-bang engine header file
+*   @details Software SPI (modes 0-3), I2C master and 1-Wire master on GPIO pins. Lines are
+*            driven with PSOR/PCOR/PTOR writes and sampled from PDIR, all pin masks are
+*            resolved off-line. Every phase of a protocol is taken from a timing table in
+*            core cycles and scheduled on absolute DWT cycle counter deadlines, so the code
+*            between two edges does not add to the bit time.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifndef PORT_HW_BITBANG_H
+#define PORT_HW_BITBANG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_BITBANG_VENDOR_ID_H                    43
+#define PORT_HW_BITBANG_AR_RELEASE_MAJOR_VERSION_H     21
+#define PORT_HW_BITBANG_AR_RELEASE_MINOR_VERSION_H     11
+#define PORT_HW_BITBANG_AR_RELEASE_REVISION_VERSION_H  0
+#define PORT_HW_BITBANG_SW_MAJOR_VERSION_H             1
+#define PORT_HW_BITBANG_SW_MINOR_VERSION_H             0
+#define PORT_HW_BITBANG_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_BitBang.h and Port_Hw.h are of the same vendor */
+#if (PORT_HW_BITBANG_VENDOR_ID_H != PORT_HW_VENDOR_ID_H)
+    #error "Port_Hw_BitBang.h and Port_Hw.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_BitBang.h and Port_Hw.h are of the same Autosar version */
+#if ((PORT_HW_BITBANG_AR_RELEASE_MAJOR_VERSION_H    != PORT_HW_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_BITBANG_AR_RELEASE_MINOR_VERSION_H    != PORT_HW_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_BITBANG_AR_RELEASE_REVISION_VERSION_H != PORT_HW_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_BitBang.h and Port_Hw.h are different"
+#endif
+
+/* Check if Port_Hw_BitBang.h and Port_Hw.h are of the same software version */
+#if ((PORT_HW_BITBANG_SW_MAJOR_VERSION_H != PORT_HW_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_BITBANG_SW_MINOR_VERSION_H != PORT_HW_SW_MINOR_VERSION_H) || \
+     (PORT_HW_BITBANG_SW_PATCH_VERSION_H != PORT_HW_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_BitBang.h and Port_Hw.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Convert a time in ns to core cycles, rounded up
+* @details Used to build the timing tables, e.g. PORT_HW_BITBANG_NS_TO_CYCLES(4700U, 80U) for
+*          the 4.7 us SCL low time of standard mode I2C at 80 MHz.
+*/
+#define PORT_HW_BITBANG_NS_TO_CYCLES(ns, coreMhz) \
+    ((uint32)(((((uint32)(ns)) * ((uint32)(coreMhz))) + 999UL) / 1000UL))
+
+/**
+* @brief Cycle counter read by the engine
+* @details Cortex-M4 DWT CYCCNT. Can be overridden by the test environment, which counts
+*          simulated cycles instead.
+*/
+#ifndef PORT_HW_BITBANG_GET_CYCLES
+    #define PORT_HW_BITBANG_GET_CYCLES()        (*(const volatile uint32*)0xE0001004UL)
+#endif
+
+/**
+* @brief Start the cycle counter read by the engine (DEMCR[TRCENA], DWT_CTRL[CYCCNTENA])
+*/
+#ifndef PORT_HW_BITBANG_START_CYCLES
+    #define PORT_HW_BITBANG_START_CYCLES()                                   \
+        do                                                                   \
+        {                                                                    \
+            (*(volatile uint32*)0xE000EDFCUL) |= (uint32)0x01000000UL;      \
+            (*(volatile uint32*)0xE0001000UL) |= (uint32)0x00000001UL;      \
+        } while (0)
+#endif
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+/**
+* @brief SPI mode: bit 1 is CPOL (SCK idle level), bit 0 is CPHA (sample on trailing edge)
+*/
+typedef enum PortHw_BitBangSpiModeType_t
+{
+    PORT_HW_BITBANG_SPI_MODE_0 = 0U,    /**< @brief CPOL 0, CPHA 0 */
+    PORT_HW_BITBANG_SPI_MODE_1 = 1U,    /**< @brief CPOL 0, CPHA 1 */
+    PORT_HW_BITBANG_SPI_MODE_2 = 2U,    /**< @brief CPOL 1, CPHA 0 */
+    PORT_HW_BITBANG_SPI_MODE_3 = 3U     /**< @brief CPOL 1, CPHA 1 */
+} PortHw_BitBangSpiModeType;
+
+/*==================================================================================================
+*                                 STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief   Open-drain line
+* @details The S32K144 pads have no open-drain enable: the line is pulled low by switching
+*          the pin to output with PDOR cleared and released by switching it back to input
+*          (external pull-up). The pin number addresses the PDDR bit-band alias.
+*/
+typedef struct PortHw_BitBangOpenDrainType_t
+{
+    GPIO_Type*                  GpioBase_ptr;       /**< @brief Pointer to GPIO peripheral base */
+    uint32                      PinMask_u32;        /**< @brief Pin of the line (bit n = pin n) */
+    uint8                       Pin_u8;             /**< @brief Pin number of the line */
+} PortHw_BitBangOpenDrainType;
+
+/**
+* @brief   SPI timing in core cycles
+*/
+typedef struct PortHw_BitBangSpiTimingType_t
+{
+    uint32                      CsSetup_u32;        /**< @brief CS asserted to first SCK edge */
+    uint32                      HalfPeriod_u32;     /**< @brief SCK high and SCK low time */
+    uint32                      CsHold_u32;         /**< @brief Last SCK edge to CS released */
+    uint32                      CsIdle_u32;         /**< @brief CS released to return of the transfer */
+} PortHw_BitBangSpiTimingType;
+
+/**
+* @brief   SPI master configuration
+* @details SCK, MOSI and CS are GPIO outputs, MISO a GPIO input, configured by Port_Init().
+*          CS is active low.
+*/
+typedef struct PortHw_BitBangSpiConfigType_t
+{
+    PortHw_PinMaskType                  Sck_st;         /**< @brief Clock output */
+    PortHw_PinMaskType                  Mosi_st;        /**< @brief Data output */
+    PortHw_PinMaskType                  Miso_st;        /**< @brief Data input */
+    PortHw_PinMaskType                  Cs_st;          /**< @brief Chip select output */
+    PortHw_BitBangSpiModeType           Mode_en;        /**< @brief Clock polarity and phase */
+    const PortHw_BitBangSpiTimingType*  Timing_ptr;     /**< @brief Timing table */
+} PortHw_BitBangSpiConfigType;
+
+/**
+* @brief   I2C timing in core cycles (I2C-bus specification symbols)
+*/
+typedef struct PortHw_BitBangI2cTimingType_t
+{
+    uint32                      HdSta_u32;          /**< @brief tHD;STA, START to first SCL fall */
+    uint32                      SuSta_u32;          /**< @brief tSU;STA, SCL rise to repeated START */
+    uint32                      Low_u32;            /**< @brief tLOW, SCL low time */
+    uint32                      High_u32;           /**< @brief tHIGH, SCL high time */
+    uint32                      HdDat_u32;          /**< @brief tHD;DAT, SCL fall to SDA change, below Low_u32 */
+    uint32                      SuSto_u32;          /**< @brief tSU;STO, SCL rise to STOP */
+    uint32                      Buf_u32;            /**< @brief tBUF, STOP to return of the transfer */
+} PortHw_BitBangI2cTimingType;
+
+/**
+* @brief   I2C master configuration
+* @details Single master, no clock stretching. Both lines are open-drain GPIO pins with an
+*          external pull-up, configured as inputs by Port_Init().
+*/
+typedef struct PortHw_BitBangI2cConfigType_t
+{
+    PortHw_BitBangOpenDrainType         Scl_st;         /**< @brief Clock line */
+    PortHw_BitBangOpenDrainType         Sda_st;         /**< @brief Data line */
+    const PortHw_BitBangI2cTimingType*  Timing_ptr;     /**< @brief Timing table */
+} PortHw_BitBangI2cConfigType;
+
+/**
+* @brief   1-Wire timing in core cycles (Maxim AN126 symbols)
+*/
+typedef struct PortHw_BitBangOneWireTimingType_t
+{
+    uint32                      WriteOneLow_u32;    /**< @brief A, low time of a write 1 and read slot */
+    uint32                      WriteOneRelease_u32;/**< @brief B, release time of a write 1 slot */
+    uint32                      WriteZeroLow_u32;   /**< @brief C, low time of a write 0 slot */
+    uint32                      WriteZeroRelease_u32;/**< @brief D, release time of a write 0 slot */
+    uint32                      ReadSample_u32;     /**< @brief E, release to sample of a read slot */
+    uint32                      ReadRelease_u32;    /**< @brief F, sample to end of a read slot */
+    uint32                      ResetLow_u32;       /**< @brief H, reset pulse */
+    uint32                      PresenceSample_u32; /**< @brief I, release to presence sample */
+    uint32                      ResetRelease_u32;   /**< @brief J, presence sample to end of reset */
+} PortHw_BitBangOneWireTimingType;
+
+/**
+* @brief   1-Wire master configuration
+* @details The line is an open-drain GPIO pin with an external pull-up, configured as input
+*          by Port_Init().
+*/
+typedef struct PortHw_BitBangOneWireConfigType_t
+{
+    PortHw_BitBangOpenDrainType             Line_st;    /**< @brief Data line */
+    const PortHw_BitBangOneWireTimingType*  Timing_ptr; /**< @brief Timing table */
+} PortHw_BitBangOneWireConfigType;
+
+/*==================================================================================================
+*                                 GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief   Starts the cycle counter used by the bit-bang engine
+* @details Must be called once before any transfer.
+*/
+void PortHw_BitBangInit(void);
+
+/**
+* @brief   Drives the SPI lines to their idle level
+* @details CS released (high), SCK at CPOL, MOSI low.
+* @param[in] Config_ptr SPI master configuration
+*/
+void PortHw_BitBangSpiInit(
+    const PortHw_BitBangSpiConfigType* Config_ptr
+);
+
+/**
+* @brief   Full-duplex SPI transfer, MSB first, framed by CS
+* @param[in]  Config_ptr SPI master configuration
+* @param[in]  TxData_ptr Bytes sent on MOSI, NULL_PTR sends 0xFF
+* @param[out] RxData_ptr Bytes received on MISO, NULL_PTR discards them
+* @param[in]  Length_u32 Number of bytes
+*/
+void PortHw_BitBangSpiTransfer(
+    const PortHw_BitBangSpiConfigType* Config_ptr,
+    const uint8* TxData_ptr,
+    uint8* RxData_ptr,
+    uint32 Length_u32
+);
+
+/**
+* @brief   Releases both I2C lines
+* @param[in] Config_ptr I2C master configuration
+*/
+void PortHw_BitBangI2cInit(
+    const PortHw_BitBangI2cConfigType* Config_ptr
+);
+
+/**
+* @brief   I2C write, read or write then read (repeated START) of a 7-bit address slave
+* @details START, address + W, TxLength_u32 bytes, then if RxLength_u32 is not 0 a repeated
+*          START (or a START if nothing was written), address + R and RxLength_u32 bytes, the
+*          last one not acknowledged, then STOP. With both lengths 0 the slave is only
+*          addressed (probe).
+* @param[in]  Config_ptr I2C master configuration
+* @param[in]  Address_u8 7-bit slave address
+* @param[in]  TxData_ptr Bytes written
+* @param[in]  TxLength_u32 Number of bytes written
+* @param[out] RxData_ptr Bytes read
+* @param[in]  RxLength_u32 Number of bytes read
+* @return  E_OK if every address and written byte was acknowledged, E_NOT_OK otherwise
+*          (the transfer is ended with STOP at the first NACK)
+*/
+Std_ReturnType PortHw_BitBangI2cTransfer(
+    const PortHw_BitBangI2cConfigType* Config_ptr,
+    uint8 Address_u8,
+    const uint8* TxData_ptr,
+    uint32 TxLength_u32,
+    uint8* RxData_ptr,
+    uint32 RxLength_u32
+);
+
+/**
+* @brief   Releases the 1-Wire line
+* @param[in] Config_ptr 1-Wire master configuration
+*/
+void PortHw_BitBangOneWireInit(
+    const PortHw_BitBangOneWireConfigType* Config_ptr
+);
+
+/**
+* @brief   1-Wire reset and presence detection
+* @param[in] Config_ptr 1-Wire master configuration
+* @return  E_OK if a slave answered with a presence pulse, E_NOT_OK otherwise
+*/
+Std_ReturnType PortHw_BitBangOneWireReset(
+    const PortHw_BitBangOneWireConfigType* Config_ptr
+);
+
+/**
+* @brief   Writes bytes on the 1-Wire line, LSB first
+* @param[in] Config_ptr 1-Wire master configuration
+* @param[in] Data_ptr Bytes written
+* @param[in] Length_u32 Number of bytes
+*/
+void PortHw_BitBangOneWireWrite(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    const uint8* Data_ptr,
+    uint32 Length_u32
+);
+
+/**
+* @brief   Reads bytes from the 1-Wire line, LSB first
+* @param[in]  Config_ptr 1-Wire master configuration
+* @param[out] Data_ptr Bytes read
+* @param[in]  Length_u32 Number of bytes
+*/
+void PortHw_BitBangOneWireRead(
+    const PortHw_BitBangOneWireConfigType* Config_ptr,
+    uint8* Data_ptr,
+    uint32 Length_u32
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_BITBANG_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,386 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Capture.c
+*
+*   @brief   Port Hardware input capture (logic analyzer mode) source file
+*   @details The open run is kept in the capture state, only closed runs are written to the
+*            ring buffer, so the consumer never sees an entry that is still growing. The ring
+*            indexes run freely: the producer alone writes Head, the consumer alone writes
+*            Tail, Head - Tail is the fill level. A full ring drops the closing run and counts
+*            it, nothing is overwritten.
+*
+*            Timestamps come from PORT_HW_CAPTURE_GET_COUNTER(), the free-running 32-bit DWT
+*            cycle counter. Every sample reads it and adds the unsigned difference to the
+*            previous read to a 32-bit capture time, which is stored in the entries. The
+*            counter wrap needs no handling; the capture time wraps after 2^32 cycles.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw_Capture.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_CAPTURE_VENDOR_ID_C                    43
+#define PORT_HW_CAPTURE_AR_RELEASE_MAJOR_VERSION_C     21
+#define PORT_HW_CAPTURE_AR_RELEASE_MINOR_VERSION_C     11
+#define PORT_HW_CAPTURE_AR_RELEASE_REVISION_VERSION_C  0
+#define PORT_HW_CAPTURE_SW_MAJOR_VERSION_C             1
+#define PORT_HW_CAPTURE_SW_MINOR_VERSION_C             0
+#define PORT_HW_CAPTURE_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Capture.c and Port_Hw_Capture.h are of the same vendor */
+#if (PORT_HW_CAPTURE_VENDOR_ID_C != PORT_HW_CAPTURE_VENDOR_ID_H)
+    #error "Port_Hw_Capture.c and Port_Hw_Capture.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Capture.c and Port_Hw_Capture.h are of the same Autosar version */
+#if ((PORT_HW_CAPTURE_AR_RELEASE_MAJOR_VERSION_C    != PORT_HW_CAPTURE_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_CAPTURE_AR_RELEASE_MINOR_VERSION_C    != PORT_HW_CAPTURE_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_CAPTURE_AR_RELEASE_REVISION_VERSION_C != PORT_HW_CAPTURE_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Capture.c and Port_Hw_Capture.h are different"
+#endif
+
+/* Check if Port_Hw_Capture.c and Port_Hw_Capture.h are of the same software version */
+#if ((PORT_HW_CAPTURE_SW_MAJOR_VERSION_C != PORT_HW_CAPTURE_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_CAPTURE_SW_MINOR_VERSION_C != PORT_HW_CAPTURE_SW_MINOR_VERSION_H) || \
+     (PORT_HW_CAPTURE_SW_PATCH_VERSION_C != PORT_HW_CAPTURE_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Capture.c and Port_Hw_Capture.h are different"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Capture state
+*/
+typedef struct
+{
+    const PortHw_CaptureConfigType* Config_ptr;     /**< @brief Last started capture, its ring stays readable after the stop */
+    boolean Active_boo;                             /**< @brief TRUE between start and stop */
+    volatile uint32 Head_u32;                       /**< @brief Runs written, producer side */
+    volatile uint32 Tail_u32;                       /**< @brief Runs drained, consumer side */
+    uint32 LastCount_u32;                           /**< @brief Counter value of the last sample */
+    uint32 Time_u32;                                /**< @brief Ticks since the capture start */
+    PortHw_CaptureEntryType Open_st;                /**< @brief Run being sampled */
+    PortHw_CaptureStatsType Stats_st;               /**< @brief Statistics */
+} PortHw_CaptureStateType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Orders the entry stores before the index store that publishes them
+*/
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    #define PORT_HW_CAPTURE_BARRIER()               ASM_KEYWORD volatile ("DMB" ::: "memory")
+#elif defined(__GNUC__)
+    #define PORT_HW_CAPTURE_BARRIER()               __sync_synchronize()
+#else
+    #define PORT_HW_CAPTURE_BARRIER()
+#endif
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define PORT_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief State of the capture
+*/
+static PortHw_CaptureStateType PortHw_Capture_st;
+
+#define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+static void PortHw_CapturePush(const PortHw_CaptureEntryType* Entry_ptr);
+LOCAL_INLINE void PortHw_CaptureTake(const PortHw_CaptureConfigType* Config_ptr);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CapturePush
+* Description   : Writes a closed run to the ring buffer, drops it when the ring is full
+*
+******************************************************************************/
+static void PortHw_CapturePush(const PortHw_CaptureEntryType* Entry_ptr)
+{
+    const PortHw_CaptureConfigType* f_Config_ptr = PortHw_Capture_st.Config_ptr;
+    uint32 f_Head_u32 = PortHw_Capture_st.Head_u32;
+
+    if ((f_Head_u32 - PortHw_Capture_st.Tail_u32) < f_Config_ptr->Size_u32)
+    {
+        f_Config_ptr->Buffer_ptr[f_Head_u32 & (f_Config_ptr->Size_u32 - 1U)] = *Entry_ptr;
+        PORT_HW_CAPTURE_BARRIER();
+        PortHw_Capture_st.Head_u32 = f_Head_u32 + 1U;
+        PortHw_Capture_st.Stats_st.Runs_u32++;
+    }
+    else
+    {
+        PortHw_Capture_st.Stats_st.Dropped_u32++;
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureTake
+* Description   : Takes one sample: advances the capture time, reads PDIR of every captured
+*                 port and extends the open run or closes it
+*
+******************************************************************************/
+LOCAL_INLINE void PortHw_CaptureTake(const PortHw_CaptureConfigType* Config_ptr)
+{
+    uint32 f_Now_u32 = PORT_HW_CAPTURE_GET_COUNTER();
+    uint32 f_Value_au32[PORT_HW_CAPTURE_MAX_PORTS_U8];
+    uint32 f_Changed_u32 = 0U;
+    uint8 f_Port_u8;
+
+    /* Modulo 2^32: correct across a counter wrap */
+    PortHw_Capture_st.Time_u32 += f_Now_u32 - PortHw_Capture_st.LastCount_u32;
+    PortHw_Capture_st.LastCount_u32 = f_Now_u32;
+
+    for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+    {
+        f_Value_au32[f_Port_u8] = PORT_HW_REG_READ32(&Config_ptr->Ports_ptr[f_Port_u8].GpioBase_ptr->PDIR) &
+                                  Config_ptr->Ports_ptr[f_Port_u8].PinMask_u32;
+        f_Changed_u32 |= f_Value_au32[f_Port_u8] ^ PortHw_Capture_st.Open_st.Value_au32[f_Port_u8];
+    }
+
+    if ((0U == f_Changed_u32) && (0xFFFFFFFFUL != PortHw_Capture_st.Open_st.Length_u32))
+    {
+        PortHw_Capture_st.Open_st.Length_u32++;
+    }
+    else
+    {
+        PortHw_CapturePush(&PortHw_Capture_st.Open_st);
+        PortHw_Capture_st.Open_st.Timestamp_u32 = PortHw_Capture_st.Time_u32;
+        PortHw_Capture_st.Open_st.Length_u32 = 1U;
+        for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+        {
+            PortHw_Capture_st.Open_st.Value_au32[f_Port_u8] = f_Value_au32[f_Port_u8];
+        }
+    }
+    PortHw_Capture_st.Stats_st.Samples_u32++;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureStart
+* Description   : Starts a capture with an empty ring buffer, first sample at time 0
+*
+* @implements Port_Hw_CaptureStart_Activity
+******************************************************************************/
+void PortHw_CaptureStart(
+    const PortHw_CaptureConfigType* Config_ptr
+)
+{
+    uint8 f_Port_u8;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Config_ptr->NumPorts_u8 > 0U) && (Config_ptr->NumPorts_u8 <= PORT_HW_CAPTURE_MAX_PORTS_U8));
+    PORT_HW_DEV_ASSERT((Config_ptr->Size_u32 > 0U) && (0U == (Config_ptr->Size_u32 & (Config_ptr->Size_u32 - 1U))));
+
+    PortHw_Capture_st.Active_boo = FALSE;
+    PortHw_Capture_st.Head_u32 = 0U;
+    PortHw_Capture_st.Tail_u32 = 0U;
+    PortHw_Capture_st.Stats_st.Samples_u32 = 1U;
+    PortHw_Capture_st.Stats_st.Runs_u32 = 0U;
+    PortHw_Capture_st.Stats_st.Dropped_u32 = 0U;
+    PortHw_Capture_st.Time_u32 = 0U;
+    PORT_HW_CAPTURE_START_COUNTER();
+    PortHw_Capture_st.LastCount_u32 = PORT_HW_CAPTURE_GET_COUNTER();
+    PortHw_Capture_st.Open_st.Timestamp_u32 = 0U;
+    PortHw_Capture_st.Open_st.Length_u32 = 1U;
+    for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_CAPTURE_MAX_PORTS_U8; f_Port_u8++)
+    {
+        PortHw_Capture_st.Open_st.Value_au32[f_Port_u8] = 0U;
+    }
+    for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+    {
+        PortHw_Capture_st.Open_st.Value_au32[f_Port_u8] =
+            PORT_HW_REG_READ32(&Config_ptr->Ports_ptr[f_Port_u8].GpioBase_ptr->PDIR) &
+            Config_ptr->Ports_ptr[f_Port_u8].PinMask_u32;
+    }
+    PortHw_Capture_st.Config_ptr = Config_ptr;
+    PortHw_Capture_st.Active_boo = TRUE;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureSample
+* Description   : Takes one sample of the active capture
+*
+* @implements Port_Hw_CaptureSample_Activity
+******************************************************************************/
+void PortHw_CaptureSample(void)
+{
+    if (TRUE == PortHw_Capture_st.Active_boo)
+    {
+        PortHw_CaptureTake(PortHw_Capture_st.Config_ptr);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureRun
+* Description   : Takes samples back to back
+*
+* @implements Port_Hw_CaptureRun_Activity
+******************************************************************************/
+void PortHw_CaptureRun(
+    uint32 NumSamples_u32
+)
+{
+    const PortHw_CaptureConfigType* f_Config_ptr = PortHw_Capture_st.Config_ptr;
+    uint32 f_Sample_u32;
+
+    if (TRUE == PortHw_Capture_st.Active_boo)
+    {
+        for (f_Sample_u32 = 0U; f_Sample_u32 < NumSamples_u32; f_Sample_u32++)
+        {
+            PortHw_CaptureTake(f_Config_ptr);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureStop
+* Description   : Closes the open run and stops the capture
+*
+* @implements Port_Hw_CaptureStop_Activity
+******************************************************************************/
+void PortHw_CaptureStop(void)
+{
+    if (TRUE == PortHw_Capture_st.Active_boo)
+    {
+        PortHw_CapturePush(&PortHw_Capture_st.Open_st);
+        PortHw_Capture_st.Active_boo = FALSE;
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureDrain
+* Description   : Copies the oldest closed runs out of the ring buffer, consumer side
+*
+* @implements Port_Hw_CaptureDrain_Activity
+******************************************************************************/
+uint32 PortHw_CaptureDrain(
+    PortHw_CaptureEntryType Entries_ptr[],
+    uint32 MaxEntries_u32
+)
+{
+    const PortHw_CaptureConfigType* f_Config_ptr = PortHw_Capture_st.Config_ptr;
+    uint32 f_Tail_u32 = PortHw_Capture_st.Tail_u32;
+    uint32 f_Count_u32 = 0U;
+    uint32 f_Available_u32 = 0U;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT((Entries_ptr != NULL_PTR) || (0U == MaxEntries_u32));
+
+    if (NULL_PTR != f_Config_ptr)
+    {
+        f_Available_u32 = PortHw_Capture_st.Head_u32 - f_Tail_u32;
+    }
+    PORT_HW_CAPTURE_BARRIER();
+    while ((f_Count_u32 < f_Available_u32) && (f_Count_u32 < MaxEntries_u32))
+    {
+        Entries_ptr[f_Count_u32] = f_Config_ptr->Buffer_ptr[f_Tail_u32 & (f_Config_ptr->Size_u32 - 1U)];
+        f_Tail_u32++;
+        f_Count_u32++;
+    }
+    PORT_HW_CAPTURE_BARRIER();
+    PortHw_Capture_st.Tail_u32 = f_Tail_u32;
+
+    return f_Count_u32;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_CaptureGetStats
+* Description   : Reads the capture statistics
+*
+* @implements Port_Hw_CaptureGetStats_Activity
+******************************************************************************/
+void PortHw_CaptureGetStats(
+    PortHw_CaptureStatsType* Stats_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stats_ptr != NULL_PTR);
+
+    *Stats_ptr = PortHw_Capture_st.Stats_st;
+}
+
+#define PORT_STOP_SEC_CODE
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
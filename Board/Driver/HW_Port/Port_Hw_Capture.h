@@ -0,0 +1,224 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Capture.h
+*
+*   @brief   Port Hardware input capture (logic analyzer mode) header file
+*   @details Samples the PDIR of up to PORT_HW_CAPTURE_MAX_PORTS_U8 ports and stores the samples
+*            run-length encoded: one entry per run of identical samples, with the core cycle
+*            time of its first sample and the number of samples. Closed runs go to a
+*            single-producer/single-consumer ring buffer given by the caller, so the memory of
+*            a capture is bounded by the buffer and the consumer drains it without a lock.
+*            Tools/Port_CaptureVcd turns drained entries into a VCD file.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifndef PORT_HW_CAPTURE_H
+#define PORT_HW_CAPTURE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_CAPTURE_VENDOR_ID_H                    43
+#define PORT_HW_CAPTURE_AR_RELEASE_MAJOR_VERSION_H     21
+#define PORT_HW_CAPTURE_AR_RELEASE_MINOR_VERSION_H     11
+#define PORT_HW_CAPTURE_AR_RELEASE_REVISION_VERSION_H  0
+#define PORT_HW_CAPTURE_SW_MAJOR_VERSION_H             1
+#define PORT_HW_CAPTURE_SW_MINOR_VERSION_H             0
+#define PORT_HW_CAPTURE_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Capture.h and Port_Hw.h are of the same vendor */
+#if (PORT_HW_CAPTURE_VENDOR_ID_H != PORT_HW_VENDOR_ID_H)
+    #error "Port_Hw_Capture.h and Port_Hw.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Capture.h and Port_Hw.h are of the same Autosar version */
+#if ((PORT_HW_CAPTURE_AR_RELEASE_MAJOR_VERSION_H    != PORT_HW_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_CAPTURE_AR_RELEASE_MINOR_VERSION_H    != PORT_HW_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_CAPTURE_AR_RELEASE_REVISION_VERSION_H != PORT_HW_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Capture.h and Port_Hw.h are different"
+#endif
+
+/* Check if Port_Hw_Capture.h and Port_Hw.h are of the same software version */
+#if ((PORT_HW_CAPTURE_SW_MAJOR_VERSION_H != PORT_HW_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_CAPTURE_SW_MINOR_VERSION_H != PORT_HW_SW_MINOR_VERSION_H) || \
+     (PORT_HW_CAPTURE_SW_PATCH_VERSION_H != PORT_HW_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Capture.h and Port_Hw.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Number of ports one capture samples
+* @details Sets the size of a ring buffer entry: (2 + PORT_HW_CAPTURE_MAX_PORTS_U8) words.
+*/
+#ifndef PORT_HW_CAPTURE_MAX_PORTS_U8
+    #define PORT_HW_CAPTURE_MAX_PORTS_U8        ((uint8)2U)
+#endif
+
+/**
+* @brief Timestamp counter: Cortex-M4 DWT CYCCNT
+* @details Free-running over 32 bits, so the ticks between two samples are the unsigned
+*          difference of the two reads as long as the samples are less than 2^32 core cycles
+*          apart (53 s at 80 MHz). Can be overridden by the test environment, which counts
+*          simulated cycles instead.
+*/
+#ifndef PORT_HW_CAPTURE_GET_COUNTER
+    #define PORT_HW_CAPTURE_GET_COUNTER()       (*(const volatile uint32*)0xE0001004UL)
+#endif
+
+/**
+* @brief Start the timestamp counter (DEMCR[TRCENA], DWT_CTRL[CYCCNTENA])
+*/
+#ifndef PORT_HW_CAPTURE_START_COUNTER
+    #define PORT_HW_CAPTURE_START_COUNTER()                                  \
+        do                                                                   \
+        {                                                                    \
+            (*(volatile uint32*)0xE000EDFCUL) |= (uint32)0x01000000UL;      \
+            (*(volatile uint32*)0xE0001000UL) |= (uint32)0x00000001UL;      \
+        } while (0)
+#endif
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief One run of identical samples
+*/
+typedef struct PortHw_CaptureEntryType_t
+{
+    uint32 Timestamp_u32;                                   /**< @brief Core cycles from the capture start to the first sample of the run */
+    uint32 Length_u32;                                      /**< @brief Number of samples of the run */
+    uint32 Value_au32[PORT_HW_CAPTURE_MAX_PORTS_U8];        /**< @brief PDIR of every captured port, masked with its pin mask */
+} PortHw_CaptureEntryType;
+
+/**
+* @brief Capture configuration
+*/
+typedef struct PortHw_CaptureConfigType_t
+{
+    const PortHw_PinMaskType*   Ports_ptr;                  /**< @brief Captured ports and pins */
+    uint8                       NumPorts_u8;                /**< @brief Number of captured ports, 1..PORT_HW_CAPTURE_MAX_PORTS_U8 */
+    PortHw_CaptureEntryType*    Buffer_ptr;                 /**< @brief Ring buffer */
+    uint32                      Size_u32;                   /**< @brief Entries of the ring buffer, a power of two */
+} PortHw_CaptureConfigType;
+
+/**
+* @brief Capture statistics
+*/
+typedef struct PortHw_CaptureStatsType_t
+{
+    uint32 Samples_u32;                                     /**< @brief Samples taken */
+    uint32 Runs_u32;                                        /**< @brief Runs written to the ring buffer */
+    uint32 Dropped_u32;                                     /**< @brief Runs lost because the ring buffer was full */
+} PortHw_CaptureStatsType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief   Starts a capture
+* @details Empties the ring buffer, clears the statistics and takes the first sample at time 0.
+* @param[in] Config_ptr Capture configuration, must stay valid until the capture is stopped
+*/
+void PortHw_CaptureStart(
+    const PortHw_CaptureConfigType* Config_ptr
+);
+
+/**
+* @brief   Takes one sample
+* @details For a periodic timer interrupt. A sample equal to the previous one only extends the
+*          open run, another one closes it into the ring buffer.
+*/
+void PortHw_CaptureSample(void);
+
+/**
+* @brief   Takes samples back to back at the highest rate of the core
+* @param[in] NumSamples_u32 Number of samples
+*/
+void PortHw_CaptureRun(
+    uint32 NumSamples_u32
+);
+
+/**
+* @brief   Stops the capture
+* @details Closes the open run into the ring buffer; further samples are ignored.
+*/
+void PortHw_CaptureStop(void);
+
+/**
+* @brief   Moves the oldest closed runs out of the ring buffer
+* @details Single consumer, may run in another context than the sampling while the capture
+*          is active.
+* @param[out] Entries_ptr    Destination
+* @param[in]  MaxEntries_u32 Entries of the destination
+* @return     uint32 Number of entries copied
+*/
+uint32 PortHw_CaptureDrain(
+    PortHw_CaptureEntryType Entries_ptr[],
+    uint32 MaxEntries_u32
+);
+
+/**
+* @brief   Reads the capture statistics
+* @param[out] Stats_ptr Statistics
+*/
+void PortHw_CaptureGetStats(
+    PortHw_CaptureStatsType* Stats_ptr
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_CAPTURE_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
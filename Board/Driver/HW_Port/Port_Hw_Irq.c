@@ -0,0 +1,331 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Irq.c
+*
+*   @brief   Port Hardware pin interrupt source file
+*   @details The notifications sit in one table of PORT_HW_PORT_COUNT_U8 x
+*            PORT_HW_PINS_PER_PORT_U8 entries, so a flagged pin reaches its notification with
+*            one indexed load. The handler clears all flags it read before calling the
+*            notifications: an event during a notification is latched again and not lost.
+*            IRQC is written through GICLR/GICHR, whose data only covers the upper PCR half, so
+*            MUX and pad settings of the pin are never rewritten and ISF (write-1-to-clear) is
+*            written 0.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw_Irq.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_IRQ_VENDOR_ID_C                    43
+#define PORT_HW_IRQ_AR_RELEASE_MAJOR_VERSION_C     21
+#define PORT_HW_IRQ_AR_RELEASE_MINOR_VERSION_C     11
+#define PORT_HW_IRQ_AR_RELEASE_REVISION_VERSION_C  0
+#define PORT_HW_IRQ_SW_MAJOR_VERSION_C             1
+#define PORT_HW_IRQ_SW_MINOR_VERSION_C             0
+#define PORT_HW_IRQ_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Irq.c and Port_Hw_Irq.h are of the same vendor */
+#if (PORT_HW_IRQ_VENDOR_ID_C != PORT_HW_IRQ_VENDOR_ID_H)
+    #error "Port_Hw_Irq.c and Port_Hw_Irq.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Irq.c and Port_Hw_Irq.h are of the same Autosar version */
+#if ((PORT_HW_IRQ_AR_RELEASE_MAJOR_VERSION_C    != PORT_HW_IRQ_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_IRQ_AR_RELEASE_MINOR_VERSION_C    != PORT_HW_IRQ_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_IRQ_AR_RELEASE_REVISION_VERSION_C != PORT_HW_IRQ_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Irq.c and Port_Hw_Irq.h are different"
+#endif
+
+/* Check if Port_Hw_Irq.c and Port_Hw_Irq.h are of the same software version */
+#if ((PORT_HW_IRQ_SW_MAJOR_VERSION_C != PORT_HW_IRQ_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_IRQ_SW_MINOR_VERSION_C != PORT_HW_IRQ_SW_MINOR_VERSION_H) || \
+     (PORT_HW_IRQ_SW_PATCH_VERSION_C != PORT_HW_IRQ_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Irq.c and Port_Hw_Irq.h are different"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Pins per GICLR/GICHR register
+*/
+#define PORT_HW_IRQ_HALF_PINS_U8                ((uint8)16U)
+
+/**
+* @brief GICLR/GICHR data of an IRQC value (data in bits 31:16, write enables in bits 15:0)
+*/
+#define PORT_HW_IRQ_GICR_VALUE(irqc, pin)       ((((uint32)(irqc) << PORT_PCR_IRQC_SHIFT) & PORT_PCR_IRQC_MASK) | \
+                                                 ((uint32)1UL << ((uint32)(pin) & 0x0FU)))
+
+/**
+* @brief Count trailing zeros of a non-zero word (RBIT + CLZ on Cortex-M4)
+*/
+#if defined(__GNUC__)
+    #define PORT_HW_IRQ_CTZ(x)                  ((uint32)__builtin_ctz(x))
+#else
+    #define PORT_HW_IRQ_CTZ(x)                  ((uint32)PortHw_IrqCtzTable_au8[(((x) & (0U - (x))) * 0x077CB531UL) >> 27U])
+#endif
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+#if !defined(__GNUC__)
+#define PORT_START_SEC_CONST_8
+#include "Port_MemMap.h"
+
+/**
+* @brief De Bruijn position table of PORT_HW_IRQ_CTZ
+*/
+static const uint8 PortHw_IrqCtzTable_au8[32] =
+{
+     0U,  1U, 28U,  2U, 29U, 14U, 24U,  3U, 30U, 22U, 20U, 15U, 25U, 17U,  4U,  8U,
+    31U, 27U, 13U, 23U, 21U, 19U, 16U,  7U, 26U, 12U, 18U,  6U, 11U,  5U, 10U,  9U
+};
+
+#define PORT_STOP_SEC_CONST_8
+#include "Port_MemMap.h"
+#endif /* !defined(__GNUC__) */
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define PORT_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief Notification of every pin, indexed by port and pin
+*/
+static PortHw_PinNotificationType PortHw_IrqNotification_apf[PORT_HW_PORT_COUNT_U8][PORT_HW_PINS_PER_PORT_U8];
+
+#define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+static void PortHw_IrqWriteIrqc(PORT_Type* Base_ptr, uint8 Pin_u8, PortHw_InterruptConfigType Irqc_en);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_IrqWriteIrqc
+* Description   : Writes the IRQC field of one pin with one GICLR/GICHR write
+*
+******************************************************************************/
+static void PortHw_IrqWriteIrqc(PORT_Type* Base_ptr, uint8 Pin_u8, PortHw_InterruptConfigType Irqc_en)
+{
+    if (Pin_u8 < PORT_HW_IRQ_HALF_PINS_U8)
+    {
+        PORT_HW_REG_WRITE32(&Base_ptr->GICLR, PORT_HW_IRQ_GICR_VALUE(Irqc_en, Pin_u8));
+    }
+    else
+    {
+        PORT_HW_REG_WRITE32(&Base_ptr->GICHR, PORT_HW_IRQ_GICR_VALUE(Irqc_en, Pin_u8));
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_EnablePinInterrupt
+* Description   : Stores the notification of a pin and enables its interrupt
+*
+* @implements Port_Hw_EnablePinInterrupt_Activity
+******************************************************************************/
+void PortHw_EnablePinInterrupt(
+    uint8 PortIndex_u8,
+    uint8 Pin_u8,
+    PortHw_InterruptConfigType Irqc_en,
+    PortHw_PinNotificationType Notification
+)
+{
+    PORT_Type* f_Base_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
+    PORT_HW_DEV_ASSERT(Pin_u8 < PORT_HW_PINS_PER_PORT_U8);
+
+    f_Base_ptr = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+
+    /* Notification first: the interrupt may fire as soon as IRQC is written */
+    PortHw_IrqNotification_apf[PortIndex_u8][Pin_u8] = Notification;
+    PORT_HW_REG_WRITE32(&f_Base_ptr->ISFR, (uint32)1UL << Pin_u8);
+    PortHw_IrqWriteIrqc(f_Base_ptr, Pin_u8, Irqc_en);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_DisablePinInterrupt
+* Description   : Disables the interrupt of a pin and removes its notification
+*
+* @implements Port_Hw_DisablePinInterrupt_Activity
+******************************************************************************/
+void PortHw_DisablePinInterrupt(
+    uint8 PortIndex_u8,
+    uint8 Pin_u8
+)
+{
+    PORT_Type* f_Base_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
+    PORT_HW_DEV_ASSERT(Pin_u8 < PORT_HW_PINS_PER_PORT_U8);
+
+    f_Base_ptr = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+
+    PortHw_IrqWriteIrqc(f_Base_ptr, Pin_u8, PORT_HW_INT_DISABLED);
+    PORT_HW_REG_WRITE32(&f_Base_ptr->ISFR, (uint32)1UL << Pin_u8);
+    PortHw_IrqNotification_apf[PortIndex_u8][Pin_u8] = NULL_PTR;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PortIrqHandler
+* Description   : Clears the pending pin flags of a port and calls their notifications
+*
+* @implements Port_Hw_PortIrqHandler_Activity
+******************************************************************************/
+void PortHw_PortIrqHandler(
+    uint8 PortIndex_u8
+)
+{
+    PORT_Type* f_Base_ptr;
+    const PortHw_PinNotificationType* f_Table_ptr;
+    PortHw_PinNotificationType f_Notification;
+    uint32 f_Flags_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PortIndex_u8 < PORT_HW_PORT_COUNT_U8);
+
+    f_Base_ptr = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+    f_Table_ptr = PortHw_IrqNotification_apf[PortIndex_u8];
+
+    /* One read, one write-1-to-clear of exactly the flags read */
+    f_Flags_u32 = PORT_HW_REG_READ32(&f_Base_ptr->ISFR);
+    PORT_HW_REG_WRITE32(&f_Base_ptr->ISFR, f_Flags_u32);
+
+    /* One step per pending flag, lowest pin first */
+    while (0U != f_Flags_u32)
+    {
+        f_Notification = f_Table_ptr[PORT_HW_IRQ_CTZ(f_Flags_u32)];
+        f_Flags_u32 &= f_Flags_u32 - 1U;
+        if (NULL_PTR != f_Notification)
+        {
+            f_Notification();
+        }
+        else
+        {
+            /* Flag of a pin without notification, cleared only */
+        }
+    }
+}
+
+#if (STD_ON == PORT_HW_IRQ_HANDLERS)
+/**
+* @brief   PORTA pin detect interrupt
+*/
+void PORTA_IRQHandler(void)
+{
+    PortHw_PortIrqHandler(0U);
+}
+
+/**
+* @brief   PORTB pin detect interrupt
+*/
+void PORTB_IRQHandler(void)
+{
+    PortHw_PortIrqHandler(1U);
+}
+
+/**
+* @brief   PORTC pin detect interrupt
+*/
+void PORTC_IRQHandler(void)
+{
+    PortHw_PortIrqHandler(2U);
+}
+
+/**
+* @brief   PORTD pin detect interrupt
+*/
+void PORTD_IRQHandler(void)
+{
+    PortHw_PortIrqHandler(3U);
+}
+
+/**
+* @brief   PORTE pin detect interrupt
+*/
+void PORTE_IRQHandler(void)
+{
+    PortHw_PortIrqHandler(4U);
+}
+#endif /* (STD_ON == PORT_HW_IRQ_HANDLERS) */
+
+#define PORT_STOP_SEC_CODE
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,187 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Irq.h
+*
+*   @brief   Port Hardware pin interrupt header file
+*   @details Pin interrupts of the PORT modules: PCR[IRQC] selects the event of a pin, the port
+*            latches it in ISFR and raises its PORTx interrupt. PortHw_PortIrqHandler() reads
+*            ISFR once, clears the latched flags with one write and calls the notification of
+*            every flagged pin from a table indexed by (port, pin), so the handler costs one
+*            step per pending flag. The NVIC line of the port is enabled by the integrator.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifndef PORT_HW_IRQ_H
+#define PORT_HW_IRQ_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_IRQ_VENDOR_ID_H                    43
+#define PORT_HW_IRQ_AR_RELEASE_MAJOR_VERSION_H     21
+#define PORT_HW_IRQ_AR_RELEASE_MINOR_VERSION_H     11
+#define PORT_HW_IRQ_AR_RELEASE_REVISION_VERSION_H  0
+#define PORT_HW_IRQ_SW_MAJOR_VERSION_H             1
+#define PORT_HW_IRQ_SW_MINOR_VERSION_H             0
+#define PORT_HW_IRQ_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Irq.h and Port_Hw.h are of the same vendor */
+#if (PORT_HW_IRQ_VENDOR_ID_H != PORT_HW_VENDOR_ID_H)
+    #error "Port_Hw_Irq.h and Port_Hw.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Irq.h and Port_Hw.h are of the same Autosar version */
+#if ((PORT_HW_IRQ_AR_RELEASE_MAJOR_VERSION_H    != PORT_HW_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_IRQ_AR_RELEASE_MINOR_VERSION_H    != PORT_HW_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_IRQ_AR_RELEASE_REVISION_VERSION_H != PORT_HW_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Irq.h and Port_Hw.h are different"
+#endif
+
+/* Check if Port_Hw_Irq.h and Port_Hw.h are of the same software version */
+#if ((PORT_HW_IRQ_SW_MAJOR_VERSION_H != PORT_HW_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_IRQ_SW_MINOR_VERSION_H != PORT_HW_SW_MINOR_VERSION_H) || \
+     (PORT_HW_IRQ_SW_PATCH_VERSION_H != PORT_HW_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Irq.h and Port_Hw.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Enable or disable the PORTA_IRQHandler..PORTE_IRQHandler vector entries
+* @details STD_OFF when the integrator installs PortHw_PortIrqHandler() through its own ISRs.
+*/
+#ifndef PORT_HW_IRQ_HANDLERS
+    #define PORT_HW_IRQ_HANDLERS               (STD_ON)
+#endif
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief   Pin Interrupt Configuration Type
+* @details PCR[IRQC] values of the interrupt events (DMA requests are not handled here)
+*/
+typedef enum Port_Hw_InterruptConfigType_t
+{
+    PORT_HW_INT_DISABLED        = 0x0U,     /**< @brief Interrupt/DMA request disabled */
+    PORT_HW_INT_LOGIC_ZERO      = 0x8U,     /**< @brief Interrupt when logic 0 */
+    PORT_HW_INT_RISING_EDGE     = 0x9U,     /**< @brief Interrupt on rising edge */
+    PORT_HW_INT_FALLING_EDGE    = 0xAU,     /**< @brief Interrupt on falling edge */
+    PORT_HW_INT_EITHER_EDGE     = 0xBU,     /**< @brief Interrupt on either edge */
+    PORT_HW_INT_LOGIC_ONE       = 0xCU      /**< @brief Interrupt when logic 1 */
+} PortHw_InterruptConfigType;
+
+/**
+* @brief   Pin notification, called from the port interrupt
+*/
+typedef void (*PortHw_PinNotificationType)(void);
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief   Enables the interrupt of a pin
+* @details Stores the notification, clears a stale flag of the pin, then sets its IRQC with one
+*          GICLR/GICHR write: no PCR read and no exclusive area, the other PCR fields and pins
+*          are not touched.
+* @param[in] PortIndex_u8  Port index (0 = A ... 4 = E)
+* @param[in] Pin_u8        Pin of the port
+* @param[in] Irqc_en       Interrupt event
+* @param[in] Notification  Called for every interrupt of the pin, NULL_PTR only clears the flag
+*/
+void PortHw_EnablePinInterrupt(
+    uint8 PortIndex_u8,
+    uint8 Pin_u8,
+    PortHw_InterruptConfigType Irqc_en,
+    PortHw_PinNotificationType Notification
+);
+
+/**
+* @brief   Disables the interrupt of a pin
+* @details Clears its IRQC with one GICLR/GICHR write, then its flag and its notification.
+* @param[in] PortIndex_u8  Port index (0 = A ... 4 = E)
+* @param[in] Pin_u8        Pin of the port
+*/
+void PortHw_DisablePinInterrupt(
+    uint8 PortIndex_u8,
+    uint8 Pin_u8
+);
+
+/**
+* @brief   Interrupt handler of one port
+* @details One ISFR read and one write-1-to-clear of the read flags, then the notification of
+*          every flagged pin, lowest pin first, found with count-trailing-zeros. A pin flagged
+*          again during a notification raises the interrupt again.
+* @param[in] PortIndex_u8  Port index (0 = A ... 4 = E)
+*/
+void PortHw_PortIrqHandler(
+    uint8 PortIndex_u8
+);
+
+#if (STD_ON == PORT_HW_IRQ_HANDLERS)
+/**
+* @brief   PORTA..PORTE pin detect interrupt vector entries
+*/
+void PORTA_IRQHandler(void);
+void PORTB_IRQHandler(void);
+void PORTC_IRQHandler(void);
+void PORTD_IRQHandler(void);
+void PORTE_IRQHandler(void);
+#endif /* (STD_ON == PORT_HW_IRQ_HANDLERS) */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_IRQ_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,480 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Pwm.c
+*
+*   @brief   Port Hardware software PWM source file
+*   @details A schedule holds the PSOR mask of every port for the period start and the clear
+*            events in ascending time, one per distinct duty strictly between 0 and the period;
+*            an event holds the PCOR mask of every port. A channel with duty 0 is never set,
+*            one with the full period is never cleared. Channel k is high for the ticks
+*            0..Duty-1 of every period.
+*
+*            PortHw_PwmUpdate() sorts the channels by duty (insertion sort, the channel count
+*            is small) into the shadow schedule and publishes it with a flag; the edge handler
+*            swaps the schedules at the next period start. The handler never reads the shadow
+*            while the flag is clear, and the update clears the flag before it writes the
+*            shadow, so no lock is needed between the task and the interrupt.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw_Pwm.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_PWM_VENDOR_ID_C                    43
+#define PORT_HW_PWM_AR_RELEASE_MAJOR_VERSION_C     21
+#define PORT_HW_PWM_AR_RELEASE_MINOR_VERSION_C     11
+#define PORT_HW_PWM_AR_RELEASE_REVISION_VERSION_C  0
+#define PORT_HW_PWM_SW_MAJOR_VERSION_C             1
+#define PORT_HW_PWM_SW_MINOR_VERSION_C             0
+#define PORT_HW_PWM_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Pwm.c and Port_Hw_Pwm.h are of the same vendor */
+#if (PORT_HW_PWM_VENDOR_ID_C != PORT_HW_PWM_VENDOR_ID_H)
+    #error "Port_Hw_Pwm.c and Port_Hw_Pwm.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Pwm.c and Port_Hw_Pwm.h are of the same Autosar version */
+#if ((PORT_HW_PWM_AR_RELEASE_MAJOR_VERSION_C    != PORT_HW_PWM_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_PWM_AR_RELEASE_MINOR_VERSION_C    != PORT_HW_PWM_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_PWM_AR_RELEASE_REVISION_VERSION_C != PORT_HW_PWM_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Pwm.c and Port_Hw_Pwm.h are different"
+#endif
+
+/* Check if Port_Hw_Pwm.c and Port_Hw_Pwm.h are of the same software version */
+#if ((PORT_HW_PWM_SW_MAJOR_VERSION_C != PORT_HW_PWM_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_PWM_SW_MINOR_VERSION_C != PORT_HW_PWM_SW_MINOR_VERSION_H) || \
+     (PORT_HW_PWM_SW_PATCH_VERSION_C != PORT_HW_PWM_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Pwm.c and Port_Hw_Pwm.h are different"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Clear event: channels that end at the same tick
+*/
+typedef struct
+{
+    uint16 Time_u16;                                        /**< @brief Tick of the period, 1..Period_u16 - 1 */
+    uint32 ClearMask_au32[PORT_HW_PWM_MAX_PORTS_U8];        /**< @brief PCOR word of every port */
+} PortHw_PwmEventType;
+
+/**
+* @brief Edges of one period
+*/
+typedef struct
+{
+    uint32 SetMask_au32[PORT_HW_PWM_MAX_PORTS_U8];          /**< @brief PSOR word of every port at the period start */
+    PortHw_PwmEventType Events_ast[PORT_HW_PWM_MAX_CHANNELS_U8]; /**< @brief Clear events in ascending time */
+    uint8 NumEvents_u8;                                     /**< @brief Number of clear events */
+} PortHw_PwmScheduleType;
+
+/**
+* @brief Software PWM state
+*/
+typedef struct
+{
+    const PortHw_PwmConfigType* Config_ptr;                 /**< @brief Configuration of the running PWM */
+    volatile boolean Active_boo;                            /**< @brief TRUE between start and stop */
+    uint32 ChannelMask_au32[PORT_HW_PWM_MAX_PORTS_U8];      /**< @brief Pins of the channels of every port */
+    uint16 Duty_au16[PORT_HW_PWM_MAX_CHANNELS_U8];          /**< @brief Duties set, published by the next update */
+    PortHw_PwmScheduleType Schedule_ast[2];                 /**< @brief Active and shadow schedule */
+    volatile uint8 Current_u8;                              /**< @brief Index of the active schedule */
+    volatile boolean Pending_boo;                           /**< @brief TRUE when the shadow schedule is ready */
+    uint16 Tick_u16;                                        /**< @brief Tick of the period (PortHw_PwmTick()) */
+    uint16 NextTime_u16;                                    /**< @brief Tick of the next edge, 0 for the period start */
+    uint8 NextEvent_u8;                                     /**< @brief Next clear event of the active schedule */
+} PortHw_PwmStateType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Orders the shadow schedule stores and the flag store that publishes them
+*/
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+    #define PORT_HW_PWM_BARRIER()                   ASM_KEYWORD volatile ("DMB" ::: "memory")
+#elif defined(__GNUC__)
+    #define PORT_HW_PWM_BARRIER()                   __sync_synchronize()
+#else
+    #define PORT_HW_PWM_BARRIER()
+#endif
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define PORT_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief State of the software PWM
+*/
+static PortHw_PwmStateType PortHw_Pwm_st;
+
+#define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+static void PortHw_PwmBuild(const PortHw_PwmConfigType* Config_ptr, PortHw_PwmScheduleType* Schedule_ptr);
+static void PortHw_PwmClearAll(const PortHw_PwmConfigType* Config_ptr);
+LOCAL_INLINE uint16 PortHw_PwmStep(const PortHw_PwmConfigType* Config_ptr);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmBuild
+* Description   : Sorts the channels by duty and merges equal duties into one clear event
+*
+******************************************************************************/
+static void PortHw_PwmBuild(const PortHw_PwmConfigType* Config_ptr, PortHw_PwmScheduleType* Schedule_ptr)
+{
+    uint8 f_Order_au8[PORT_HW_PWM_MAX_CHANNELS_U8];
+    PortHw_PwmEventType* f_Event_ptr = NULL_PTR;
+    uint32 f_Bit_u32;
+    uint16 f_Duty_u16;
+    uint8 f_Channel_u8;
+    uint8 f_Index_u8;
+    uint8 f_Port_u8;
+    uint8 f_Clear_u8;
+
+    /* Insertion sort of the channel indexes by duty */
+    for (f_Index_u8 = 0U; f_Index_u8 < Config_ptr->NumChannels_u8; f_Index_u8++)
+    {
+        f_Channel_u8 = f_Index_u8;
+        while ((f_Channel_u8 > 0U) &&
+               (PortHw_Pwm_st.Duty_au16[f_Order_au8[f_Channel_u8 - 1U]] > PortHw_Pwm_st.Duty_au16[f_Index_u8]))
+        {
+            f_Order_au8[f_Channel_u8] = f_Order_au8[f_Channel_u8 - 1U];
+            f_Channel_u8--;
+        }
+        f_Order_au8[f_Channel_u8] = f_Index_u8;
+    }
+
+    for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+    {
+        Schedule_ptr->SetMask_au32[f_Port_u8] = 0U;
+    }
+    Schedule_ptr->NumEvents_u8 = 0U;
+
+    for (f_Index_u8 = 0U; f_Index_u8 < Config_ptr->NumChannels_u8; f_Index_u8++)
+    {
+        f_Channel_u8 = f_Order_au8[f_Index_u8];
+        f_Duty_u16 = PortHw_Pwm_st.Duty_au16[f_Channel_u8];
+        f_Port_u8 = Config_ptr->Channels_ptr[f_Channel_u8].Port_u8;
+        f_Bit_u32 = (uint32)1U << Config_ptr->Channels_ptr[f_Channel_u8].Pin_u8;
+
+        if (0U != f_Duty_u16)
+        {
+            Schedule_ptr->SetMask_au32[f_Port_u8] |= f_Bit_u32;
+            if (f_Duty_u16 < Config_ptr->Period_u16)
+            {
+                if ((NULL_PTR == f_Event_ptr) || (f_Event_ptr->Time_u16 != f_Duty_u16))
+                {
+                    f_Event_ptr = &Schedule_ptr->Events_ast[Schedule_ptr->NumEvents_u8];
+                    Schedule_ptr->NumEvents_u8++;
+                    f_Event_ptr->Time_u16 = f_Duty_u16;
+                    for (f_Clear_u8 = 0U; f_Clear_u8 < Config_ptr->NumPorts_u8; f_Clear_u8++)
+                    {
+                        f_Event_ptr->ClearMask_au32[f_Clear_u8] = 0U;
+                    }
+                }
+                f_Event_ptr->ClearMask_au32[f_Port_u8] |= f_Bit_u32;
+            }
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmClearAll
+* Description   : Drives every channel low, one PCOR write per port
+*
+******************************************************************************/
+static void PortHw_PwmClearAll(const PortHw_PwmConfigType* Config_ptr)
+{
+    uint8 f_Port_u8;
+
+    for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+    {
+        if (0U != PortHw_Pwm_st.ChannelMask_au32[f_Port_u8])
+        {
+            PORT_HW_REG_WRITE32(&Config_ptr->Ports_ptr[f_Port_u8]->PCOR, PortHw_Pwm_st.ChannelMask_au32[f_Port_u8]);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmStep
+* Description   : Runs the next edge: period start (schedule swap, one PSOR write per port)
+*                 or clear event (one PCOR write per port), returns the ticks to the next edge
+*
+******************************************************************************/
+LOCAL_INLINE uint16 PortHw_PwmStep(const PortHw_PwmConfigType* Config_ptr)
+{
+    const PortHw_PwmScheduleType* f_Schedule_ptr;
+    const PortHw_PwmEventType* f_Event_ptr;
+    uint16 f_Now_u16 = PortHw_Pwm_st.NextTime_u16;
+    uint16 f_Next_u16;
+    uint8 f_Port_u8;
+
+    if (0U == f_Now_u16)
+    {
+        if (TRUE == PortHw_Pwm_st.Pending_boo)
+        {
+            PortHw_Pwm_st.Current_u8 ^= 1U;
+            PortHw_Pwm_st.Pending_boo = FALSE;
+        }
+        f_Schedule_ptr = &PortHw_Pwm_st.Schedule_ast[PortHw_Pwm_st.Current_u8];
+        for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+        {
+            if (0U != f_Schedule_ptr->SetMask_au32[f_Port_u8])
+            {
+                PORT_HW_REG_WRITE32(&Config_ptr->Ports_ptr[f_Port_u8]->PSOR, f_Schedule_ptr->SetMask_au32[f_Port_u8]);
+            }
+        }
+        PortHw_Pwm_st.NextEvent_u8 = 0U;
+    }
+    else
+    {
+        f_Schedule_ptr = &PortHw_Pwm_st.Schedule_ast[PortHw_Pwm_st.Current_u8];
+        f_Event_ptr = &f_Schedule_ptr->Events_ast[PortHw_Pwm_st.NextEvent_u8];
+        for (f_Port_u8 = 0U; f_Port_u8 < Config_ptr->NumPorts_u8; f_Port_u8++)
+        {
+            if (0U != f_Event_ptr->ClearMask_au32[f_Port_u8])
+            {
+                PORT_HW_REG_WRITE32(&Config_ptr->Ports_ptr[f_Port_u8]->PCOR, f_Event_ptr->ClearMask_au32[f_Port_u8]);
+            }
+        }
+        PortHw_Pwm_st.NextEvent_u8++;
+    }
+
+    if (PortHw_Pwm_st.NextEvent_u8 < f_Schedule_ptr->NumEvents_u8)
+    {
+        f_Next_u16 = f_Schedule_ptr->Events_ast[PortHw_Pwm_st.NextEvent_u8].Time_u16;
+        PortHw_Pwm_st.NextTime_u16 = f_Next_u16;
+    }
+    else
+    {
+        f_Next_u16 = Config_ptr->Period_u16;
+        PortHw_Pwm_st.NextTime_u16 = 0U;
+    }
+
+    return (uint16)(f_Next_u16 - f_Now_u16);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmStart
+* Description   : Starts the software PWM with every duty at 0
+*
+* @implements Port_Hw_PwmStart_Activity
+******************************************************************************/
+void PortHw_PwmStart(
+    const PortHw_PwmConfigType* Config_ptr
+)
+{
+    uint8 f_Channel_u8;
+    uint8 f_Port_u8;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Config_ptr->NumPorts_u8 > 0U) && (Config_ptr->NumPorts_u8 <= PORT_HW_PWM_MAX_PORTS_U8));
+    PORT_HW_DEV_ASSERT((Config_ptr->NumChannels_u8 > 0U) && (Config_ptr->NumChannels_u8 <= PORT_HW_PWM_MAX_CHANNELS_U8));
+    PORT_HW_DEV_ASSERT(Config_ptr->Period_u16 >= 2U);
+
+    PortHw_Pwm_st.Active_boo = FALSE;
+    for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_PWM_MAX_PORTS_U8; f_Port_u8++)
+    {
+        PortHw_Pwm_st.ChannelMask_au32[f_Port_u8] = 0U;
+    }
+    for (f_Channel_u8 = 0U; f_Channel_u8 < Config_ptr->NumChannels_u8; f_Channel_u8++)
+    {
+        PORT_HW_DEV_ASSERT((Config_ptr->Channels_ptr[f_Channel_u8].Port_u8 < Config_ptr->NumPorts_u8) &&
+                           (Config_ptr->Channels_ptr[f_Channel_u8].Pin_u8 < 32U));
+        PortHw_Pwm_st.ChannelMask_au32[Config_ptr->Channels_ptr[f_Channel_u8].Port_u8] |=
+            (uint32)1U << Config_ptr->Channels_ptr[f_Channel_u8].Pin_u8;
+        PortHw_Pwm_st.Duty_au16[f_Channel_u8] = 0U;
+    }
+
+    PortHw_PwmBuild(Config_ptr, &PortHw_Pwm_st.Schedule_ast[0]);
+    PortHw_Pwm_st.Current_u8 = 0U;
+    PortHw_Pwm_st.Pending_boo = FALSE;
+    PortHw_Pwm_st.Tick_u16 = 0U;
+    PortHw_Pwm_st.NextTime_u16 = 0U;
+    PortHw_Pwm_st.NextEvent_u8 = 0U;
+    PortHw_PwmClearAll(Config_ptr);
+    PortHw_Pwm_st.Config_ptr = Config_ptr;
+    PortHw_Pwm_st.Active_boo = TRUE;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmStop
+* Description   : Stops the software PWM and drives every channel low
+*
+* @implements Port_Hw_PwmStop_Activity
+******************************************************************************/
+void PortHw_PwmStop(void)
+{
+    if (TRUE == PortHw_Pwm_st.Active_boo)
+    {
+        PortHw_Pwm_st.Active_boo = FALSE;
+        PortHw_PwmClearAll(PortHw_Pwm_st.Config_ptr);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmSetDuty
+* Description   : Sets the duty of a channel for the next update
+*
+* @implements Port_Hw_PwmSetDuty_Activity
+******************************************************************************/
+void PortHw_PwmSetDuty(
+    uint8 Channel_u8,
+    uint16 Duty_u16
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(PortHw_Pwm_st.Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT(Channel_u8 < PortHw_Pwm_st.Config_ptr->NumChannels_u8);
+    PORT_HW_DEV_ASSERT(Duty_u16 <= PortHw_Pwm_st.Config_ptr->Period_u16);
+
+    PortHw_Pwm_st.Duty_au16[Channel_u8] = Duty_u16;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmUpdate
+* Description   : Builds the shadow schedule and publishes it for the next period start
+*
+* @implements Port_Hw_PwmUpdate_Activity
+******************************************************************************/
+void PortHw_PwmUpdate(void)
+{
+    if (TRUE == PortHw_Pwm_st.Active_boo)
+    {
+        /* The edge handler stops looking at the shadow before it is rewritten */
+        PortHw_Pwm_st.Pending_boo = FALSE;
+        PORT_HW_PWM_BARRIER();
+        PortHw_PwmBuild(PortHw_Pwm_st.Config_ptr, &PortHw_Pwm_st.Schedule_ast[PortHw_Pwm_st.Current_u8 ^ 1U]);
+        PORT_HW_PWM_BARRIER();
+        PortHw_Pwm_st.Pending_boo = TRUE;
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmTick
+* Description   : Runs the edges due at the current tick and advances the tick
+*
+* @implements Port_Hw_PwmTick_Activity
+******************************************************************************/
+void PortHw_PwmTick(void)
+{
+    const PortHw_PwmConfigType* f_Config_ptr = PortHw_Pwm_st.Config_ptr;
+
+    if (TRUE == PortHw_Pwm_st.Active_boo)
+    {
+        if (PortHw_Pwm_st.Tick_u16 == PortHw_Pwm_st.NextTime_u16)
+        {
+            (void)PortHw_PwmStep(f_Config_ptr);
+        }
+        PortHw_Pwm_st.Tick_u16++;
+        if (PortHw_Pwm_st.Tick_u16 == f_Config_ptr->Period_u16)
+        {
+            PortHw_Pwm_st.Tick_u16 = 0U;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_PwmEvent
+* Description   : Runs the next edge and returns the ticks to the following one
+*
+* @implements Port_Hw_PwmEvent_Activity
+******************************************************************************/
+uint16 PortHw_PwmEvent(void)
+{
+    uint16 f_Ticks_u16 = 0U;
+
+    if (TRUE == PortHw_Pwm_st.Active_boo)
+    {
+        f_Ticks_u16 = PortHw_PwmStep(PortHw_Pwm_st.Config_ptr);
+    }
+
+    return f_Ticks_u16;
+}
+
+#define PORT_STOP_SEC_CODE
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,203 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Pwm.h
+*
+*   @brief   Port Hardware software PWM header file
+*   @details Drives up to PORT_HW_PWM_MAX_CHANNELS_U8 low-frequency PWM channels on GPIO
+*            output pins of up to PORT_HW_PWM_MAX_PORTS_U8 ports, all with the same period.
+*            The duty cycles are sorted into an event list: at the period start one PSOR
+*            write per port sets every channel with a non-zero duty, and at every distinct
+*            duty one PCOR write per port clears every channel that ends then. The work per
+*            period is proportional to the number of distinct edges, not to the number of
+*            channels times the number of ticks.
+*
+*            Two ways to pace it:
+*            - PortHw_PwmTick() from a periodic timer interrupt, once per tick; a tick without
+*              an edge only counts.
+*            - PortHw_PwmEvent() from a one-shot compare interrupt, only at the edges; it
+*              returns the ticks until the next edge for the next compare value.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifndef PORT_HW_PWM_H
+#define PORT_HW_PWM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_PWM_VENDOR_ID_H                    43
+#define PORT_HW_PWM_AR_RELEASE_MAJOR_VERSION_H     21
+#define PORT_HW_PWM_AR_RELEASE_MINOR_VERSION_H     11
+#define PORT_HW_PWM_AR_RELEASE_REVISION_VERSION_H  0
+#define PORT_HW_PWM_SW_MAJOR_VERSION_H             1
+#define PORT_HW_PWM_SW_MINOR_VERSION_H             0
+#define PORT_HW_PWM_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Pwm.h and Port_Hw.h are of the same vendor */
+#if (PORT_HW_PWM_VENDOR_ID_H != PORT_HW_VENDOR_ID_H)
+    #error "Port_Hw_Pwm.h and Port_Hw.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Pwm.h and Port_Hw.h are of the same Autosar version */
+#if ((PORT_HW_PWM_AR_RELEASE_MAJOR_VERSION_H    != PORT_HW_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_PWM_AR_RELEASE_MINOR_VERSION_H    != PORT_HW_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_PWM_AR_RELEASE_REVISION_VERSION_H != PORT_HW_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Pwm.h and Port_Hw.h are different"
+#endif
+
+/* Check if Port_Hw_Pwm.h and Port_Hw.h are of the same software version */
+#if ((PORT_HW_PWM_SW_MAJOR_VERSION_H != PORT_HW_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_PWM_SW_MINOR_VERSION_H != PORT_HW_SW_MINOR_VERSION_H) || \
+     (PORT_HW_PWM_SW_PATCH_VERSION_H != PORT_HW_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Pwm.h and Port_Hw.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Number of PWM channels
+* @details Sets the size of the active and the shadow event list, one event per channel.
+*/
+#ifndef PORT_HW_PWM_MAX_CHANNELS_U8
+    #define PORT_HW_PWM_MAX_CHANNELS_U8         ((uint8)32U)
+#endif
+
+/**
+* @brief Number of GPIO ports the channels are spread over
+* @details Sets the size of an event: one set or clear mask per port.
+*/
+#ifndef PORT_HW_PWM_MAX_PORTS_U8
+    #define PORT_HW_PWM_MAX_PORTS_U8            ((uint8)3U)
+#endif
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief PWM channel
+*/
+typedef struct PortHw_PwmChannelConfigType_t
+{
+    uint8 Port_u8;                                  /**< @brief Index of the GPIO block in PortHw_PwmConfigType::Ports_ptr */
+    uint8 Pin_u8;                                   /**< @brief Pin of the GPIO block, configured as GPIO output */
+} PortHw_PwmChannelConfigType;
+
+/**
+* @brief Software PWM configuration
+*/
+typedef struct PortHw_PwmConfigType_t
+{
+    GPIO_Type* const*                   Ports_ptr;          /**< @brief GPIO blocks of the channels */
+    uint8                               NumPorts_u8;        /**< @brief Number of GPIO blocks, 1..PORT_HW_PWM_MAX_PORTS_U8 */
+    const PortHw_PwmChannelConfigType*  Channels_ptr;       /**< @brief Channels */
+    uint8                               NumChannels_u8;     /**< @brief Number of channels, 1..PORT_HW_PWM_MAX_CHANNELS_U8 */
+    uint16                              Period_u16;         /**< @brief Ticks per period, at least 2 */
+} PortHw_PwmConfigType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief   Starts the software PWM
+* @details Drives every channel low and sets every duty to 0; the first period starts with
+*          the next PortHw_PwmTick() or PortHw_PwmEvent().
+* @param[in] Config_ptr Configuration, must stay valid until the PWM is stopped
+*/
+void PortHw_PwmStart(
+    const PortHw_PwmConfigType* Config_ptr
+);
+
+/**
+* @brief   Stops the software PWM and drives every channel low
+*/
+void PortHw_PwmStop(void);
+
+/**
+* @brief   Sets the duty of a channel
+* @details Takes effect with the next PortHw_PwmUpdate().
+* @param[in] Channel_u8 Channel
+* @param[in] Duty_u16   High ticks per period, 0 (always low)..Period_u16 (always high)
+*/
+void PortHw_PwmSetDuty(
+    uint8 Channel_u8,
+    uint16 Duty_u16
+);
+
+/**
+* @brief   Publishes the duties set since the last update
+* @details Sorts the duties into the shadow event list, which replaces the active one at the
+*          next period start, so a period never mixes old and new duties. For the task
+*          context; must not preempt itself.
+*/
+void PortHw_PwmUpdate(void);
+
+/**
+* @brief   PWM tick, for a periodic timer interrupt
+* @details Runs the edges due at the current tick, then advances the tick.
+*/
+void PortHw_PwmTick(void);
+
+/**
+* @brief   PWM edge, for a one-shot compare interrupt
+* @details Runs the next edge (period start or clear event) and returns the ticks until the
+*          following one.
+* @return  uint16 Ticks from this edge to the next, 1..Period_u16, 0 when the PWM is stopped
+*/
+uint16 PortHw_PwmEvent(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_PWM_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -77,6 +77,41 @@ extern "C" {
 */
 #define PORT_HW_GET_PIN_U32(channel)       ((uint32)((uint32)(channel) & 31U))
 
+/**
+* @brief Pad id of a pin: port index in bits 7-5, pin index in bits 4-0
+* @details Decoded with PORT_HW_GET_PORT_U32() and PORT_HW_GET_PIN_U32(); PTE31 is 159, so
+*          every pad fits in one byte of PortHw_PinTableType::PadId_ptr.
+*/
+#define PORT_HW_PAD_ID_U8(port, pin)       ((uint8)(((uint32)(port) << 5U) | ((uint32)(pin) & 31U)))
+
+/**
+* @brief Fields of a PortHw_PinTableType::Flags_ptr byte
+* @details Bits 1-0 hold the PortHw_DirectionType, bit 2 the initial output level and bit 3
+*          is set when the PCR word muxes the pin as GPIO, so the GPIO part of the
+*          initialization does not read the PCR words. Bits 7-4 are not read by the Port_Hw
+*          layer and are left to the upper layer.
+*/
+#define PORT_HW_PIN_FLAG_DIR_MASK_U8       ((uint8)0x03U)
+#define PORT_HW_PIN_FLAG_LEVEL_HIGH_U8     ((uint8)0x04U)
+#define PORT_HW_PIN_FLAG_GPIO_U8           ((uint8)0x08U)
+
+/**
+* @brief Builds the Port_Hw part of a pin flags byte from the mux, direction and output level
+*/
+#define PORT_HW_PIN_FLAGS_U8(mux, dir, level)   \
+    ((uint8)((((uint32)PORT_HW_MUX_AS_GPIO == (uint32)(mux)) ? (uint32)PORT_HW_PIN_FLAG_GPIO_U8 : 0U) | \
+             ((uint32)(dir) & (uint32)PORT_HW_PIN_FLAG_DIR_MASK_U8) | (((uint32)(level) & 1U) << 2U)))
+
+/**
+* @brief Direction field of a pin flags byte
+*/
+#define PORT_HW_PIN_FLAG_DIR(flags)        ((PortHw_DirectionType)((uint32)(flags) & (uint32)PORT_HW_PIN_FLAG_DIR_MASK_U8))
+
+/**
+* @brief MUX field of a PCR word
+*/
+#define PORT_HW_PCR_MUX_U32(pcr)           (((uint32)(pcr) & PORT_PCR_MUX_MASK) >> PORT_PCR_MUX_SHIFT)
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -183,21 +218,114 @@ typedef struct PortHw_UnusedPinConfigType_t
 
 
 /**
-* @brief   Port Pin Settings Configuration Structure
-* @details Main structure for configuring a single PORT pin
+* @brief   Digital Filter Clock Source Enumeration
+* @details Clock of the digital input filter of a port (DFCR[CS])
+*/
+typedef enum Port_Hw_DigitalFilterClockType_t
+{
+    PORT_HW_DIGITAL_FILTER_BUS_CLOCK    = 0U,    /**< @brief Filter clocked by the bus clock */
+    PORT_HW_DIGITAL_FILTER_LPO_CLOCK    = 1U     /**< @brief Filter clocked by LPO_CLK, also runs in stop modes */
+} PortHw_DigitalFilterClockType;
+
+/**
+* @brief   Pin Table Structure
+* @details Configured pins as three parallel arrays indexed by the configuration pin index,
+*          so a service reads only the arrays it needs: 6 bytes of flash per pin. The PCR word
+*          is the only source of the pull, drive strength, lock and mux settings. Base
+*          addresses come from the pad id through PortHw_g_PortBaseAddr_ptr and
+*          PortHw_g_GpioBaseAddr_ptr.
+*/
+typedef struct PortHw_PinTableType_t
+{
+    const uint32*               Pcr_ptr;            /**< @brief Ready-to-write PCR value per pin (pull, DSE, LK, MUX, IRQC) */
+    const uint8*                PadId_ptr;          /**< @brief Pad per pin, PORT_HW_PAD_ID_U8(port, pin) */
+    const uint8*                Flags_ptr;          /**< @brief GPIO mux, direction and output level per pin, PORT_HW_PIN_FLAGS_U8() */
+} PortHw_PinTableType;
+
+/**
+* @brief   Init Script Entry Structure
+* @details One register write of a generated initialization script
+*/
+typedef struct PortHw_InitScriptEntryType_t
+{
+    volatile uint32*            Address_ptr;        /**< @brief Register address */
+    uint32                      Value_u32;          /**< @brief Value written to the register */
+} PortHw_InitScriptEntryType;
+
+/**
+* @brief   Init Script Structure
+* @details Ordered register write sequence generated off-line from a configuration set.
+*          Replaying it from the reset state gives the same result as PortHw_Init().
+*/
+typedef struct PortHw_InitScriptType_t
+{
+    uint32                              NumEntries_u32; /**< @brief Number of register writes */
+    const PortHw_InitScriptEntryType*   Entries_ptr;    /**< @brief Register writes, in order */
+} PortHw_InitScriptType;
+
+/**
+* @brief   Port Pin Mask Structure
+* @details Pins of one port, resolved off-line from a list of pins to the GPIO base address
+*          and a pin mask
+*/
+typedef struct PortHw_PinMaskType_t
+{
+    GPIO_Type*                  GpioBase_ptr;       /**< @brief Pointer to GPIO peripheral base */
+    uint32                      PinMask_u32;        /**< @brief Pins of the port (bit n = pin n) */
+} PortHw_PinMaskType;
+
+/**
+* @brief   Channel Group Structure
+* @details Adjoining pins of one port read and written as one value, resolved off-line from a
+*          list of pins to the GPIO base address, the pin mask and the position of its lowest pin
 */
-typedef struct Port_Hw_PinSettingsConfigType_t
+typedef struct PortHw_ChannelGroupType_t
 {
-    PORT_Type*                  PortBase_ptr;       /**< @brief Pointer to PORT peripheral base */
     GPIO_Type*                  GpioBase_ptr;       /**< @brief Pointer to GPIO peripheral base */
-    uint32                      PinPortIndex_u32;     /**< @brief Pin index within the port (0-31) */
-    PortHw_PullConfigType      PullConfig_en;      /**< @brief Pull resistor configuration */
-    PortHw_MuxType             Mux_en;             /**< @brief Pin mux (alternate function) */
-    PortHw_DirectionType       Direction_en;       /**< @brief Pin direction (in/out/high-z) */
-    PortHw_DriveStrengthType   DriveStrength_en;   /**< @brief Output drive strength */
-    PortHw_LockRegisterType    LockRegister_en;    /**< @brief Configuration lock */
-    PortHw_PortPinsLevelType        InitValue_u8;       /**< @brief Initial output value for GPIO */
-} PortHw_PinSettingsConfigType;
+    uint32                      Mask_u32;           /**< @brief Pins of the group (bit n = pin n), adjoining */
+    uint8                       Offset_u8;          /**< @brief Lowest pin of the group */
+} PortHw_ChannelGroupType;
+
+/**
+* @brief   Debounce State Structure
+* @details Bit-sliced state of the debounced pins of one port: bit n of every word belongs to
+*          pin n. Count0_u32/Count1_u32 are the two bit planes of a 2-bit counter per pin, so
+*          all 32 pins are counted by a few word operations.
+*/
+typedef struct PortHw_DebounceStateType_t
+{
+    uint32                      Count0_u32;         /**< @brief Counter bit 0 of every pin */
+    uint32                      Count1_u32;         /**< @brief Counter bit 1 of every pin */
+    uint32                      State_u32;          /**< @brief Debounced level (bit n = pin n) */
+    uint32                      Edge_u32;           /**< @brief Pins whose debounced level changed on the last update */
+} PortHw_DebounceStateType;
+
+/**
+* @brief   Digital Filter Configuration Structure
+* @details Digital input filter of one port: clock and width are shared by all pins of the
+*          port, the filter is enabled on the pins of PinMask_u32. An input pulse shorter than
+*          Width_u8 filter clock cycles is not passed to PDIR, the pin interrupt and DMA.
+*/
+typedef struct PortHw_DigitalFilterConfigType_t
+{
+    PORT_Type*                      PortBase_ptr;   /**< @brief Pointer to PORT peripheral base */
+    uint32                          PinMask_u32;    /**< @brief Filtered pins (bit n = pin n) */
+    PortHw_DigitalFilterClockType   Clock_en;       /**< @brief Filter clock source */
+    uint8                           Width_u8;       /**< @brief Filter width in filter clock cycles (0-31) */
+} PortHw_DigitalFilterConfigType;
+
+/**
+* @brief   Global Pin Control Write Structure
+* @details One GPCLR/GPCHR write: the lower PCR half (MUX and pad settings) written to the
+*          selected pins of one port half, resolved off-line from a list of (pin, mode)
+*/
+typedef struct PortHw_GlobalPinControlType_t
+{
+    PORT_Type*                      PortBase_ptr;   /**< @brief Pointer to PORT peripheral base */
+    uint16                          Pins_u16;       /**< @brief Pins of the half (bit 0 = pin 0/16) */
+    uint16                          Value_u16;      /**< @brief PCR[15:0] written to the pins */
+    PortHw_GlobalControlPinsType    Half_en;        /**< @brief Lower or upper half of the port */
+} PortHw_GlobalPinControlType;
 
 /*==================================================================================================
 *                                 GLOBAL VARIABLE DECLARATIONS
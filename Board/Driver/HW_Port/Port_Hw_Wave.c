@@ -0,0 +1,484 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Wave.c
+*
+*   @brief   Port Hardware waveform playback source file
+*   @details DMA backend: the whole buffer is one major loop of 2 * HalfLength_u16 minor loops
+*            of one 32-bit word. The source advances by 4 bytes per word and SLAST rewinds it
+*            to the buffer start at the end of the major loop, the destination stays on the
+*            output register. The half interrupt fires when the first half has been written,
+*            the major interrupt when the second one has. The handler reads CSR[DONE], set at
+*            the end of the major loop, and the remaining count CITER, which is reloaded with
+*            BITER then and is at most HalfLength_u16 once the first half has been written.
+*            A late handler can find both a finished major loop and a finished first half; it
+*            then calls both notifications in playing order. A one-shot buffer sets
+*            CSR[DREQ], so the hardware clears the request enable after the last word.
+*
+*            Channels are enabled and disabled with the byte-wide SERQ/CERQ registers, which
+*            change one channel without a read-modify-write of ERQ, so no exclusive area is
+*            needed between streams.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw_Wave.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_WAVE_VENDOR_ID_C                    43
+#define PORT_HW_WAVE_AR_RELEASE_MAJOR_VERSION_C     21
+#define PORT_HW_WAVE_AR_RELEASE_MINOR_VERSION_C     11
+#define PORT_HW_WAVE_AR_RELEASE_REVISION_VERSION_C  0
+#define PORT_HW_WAVE_SW_MAJOR_VERSION_C             1
+#define PORT_HW_WAVE_SW_MINOR_VERSION_C             0
+#define PORT_HW_WAVE_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Wave.c and Port_Hw_Wave.h are of the same vendor */
+#if (PORT_HW_WAVE_VENDOR_ID_C != PORT_HW_WAVE_VENDOR_ID_H)
+    #error "Port_Hw_Wave.c and Port_Hw_Wave.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Wave.c and Port_Hw_Wave.h are of the same Autosar version */
+#if ((PORT_HW_WAVE_AR_RELEASE_MAJOR_VERSION_C    != PORT_HW_WAVE_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_WAVE_AR_RELEASE_MINOR_VERSION_C    != PORT_HW_WAVE_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_WAVE_AR_RELEASE_REVISION_VERSION_C != PORT_HW_WAVE_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Wave.c and Port_Hw_Wave.h are different"
+#endif
+
+/* Check if Port_Hw_Wave.c and Port_Hw_Wave.h are of the same software version */
+#if ((PORT_HW_WAVE_SW_MAJOR_VERSION_C != PORT_HW_WAVE_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_WAVE_SW_MINOR_VERSION_C != PORT_HW_WAVE_SW_MINOR_VERSION_H) || \
+     (PORT_HW_WAVE_SW_PATCH_VERSION_C != PORT_HW_WAVE_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Wave.c and Port_Hw_Wave.h are different"
+#endif
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Stream state
+*/
+typedef struct
+{
+    const PortHw_WaveConfigType* Config_ptr;        /**< @brief Configuration of the running stream */
+    volatile uint32* Target_ptr;                    /**< @brief Output register written */
+    uint32 Index_u32;                               /**< @brief CPU backend: next word */
+    uint8 NextHalf_u8;                              /**< @brief DMA backend: half notified next */
+    volatile boolean Running_boo;                   /**< @brief TRUE between start and stop */
+} PortHw_WaveStreamType;
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Bus address of a buffer or register as programmed into a TCD
+* @details Can be overridden by the test environment, whose pointers do not fit 32 bits.
+*/
+#ifndef PORT_HW_WAVE_DMA_ADDRESS
+    #define PORT_HW_WAVE_DMA_ADDRESS(address)       ((uint32)(address))
+#endif
+
+/**
+* @brief DMAMUX source that always requests ("always enabled" slot), gated by the PIT trigger
+*/
+#define PORT_HW_WAVE_DMAMUX_ALWAYS_ON_U8            ((uint8)63U)
+
+/**
+* @brief Bytes of one word and its TCD transfer size code (32-bit)
+*/
+#define PORT_HW_WAVE_WORD_BYTES_U32                 ((uint32)4U)
+#define PORT_HW_WAVE_WORD_SIZE_U16                  ((uint16)2U)
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+#define PORT_START_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/**
+* @brief State of the streams
+*/
+static PortHw_WaveStreamType PortHw_Wave_ast[PORT_HW_WAVE_MAX_STREAMS_U8];
+
+#define PORT_STOP_SEC_VAR_CLEARED_UNSPECIFIED
+#include "Port_MemMap.h"
+
+/*==================================================================================================
+*                                      GLOBAL CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+#define PORT_START_SEC_CODE
+#include "Port_MemMap.h"
+
+static volatile uint32* PortHw_WaveTarget(const PortHw_WaveConfigType* Config_ptr);
+static void PortHw_WaveDmaStart(const PortHw_WaveConfigType* Config_ptr, volatile uint32* Target_ptr);
+static void PortHw_WaveDmaStop(uint8 Channel_u8);
+static void PortHw_WaveNotify(uint8 Stream_u8, const PortHw_WaveConfigType* Config_ptr, uint8 Half_u8);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveTarget
+* Description   : Returns the output register selected by the configuration
+*
+******************************************************************************/
+static volatile uint32* PortHw_WaveTarget(const PortHw_WaveConfigType* Config_ptr)
+{
+    volatile uint32* f_Target_ptr;
+
+    switch (Config_ptr->Target_en)
+    {
+        case PORT_HW_WAVE_TARGET_PSOR:
+            f_Target_ptr = &Config_ptr->GpioBase_ptr->PSOR;
+            break;
+        case PORT_HW_WAVE_TARGET_PCOR:
+            f_Target_ptr = &Config_ptr->GpioBase_ptr->PCOR;
+            break;
+        case PORT_HW_WAVE_TARGET_PTOR:
+            f_Target_ptr = &Config_ptr->GpioBase_ptr->PTOR;
+            break;
+        default:
+            f_Target_ptr = &Config_ptr->GpioBase_ptr->PDOR;
+            break;
+    }
+
+    return f_Target_ptr;
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveDmaStart
+* Description   : Programs the TCD and the DMAMUX channel of a DMA stream and enables its
+*                 request
+*
+******************************************************************************/
+static void PortHw_WaveDmaStart(const PortHw_WaveConfigType* Config_ptr, volatile uint32* Target_ptr)
+{
+    uint8 f_Channel_u8 = Config_ptr->DmaChannel_u8;
+    uint16 f_Words_u16 = (uint16)(2U * (uint32)Config_ptr->HalfLength_u16);
+    uint16 f_Csr_u16 = (uint16)(DMA_TCD_CSR_INTHALF_MASK | DMA_TCD_CSR_INTMAJOR_MASK);
+
+    if (FALSE == Config_ptr->Loop_boo)
+    {
+        f_Csr_u16 |= (uint16)DMA_TCD_CSR_DREQ_MASK;
+    }
+
+    /* Channel stopped and unrouted while its TCD changes */
+    PortHw_WaveDmaStop(f_Channel_u8);
+
+    PORT_HW_REG_WRITE32(&IP_DMA->TCD[f_Channel_u8].SADDR, PORT_HW_WAVE_DMA_ADDRESS(Config_ptr->Buffer_ptr));
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].SOFF, PORT_HW_WAVE_WORD_BYTES_U32);
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].ATTR,
+                        DMA_TCD_ATTR_SSIZE(PORT_HW_WAVE_WORD_SIZE_U16) | DMA_TCD_ATTR_DSIZE(PORT_HW_WAVE_WORD_SIZE_U16));
+    PORT_HW_REG_WRITE32(&IP_DMA->TCD[f_Channel_u8].NBYTES.MLNO, PORT_HW_WAVE_WORD_BYTES_U32);
+    PORT_HW_REG_WRITE32(&IP_DMA->TCD[f_Channel_u8].SLAST, 0U - ((uint32)f_Words_u16 * PORT_HW_WAVE_WORD_BYTES_U32));
+    PORT_HW_REG_WRITE32(&IP_DMA->TCD[f_Channel_u8].DADDR, PORT_HW_WAVE_DMA_ADDRESS(Target_ptr));
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].DOFF, 0U);
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].CITER.ELINKNO, f_Words_u16);
+    PORT_HW_REG_WRITE32(&IP_DMA->TCD[f_Channel_u8].DLASTSGA, 0U);
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].CSR, f_Csr_u16);
+    PORT_HW_REG_WRITE16(&IP_DMA->TCD[f_Channel_u8].BITER.ELINKNO, f_Words_u16);
+
+    PORT_HW_REG_WRITE8(&IP_DMAMUX->CHCFG[f_Channel_u8],
+                       DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_TRIG_MASK | DMAMUX_CHCFG_SOURCE(PORT_HW_WAVE_DMAMUX_ALWAYS_ON_U8));
+    PORT_HW_REG_WRITE8(&IP_DMA->SERQ, f_Channel_u8);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveDmaStop
+* Description   : Disables the request of a DMA channel, unroutes it and drops a pending
+*                 interrupt
+*
+******************************************************************************/
+static void PortHw_WaveDmaStop(uint8 Channel_u8)
+{
+    PORT_HW_REG_WRITE8(&IP_DMA->CERQ, Channel_u8);
+    PORT_HW_REG_WRITE8(&IP_DMAMUX->CHCFG[Channel_u8], 0U);
+    PORT_HW_REG_WRITE8(&IP_DMA->CINT, Channel_u8);
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveNotify
+* Description   : Calls the half notification of a stream, if configured
+*
+******************************************************************************/
+static void PortHw_WaveNotify(uint8 Stream_u8, const PortHw_WaveConfigType* Config_ptr, uint8 Half_u8)
+{
+    if (NULL_PTR != Config_ptr->Notification)
+    {
+        Config_ptr->Notification(Stream_u8, Half_u8);
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveStart
+* Description   : Starts a waveform on a stream, a running one is replaced
+*
+* @implements Port_Hw_WaveStart_Activity
+******************************************************************************/
+void PortHw_WaveStart(
+    uint8 Stream_u8,
+    const PortHw_WaveConfigType* Config_ptr
+)
+{
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stream_u8 < PORT_HW_WAVE_MAX_STREAMS_U8);
+    PORT_HW_DEV_ASSERT(Config_ptr != NULL_PTR);
+    PORT_HW_DEV_ASSERT((Config_ptr->GpioBase_ptr != NULL_PTR) && (Config_ptr->Buffer_ptr != NULL_PTR));
+    PORT_HW_DEV_ASSERT((Config_ptr->HalfLength_u16 > 0U) && (Config_ptr->HalfLength_u16 <= PORT_HW_WAVE_HALF_LENGTH_MAX_U16));
+    PORT_HW_DEV_ASSERT((PORT_HW_WAVE_BACKEND_CPU == Config_ptr->Backend_en) ||
+                       (Config_ptr->DmaChannel_u8 <= PORT_HW_WAVE_DMA_CHANNEL_MAX_U8));
+
+    PortHw_WaveStop(Stream_u8);
+
+    PortHw_Wave_ast[Stream_u8].Config_ptr = Config_ptr;
+    PortHw_Wave_ast[Stream_u8].Target_ptr = PortHw_WaveTarget(Config_ptr);
+    PortHw_Wave_ast[Stream_u8].Index_u32 = 0U;
+    PortHw_Wave_ast[Stream_u8].NextHalf_u8 = 0U;
+    PortHw_Wave_ast[Stream_u8].Running_boo = TRUE;
+
+    if (PORT_HW_WAVE_BACKEND_DMA == Config_ptr->Backend_en)
+    {
+        PortHw_WaveDmaStart(Config_ptr, PortHw_Wave_ast[Stream_u8].Target_ptr);
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveStop
+* Description   : Stops the waveform of a stream
+*
+* @implements Port_Hw_WaveStop_Activity
+******************************************************************************/
+void PortHw_WaveStop(
+    uint8 Stream_u8
+)
+{
+    const PortHw_WaveConfigType* f_Config_ptr;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stream_u8 < PORT_HW_WAVE_MAX_STREAMS_U8);
+
+    f_Config_ptr = PortHw_Wave_ast[Stream_u8].Config_ptr;
+    if (TRUE == PortHw_Wave_ast[Stream_u8].Running_boo)
+    {
+        PortHw_Wave_ast[Stream_u8].Running_boo = FALSE;
+        if (PORT_HW_WAVE_BACKEND_DMA == f_Config_ptr->Backend_en)
+        {
+            PortHw_WaveDmaStop(f_Config_ptr->DmaChannel_u8);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveTick
+* Description   : Writes the next word of a CPU backend stream
+*
+* @implements Port_Hw_WaveTick_Activity
+******************************************************************************/
+void PortHw_WaveTick(
+    uint8 Stream_u8
+)
+{
+    PortHw_WaveStreamType* f_Stream_ptr;
+    const PortHw_WaveConfigType* f_Config_ptr;
+    uint32 f_Index_u32;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stream_u8 < PORT_HW_WAVE_MAX_STREAMS_U8);
+
+    f_Stream_ptr = &PortHw_Wave_ast[Stream_u8];
+    f_Config_ptr = f_Stream_ptr->Config_ptr;
+    if ((TRUE == f_Stream_ptr->Running_boo) && (PORT_HW_WAVE_BACKEND_CPU == f_Config_ptr->Backend_en))
+    {
+        f_Index_u32 = f_Stream_ptr->Index_u32;
+        PORT_HW_REG_WRITE32(f_Stream_ptr->Target_ptr, f_Config_ptr->Buffer_ptr[f_Index_u32]);
+        f_Index_u32++;
+
+        if (f_Index_u32 == (uint32)f_Config_ptr->HalfLength_u16)
+        {
+            f_Stream_ptr->Index_u32 = f_Index_u32;
+            if (NULL_PTR != f_Config_ptr->Notification)
+            {
+                f_Config_ptr->Notification(Stream_u8, 0U);
+            }
+        }
+        else if (f_Index_u32 == (2U * (uint32)f_Config_ptr->HalfLength_u16))
+        {
+            /* End of the buffer: replay or stop before the notification, which may restart */
+            f_Stream_ptr->Index_u32 = 0U;
+            if (FALSE == f_Config_ptr->Loop_boo)
+            {
+                f_Stream_ptr->Running_boo = FALSE;
+            }
+            if (NULL_PTR != f_Config_ptr->Notification)
+            {
+                f_Config_ptr->Notification(Stream_u8, 1U);
+            }
+        }
+        else
+        {
+            f_Stream_ptr->Index_u32 = f_Index_u32;
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveDmaIrqHandler
+* Description   : Handles the half or major loop interrupt of a DMA backend stream
+*
+* @implements Port_Hw_WaveDmaIrqHandler_Activity
+******************************************************************************/
+void PortHw_WaveDmaIrqHandler(
+    uint8 Stream_u8
+)
+{
+    PortHw_WaveStreamType* f_Stream_ptr;
+    const PortHw_WaveConfigType* f_Config_ptr;
+    uint16 f_Remaining_u16;
+    boolean f_Done_boo;
+    boolean f_FirstHalf_boo;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stream_u8 < PORT_HW_WAVE_MAX_STREAMS_U8);
+
+    f_Stream_ptr = &PortHw_Wave_ast[Stream_u8];
+    f_Config_ptr = f_Stream_ptr->Config_ptr;
+    if ((TRUE == f_Stream_ptr->Running_boo) && (PORT_HW_WAVE_BACKEND_DMA == f_Config_ptr->Backend_en))
+    {
+        PORT_HW_REG_WRITE8(&IP_DMA->CINT, f_Config_ptr->DmaChannel_u8);
+
+        f_Done_boo = (0U != (PORT_HW_REG_READ16(&IP_DMA->TCD[f_Config_ptr->DmaChannel_u8].CSR) & DMA_TCD_CSR_DONE_MASK));
+        f_Remaining_u16 = (uint16)(PORT_HW_REG_READ16(&IP_DMA->TCD[f_Config_ptr->DmaChannel_u8].CITER.ELINKNO) &
+                                   DMA_TCD_CITER_ELINKNO_CITER_MASK);
+        f_FirstHalf_boo = (f_Remaining_u16 <= f_Config_ptr->HalfLength_u16);
+
+        /* Major loop finished: DONE, or CITER reloaded after the first half was notified */
+        if ((TRUE == f_Done_boo) || ((1U == f_Stream_ptr->NextHalf_u8) && (FALSE == f_FirstHalf_boo)))
+        {
+            if (TRUE == f_Done_boo)
+            {
+                PORT_HW_REG_WRITE8(&IP_DMA->CDNE, f_Config_ptr->DmaChannel_u8);
+            }
+            if (0U == f_Stream_ptr->NextHalf_u8)
+            {
+                /* The half interrupt was merged into the major one */
+                PortHw_WaveNotify(Stream_u8, f_Config_ptr, 0U);
+            }
+            f_Stream_ptr->NextHalf_u8 = 0U;
+            if (FALSE == f_Config_ptr->Loop_boo)
+            {
+                /* The hardware already cleared the request (CSR[DREQ]) */
+                PortHw_WaveStop(Stream_u8);
+                f_FirstHalf_boo = FALSE;
+            }
+            PortHw_WaveNotify(Stream_u8, f_Config_ptr, 1U);
+        }
+
+        /* First half written, possibly already of the next pass */
+        if ((TRUE == f_FirstHalf_boo) && (0U == f_Stream_ptr->NextHalf_u8))
+        {
+            f_Stream_ptr->NextHalf_u8 = 1U;
+            PortHw_WaveNotify(Stream_u8, f_Config_ptr, 0U);
+        }
+    }
+}
+
+/*FUNCTION**********************************************************************
+*
+* Function Name : PortHw_WaveIsRunning
+* Description   : Tells whether a stream still plays
+*
+* @implements Port_Hw_WaveIsRunning_Activity
+******************************************************************************/
+boolean PortHw_WaveIsRunning(
+    uint8 Stream_u8
+)
+{
+    const PortHw_WaveConfigType* f_Config_ptr;
+    boolean f_Running_boo;
+
+    /* Validate input parameters */
+    PORT_HW_DEV_ASSERT(Stream_u8 < PORT_HW_WAVE_MAX_STREAMS_U8);
+
+    f_Config_ptr = PortHw_Wave_ast[Stream_u8].Config_ptr;
+    f_Running_boo = PortHw_Wave_ast[Stream_u8].Running_boo;
+    if ((TRUE == f_Running_boo) && (PORT_HW_WAVE_BACKEND_DMA == f_Config_ptr->Backend_en))
+    {
+        /* A one-shot buffer ends in hardware even if its last interrupt is not served yet */
+        if (0U == (PORT_HW_REG_READ32(&IP_DMA->ERQ) & (1UL << f_Config_ptr->DmaChannel_u8)))
+        {
+            f_Running_boo = FALSE;
+        }
+    }
+
+    return f_Running_boo;
+}
+
+#define PORT_STOP_SEC_CODE
+#include "Port_MemMap.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
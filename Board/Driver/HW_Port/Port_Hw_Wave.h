@@ -0,0 +1,240 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.0
+*   Build Version        :
+*
+*   Author               : PhucPH32
+==================================================================================================*/
+/**
+*   @file    Port_Hw_Wave.h
+*
+*   @brief   Port Hardware waveform playback header file
+*   @details Streams a precomputed buffer of port-wide words to one output register (PDOR,
+*            PSOR, PCOR or PTOR) of a GPIO block, one word per step, for stepper motor and LED
+*            matrix patterns. The buffer is played as two halves: a notification reports every
+*            half that has been written out, so the caller can refill it while the other half
+*            plays (double buffering).
+*
+*            Two backends use the same buffer format:
+*            - PORT_HW_WAVE_BACKEND_DMA: an eDMA channel moves one word per request, paced by
+*              the PIT channel of the same number through the DMAMUX periodic trigger. The CPU
+*              only handles the half and major loop interrupts.
+*            - PORT_HW_WAVE_BACKEND_CPU: PortHw_WaveTick() writes one word per call, for a
+*              timer interrupt on a device without a free DMA channel.
+*
+*   @addtogroup Port_HW
+*   @{
+*/
+
+#ifndef PORT_HW_WAVE_H
+#define PORT_HW_WAVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+/**
+* @brief Parameters that shall be published within the Port driver header file and also in the
+*        module's description file
+*/
+#define PORT_HW_WAVE_VENDOR_ID_H                    43
+#define PORT_HW_WAVE_AR_RELEASE_MAJOR_VERSION_H     21
+#define PORT_HW_WAVE_AR_RELEASE_MINOR_VERSION_H     11
+#define PORT_HW_WAVE_AR_RELEASE_REVISION_VERSION_H  0
+#define PORT_HW_WAVE_SW_MAJOR_VERSION_H             1
+#define PORT_HW_WAVE_SW_MINOR_VERSION_H             0
+#define PORT_HW_WAVE_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                      FILE VERSION CHECKS
+==================================================================================================*/
+/* Check if Port_Hw_Wave.h and Port_Hw.h are of the same vendor */
+#if (PORT_HW_WAVE_VENDOR_ID_H != PORT_HW_VENDOR_ID_H)
+    #error "Port_Hw_Wave.h and Port_Hw.h have different vendor ids"
+#endif
+
+/* Check if Port_Hw_Wave.h and Port_Hw.h are of the same Autosar version */
+#if ((PORT_HW_WAVE_AR_RELEASE_MAJOR_VERSION_H    != PORT_HW_AR_RELEASE_MAJOR_VERSION_H)  || \
+     (PORT_HW_WAVE_AR_RELEASE_MINOR_VERSION_H    != PORT_HW_AR_RELEASE_MINOR_VERSION_H)  || \
+     (PORT_HW_WAVE_AR_RELEASE_REVISION_VERSION_H != PORT_HW_AR_RELEASE_REVISION_VERSION_H)  \
+    )
+    #error "Autosar Version Numbers of Port_Hw_Wave.h and Port_Hw.h are different"
+#endif
+
+/* Check if Port_Hw_Wave.h and Port_Hw.h are of the same software version */
+#if ((PORT_HW_WAVE_SW_MAJOR_VERSION_H != PORT_HW_SW_MAJOR_VERSION_H) || \
+     (PORT_HW_WAVE_SW_MINOR_VERSION_H != PORT_HW_SW_MINOR_VERSION_H) || \
+     (PORT_HW_WAVE_SW_PATCH_VERSION_H != PORT_HW_SW_PATCH_VERSION_H)    \
+    )
+    #error "Software Version Numbers of Port_Hw_Wave.h and Port_Hw.h are different"
+#endif
+
+/*==================================================================================================
+*                                          CONSTANTS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Number of waveform streams that can play at the same time
+*/
+#ifndef PORT_HW_WAVE_MAX_STREAMS_U8
+    #define PORT_HW_WAVE_MAX_STREAMS_U8         ((uint8)2U)
+#endif
+
+/**
+* @brief Highest eDMA channel of the DMA backend
+* @details Only DMAMUX channels 0..3 have a periodic trigger (PIT channels 0..3).
+*/
+#define PORT_HW_WAVE_DMA_CHANNEL_MAX_U8         ((uint8)3U)
+
+/**
+* @brief Longest buffer half in words
+* @details Both halves are one major loop, whose count is 15 bits wide.
+*/
+#define PORT_HW_WAVE_HALF_LENGTH_MAX_U16        ((uint16)16383U)
+
+/*==================================================================================================
+*                                             ENUMS
+==================================================================================================*/
+/**
+* @brief GPIO output register the buffer words are written to
+*/
+typedef enum
+{
+    PORT_HW_WAVE_TARGET_PDOR = 0U,              /**< @brief Word is the new output level of the port */
+    PORT_HW_WAVE_TARGET_PSOR = 1U,              /**< @brief Word sets pins */
+    PORT_HW_WAVE_TARGET_PCOR = 2U,              /**< @brief Word clears pins */
+    PORT_HW_WAVE_TARGET_PTOR = 3U               /**< @brief Word toggles pins */
+} PortHw_WaveTargetType;
+
+/**
+* @brief Engine that moves the words
+*/
+typedef enum
+{
+    PORT_HW_WAVE_BACKEND_DMA = 0U,              /**< @brief eDMA channel paced by its PIT trigger */
+    PORT_HW_WAVE_BACKEND_CPU = 1U               /**< @brief PortHw_WaveTick() from a timer interrupt */
+} PortHw_WaveBackendType;
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Half notification
+* @details Called from the DMA interrupt (PortHw_WaveDmaIrqHandler()) or from PortHw_WaveTick()
+*          when the last word of a half has been written; the half may be refilled until the
+*          other half has played.
+* @param Stream_u8 Stream
+* @param Half_u8   Half written out: 0 = first, 1 = second
+*/
+typedef void (*PortHw_WaveNotificationType)(uint8 Stream_u8, uint8 Half_u8);
+
+/**
+* @brief Waveform configuration
+*/
+typedef struct PortHw_WaveConfigType_t
+{
+    GPIO_Type*                  GpioBase_ptr;       /**< @brief GPIO block written */
+    PortHw_WaveTargetType       Target_en;          /**< @brief Output register written */
+    const uint32*               Buffer_ptr;         /**< @brief 2 * HalfLength_u16 words, first half then second half */
+    uint16                      HalfLength_u16;     /**< @brief Words of one half, 1..PORT_HW_WAVE_HALF_LENGTH_MAX_U16 */
+    PortHw_WaveBackendType      Backend_en;         /**< @brief Engine */
+    uint8                       DmaChannel_u8;      /**< @brief eDMA and PIT channel of the DMA backend, 0..PORT_HW_WAVE_DMA_CHANNEL_MAX_U8 */
+    boolean                     Loop_boo;           /**< @brief TRUE: replay the buffer until stopped, FALSE: play it once */
+    PortHw_WaveNotificationType Notification;       /**< @brief Half notification, NULL_PTR for none */
+} PortHw_WaveConfigType;
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+
+/*==================================================================================================
+*                                    FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief   Starts a waveform
+* @details DMA backend: programs the TCD of the channel (one 32-bit word per minor loop, both
+*          halves in one major loop with the half and major interrupts, source rewound at the
+*          end of the major loop), routes the always-enabled DMAMUX source through the PIT
+*          trigger and enables the request. The PIT channel and the DMA interrupt must be set
+*          up by the integrator; every PIT period writes one word.
+*          CPU backend: the first PortHw_WaveTick() writes the first word.
+* @param[in] Stream_u8  Stream, 0..PORT_HW_WAVE_MAX_STREAMS_U8 - 1
+* @param[in] Config_ptr Configuration, must stay valid until the stream is stopped
+*/
+void PortHw_WaveStart(
+    uint8 Stream_u8,
+    const PortHw_WaveConfigType* Config_ptr
+);
+
+/**
+* @brief   Stops a waveform
+* @details The output keeps the last word written.
+* @param[in] Stream_u8 Stream
+*/
+void PortHw_WaveStop(
+    uint8 Stream_u8
+);
+
+/**
+* @brief   Writes the next word of a CPU backend stream
+* @details For the timer interrupt that paces the stream: one register write per call, the
+*          half notification is called after the last word of a half.
+* @param[in] Stream_u8 Stream
+*/
+void PortHw_WaveTick(
+    uint8 Stream_u8
+);
+
+/**
+* @brief   DMA interrupt of a DMA backend stream
+* @details For the DMAn_IRQHandler of the stream channel: clears the interrupt request and
+*          the DONE flag and calls the half notification. When the handler ran late and both
+*          a half and the end of the major loop are pending, both notifications are called in
+*          playing order. A one-shot stream is stopped after its second half.
+* @param[in] Stream_u8 Stream
+*/
+void PortHw_WaveDmaIrqHandler(
+    uint8 Stream_u8
+);
+
+/**
+* @brief   Tells whether a stream still plays
+* @param[in] Stream_u8 Stream
+* @return    boolean TRUE between the start and the stop or the end of a one-shot buffer
+*/
+boolean PortHw_WaveIsRunning(
+    uint8 Stream_u8
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_WAVE_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -31,6 +31,7 @@ extern "C" {
 ==================================================================================================*/
 #include "S32K144.h"
 #include "test_port_driver.h"
+#include "bench_port_hw.h"
 
 /*==================================================================================================
 *                                       LOCAL MACROS
@@ -169,7 +170,7 @@ static void Delay(uint32 count)
 *   1. Initialize system clock
 *   2. Initialize LEDs for status indication
 *   3. Blink Blue LED to indicate test start
-*   4. Run all Port driver test cases
+*   4. Run all Port driver test cases, then the cycle benchmarks
 *   5. Show test result status on LED:
 *      - GREEN: All tests passed
 *      - RED: All tests failed
@@ -199,6 +200,9 @@ int main(void)
     
     /* Get test summary */
     pSummary = Test_Port_Driver_GetSummary();
+
+    /* Run cycle benchmarks (results are read with the debugger) */
+    Bench_Port_Hw_RunAll();
     
     /* Set LED status based on results */
     LED_SetStatus(pSummary->passedTests, pSummary->failedTests);
@@ -401,7 +401,7 @@ static uint8 Test_PORT_IT_DRV_002(void)
 }
 
 /**
-* @brief PORT_IT_DRV_003: Port_Init with invalid config (IpConfig_ptr = NULL or NumPins = 0)
+* @brief PORT_IT_DRV_003: Port_Init with invalid config (PinTable_ptr = NULL or NumPins = 0)
 * @details Tests PORT_E_PARAM_CONFIG error with invalid configuration
 */
 static uint8 Test_PORT_IT_DRV_003(void)
@@ -410,7 +410,7 @@ static uint8 Test_PORT_IT_DRV_003(void)
     
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* This test requires a special invalid configuration - skip if not available */
-    /* In real testing, create Port_ConfigType with IpConfig_ptr = NULL_PTR */
+    /* In real testing, create Port_ConfigType with PinTable_ptr = NULL_PTR */
     TestSummary.skippedTests++;
     result = TEST_PASSED; /* Mark as passed if test infrastructure not available */
 #else
@@ -0,0 +1,284 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host benchmark of the Port switch debounce
+==================================================================================================*/
+
+/**
+*   @file    bench_port_debounce_host.c
+*
+*   @brief   Host benchmark of the Port switch debounce
+*   @details Debounces 40 switches (PTA0-31, PTE16-23) fed with random bouncing inputs, first
+*            with one PortHw_ReadPin() and one counter per pin, then with
+*            Port_DebounceMainFunction() and its vertical counters. Prints the register reads
+*            per tick (counted by the simulated register file) and the time per tick, and
+*            checks that both ways end with the same debounced levels. The time is host time
+*            through the simulator, only the ratio is meaningful; target cycles are measured by
+*            PORT_HW_BM_012 of bench_port_hw.c. _POSIX_C_SOURCE is given on the command line
+*            because Port_Hw_Sim.h is force-included before this file.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -include Port_Hw_Sim.h -IBSW/MCAL/Stub/Det -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/bench_port_debounce_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                BSW/MCAL/Config/Port/Port_Hw_VS_0_PBcfg.c BSW/MCAL/Config/Port/Port_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Cfg.c BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*                Board/Driver/HW_Port/Port_Hw_Irq.c BSW/MCAL/Driver/Port/Port.c BSW/MCAL/Stub/Det/Det.c -o bench_port_debounce_host
+*            ./bench_port_debounce_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <time.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw.h"
+#include "Port.h"
+
+#if (STD_ON != PORT_DEBOUNCE_API)
+    #error "bench_port_debounce_host.c needs PORT_DEBOUNCE_API"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Debounce ticks per measurement
+*/
+#define BENCH_TICKS                     (200000U)
+
+/**
+* @brief Input patterns, replayed cyclically (power of two)
+*/
+#define BENCH_PATTERNS                  (1024U)
+
+/**
+* @brief Debounced switches: all of PTA and PTE16-23
+*/
+#define BENCH_PORTS                     (2U)
+#define BENCH_PINS                      (40U)
+
+/*==================================================================================================
+*                                   LOCAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Cost of one debounce way
+*/
+typedef struct
+{
+    uint32 Reads_u32;           /**< @brief Register reads of one tick */
+    double Seconds;             /**< @brief Time of BENCH_TICKS ticks */
+} Bench_CostType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Debounce ports, in simulated port order
+*/
+static const PortHw_PinMaskType Bench_DebouncePorts[BENCH_PORTS] =
+{
+    { IP_PTA, (uint32)0xFFFFFFFFU },
+    { IP_PTE, (uint32)0x00FF0000U }
+};
+static const uint8 Bench_PortIndex[BENCH_PORTS] = { 0U, 4U };
+
+/**
+* @brief RAM debounce state of the vertical counters
+*/
+static PortHw_DebounceStateType Bench_DebounceState[BENCH_PORTS];
+
+/**
+* @brief Random bouncing inputs of every port, one word per tick
+*/
+static uint32 Bench_Pattern[BENCH_PATTERNS][BENCH_PORTS];
+
+/**
+* @brief Per-pin reference: level and counter of every switch
+*/
+static uint8 Bench_RefState[BENCH_PINS];
+static uint8 Bench_RefCount[BENCH_PINS];
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Fills the input patterns: random switch changes with a few ticks of bounce each
+*/
+static void Bench_BuildPatterns(void)
+{
+    uint32 seed = 0x9E3779B9U;
+    uint32 level[BENCH_PORTS] = { 0U, 0U };
+    uint32 bounce[BENCH_PORTS] = { 0U, 0U };
+    uint32 tick;
+    uint32 port;
+    uint32 changes;
+
+    for (tick = 0U; tick < BENCH_PATTERNS; tick++)
+    {
+        for (port = 0U; port < BENCH_PORTS; port++)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            changes = seed & (seed >> 7) & (seed >> 14) & (seed >> 21);
+            level[port] ^= changes;
+            bounce[port] = (bounce[port] | changes) & (seed >> 3);
+            Bench_Pattern[tick][port] = level[port] ^ (bounce[port] & seed);
+        }
+    }
+}
+
+/**
+* @brief Applies the input pattern of a tick to the simulated ports
+*/
+static void Bench_SetInputs(uint32 Tick)
+{
+    uint32 port;
+
+    for (port = 0U; port < BENCH_PORTS; port++)
+    {
+        PortHwSim_SetInput(Bench_PortIndex[port], Bench_Pattern[Tick & (BENCH_PATTERNS - 1U)][port]);
+    }
+}
+
+/**
+* @brief Reference tick: one pin read and one counter per switch
+*/
+static void Bench_PerPinTick(void)
+{
+    static GPIO_Type* const pinBase[BENCH_PINS / 8U] = { IP_PTA, IP_PTA, IP_PTA, IP_PTA, IP_PTE };
+    static const uint8 firstPin[BENCH_PINS / 8U] = { 0U, 8U, 16U, 24U, 16U };
+    uint32 pin;
+    uint8 level;
+
+    for (pin = 0U; pin < BENCH_PINS; pin++)
+    {
+        level = PortHw_ReadPin(pinBase[pin / 8U], (uint32)firstPin[pin / 8U] + (pin % 8U));
+        if (level != Bench_RefState[pin])
+        {
+            Bench_RefCount[pin]++;
+            if (PORT_HW_DEBOUNCE_TICKS_U8 == Bench_RefCount[pin])
+            {
+                Bench_RefState[pin] = level;
+                Bench_RefCount[pin] = 0U;
+            }
+        }
+        else
+        {
+            Bench_RefCount[pin] = 0U;
+        }
+    }
+}
+
+/**
+* @brief Counts the reads of one tick, then times BENCH_TICKS ticks
+*/
+static void Bench_Measure(void (*Tick)(void), Bench_CostType* pCost)
+{
+    struct timespec start;
+    struct timespec stop;
+    uint32 i;
+
+    Bench_SetInputs(0U);
+    PortHwSim_ClearCounters();
+    Tick();
+    pCost->Reads_u32 = PortHwSim_g_ReadCount_u32;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 1U; i < BENCH_TICKS; i++)
+    {
+        Bench_SetInputs(i);
+        Tick();
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    pCost->Seconds = ((double)(stop.tv_sec - start.tv_sec)) + (((double)(stop.tv_nsec - start.tv_nsec)) * 1e-9);
+}
+
+/**
+* @brief Prints one way
+*/
+static void Bench_Print(const char* pName, const Bench_CostType* pCost)
+{
+    (void)printf("  %-26s: %2u reads per tick, %8.1f ns per tick\n",
+                 pName, (unsigned)pCost->Reads_u32, (pCost->Seconds * 1e9) / (double)BENCH_TICKS);
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    Port_ConfigType config;
+    Bench_CostType perPin;
+    Bench_CostType vertical;
+    uint32 pin;
+    uint32 port;
+    uint32 state;
+    uint32 mismatches = 0U;
+
+    Bench_BuildPatterns();
+    PortHwSim_Reset();
+    Bench_SetInputs(BENCH_PATTERNS - 1U);
+    config = Port_Config_VS_0;
+    config.NumDebouncePorts_u16 = (uint16)BENCH_PORTS;
+    config.DebounceConfig_ptr = Bench_DebouncePorts;
+    config.DebounceState_ptr = Bench_DebounceState;
+    Port_Init(&config);
+    for (pin = 0U; pin < BENCH_PINS; pin++)
+    {
+        port = (pin < 32U) ? 0U : 1U;
+        Bench_RefState[pin] = (uint8)((Bench_DebounceState[port].State_u32 >> ((pin < 32U) ? pin : (pin - 16U))) & 1U);
+    }
+
+    Bench_Measure(Bench_PerPinTick, &perPin);
+    Bench_Measure(Port_DebounceMainFunction, &vertical);
+
+    /* Both ways saw the same inputs */
+    for (pin = 0U; pin < BENCH_PINS; pin++)
+    {
+        state = (pin < 32U) ? (Port_GetDebouncedState(0U) >> pin) : (Port_GetDebouncedState(1U) >> (pin - 16U));
+        if ((state & 1U) != (uint32)Bench_RefState[pin])
+        {
+            mismatches++;
+        }
+    }
+
+    (void)printf("%u switches on %u ports, %u ticks\n", (unsigned)BENCH_PINS, (unsigned)BENCH_PORTS, (unsigned)BENCH_TICKS);
+    Bench_Print("per-pin counters", &perPin);
+    Bench_Print("Port_DebounceMainFunction", &vertical);
+    (void)printf("  final debounced levels: %u mismatches\n", (unsigned)mismatches);
+
+    return (0U == mismatches) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,1179 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Port driver cycle benchmarks (on target)
+==================================================================================================*/
+
+/**
+*   @file    bench_port_hw.c
+*
+*   @brief   Port driver cycle benchmarks
+*   @details Measures core cycles with the Cortex-M4 DWT cycle counter. Results are stored in
+*            BenchResults[] and read with the debugger after Bench_Port_Hw_RunAll().
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include "S32K144.h"
+#include "Port.h"
+#include "Port_Hw_BitBang.h"
+#include "Port_Hw_Capture.h"
+#include "Port_Hw_Wave.h"
+#include "Port_Hw_Pwm.h"
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+#include "Port_Hw_Irq.h"
+#endif
+#include "bench_port_hw.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define BENCH_PORT_HW_VENDOR_ID_C                    43
+#define BENCH_PORT_HW_AR_RELEASE_MAJOR_VERSION_C     21
+#define BENCH_PORT_HW_AR_RELEASE_MINOR_VERSION_C     11
+#define BENCH_PORT_HW_AR_RELEASE_REVISION_VERSION_C  0
+#define BENCH_PORT_HW_SW_MAJOR_VERSION_C             1
+#define BENCH_PORT_HW_SW_MINOR_VERSION_C             0
+#define BENCH_PORT_HW_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Cortex-M4 debug registers used for cycle counting
+*/
+#define BENCH_DEMCR                     (*(volatile uint32*)0xE000EDFCUL)
+#define BENCH_DEMCR_TRCENA_MASK         (0x01000000UL)
+#define BENCH_DWT_CTRL                  (*(volatile uint32*)0xE0001000UL)
+#define BENCH_DWT_CTRL_CYCCNTENA_MASK   (0x00000001UL)
+#define BENCH_DWT_CYCCNT                (*(volatile uint32*)0xE0001004UL)
+
+/**
+* @brief Number of repetitions of every measured operation
+*/
+#define BENCH_ITERATIONS                (100U)
+
+/**
+* @brief Init steps per Port_InitMainFunction() call in the phased init benchmark
+*/
+#define BENCH_PHASED_INIT_BUDGET        (1U)
+
+/**
+* @brief Width of the parallel bus turned around in the pin group benchmark
+*/
+#define BENCH_BUS_WIDTH                 (8U)
+
+/**
+* @brief Pins of the peripheral switched in the mode profile benchmark (e.g. LPSPI SCK/SIN/SOUT/PCS)
+*/
+#define BENCH_PROFILE_PINS              (4U)
+
+/**
+* @brief Bytes per frame of the bit-bang benchmark
+*/
+#define BENCH_BITBANG_BYTES             (8U)
+
+/**
+* @brief Ring buffer entries of the capture benchmark
+*/
+#define BENCH_CAPTURE_RING_SIZE         (16U)
+
+/**
+* @brief Debounced switches of the debounce benchmark: all of PTA and PTE16-23
+*/
+#define BENCH_DEBOUNCE_PORTS            (2U)
+#define BENCH_DEBOUNCE_PINS             (40U)
+
+/**
+* @brief Pins toggled to raise flags in the interrupt dispatch benchmark (PTD24-27)
+*/
+#define BENCH_IRQ_PIN_MASK              ((uint32)0x0F000000U)
+
+/**
+* @brief Pattern pins (PTD0-7) and buffer half of the waveform benchmark
+*/
+#define BENCH_WAVE_PINS                 (8U)
+#define BENCH_WAVE_HALF                 (8U)
+
+/**
+* @brief Channels (PTD0-23) and period in ticks of the software PWM benchmark
+*/
+#define BENCH_PWM_CHANNELS              (24U)
+#define BENCH_PWM_PERIOD                (100U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Pin settings as carried by the configuration before it held PCR words
+*/
+typedef struct
+{
+    PortHw_PullConfigType PullConfig_en;
+    PortHw_DriveStrengthType DriveStrength_en;
+    PortHw_LockRegisterType LockRegister_en;
+    PortHw_MuxType Mux_en;
+} Bench_PinSettingsType;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+/**
+* @brief Settings of pin 0 of Port_Config_VS_0 (PTD0, GPIO, no pull, low drive, unlocked)
+*/
+static const Bench_PinSettingsType Bench_Pin0Settings =
+{
+    PORT_HW_PULL_NOT_ENABLED, PORT_HW_DRIVE_STRENGTH_LOW, PORT_HW_LOCK_DISABLED, PORT_HW_MUX_AS_GPIO
+};
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Benchmark results storage
+*/
+static BenchResult_Type BenchResults[BENCH_MAX_RECORDS];
+
+/**
+* @brief Number of recorded benchmarks
+*/
+static uint32 BenchCount = 0U;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void Bench_CycleCounterInit(void);
+static void Bench_Record(uint8 benchId, const char* benchName, uint32 items, uint32 cyclesRef, uint32 cyclesDut);
+static uint32 Bench_ComposePcr(const Bench_PinSettingsType* pCfg);
+static void Bench_RefSetPinDirection(const Port_ConfigType* pConfig, Port_PinType Pin, Port_PinDirectionType Direction);
+static void Bench_RefSetPinMode(const Port_ConfigType* pConfig, Port_PinType Pin, Port_PinModeType Mode);
+static void Bench_RefRefreshPortDirection(const Port_ConfigType* pConfig);
+
+/* Benchmark functions */
+static void Bench_PORT_HW_BM_001(void);    /* Precomputed PCR word vs runtime composition */
+#if (STD_ON == PORT_PHASED_INIT_API)
+static void Bench_PORT_HW_BM_002(void);    /* Full Port_Init vs phased init */
+#endif
+static void Bench_PORT_HW_BM_003(void);    /* Runtime services: configuration arrays vs pin handles */
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+static void Bench_PORT_HW_BM_004(void);    /* Single pin direction: locked read-modify-write vs bit-band */
+#endif
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+static void Bench_PORT_HW_BM_005(void);    /* 8-bit bus turnaround: per-pin loop vs pin group */
+#endif
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+static void Bench_PORT_HW_BM_006(void);    /* Periodic direction refresh: rewrite vs verify-only */
+#endif
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+static void Bench_PORT_HW_BM_007(void);    /* Peripheral pin set switch: per-pin mode vs mode profile */
+#endif
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+static void Bench_PORT_HW_BM_008(void);    /* Sleep entry/exit: full re-init vs profile switch delta */
+#endif
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+static void Bench_PORT_HW_BM_009(void);    /* Parallel bus access: pin by pin vs channel group */
+#endif
+static void Bench_PORT_HW_BM_010(void);    /* Bit-bang SPI bit: per-pin write/read loop vs engine at zero delay */
+static void Bench_PORT_HW_BM_011(void);    /* Input capture: raw timestamped samples vs run-length encoded ring */
+#if (STD_ON == PORT_DEBOUNCE_API)
+static void Bench_PORT_HW_BM_012(void);    /* Switch debounce tick: per-pin counters vs vertical counters */
+#endif
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+static void Bench_IrqNotification(void);
+static void Bench_PORT_HW_BM_013(void);    /* Port interrupt dispatch: 32-bit scan vs count-trailing-zeros */
+#endif
+static void Bench_PORT_HW_BM_014(void);    /* Waveform step: per-pin writes vs one buffer word */
+static void Bench_PORT_HW_BM_015(void);    /* PWM tick: per-channel compare vs sorted edge list */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Enable the DWT cycle counter
+*/
+static void Bench_CycleCounterInit(void)
+{
+    BENCH_DEMCR |= BENCH_DEMCR_TRCENA_MASK;
+    BENCH_DWT_CYCCNT = 0U;
+    BENCH_DWT_CTRL |= BENCH_DWT_CTRL_CYCCNTENA_MASK;
+}
+
+/**
+* @brief Store one benchmark record
+* @param benchId Benchmark ID
+* @param benchName Benchmark name
+* @param items Number of items measured
+* @param cyclesRef Reference cycles for all items
+* @param cyclesDut DUT cycles for all items
+*/
+static void Bench_Record(uint8 benchId, const char* benchName, uint32 items, uint32 cyclesRef, uint32 cyclesDut)
+{
+    uint8 i;
+    BenchResult_Type* pResult;
+
+    if ((BenchCount < BENCH_MAX_RECORDS) && (0U != items))
+    {
+        pResult = &BenchResults[BenchCount];
+        pResult->benchId = benchId;
+        for (i = 0U; (i < 31U) && (benchName[i] != '\0'); i++)
+        {
+            pResult->benchName[i] = benchName[i];
+        }
+        pResult->benchName[i] = '\0';
+        pResult->items = items;
+        pResult->cyclesRef = cyclesRef / items;
+        pResult->cyclesDut = cyclesDut / items;
+        pResult->nsRef = (pResult->cyclesRef * 1000U) / BENCH_CORE_CLOCK_MHZ;
+        pResult->nsDut = (pResult->cyclesDut * 1000U) / BENCH_CORE_CLOCK_MHZ;
+        BenchCount++;
+    }
+}
+
+/**
+* @brief Runtime PCR composition as done before the configuration carried PCR words
+* @param pCfg Pin configuration
+* @return PCR value
+*/
+static uint32 Bench_ComposePcr(const Bench_PinSettingsType* pCfg)
+{
+    uint32 pcr = 0U;
+
+    if (pCfg->PullConfig_en != PORT_HW_PULL_NOT_ENABLED)
+    {
+        pcr |= PORT_PCR_PE(1U);
+        pcr |= PORT_PCR_PS(pCfg->PullConfig_en);
+    }
+    pcr |= PORT_PCR_DSE(pCfg->DriveStrength_en);
+    pcr |= PORT_PCR_LK(pCfg->LockRegister_en);
+    pcr |= PORT_PCR_MUX(pCfg->Mux_en);
+
+    return pcr;
+}
+
+/**
+* @brief PORT_HW_BM_001 - PCR write of one pin during initialization
+* @details Reference composes the PCR from the pin settings, DUT copies the precomputed
+*          configuration word. Both write the PCR of the first configured pin, which is
+*          rewritten with its own value.
+*/
+static void Bench_PORT_HW_BM_001(void)
+{
+    const PortHw_PinTableType* pTable = Port_Config_VS_0.PinTable_ptr;
+    PORT_Type* pBase = PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(pTable->PadId_ptr[0])];
+    uint32 pin = PORT_HW_GET_PIN_U32(pTable->PadId_ptr[0]);
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        pBase->PCR[pin] = Bench_ComposePcr(&Bench_Pin0Settings);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        pBase->PCR[pin] = pTable->Pcr_ptr[0];
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+
+    Bench_Record(1U, "BM_001 PCR init per pin", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+
+/**
+* @brief Port_SetPinDirection as implemented before the pin handle table
+* @details Checks and data accesses of the former implementation, DET reporting left out.
+*/
+static void Bench_RefSetPinDirection(const Port_ConfigType* pConfig, Port_PinType Pin, Port_PinDirectionType Direction)
+{
+    if ((NULL_PTR != pConfig) && (Pin < pConfig->NumPins_u16) &&
+        (0U != (pConfig->PinTable_ptr->Flags_ptr[Pin] & PORT_PIN_FLAG_DIR_CHANGEABLE_U8)))
+    {
+        PortHw_SetPinDirection(PortHw_g_GpioBaseAddr_ptr[PORT_HW_GET_PORT_U32(pConfig->PinTable_ptr->PadId_ptr[Pin])],
+                               PORT_HW_GET_PIN_U32(pConfig->PinTable_ptr->PadId_ptr[Pin]),
+                               (PORT_PIN_OUT == Direction) ? PORT_HW_PIN_OUT : PORT_HW_PIN_IN);
+    }
+}
+
+/**
+* @brief Port_SetPinMode as implemented before the pin handle table
+*/
+static void Bench_RefSetPinMode(const Port_ConfigType* pConfig, Port_PinType Pin, Port_PinModeType Mode)
+{
+    if ((NULL_PTR != pConfig) && (Pin < pConfig->NumPins_u16) &&
+        (0U != (pConfig->PinTable_ptr->Flags_ptr[Pin] & PORT_PIN_FLAG_MODE_CHANGEABLE_U8)) && (Mode <= (Port_PinModeType)7U))
+    {
+        PortHw_SetMuxModeSel(PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(pConfig->PinTable_ptr->PadId_ptr[Pin])],
+                             PORT_HW_GET_PIN_U32(pConfig->PinTable_ptr->PadId_ptr[Pin]), (PortHw_MuxType)Mode);
+    }
+}
+
+/**
+* @brief Port_RefreshPortDirection as implemented before the pin handle table
+*/
+static void Bench_RefRefreshPortDirection(const Port_ConfigType* pConfig)
+{
+    uint16 pin;
+
+    for (pin = 0U; pin < pConfig->NumPins_u16; pin++)
+    {
+        if (0U == (pConfig->PinTable_ptr->Flags_ptr[pin] & PORT_PIN_FLAG_DIR_CHANGEABLE_U8))
+        {
+            PortHw_SetPinDirection(PortHw_g_GpioBaseAddr_ptr[PORT_HW_GET_PORT_U32(pConfig->PinTable_ptr->PadId_ptr[pin])],
+                                   PORT_HW_GET_PIN_U32(pConfig->PinTable_ptr->PadId_ptr[pin]),
+                                   (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(pConfig->PinTable_ptr->Flags_ptr[pin])) ? PORT_HW_PIN_OUT : PORT_HW_PIN_IN);
+        }
+    }
+}
+
+#if (STD_ON == PORT_PHASED_INIT_API)
+/**
+* @brief PORT_HW_BM_002 - Time to first pin and total time of the initialization
+* @details Reference is Port_Init(): the critical pins are final only when it returns, so
+*          its time to first pin is its total time. DUT is Port_InitCritical() followed by
+*          Port_InitMainFunction() calls until it returns TRUE. Three records: time to first
+*          pin, total init time (sum of all calls, idle time excluded) and longest slice.
+*/
+static void Bench_PORT_HW_BM_002(void)
+{
+    const Port_ConfigType* pConfig = &Port_Config_VS_0;
+    uint32 start;
+    uint32 cycles;
+    uint32 cyclesFull;
+    uint32 cyclesCritical;
+    uint32 cyclesPhased;
+    uint32 cyclesSliceMax = 0U;
+    boolean done = FALSE;
+
+    start = BENCH_DWT_CYCCNT;
+    Port_Init(pConfig);
+    cyclesFull = BENCH_DWT_CYCCNT - start;
+
+    start = BENCH_DWT_CYCCNT;
+    Port_InitCritical(pConfig);
+    cyclesCritical = BENCH_DWT_CYCCNT - start;
+
+    cyclesPhased = cyclesCritical;
+    while (FALSE == done)
+    {
+        start = BENCH_DWT_CYCCNT;
+        done = Port_InitMainFunction((uint16)BENCH_PHASED_INIT_BUDGET);
+        cycles = BENCH_DWT_CYCCNT - start;
+        cyclesPhased += cycles;
+        if (cycles > cyclesSliceMax)
+        {
+            cyclesSliceMax = cycles;
+        }
+    }
+
+    Bench_Record(2U, "BM_002 time to first pin", 1U, cyclesFull, cyclesCritical);
+    Bench_Record(2U, "BM_002 total init", 1U, cyclesFull, cyclesPhased);
+    Bench_Record(2U, "BM_002 longest init slice", 1U, cyclesFull, cyclesSliceMax);
+}
+#endif /* (STD_ON == PORT_PHASED_INIT_API) */
+
+/**
+* @brief PORT_HW_BM_003 - Runtime services through the pin handle table
+* @details Reference runs the former implementations on the configuration arrays, DUT the
+*          Port services on the RAM handles. Pin 0 of Port_Config_VS_0 keeps its configured
+*          direction and mode, so the pins do not change state.
+*/
+static void Bench_PORT_HW_BM_003(void)
+{
+    const Port_ConfigType* pConfig = &Port_Config_VS_0;
+    Port_PinDirectionType direction = (Port_PinDirectionType)PORT_HW_PIN_FLAG_DIR(pConfig->PinTable_ptr->Flags_ptr[0]);
+    Port_PinModeType mode = (Port_PinModeType)PORT_HW_PCR_MUX_U32(pConfig->PinTable_ptr->Pcr_ptr[0]);
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    Port_Init(pConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Bench_RefSetPinDirection(pConfig, 0U, direction);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_SetPinDirection(0U, direction);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(3U, "BM_003 Port_SetPinDirection", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Bench_RefSetPinMode(pConfig, 0U, mode);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_SetPinMode(0U, mode);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(3U, "BM_003 Port_SetPinMode", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Bench_RefRefreshPortDirection(pConfig);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_RefreshPortDirection();
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(3U, "BM_003 Port_RefreshPortDir", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+/**
+* @brief PORT_HW_BM_004 - Single pin direction change
+* @details Reference is the masked read-modify-write inside exclusive areas 09/10, DUT the
+*          bit-band alias stores of PortHw_SetPinDirection(). PTD bit 31 is not bonded out on
+*          the 100-pin package.
+*/
+static void Bench_PORT_HW_BM_004(void)
+{
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_SetPinsDirection(PTD, (1UL << 31U), PORT_HW_PIN_OUT);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_SetPinDirection(PTD, 31U, PORT_HW_PIN_OUT);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(4U, "BM_004 direction out", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_SetPinsDirection(PTD, (1UL << 31U), PORT_HW_PIN_IN);
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_SetPinDirection(PTD, 31U, PORT_HW_PIN_IN);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(4U, "BM_004 direction in", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/**
+* @brief PORT_HW_BM_005 - Direction change of an 8-bit parallel bus
+* @details Reference calls Port_SetPinDirection() once per bus line (pin 0 of Port_Config_VS_0
+*          with its configured direction, so the pin does not change state), DUT calls
+*          Port_SetPinGroupDirection() once for a group of eight lines on PTD24-31, which are
+*          not bonded out on the 100-pin package.
+*/
+static void Bench_PORT_HW_BM_005(void)
+{
+    static const PortHw_PinMaskType busMasks[1] =
+    {
+        { IP_PTD, (uint32)0xFF000000U }
+    };
+    static const Port_PinGroupConfigType busGroup[1] =
+    {
+        { busMasks, (uint8)1, (boolean)TRUE }
+    };
+    static Port_ConfigType busConfig;
+    Port_PinDirectionType direction = (Port_PinDirectionType)PORT_HW_PIN_FLAG_DIR(Port_Config_VS_0.PinTable_ptr->Flags_ptr[0]);
+    uint32 i;
+    uint32 line;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    busConfig = Port_Config_VS_0;
+    busConfig.NumPinGroups_u16 = 1U;
+    busConfig.PinGroupConfig_ptr = busGroup;
+    Port_Init(&busConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        for (line = 0U; line < BENCH_BUS_WIDTH; line++)
+        {
+            Port_SetPinDirection(0U, direction);
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_SetPinGroupDirection(0U, direction);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(5U, "BM_005 8-bit bus turnaround", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    Port_Init(&Port_Config_VS_0);
+}
+#endif /* (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API) */
+
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+/**
+* @brief PORT_HW_BM_006 - Periodic direction refresh
+* @details Reference rewrites the direction masks with Port_RefreshPortDirection(), DUT only
+*          reads them with Port_VerifyPortDirection() (directions are as configured).
+*/
+static void Bench_PORT_HW_BM_006(void)
+{
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    Port_Init(&Port_Config_VS_0);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_RefreshPortDirection();
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        (void)Port_VerifyPortDirection();
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(6U, "BM_006 Port_VerifyPortDir", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+#endif /* (STD_ON == PORT_VERIFY_PORT_DIRECTION_API) */
+
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/**
+* @brief PORT_HW_BM_007 - Mode switch of a peripheral pin set
+* @details Reference calls Port_SetPinMode() once per peripheral pin (pin 0 of Port_Config_VS_0
+*          with its configured mode, so the pin does not change state), DUT calls
+*          Port_ApplyModeProfile() once for a profile of four pins on PTD24-27, which are not
+*          bonded out on the 100-pin package (one GPCHR write).
+*/
+static void Bench_PORT_HW_BM_007(void)
+{
+    static const PortHw_GlobalPinControlType profileControls[1] =
+    {
+        { IP_PORTD, (uint16)0x0F00U, (uint16)0x0100U, PORT_HW_GLOBAL_UPPER_HALF }
+    };
+    static const Port_ModeProfileConfigType profile[1] =
+    {
+        { profileControls, (uint8)1 }
+    };
+    static Port_ConfigType profileConfig;
+    uint32 i;
+    uint32 pin;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    profileConfig = Port_Config_VS_0;
+    profileConfig.NumModeProfiles_u16 = 1U;
+    profileConfig.ModeProfileConfig_ptr = profile;
+    Port_Init(&profileConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        for (pin = 0U; pin < BENCH_PROFILE_PINS; pin++)
+        {
+            Port_SetPinMode(0U, PORT_GPIO_MODE);
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_ApplyModeProfile(0U);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(7U, "BM_007 4-pin mode switch", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    Port_Init(&Port_Config_VS_0);
+}
+#endif /* (STD_ON == PORT_APPLY_MODE_PROFILE_API) */
+
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief PORT_HW_BM_008 - Pin parking around a low-power mode
+* @details Reference re-initializes all pins with PortHw_Init() for the sleep profile of
+*          Port_Config_VS_0 and with Port_Init() for the run profile. DUT calls
+*          Port_SwitchProfile() with the generated run/sleep deltas. Two records: sleep entry
+*          and sleep exit.
+*/
+static void Bench_PORT_HW_BM_008(void)
+{
+    const Port_ConfigType* pConfig = &Port_Config_VS_0;
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRefEntry = 0U;
+    uint32 cyclesRefExit = 0U;
+    uint32 cyclesDutEntry = 0U;
+    uint32 cyclesDutExit = 0U;
+
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        start = BENCH_DWT_CYCCNT;
+        PortHw_Init(pConfig->NumPins_u16, &PortHw_g_PinSleepTable_VS_0, pConfig->NumUnusedPins_u16,
+                    pConfig->UnusedPadMask_ptr, &PortHw_g_UnusedPinSleepConfig_VS_0);
+        cyclesRefEntry += BENCH_DWT_CYCCNT - start;
+        start = BENCH_DWT_CYCCNT;
+        Port_Init(pConfig);
+        cyclesRefExit += BENCH_DWT_CYCCNT - start;
+    }
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        start = BENCH_DWT_CYCCNT;
+        Port_SwitchProfile(PortConfigSet_PortProfile_Run, PortConfigSet_PortProfile_Sleep);
+        cyclesDutEntry += BENCH_DWT_CYCCNT - start;
+        start = BENCH_DWT_CYCCNT;
+        Port_SwitchProfile(PortConfigSet_PortProfile_Sleep, PortConfigSet_PortProfile_Run);
+        cyclesDutExit += BENCH_DWT_CYCCNT - start;
+    }
+    Bench_Record(8U, "BM_008 sleep entry", BENCH_ITERATIONS, cyclesRefEntry, cyclesDutEntry);
+    Bench_Record(8U, "BM_008 sleep exit", BENCH_ITERATIONS, cyclesRefExit, cyclesDutExit);
+}
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/**
+* @brief PORT_HW_BM_009 - Parallel bus access
+* @details Reference reads an 8-bit bus on PTD0-7 with one PortHw_ReadPin() per bit and
+*          writes a 4-bit bus on PTD24-27 (not bonded out on the 100-pin package) with one
+*          PortHw_WritePin() per bit. DUT uses Port_ReadChannelGroup() and
+*          Port_WriteChannelGroup() on the same pins.
+*/
+static void Bench_PORT_HW_BM_009(void)
+{
+    static const PortHw_ChannelGroupType busGroups[2] =
+    {
+        { IP_PTD, (uint32)0x000000FFU, (uint8)0U },
+        { IP_PTD, (uint32)0x0F000000U, (uint8)24U }
+    };
+    static Port_ConfigType busConfig;
+    volatile uint32 level = 0U;
+    uint32 i;
+    uint32 pin;
+    uint32 value;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    busConfig = Port_Config_VS_0;
+    busConfig.NumChannelGroups_u16 = 2U;
+    busConfig.ChannelGroupConfig_ptr = busGroups;
+    Port_Init(&busConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        value = 0U;
+        for (pin = 0U; pin < 8U; pin++)
+        {
+            value |= (uint32)PortHw_ReadPin(IP_PTD, pin) << pin;
+        }
+        level = value;
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        level = Port_ReadChannelGroup(0U);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(9U, "BM_009 8-bit bus read", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        for (pin = 0U; pin < 4U; pin++)
+        {
+            PortHw_WritePin(IP_PTD, 24U + pin, (uint8)((i >> pin) & 1U));
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_WriteChannelGroup(1U, i);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(9U, "BM_009 4-bit bus write", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    (void)level;
+    Port_Init(&Port_Config_VS_0);
+}
+#endif /* (STD_ON == PORT_CHANNEL_GROUP_API) */
+
+/**
+* @brief PORT_HW_BM_010 - Maximum bit rate of the bit-bang engine
+* @details SPI mode 0 frame of BENCH_BITBANG_BYTES bytes on PTD24-27 (SCK, MOSI, MISO, CS)
+*          with an all-zero timing table, so every wait returns at once and the figure is the
+*          engine overhead per bit: the maximum SPI bit rate is BENCH_CORE_CLOCK_MHZ / cyclesDut.
+*          Reference is the usual hand-written loop with PortHw_WritePin()/PortHw_ReadPin() per
+*          edge. The second record is the I2C master at zero delay per clock, START and STOP
+*          included; it has no reference (reference = DUT).
+*/
+static void Bench_PORT_HW_BM_010(void)
+{
+    static const PortHw_BitBangSpiTimingType spiTiming = { 0U, 0U, 0U, 0U };
+    static const PortHw_BitBangI2cTimingType i2cTiming = { 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+    static const uint8 txData[BENCH_BITBANG_BYTES] = { 0x55U, 0xAAU, 0x0FU, 0xF0U, 0x33U, 0xCCU, 0x01U, 0x80U };
+    PortHw_BitBangSpiConfigType spiConfig;
+    PortHw_BitBangI2cConfigType i2cConfig;
+    uint8 rxData[BENCH_BITBANG_BYTES];
+    uint32 i;
+    uint32 bit;
+    uint8 value;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    spiConfig.Sck_st.GpioBase_ptr = IP_PTD;
+    spiConfig.Sck_st.PinMask_u32 = (uint32)1U << 24U;
+    spiConfig.Mosi_st.GpioBase_ptr = IP_PTD;
+    spiConfig.Mosi_st.PinMask_u32 = (uint32)1U << 25U;
+    spiConfig.Miso_st.GpioBase_ptr = IP_PTD;
+    spiConfig.Miso_st.PinMask_u32 = (uint32)1U << 26U;
+    spiConfig.Cs_st.GpioBase_ptr = IP_PTD;
+    spiConfig.Cs_st.PinMask_u32 = (uint32)1U << 27U;
+    spiConfig.Mode_en = PORT_HW_BITBANG_SPI_MODE_0;
+    spiConfig.Timing_ptr = &spiTiming;
+    PortHw_SetPinsDirection(IP_PTD, (uint32)0x0B000000U, PORT_HW_PIN_OUT);
+    PortHw_BitBangInit();
+    PortHw_BitBangSpiInit(&spiConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    PortHw_WritePin(IP_PTD, 27U, 0U);
+    for (i = 0U; i < BENCH_BITBANG_BYTES; i++)
+    {
+        value = 0U;
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            PortHw_WritePin(IP_PTD, 25U, (uint8)((txData[i] >> (7U - bit)) & 1U));
+            PortHw_WritePin(IP_PTD, 24U, 1U);
+            value = (uint8)((value << 1U) | PortHw_ReadPin(IP_PTD, 26U));
+            PortHw_WritePin(IP_PTD, 24U, 0U);
+        }
+        rxData[i] = value;
+    }
+    PortHw_WritePin(IP_PTD, 27U, 1U);
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    PortHw_BitBangSpiTransfer(&spiConfig, txData, rxData, BENCH_BITBANG_BYTES);
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(10U, "BM_010 SPI bit, zero delay", 8U * BENCH_BITBANG_BYTES, cyclesRef, cyclesDut);
+
+    i2cConfig.Scl_st.GpioBase_ptr = IP_PTD;
+    i2cConfig.Scl_st.PinMask_u32 = (uint32)1U << 24U;
+    i2cConfig.Scl_st.Pin_u8 = 24U;
+    i2cConfig.Sda_st.GpioBase_ptr = IP_PTD;
+    i2cConfig.Sda_st.PinMask_u32 = (uint32)1U << 25U;
+    i2cConfig.Sda_st.Pin_u8 = 25U;
+    i2cConfig.Timing_ptr = &i2cTiming;
+    PortHw_BitBangI2cInit(&i2cConfig);
+
+    /* No slave on the unbonded pins: the address is not acknowledged, time the address byte */
+    start = BENCH_DWT_CYCCNT;
+    (void)PortHw_BitBangI2cTransfer(&i2cConfig, 0x50U, txData, BENCH_BITBANG_BYTES, NULL_PTR, 0U);
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(10U, "BM_010 I2C address frame", 9U, cyclesDut, cyclesDut);
+
+    (void)rxData;
+    Port_Init(&Port_Config_VS_0);
+}
+
+/**
+* @brief PORT_HW_BM_011 - Input capture sample rate
+* @details Reference stores every sample of PTD0-7 raw with its DWT cycle counter timestamp;
+*          DUT is PortHw_CaptureRun() on the same pins (steady input, so one run). cyclesDut is
+*          the time per sample: the maximum capture rate is BENCH_CORE_CLOCK_MHZ / cyclesDut
+*          Msample/s.
+*/
+static void Bench_PORT_HW_BM_011(void)
+{
+    static const PortHw_PinMaskType capturePorts[1] = { { IP_PTD, (uint32)0x000000FFU } };
+    static PortHw_CaptureEntryType captureRing[BENCH_CAPTURE_RING_SIZE];
+    static volatile uint32 rawSamples[BENCH_ITERATIONS][2];
+    PortHw_CaptureConfigType captureConfig;
+    uint32 i;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    captureConfig.Ports_ptr = capturePorts;
+    captureConfig.NumPorts_u8 = 1U;
+    captureConfig.Buffer_ptr = captureRing;
+    captureConfig.Size_u32 = BENCH_CAPTURE_RING_SIZE;
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        rawSamples[i][0] = PORT_HW_CAPTURE_GET_COUNTER();
+        rawSamples[i][1] = PORT_HW_REG_READ32(&IP_PTD->PDIR) & (uint32)0x000000FFU;
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    PortHw_CaptureStart(&captureConfig);
+    start = BENCH_DWT_CYCCNT;
+    PortHw_CaptureRun(BENCH_ITERATIONS);
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    PortHw_CaptureStop();
+    Bench_Record(11U, "BM_011 capture sample", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    (void)rawSamples;
+}
+
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief PORT_HW_BM_012 - Switch debounce tick
+* @details Reference debounces 40 switches (PTA0-31, PTE16-23) with one PortHw_ReadPin() and one
+*          counter per pin, as a per-switch 1 ms task does. DUT is Port_DebounceMainFunction() on
+*          the same pins: one PDIR read and vertical counters per port. Items are debounce
+*          ticks.
+*/
+static void Bench_PORT_HW_BM_012(void)
+{
+    static const PortHw_PinMaskType debouncePorts[BENCH_DEBOUNCE_PORTS] =
+    {
+        { IP_PTA, (uint32)0xFFFFFFFFU },
+        { IP_PTE, (uint32)0x00FF0000U }
+    };
+    static GPIO_Type* const refBase[BENCH_DEBOUNCE_PINS / 8U] = { IP_PTA, IP_PTA, IP_PTA, IP_PTA, IP_PTE };
+    static const uint8 refFirstPin[BENCH_DEBOUNCE_PINS / 8U] = { 0U, 8U, 16U, 24U, 16U };
+    static PortHw_DebounceStateType debounceState[BENCH_DEBOUNCE_PORTS];
+    static Port_ConfigType debounceConfig;
+    static uint8 refCount[BENCH_DEBOUNCE_PINS];
+    static volatile uint8 refState[BENCH_DEBOUNCE_PINS];
+    uint32 i;
+    uint32 pin;
+    uint8 level;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    debounceConfig = Port_Config_VS_0;
+    debounceConfig.NumDebouncePorts_u16 = (uint16)BENCH_DEBOUNCE_PORTS;
+    debounceConfig.DebounceConfig_ptr = debouncePorts;
+    debounceConfig.DebounceState_ptr = debounceState;
+    Port_Init(&debounceConfig);
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        for (pin = 0U; pin < BENCH_DEBOUNCE_PINS; pin++)
+        {
+            level = PortHw_ReadPin(refBase[pin / 8U], (uint32)refFirstPin[pin / 8U] + (pin % 8U));
+            if (level != refState[pin])
+            {
+                refCount[pin]++;
+                if (PORT_HW_DEBOUNCE_TICKS_U8 == refCount[pin])
+                {
+                    refState[pin] = level;
+                    refCount[pin] = 0U;
+                }
+            }
+            else
+            {
+                refCount[pin] = 0U;
+            }
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Port_DebounceMainFunction();
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(12U, "BM_012 40-switch debounce tick", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    Port_Init(&Port_Config_VS_0);
+}
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+/**
+* @brief Notification of the interrupt dispatch benchmark
+*/
+static volatile uint32 Bench_IrqNotifications = 0U;
+
+static void Bench_IrqNotification(void)
+{
+    Bench_IrqNotifications++;
+}
+
+/**
+* @brief PORT_HW_BM_013 - Port interrupt dispatch
+* @details PTD24-27 are driven as outputs with either-edge interrupts; every iteration toggles
+*          them through PTOR, which latches four ISFR flags, and dispatches them without the
+*          NVIC. Reference tests the 32 ISFR bits one by one and clears every flag with its
+*          own write; DUT is PortHw_PortIrqHandler(): one ISFR read, one write and one
+*          count-trailing-zeros step per flag. Items are dispatched interrupts, PTOR write
+*          included in both.
+*/
+static void Bench_PORT_HW_BM_013(void)
+{
+    static PortHw_PinNotificationType refNotification[32];
+    uint32 i;
+    uint32 pin;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    PortHw_SetPinsDirection(IP_PTD, BENCH_IRQ_PIN_MASK, PORT_HW_PIN_OUT);
+    for (pin = 24U; pin < 28U; pin++)
+    {
+        refNotification[pin] = Bench_IrqNotification;
+        PortHw_EnablePinInterrupt(3U, (uint8)pin, PORT_HW_INT_EITHER_EDGE, Bench_IrqNotification);
+    }
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        IP_PTD->PTOR = BENCH_IRQ_PIN_MASK;
+        for (pin = 0U; pin < 32U; pin++)
+        {
+            if (0U != (IP_PORTD->ISFR & ((uint32)1U << pin)))
+            {
+                IP_PORTD->ISFR = (uint32)1U << pin;
+                if (NULL_PTR != refNotification[pin])
+                {
+                    refNotification[pin]();
+                }
+            }
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        IP_PTD->PTOR = BENCH_IRQ_PIN_MASK;
+        PortHw_PortIrqHandler(3U);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    Bench_Record(13U, "BM_013 4-flag PORTD dispatch", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+
+    for (pin = 24U; pin < 28U; pin++)
+    {
+        PortHw_DisablePinInterrupt(3U, (uint8)pin);
+    }
+    Port_Init(&Port_Config_VS_0);
+}
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) */
+
+/**
+* @brief PORT_HW_BM_014 - Waveform step
+* @details One step of an 8-pin pattern on PTD0-7 (stepper phases, LED matrix row), as done
+*          from a timer interrupt. Reference writes the 8 pins with PortHw_WritePin(); DUT is
+*          PortHw_WaveTick() of a CPU backend stream on PDOR: one register write per step.
+*          With the DMA backend a step costs no core cycle, only the half interrupt every
+*          BENCH_WAVE_HALF steps.
+*/
+static void Bench_PORT_HW_BM_014(void)
+{
+    static const uint8 halfStep[8] = { 0x1U, 0x3U, 0x2U, 0x6U, 0x4U, 0xCU, 0x8U, 0x9U };
+    static uint32 waveBuffer[2U * BENCH_WAVE_HALF];
+    PortHw_WaveConfigType waveConfig;
+    uint32 i;
+    uint32 pin;
+    uint32 word;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    for (i = 0U; i < (2U * BENCH_WAVE_HALF); i++)
+    {
+        /* Half-step sequence of a unipolar stepper on PTD0-3, walking LED on PTD4-7 */
+        waveBuffer[i] = (uint32)halfStep[i & 7U] | ((uint32)0x10U << (i & 3U));
+    }
+    waveConfig.GpioBase_ptr = IP_PTD;
+    waveConfig.Target_en = PORT_HW_WAVE_TARGET_PDOR;
+    waveConfig.Buffer_ptr = waveBuffer;
+    waveConfig.HalfLength_u16 = (uint16)BENCH_WAVE_HALF;
+    waveConfig.Backend_en = PORT_HW_WAVE_BACKEND_CPU;
+    waveConfig.DmaChannel_u8 = 0U;
+    waveConfig.Loop_boo = TRUE;
+    waveConfig.Notification = NULL_PTR;
+
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        word = waveBuffer[i % (2U * BENCH_WAVE_HALF)];
+        for (pin = 0U; pin < BENCH_WAVE_PINS; pin++)
+        {
+            PortHw_WritePin(IP_PTD, pin, (uint8)((word >> pin) & 1U));
+        }
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    PortHw_WaveStart(0U, &waveConfig);
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_WaveTick(0U);
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    PortHw_WaveStop(0U);
+    Bench_Record(14U, "BM_014 8-pin waveform step", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+
+/**
+* @brief PORT_HW_BM_015 - Software PWM tick
+* @details 24 PWM channels on PTD0-23 with 6 distinct duties, one tick per iteration.
+*          Reference compares the tick counter with the duty of every channel and writes
+*          every pin with PortHw_WritePin(); DUT is PortHw_PwmTick(): a counter increment on
+*          most ticks, one PSOR write at the period start and one PCOR write per distinct duty.
+*/
+static void Bench_PORT_HW_BM_015(void)
+{
+    static PortHw_PwmChannelConfigType pwmChannels[BENCH_PWM_CHANNELS];
+    static GPIO_Type* const pwmPorts[1] = { IP_PTD };
+    static PortHw_PwmConfigType pwmConfig;
+    uint16 duty[BENCH_PWM_CHANNELS];
+    uint32 i;
+    uint32 channel;
+    uint32 tick;
+    uint32 start;
+    uint32 cyclesRef;
+    uint32 cyclesDut;
+
+    for (channel = 0U; channel < BENCH_PWM_CHANNELS; channel++)
+    {
+        pwmChannels[channel].Port_u8 = 0U;
+        pwmChannels[channel].Pin_u8 = (uint8)channel;
+        duty[channel] = (uint16)(10U + ((channel % 6U) * 15U));
+    }
+    pwmConfig.Ports_ptr = pwmPorts;
+    pwmConfig.NumPorts_u8 = 1U;
+    pwmConfig.Channels_ptr = pwmChannels;
+    pwmConfig.NumChannels_u8 = (uint8)BENCH_PWM_CHANNELS;
+    pwmConfig.Period_u16 = (uint16)BENCH_PWM_PERIOD;
+
+    tick = 0U;
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        for (channel = 0U; channel < BENCH_PWM_CHANNELS; channel++)
+        {
+            PortHw_WritePin(IP_PTD, channel, (uint8)((tick < duty[channel]) ? 1U : 0U));
+        }
+        tick = (tick + 1U) % BENCH_PWM_PERIOD;
+    }
+    cyclesRef = BENCH_DWT_CYCCNT - start;
+    PortHw_PwmStart(&pwmConfig);
+    for (channel = 0U; channel < BENCH_PWM_CHANNELS; channel++)
+    {
+        PortHw_PwmSetDuty((uint8)channel, duty[channel]);
+    }
+    PortHw_PwmUpdate();
+    start = BENCH_DWT_CYCCNT;
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        PortHw_PwmTick();
+    }
+    cyclesDut = BENCH_DWT_CYCCNT - start;
+    PortHw_PwmStop();
+    Bench_Record(15U, "BM_015 24-channel PWM tick", BENCH_ITERATIONS, cyclesRef, cyclesDut);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Run all Port driver benchmarks
+*/
+void Bench_Port_Hw_RunAll(void)
+{
+    BenchCount = 0U;
+    Bench_CycleCounterInit();
+
+    Bench_PORT_HW_BM_001();
+#if (STD_ON == PORT_PHASED_INIT_API)
+    Bench_PORT_HW_BM_002();
+#endif
+    Bench_PORT_HW_BM_003();
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+    Bench_PORT_HW_BM_004();
+#endif
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+    Bench_PORT_HW_BM_005();
+#endif
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+    Bench_PORT_HW_BM_006();
+#endif
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+    Bench_PORT_HW_BM_007();
+#endif
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+    Bench_PORT_HW_BM_008();
+#endif
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+    Bench_PORT_HW_BM_009();
+#endif
+    Bench_PORT_HW_BM_010();
+    Bench_PORT_HW_BM_011();
+#if (STD_ON == PORT_DEBOUNCE_API)
+    Bench_PORT_HW_BM_012();
+#endif
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+    Bench_PORT_HW_BM_013();
+#endif
+    Bench_PORT_HW_BM_014();
+    Bench_PORT_HW_BM_015();
+}
+
+/**
+* @brief Get benchmark results
+*/
+const BenchResult_Type* Bench_Port_Hw_GetResults(uint32* pCount)
+{
+    *pCount = BenchCount;
+
+    return BenchResults;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
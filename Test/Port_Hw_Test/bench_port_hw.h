@@ -0,0 +1,108 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Header file for Port driver cycle benchmarks
+==================================================================================================*/
+
+#ifndef BENCH_PORT_HW_H
+#define BENCH_PORT_HW_H
+
+/**
+*   @file    bench_port_hw.h
+*
+*   @brief   Header for Port driver cycle benchmarks
+*   @details Benchmarks run on target and measure core cycles with the DWT cycle counter.
+*            Each benchmark records a reference and a DUT (device under test) figure so the
+*            results can be read from the debugger.
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define BENCH_PORT_HW_VENDOR_ID_H                    43
+#define BENCH_PORT_HW_AR_RELEASE_MAJOR_VERSION_H     21
+#define BENCH_PORT_HW_AR_RELEASE_MINOR_VERSION_H     11
+#define BENCH_PORT_HW_AR_RELEASE_REVISION_VERSION_H  0
+#define BENCH_PORT_HW_SW_MAJOR_VERSION_H             1
+#define BENCH_PORT_HW_SW_MINOR_VERSION_H             0
+#define BENCH_PORT_HW_SW_PATCH_VERSION_H             0
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Maximum number of benchmark records
+*/
+#define BENCH_MAX_RECORDS               (24U)
+
+/**
+* @brief Core clock used to convert cycles to time (S32K144 RUN mode, 80 MHz)
+*/
+#define BENCH_CORE_CLOCK_MHZ            (80U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Benchmark result structure
+* @details Cycle figures are per item (pin, call, ...). Times are derived for
+*          BENCH_CORE_CLOCK_MHZ, cycle counts do not depend on the clock the test runs at.
+*/
+typedef struct
+{
+    uint8   benchId;            /**< @brief Benchmark ID */
+    char    benchName[32];      /**< @brief Benchmark name */
+    uint32  items;              /**< @brief Number of items measured */
+    uint32  cyclesRef;          /**< @brief Reference implementation, cycles per item */
+    uint32  cyclesDut;          /**< @brief Implementation under test, cycles per item */
+    uint32  nsRef;              /**< @brief Reference implementation, ns per item at 80 MHz */
+    uint32  nsDut;              /**< @brief Implementation under test, ns per item at 80 MHz */
+} BenchResult_Type;
+
+/*==================================================================================================
+*                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief Run all Port driver benchmarks
+* @pre   Port_Init() has been called (benchmarks run on the configured pins)
+*/
+void Bench_Port_Hw_RunAll(void);
+
+/**
+* @brief Get benchmark results
+* @param[out] pCount Number of valid records
+* @return Pointer to benchmark results array
+*/
+const BenchResult_Type* Bench_Port_Hw_GetResults(uint32* pCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* BENCH_PORT_HW_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
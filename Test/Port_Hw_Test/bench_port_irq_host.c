@@ -0,0 +1,289 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host benchmark of the Port pin interrupt dispatch
+==================================================================================================*/
+
+/**
+*   @file    bench_port_irq_host.c
+*
+*   @brief   Host benchmark of the Port pin interrupt dispatch
+*   @details Dispatches PORTC interrupts with 1, 2, 4, 8, 16 and 32 pending flags, first with a
+*            naive handler that tests the 32 ISFR bits one by one and clears every flag with its
+*            own write, then with PortHw_PortIrqHandler(), which reads and clears ISFR once and
+*            steps from flag to flag with count-trailing-zeros. Prints the register accesses per
+*            interrupt (counted by the simulated register file) and the time per interrupt, and
+*            checks that both handlers called the same notifications. The time is host time
+*            through the simulator, only the ratio is meaningful; target cycles are measured by
+*            PORT_HW_BM_013 of bench_port_hw.c. _POSIX_C_SOURCE is given on the command line
+*            because Port_Hw_Sim.h is force-included before this file.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -include Port_Hw_Sim.h -IBSW/MCAL/Stub/Det -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/bench_port_irq_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                BSW/MCAL/Config/Port/Port_Hw_VS_0_PBcfg.c BSW/MCAL/Config/Port/Port_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Cfg.c BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*                Board/Driver/HW_Port/Port_Hw_Irq.c BSW/MCAL/Driver/Port/Port.c BSW/MCAL/Stub/Det/Det.c -o bench_port_irq_host
+*            ./bench_port_irq_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <time.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw.h"
+#include "Port_Hw_Irq.h"
+
+#if (STD_ON != PORT_HW_IRQ_HANDLERS)
+    #error "bench_port_irq_host.c needs PORT_HW_IRQ_HANDLERS"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Interrupts per measurement
+*/
+#define BENCH_IRQS                      (200000U)
+
+/**
+* @brief Flag patterns, replayed cyclically (power of two)
+*/
+#define BENCH_PATTERNS                  (256U)
+
+/**
+* @brief Dispatched port (PTC) and its simulated index
+*/
+#define BENCH_PORT                      (2U)
+
+/**
+* @brief Measured numbers of pending flags
+*/
+#define BENCH_LOADS                     (6U)
+
+/*==================================================================================================
+*                                   LOCAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Cost of one handler
+*/
+typedef struct
+{
+    uint32 Reads_u32;           /**< @brief Register reads of one interrupt */
+    uint32 Writes_u32;          /**< @brief Register writes of one interrupt */
+    double Seconds;             /**< @brief Time of BENCH_IRQS interrupts */
+} Bench_CostType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Notifications of the naive handler, indexed by pin
+*/
+static PortHw_PinNotificationType Bench_NaiveNotification[32];
+
+/**
+* @brief Random flag patterns with a fixed number of set bits
+*/
+static uint32 Bench_Pattern[BENCH_PATTERNS];
+
+/**
+* @brief Sum of the notified pin numbers, to compare both handlers
+*/
+static volatile uint32 Bench_Checksum;
+
+#define BENCH_NOTIFICATION(n) \
+    static void Bench_Notification##n(void) \
+    { \
+        Bench_Checksum += (uint32)(n) + 1U; \
+    }
+
+BENCH_NOTIFICATION(0)  BENCH_NOTIFICATION(1)  BENCH_NOTIFICATION(2)  BENCH_NOTIFICATION(3)
+BENCH_NOTIFICATION(4)  BENCH_NOTIFICATION(5)  BENCH_NOTIFICATION(6)  BENCH_NOTIFICATION(7)
+BENCH_NOTIFICATION(8)  BENCH_NOTIFICATION(9)  BENCH_NOTIFICATION(10) BENCH_NOTIFICATION(11)
+BENCH_NOTIFICATION(12) BENCH_NOTIFICATION(13) BENCH_NOTIFICATION(14) BENCH_NOTIFICATION(15)
+BENCH_NOTIFICATION(16) BENCH_NOTIFICATION(17) BENCH_NOTIFICATION(18) BENCH_NOTIFICATION(19)
+BENCH_NOTIFICATION(20) BENCH_NOTIFICATION(21) BENCH_NOTIFICATION(22) BENCH_NOTIFICATION(23)
+BENCH_NOTIFICATION(24) BENCH_NOTIFICATION(25) BENCH_NOTIFICATION(26) BENCH_NOTIFICATION(27)
+BENCH_NOTIFICATION(28) BENCH_NOTIFICATION(29) BENCH_NOTIFICATION(30) BENCH_NOTIFICATION(31)
+
+static const PortHw_PinNotificationType Bench_Notification[32] =
+{
+    Bench_Notification0,  Bench_Notification1,  Bench_Notification2,  Bench_Notification3,
+    Bench_Notification4,  Bench_Notification5,  Bench_Notification6,  Bench_Notification7,
+    Bench_Notification8,  Bench_Notification9,  Bench_Notification10, Bench_Notification11,
+    Bench_Notification12, Bench_Notification13, Bench_Notification14, Bench_Notification15,
+    Bench_Notification16, Bench_Notification17, Bench_Notification18, Bench_Notification19,
+    Bench_Notification20, Bench_Notification21, Bench_Notification22, Bench_Notification23,
+    Bench_Notification24, Bench_Notification25, Bench_Notification26, Bench_Notification27,
+    Bench_Notification28, Bench_Notification29, Bench_Notification30, Bench_Notification31
+};
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Fills the flag patterns with Flags_u32 random distinct pins each
+*/
+static void Bench_BuildPatterns(uint32 Flags_u32)
+{
+    static uint32 seed = 0x2545F491U;
+    uint32 i;
+    uint32 bits;
+
+    for (i = 0U; i < BENCH_PATTERNS; i++)
+    {
+        Bench_Pattern[i] = 0U;
+        bits = 0U;
+        while (bits < Flags_u32)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            if (0U == (Bench_Pattern[i] & (1UL << (seed & 31U))))
+            {
+                Bench_Pattern[i] |= 1UL << (seed & 31U);
+                bits++;
+            }
+        }
+    }
+}
+
+/**
+* @brief Naive handler: tests every ISFR bit and clears each flag with its own write
+*/
+static void Bench_NaiveIrqHandler(void)
+{
+    PORT_Type* const pPort = IP_PORTC;
+    uint32 pin;
+
+    for (pin = 0U; pin < 32U; pin++)
+    {
+        if (0U != (PORT_HW_REG_READ32(&pPort->ISFR) & (1UL << pin)))
+        {
+            PORT_HW_REG_WRITE32(&pPort->ISFR, 1UL << pin);
+            if (NULL_PTR != Bench_NaiveNotification[pin])
+            {
+                Bench_NaiveNotification[pin]();
+            }
+        }
+    }
+}
+
+/**
+* @brief Dispatch of the driver
+*/
+static void Bench_DriverIrqHandler(void)
+{
+    PortHw_PortIrqHandler(BENCH_PORT);
+}
+
+/**
+* @brief Counts the accesses of one interrupt, then times BENCH_IRQS interrupts
+*/
+static void Bench_Measure(void (*Handler)(void), Bench_CostType* pCost)
+{
+    struct timespec start;
+    struct timespec stop;
+    uint32 i;
+
+    PortHwSim_SetInterruptFlags(BENCH_PORT, Bench_Pattern[0]);
+    PortHwSim_ClearCounters();
+    Handler();
+    pCost->Reads_u32 = PortHwSim_g_ReadCount_u32;
+    pCost->Writes_u32 = PortHwSim_g_WriteCount_u32;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 1U; i < BENCH_IRQS; i++)
+    {
+        PortHwSim_SetInterruptFlags(BENCH_PORT, Bench_Pattern[i & (BENCH_PATTERNS - 1U)]);
+        Handler();
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    pCost->Seconds = ((double)(stop.tv_sec - start.tv_sec)) + (((double)(stop.tv_nsec - start.tv_nsec)) * 1e-9);
+}
+
+/**
+* @brief Prints one handler
+*/
+static void Bench_Print(const char* pName, const Bench_CostType* pCost)
+{
+    (void)printf("    %-22s: %2u reads, %2u writes, %8.1f ns per interrupt\n",
+                 pName, (unsigned)pCost->Reads_u32, (unsigned)pCost->Writes_u32,
+                 (pCost->Seconds * 1e9) / (double)BENCH_IRQS);
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    static const uint32 load[BENCH_LOADS] = { 1U, 2U, 4U, 8U, 16U, 32U };
+    Bench_CostType naive;
+    Bench_CostType driver;
+    uint32 naiveSum;
+    uint32 pin;
+    uint32 i;
+    uint32 mismatches = 0U;
+
+    PortHwSim_Reset();
+    for (pin = 0U; pin < 32U; pin++)
+    {
+        Bench_NaiveNotification[pin] = Bench_Notification[pin];
+        PortHw_EnablePinInterrupt(BENCH_PORT, (uint8)pin, PORT_HW_INT_EITHER_EDGE, Bench_Notification[pin]);
+    }
+
+    (void)printf("PORTC interrupts, %u per measurement\n", (unsigned)BENCH_IRQS);
+    for (i = 0U; i < BENCH_LOADS; i++)
+    {
+        Bench_BuildPatterns(load[i]);
+        Bench_Checksum = 0U;
+        Bench_Measure(Bench_NaiveIrqHandler, &naive);
+        naiveSum = Bench_Checksum;
+        Bench_Checksum = 0U;
+        Bench_Measure(Bench_DriverIrqHandler, &driver);
+        if (naiveSum != Bench_Checksum)
+        {
+            mismatches++;
+        }
+        (void)printf("  %2u pending flags\n", (unsigned)load[i]);
+        Bench_Print("naive bit scan", &naive);
+        Bench_Print("PortHw_PortIrqHandler", &driver);
+    }
+    (void)printf("  notifications: %u mismatches\n", (unsigned)mismatches);
+
+    return (0U == mismatches) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,191 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host benchmark of the Port pin profile switch
+==================================================================================================*/
+
+/**
+*   @file    bench_port_profile_host.c
+*
+*   @brief   Host benchmark of the Port pin profile switch
+*   @details Parks the pins of Port_Config_VS_0 for sleep and restores them, first by
+*            re-initializing every pin with PortHw_Init() for the sleep and run profiles, then
+*            with Port_SwitchProfile() and the generated deltas. Prints the register writes
+*            and reads of each way (counted by the simulated register file) and the time per
+*            switch. The time is host time through the simulator, only the ratio is meaningful;
+*            target cycles are measured by PORT_HW_BM_008 of bench_port_hw.c.
+*            _POSIX_C_SOURCE is given on the command line because Port_Hw_Sim.h is
+*            force-included before this file.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -include Port_Hw_Sim.h -IBSW/MCAL/Stub/Det -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/bench_port_profile_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                BSW/MCAL/Config/Port/Port_Hw_VS_0_PBcfg.c BSW/MCAL/Config/Port/Port_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Cfg.c BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*                Board/Driver/HW_Port/Port_Hw_Irq.c BSW/MCAL/Driver/Port/Port.c BSW/MCAL/Stub/Det/Det.c -o bench_port_profile_host
+*            ./bench_port_profile_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <time.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw.h"
+#include "Port.h"
+
+#if (STD_ON != PORT_SWITCH_PROFILE_API)
+    #error "bench_port_profile_host.c needs PORT_SWITCH_PROFILE_API"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Sleep/wake cycles per measurement
+*/
+#define BENCH_ITERATIONS                (100000U)
+
+/*==================================================================================================
+*                                   LOCAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Cost of one sleep/wake way
+*/
+typedef struct
+{
+    uint32 EntryWrites_u32;     /**< @brief Register writes of the sleep entry */
+    uint32 EntryReads_u32;      /**< @brief Register reads of the sleep entry */
+    uint32 ExitWrites_u32;      /**< @brief Register writes of the sleep exit */
+    uint32 ExitReads_u32;       /**< @brief Register reads of the sleep exit */
+    double Seconds;             /**< @brief Time of BENCH_ITERATIONS sleep/wake cycles */
+} Bench_CostType;
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Parks the pins by re-initializing them for the sleep profile
+*/
+static void Bench_FullEntry(void)
+{
+    PortHw_Init(Port_Config_VS_0.NumPins_u16, &PortHw_g_PinSleepTable_VS_0, Port_Config_VS_0.NumUnusedPins_u16,
+                Port_Config_VS_0.UnusedPadMask_ptr, &PortHw_g_UnusedPinSleepConfig_VS_0);
+}
+
+/**
+* @brief Restores the pins by re-initializing them for the run profile
+*/
+static void Bench_FullExit(void)
+{
+    Port_Init(&Port_Config_VS_0);
+}
+
+/**
+* @brief Parks the pins with the generated run to sleep delta
+*/
+static void Bench_DeltaEntry(void)
+{
+    Port_SwitchProfile(PortConfigSet_PortProfile_Run, PortConfigSet_PortProfile_Sleep);
+}
+
+/**
+* @brief Restores the pins with the generated sleep to run delta
+*/
+static void Bench_DeltaExit(void)
+{
+    Port_SwitchProfile(PortConfigSet_PortProfile_Sleep, PortConfigSet_PortProfile_Run);
+}
+
+/**
+* @brief Counts the accesses of one entry/exit pair, then times BENCH_ITERATIONS pairs
+*/
+static void Bench_Measure(void (*Entry)(void), void (*Exit)(void), Bench_CostType* pCost)
+{
+    struct timespec start;
+    struct timespec stop;
+    uint32 i;
+
+    PortHwSim_Reset();
+    Port_Init(&Port_Config_VS_0);
+
+    PortHwSim_ClearCounters();
+    Entry();
+    pCost->EntryWrites_u32 = PortHwSim_g_WriteCount_u32;
+    pCost->EntryReads_u32 = PortHwSim_g_ReadCount_u32;
+    PortHwSim_ClearCounters();
+    Exit();
+    pCost->ExitWrites_u32 = PortHwSim_g_WriteCount_u32;
+    pCost->ExitReads_u32 = PortHwSim_g_ReadCount_u32;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        Entry();
+        Exit();
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    pCost->Seconds = ((double)(stop.tv_sec - start.tv_sec)) + (((double)(stop.tv_nsec - start.tv_nsec)) * 1e-9);
+}
+
+/**
+* @brief Prints one way
+*/
+static void Bench_Print(const char* pName, const Bench_CostType* pCost)
+{
+    (void)printf("  %-18s: entry %3u writes %3u reads, exit %3u writes %3u reads, %8.1f ns per switch\n",
+                 pName, (unsigned)pCost->EntryWrites_u32, (unsigned)pCost->EntryReads_u32,
+                 (unsigned)pCost->ExitWrites_u32, (unsigned)pCost->ExitReads_u32,
+                 (pCost->Seconds * 1e9) / (2.0 * (double)BENCH_ITERATIONS));
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    Bench_CostType full;
+    Bench_CostType delta;
+
+    Bench_Measure(Bench_FullEntry, Bench_FullExit, &full);
+    Bench_Measure(Bench_DeltaEntry, Bench_DeltaExit, &delta);
+
+    (void)printf("Port_Config_VS_0 run/sleep pin profiles, %u configured and %u unused pads\n",
+                 (unsigned)Port_Config_VS_0.NumPins_u16, (unsigned)Port_Config_VS_0.NumUnusedPins_u16);
+    Bench_Print("full re-init", &full);
+    Bench_Print("Port_SwitchProfile", &delta);
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,170 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host contention benchmark of the Port exclusive areas
+==================================================================================================*/
+
+/**
+*   @file    bench_schm_port_host.c
+*
+*   @brief   Host contention benchmark of the Port exclusive areas
+*   @details One thread per port performs read-modify-write updates of its own direction
+*            register inside exclusive area 09, first with the per-port lock
+*            (SchM_Enter_Port_PortArea()), then with the module lock
+*            (SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09()) shared by all threads. Prints the
+*            update rate of both runs; on a host build the locks are the SchM_Port.c mutexes.
+*
+*            Build and run (from repository root):
+*            gcc -std=c11 -O2 -pthread -IBSW/MCAL/Config/Common -IBSW/MCAL/Driver/SchM
+*                Test/Port_Hw_Test/bench_schm_port_host.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                -o bench_schm_port_host
+*            ./bench_schm_port_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include "SchM_Port.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief One thread per port
+*/
+#define BENCH_THREAD_COUNT              (SCHM_PORT_NUM_PORT_LOCKS)
+
+/**
+* @brief Locked updates per thread
+*/
+#define BENCH_ITERATIONS                (200000U)
+
+/*==================================================================================================
+*                                   LOCAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Per-thread state
+*/
+typedef struct
+{
+    uint8 PortIndex_u8;         /**< @brief Port owned by the thread */
+    boolean PerPort_bool;       /**< @brief TRUE: per-port lock, FALSE: module lock */
+} Bench_ThreadType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Direction register of every port, padded to separate cache lines
+*/
+static volatile uint32 Bench_au32Pddr[BENCH_THREAD_COUNT][16];
+
+static Bench_ThreadType Bench_aThreads[BENCH_THREAD_COUNT];
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Locked read-modify-write loop of one thread
+*/
+static void* Bench_ThreadMain(void* Arg_ptr)
+{
+    const Bench_ThreadType* pThread = (const Bench_ThreadType*)Arg_ptr;
+    volatile uint32* pPddr = &Bench_au32Pddr[pThread->PortIndex_u8][0];
+    uint32 i;
+
+    for (i = 0U; i < BENCH_ITERATIONS; i++)
+    {
+        if (TRUE == pThread->PerPort_bool)
+        {
+            SchM_Enter_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_09, pThread->PortIndex_u8);
+            *pPddr = *pPddr ^ (1UL << (i & 31U));
+            SchM_Exit_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_09, pThread->PortIndex_u8);
+        }
+        else
+        {
+            SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
+            *pPddr = *pPddr ^ (1UL << (i & 31U));
+            SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+        }
+    }
+
+    return NULL;
+}
+
+/**
+* @brief Runs all threads with one lock kind and returns the elapsed time in seconds
+*/
+static double Bench_Run(boolean PerPort_bool)
+{
+    pthread_t threads[BENCH_THREAD_COUNT];
+    struct timespec start;
+    struct timespec stop;
+    uint32 t;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = 0U; t < BENCH_THREAD_COUNT; t++)
+    {
+        Bench_aThreads[t].PortIndex_u8 = (uint8)t;
+        Bench_aThreads[t].PerPort_bool = PerPort_bool;
+        (void)pthread_create(&threads[t], NULL, Bench_ThreadMain, &Bench_aThreads[t]);
+    }
+    for (t = 0U; t < BENCH_THREAD_COUNT; t++)
+    {
+        (void)pthread_join(threads[t], NULL);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((double)(stop.tv_sec - start.tv_sec)) + (((double)(stop.tv_nsec - start.tv_nsec)) * 1e-9);
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    const double updates = (double)BENCH_THREAD_COUNT * (double)BENCH_ITERATIONS;
+    double perPortTime;
+    double moduleTime;
+
+    perPortTime = Bench_Run(TRUE);
+    moduleTime = Bench_Run(FALSE);
+
+    (void)printf("%u threads x %u locked updates, exclusive area 09\n",
+                 (unsigned)BENCH_THREAD_COUNT, (unsigned)BENCH_ITERATIONS);
+    (void)printf("  per-port lock : %8.3f ms  %7.2f Mupdates/s\n", perPortTime * 1e3, (updates / perPortTime) * 1e-6);
+    (void)printf("  module lock   : %8.3f ms  %7.2f Mupdates/s\n", moduleTime * 1e3, (updates / moduleTime) * 1e-6);
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,164 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host thread stress test of the Port_Hw atomic register updates
+==================================================================================================*/
+
+/**
+*   @file    stress_port_hw_atomic.c
+*
+*   @brief   Host thread stress test of the Port_Hw atomic register updates
+*   @details Several threads change the direction of their own pins of the same port at the
+*            same time. Without atomic read-modify-write an update of one thread overwrites the
+*            bits of another one (lost update); with PORT_HW_ATOMIC_RMW no update may be lost.
+*
+*            Build (from repository root):
+*            gcc -std=c11 -pthread -DPORT_HW_ATOMIC_RMW=STD_ON -include Port_Hw_Sim.h -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/stress_port_hw_atomic.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <pthread.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw.h"
+
+#if (STD_ON != PORT_HW_ATOMIC_RMW)
+    #error "stress_port_hw_atomic.c must be built with -DPORT_HW_ATOMIC_RMW=STD_ON"
+#endif
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Number of concurrent threads, each owns STRESS_PINS_PER_THREAD pins of PTA
+*/
+#define STRESS_THREAD_COUNT             (4U)
+#define STRESS_PINS_PER_THREAD          (8U)
+
+/**
+* @brief Direction changes per thread
+*/
+#define STRESS_ITERATIONS               (200000U)
+
+/*==================================================================================================
+*                                   LOCAL TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Per-thread state
+*/
+typedef struct
+{
+    uint32 PinMask_u32;         /**< @brief Pins owned by the thread */
+    uint32 LostUpdates_u32;     /**< @brief Own pins found in the wrong direction */
+} Stress_ThreadType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+static Stress_ThreadType Stress_aThreads[STRESS_THREAD_COUNT];
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Toggles the direction of the thread's pins and checks them after every change
+*/
+static void* Stress_ThreadMain(void* Arg_ptr)
+{
+    Stress_ThreadType* pThread = (Stress_ThreadType*)Arg_ptr;
+    uint32 i;
+    uint32 pddr;
+
+    for (i = 0U; i < STRESS_ITERATIONS; i++)
+    {
+        PortHw_SetPinsDirection(IP_PTA, pThread->PinMask_u32, PORT_HW_PIN_OUT);
+        pddr = __atomic_load_n(&IP_PTA->PDDR, __ATOMIC_SEQ_CST);
+        if (pThread->PinMask_u32 != (pddr & pThread->PinMask_u32))
+        {
+            pThread->LostUpdates_u32++;
+        }
+
+        PortHw_SetPinsDirection(IP_PTA, pThread->PinMask_u32, PORT_HW_PIN_IN);
+        pddr = __atomic_load_n(&IP_PTA->PDDR, __ATOMIC_SEQ_CST);
+        if (0U != (pddr & pThread->PinMask_u32))
+        {
+            pThread->LostUpdates_u32++;
+        }
+    }
+
+    /* Leave the own pins as output, the final PDDR must hold all of them */
+    PortHw_SetPinsDirection(IP_PTA, pThread->PinMask_u32, PORT_HW_PIN_OUT);
+
+    return NULL;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    pthread_t threads[STRESS_THREAD_COUNT];
+    uint32 expectedPddr = 0U;
+    uint32 lostUpdates = 0U;
+    uint32 pddr;
+    uint32 t;
+    int status;
+
+    PortHwSim_Reset();
+
+    for (t = 0U; t < STRESS_THREAD_COUNT; t++)
+    {
+        Stress_aThreads[t].PinMask_u32 = ((1UL << STRESS_PINS_PER_THREAD) - 1UL) << (t * STRESS_PINS_PER_THREAD);
+        Stress_aThreads[t].LostUpdates_u32 = 0U;
+        expectedPddr |= Stress_aThreads[t].PinMask_u32;
+        (void)pthread_create(&threads[t], NULL, Stress_ThreadMain, &Stress_aThreads[t]);
+    }
+
+    for (t = 0U; t < STRESS_THREAD_COUNT; t++)
+    {
+        (void)pthread_join(threads[t], NULL);
+        lostUpdates += Stress_aThreads[t].LostUpdates_u32;
+    }
+
+    pddr = IP_PTA->PDDR;
+    status = ((expectedPddr == pddr) && (0U == lostUpdates)) ? 0 : 1;
+
+    (void)printf("%u threads x %u direction changes: PDDR 0x%08lX (expected 0x%08lX), %lu lost updates\n",
+                 (unsigned)STRESS_THREAD_COUNT, (unsigned)(2U * STRESS_ITERATIONS),
+                 (unsigned long)pddr, (unsigned long)expectedPddr, (unsigned long)lostUpdates);
+    (void)printf("[%s] PORT_HW_ST_001 atomic direction updates\n", (0 == status) ? "PASS" : "FAIL");
+
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,1348 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host waveform tests of the Port_Hw bit-bang engine
+==================================================================================================*/
+
+/**
+*   @file    test_port_hw_bitbang_host.c
+*
+*   @brief   Host waveform tests of the Port_Hw bit-bang engine
+*   @details Runs the SPI, I2C and 1-Wire masters of Port_Hw_BitBang.c against the simulated
+*            register file. Every GPIO write is traced with its simulated cycle, the trace is
+*            turned into line edges and checked against the protocol: SPI against the timing
+*            table of the test (SPI has no bus-level timing of its own), I2C against the
+*            standard-mode limits of the I2C-bus specification and 1-Wire against the
+*            standard speed limits of the 1-Wire protocol, both at an 80 MHz core clock.
+*            Slaves are modelled from the same trace in the PDIR input hook of the simulator.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/test_port_hw_bitbang_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw_BitBang.c Board/Driver/HW_Port/Port_Hw.c
+*                BSW/MCAL/Driver/SchM/SchM_Port.c -o test_port_hw_bitbang_host
+*            ./test_port_hw_bitbang_host
+*
+*            The same build with -DPORT_HW_BITBAND_PDDR=STD_OFF
+*            -DPORT_HW_PER_PORT_EXCLUSIVE_AREAS=STD_OFF runs the 1-Wire slots on PDDR
+*            read-modify-writes inside the module-wide exclusive area 11.
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw_BitBang.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Test result macros
+*/
+#define TEST_PASSED                     (0U)
+#define TEST_FAILED                     (1U)
+
+/**
+* @brief Core clock of the timing tables and of the protocol limits
+*/
+#define TEST_CORE_CLOCK_MHZ             (80U)
+#define TEST_NS(ns)                     PORT_HW_BITBANG_NS_TO_CYCLES((ns), TEST_CORE_CLOCK_MHZ)
+#define TEST_US(us)                     PORT_HW_BITBANG_NS_TO_CYCLES((us) * 1000U, TEST_CORE_CLOCK_MHZ)
+
+/**
+* @brief Trace, edge and sample buffers
+*/
+#define TEST_TRACE_SIZE                 (4096U)
+#define TEST_MAX_SAMPLES                (256U)
+#define TEST_MAX_TOKENS                 (32U)
+
+/**
+* @brief SPI pins (PTB)
+*/
+#define TEST_SPI_PORT                   (1U)
+#define TEST_SPI_SCK                    (1UL << 0U)
+#define TEST_SPI_MOSI                   (1UL << 1U)
+#define TEST_SPI_MISO                   (1UL << 2U)
+#define TEST_SPI_CS                     (1UL << 3U)
+
+/**
+* @brief I2C pins (PTC)
+*/
+#define TEST_I2C_PORT                   (2U)
+#define TEST_I2C_SCL_PIN                (4U)
+#define TEST_I2C_SDA_PIN                (5U)
+#define TEST_I2C_SCL                    (1UL << TEST_I2C_SCL_PIN)
+#define TEST_I2C_SDA                    (1UL << TEST_I2C_SDA_PIN)
+#define TEST_I2C_SLAVE_ADDRESS          (0x50U)
+
+/**
+* @brief 1-Wire pin (PTE)
+*/
+#define TEST_OW_PORT                    (4U)
+#define TEST_OW_PIN                     (6U)
+#define TEST_OW_DQ                      (1UL << TEST_OW_PIN)
+
+/**
+* @brief Line indexes of the edge lists
+*/
+#define TEST_LINE_SCK                   (0U)
+#define TEST_LINE_MOSI                  (1U)
+#define TEST_LINE_CS                    (2U)
+#define TEST_LINE_SCL                   (0U)
+#define TEST_LINE_SDA                   (1U)
+#define TEST_LINE_DQ                    (0U)
+#define TEST_MAX_LINES                  (3U)
+
+/**
+* @brief I2C token kinds
+*/
+#define TEST_TOKEN_START                (0U)
+#define TEST_TOKEN_BYTE                 (1U)
+#define TEST_TOKEN_STOP                 (2U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Test case descriptor
+*/
+typedef struct
+{
+    const char* testName;           /**< @brief Test case name */
+    uint8 (*testFunc)(void);        /**< @brief Test case function */
+} TestCase_Type;
+
+/**
+* @brief Line observed in the trace
+*/
+typedef struct
+{
+    uint8 Port_u8;                  /**< @brief Port index */
+    uint32 Mask_u32;                /**< @brief Pin of the line */
+    boolean OpenDrain_bool;         /**< @brief TRUE: level from PDDR (pulled or released) */
+} TestLine_Type;
+
+/**
+* @brief Level change of a line
+*/
+typedef struct
+{
+    uint32 Cycle_u32;               /**< @brief Simulated cycle of the change */
+    uint8 Line_u8;                  /**< @brief Line index */
+    uint8 Level_u8;                 /**< @brief New level */
+} TestEdge_Type;
+
+/**
+* @brief Decoded I2C symbol (START, byte with its ninth bit, STOP)
+*/
+typedef struct
+{
+    uint8 Kind_u8;                  /**< @brief TEST_TOKEN_xxx */
+    uint8 Value_u8;                 /**< @brief Byte as driven by the master */
+    uint8 Ack_u8;                   /**< @brief Ninth bit as driven by the master */
+} TestToken_Type;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+static const TestLine_Type Test_SpiLines[3] =
+{
+    { (uint8)TEST_SPI_PORT, TEST_SPI_SCK, FALSE },
+    { (uint8)TEST_SPI_PORT, TEST_SPI_MOSI, FALSE },
+    { (uint8)TEST_SPI_PORT, TEST_SPI_CS, FALSE }
+};
+
+static const TestLine_Type Test_I2cLines[2] =
+{
+    { (uint8)TEST_I2C_PORT, TEST_I2C_SCL, TRUE },
+    { (uint8)TEST_I2C_PORT, TEST_I2C_SDA, TRUE }
+};
+
+static const TestLine_Type Test_OneWireLines[1] =
+{
+    { (uint8)TEST_OW_PORT, TEST_OW_DQ, TRUE }
+};
+
+/**
+* @brief SPI timing of the waveform test and of the maximum rate test
+*/
+static const PortHw_BitBangSpiTimingType Test_SpiTiming = { 40U, 20U, 30U, 50U };
+static const PortHw_BitBangSpiTimingType Test_SpiTimingZero = { 0U, 0U, 0U, 0U };
+
+/**
+* @brief Standard-mode I2C (100 kHz) at the spec minimum values
+*/
+static const PortHw_BitBangI2cTimingType Test_I2cTiming =
+{
+    TEST_NS(4000U),     /* tHD;STA */
+    TEST_NS(4700U),     /* tSU;STA */
+    TEST_NS(4700U),     /* tLOW */
+    TEST_NS(4000U),     /* tHIGH */
+    TEST_NS(300U),      /* tHD;DAT */
+    TEST_NS(4000U),     /* tSU;STO */
+    TEST_NS(4700U)      /* tBUF */
+};
+
+/**
+* @brief Standard speed 1-Wire, recommended values A..J of Maxim AN126
+*/
+static const PortHw_BitBangOneWireTimingType Test_OneWireTiming =
+{
+    TEST_US(6U), TEST_US(64U), TEST_US(60U), TEST_US(10U), TEST_US(9U), TEST_US(55U),
+    TEST_US(480U), TEST_US(70U), TEST_US(410U)
+};
+
+/**
+* @brief Data returned by the slave models
+*/
+static const uint8 Test_SlaveData[8] = { 0x28U, 0xFFU, 0x4CU, 0x06U, 0x90U, 0x15U, 0x03U, 0x5AU };
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+static PortHwSim_TraceEntryType Test_Trace[TEST_TRACE_SIZE];
+static uint32 Test_StartPdor[PORT_HW_SIM_PORT_COUNT_U8];
+static uint32 Test_StartPddr[PORT_HW_SIM_PORT_COUNT_U8];
+
+/**
+* @brief Edges of the checkers and of the slave models
+*/
+static TestEdge_Type Test_Edges[TEST_TRACE_SIZE];
+static TestEdge_Type Test_HookEdges[TEST_TRACE_SIZE];
+
+/**
+* @brief Cycles of the PDIR reads of the port under test
+*/
+static uint32 Test_SampleCycles[TEST_MAX_SAMPLES];
+static uint32 Test_SampleCount;
+
+/**
+* @brief Slave model state
+*/
+static PortHw_BitBangSpiModeType Test_SpiMode;
+static boolean Test_SlavePresent;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void Test_StartTrace(void);
+static uint8 Test_LineLevel(const TestLine_Type* pLine, uint32 pdor, uint32 pddr);
+static uint32 Test_BuildEdges(const TestLine_Type lines[], uint8 numLines, uint32 traceCount,
+                              TestEdge_Type edges[], uint8 initLevel[]);
+static void Test_RecordSample(void);
+static uint32 Test_SpiSlaveModel(uint8 PortIndex_u8);
+static uint32 Test_I2cSlaveModel(uint8 PortIndex_u8);
+static uint32 Test_OneWireSlaveModel(uint8 PortIndex_u8);
+static uint8 Test_CheckSpi(const PortHw_BitBangSpiTimingType* pTiming, boolean exact, const uint8 tx[], uint32 length);
+static uint8 Test_RunSpi(PortHw_BitBangSpiModeType mode, const PortHw_BitBangSpiTimingType* pTiming, boolean exact);
+static uint32 Test_DecodeI2c(uint32 endCycle, TestToken_Type tokens[], uint8* pResult);
+static uint8 Test_CheckTokens(const TestToken_Type tokens[], uint32 numTokens, const TestToken_Type expected[], uint32 numExpected);
+static void Test_I2cSetup(PortHw_BitBangI2cConfigType* pConfig);
+static void Test_OneWireSetup(PortHw_BitBangOneWireConfigType* pConfig);
+static uint8 Test_PORT_HW_BB_001(void);    /* SPI modes 0-3: edges, setup/hold and data */
+static uint8 Test_PORT_HW_BB_002(void);    /* SPI at zero delay: edge order and data */
+static uint8 Test_PORT_HW_BB_003(void);    /* I2C write then read: standard-mode timing and framing */
+static uint8 Test_PORT_HW_BB_004(void);    /* I2C address not acknowledged: STOP, E_NOT_OK */
+static uint8 Test_PORT_HW_BB_005(void);    /* 1-Wire reset, write and read slots */
+static uint8 Test_PORT_HW_BB_006(void);    /* 1-Wire reset without slave: E_NOT_OK */
+static uint8 Test_PORT_HW_BB_007(void);    /* 1-Wire slots: one PDDR write per edge, no nested area */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Snapshot the port outputs and start the GPIO write trace
+*/
+static void Test_StartTrace(void)
+{
+    uint8 port;
+
+    for (port = 0U; port < PORT_HW_SIM_PORT_COUNT_U8; port++)
+    {
+        Test_StartPdor[port] = PortHwSim_g_GpioRegs_ast[port].PDOR;
+        Test_StartPddr[port] = PortHwSim_g_GpioRegs_ast[port].PDDR;
+    }
+    Test_SampleCount = 0U;
+    PortHwSim_StartTrace(Test_Trace, TEST_TRACE_SIZE);
+}
+
+/**
+* @brief Level driven by the master on a line: PDOR for a push-pull line, low only when
+*        pulled (output driving 0) for an open-drain line
+*/
+static uint8 Test_LineLevel(const TestLine_Type* pLine, uint32 pdor, uint32 pddr)
+{
+    uint8 level;
+
+    if (TRUE == pLine->OpenDrain_bool)
+    {
+        level = ((0U != (pddr & pLine->Mask_u32)) && (0U == (pdor & pLine->Mask_u32))) ? 0U : 1U;
+    }
+    else
+    {
+        level = (0U != (pdor & pLine->Mask_u32)) ? 1U : 0U;
+    }
+
+    return level;
+}
+
+/**
+* @brief Turn the first traceCount trace entries into level changes of the given lines
+* @return Number of edges
+*/
+static uint32 Test_BuildEdges(const TestLine_Type lines[], uint8 numLines, uint32 traceCount,
+                              TestEdge_Type edges[], uint8 initLevel[])
+{
+    uint32 pdor[PORT_HW_SIM_PORT_COUNT_U8];
+    uint32 pddr[PORT_HW_SIM_PORT_COUNT_U8];
+    uint8 last[TEST_MAX_LINES];
+    uint8 level;
+    uint8 port;
+    uint8 l;
+    uint32 i;
+    uint32 n = 0U;
+
+    (void)memcpy(pdor, Test_StartPdor, sizeof(pdor));
+    (void)memcpy(pddr, Test_StartPddr, sizeof(pddr));
+    for (l = 0U; l < numLines; l++)
+    {
+        initLevel[l] = Test_LineLevel(&lines[l], pdor[lines[l].Port_u8], pddr[lines[l].Port_u8]);
+        last[l] = initLevel[l];
+    }
+
+    for (i = 0U; (i < traceCount) && (i < TEST_TRACE_SIZE); i++)
+    {
+        port = Test_Trace[i].PortIndex_u8;
+        pdor[port] = Test_Trace[i].Pdor_u32;
+        pddr[port] = Test_Trace[i].Pddr_u32;
+        for (l = 0U; l < numLines; l++)
+        {
+            if (lines[l].Port_u8 == port)
+            {
+                level = Test_LineLevel(&lines[l], pdor[port], pddr[port]);
+                if (level != last[l])
+                {
+                    edges[n].Cycle_u32 = Test_Trace[i].Cycle_u32;
+                    edges[n].Line_u8 = l;
+                    edges[n].Level_u8 = level;
+                    n++;
+                    last[l] = level;
+                }
+            }
+        }
+    }
+
+    return n;
+}
+
+/**
+* @brief Store the cycle of a PDIR read of the port under test
+*/
+static void Test_RecordSample(void)
+{
+    if (Test_SampleCount < TEST_MAX_SAMPLES)
+    {
+        Test_SampleCycles[Test_SampleCount] = PortHwSim_g_Cycles_u32;
+        Test_SampleCount++;
+    }
+}
+
+/**
+* @brief SPI slave shifting out Test_SlaveData, MSB first
+* @details The first bit is presented when CS falls. With CPHA 0 the next bit follows every
+*          trailing SCK edge, with CPHA 1 every leading edge after the first one.
+*/
+static uint32 Test_SpiSlaveModel(uint8 PortIndex_u8)
+{
+    uint8 init[TEST_MAX_LINES];
+    uint32 n;
+    uint32 e;
+    uint32 leading = 0U;
+    uint32 trailing = 0U;
+    uint32 bit;
+    uint32 pdir = 0U;
+    const uint8 cpol = (0U != ((uint32)Test_SpiMode & 2U)) ? 1U : 0U;
+
+    if (TEST_SPI_PORT == PortIndex_u8)
+    {
+        n = Test_BuildEdges(Test_SpiLines, 3U, PortHwSim_GetTraceCount(), Test_HookEdges, init);
+        for (e = 0U; e < n; e++)
+        {
+            if ((TEST_LINE_CS == Test_HookEdges[e].Line_u8) && (0U == Test_HookEdges[e].Level_u8))
+            {
+                leading = 0U;
+                trailing = 0U;
+            }
+            else if (TEST_LINE_SCK == Test_HookEdges[e].Line_u8)
+            {
+                if (cpol != Test_HookEdges[e].Level_u8)
+                {
+                    leading++;
+                }
+                else
+                {
+                    trailing++;
+                }
+            }
+            else
+            {
+                /* MOSI is not used by the model */
+            }
+        }
+
+        if (0U != ((uint32)Test_SpiMode & 1U))
+        {
+            bit = (0U != leading) ? (leading - 1U) : 0U;
+        }
+        else
+        {
+            bit = trailing;
+        }
+        if ((bit >= (8U * sizeof(Test_SlaveData))) ||
+            (0U != (Test_SlaveData[bit / 8U] & (0x80U >> (bit % 8U)))))
+        {
+            pdir |= TEST_SPI_MISO;
+        }
+    }
+
+    return pdir;
+}
+
+/**
+* @brief I2C slave at TEST_I2C_SLAVE_ADDRESS
+* @details Acknowledges its address and every written byte and returns Test_SlaveData when
+*          read. The bus state is decoded from the master levels of the trace.
+*/
+static uint32 Test_I2cSlaveModel(uint8 PortIndex_u8)
+{
+    uint8 init[TEST_MAX_LINES];
+    uint32 n;
+    uint32 e;
+    uint8 scl;
+    uint8 sda;
+    uint8 slaveSda = 1U;
+    uint32 clocks = 0U;
+    uint32 address = 0U;
+    uint32 pos;
+    uint32 byte;
+    uint32 pdir = 0U;
+
+    if (TEST_I2C_PORT == PortIndex_u8)
+    {
+        Test_RecordSample();
+        n = Test_BuildEdges(Test_I2cLines, 2U, PortHwSim_GetTraceCount(), Test_HookEdges, init);
+        scl = init[TEST_LINE_SCL];
+        sda = init[TEST_LINE_SDA];
+        for (e = 0U; e < n; e++)
+        {
+            if (TEST_LINE_SDA == Test_HookEdges[e].Line_u8)
+            {
+                if (1U == scl)
+                {
+                    /* START or STOP */
+                    clocks = 0U;
+                    address = 0U;
+                }
+                sda = Test_HookEdges[e].Level_u8;
+            }
+            else
+            {
+                scl = Test_HookEdges[e].Level_u8;
+                if (1U == scl)
+                {
+                    clocks++;
+                    if (clocks <= 8U)
+                    {
+                        address = (address << 1U) | sda;
+                    }
+                }
+            }
+        }
+
+        if ((1U == scl) && (0U != clocks) && (TEST_I2C_SLAVE_ADDRESS == (address >> 1U)))
+        {
+            pos = (clocks - 1U) % 9U;
+            byte = (clocks - 1U) / 9U;
+            if (8U == pos)
+            {
+                /* Acknowledge of the address and of written bytes */
+                if ((0U == byte) || (0U == (address & 1U)))
+                {
+                    slaveSda = 0U;
+                }
+            }
+            else if ((0U != byte) && (0U != (address & 1U)) && (byte <= sizeof(Test_SlaveData)))
+            {
+                slaveSda = (uint8)((Test_SlaveData[byte - 1U] >> (7U - pos)) & 1U);
+            }
+            else
+            {
+                /* Master drives the bit */
+            }
+        }
+
+        pdir = ((0U != scl) ? TEST_I2C_SCL : 0U) | (((0U != sda) && (0U != slaveSda)) ? TEST_I2C_SDA : 0U);
+    }
+
+    return pdir;
+}
+
+/**
+* @brief 1-Wire slave returning Test_SlaveData after a one byte command
+* @details Answers a reset with a presence pulse 20-140 us after the release. In the read
+*          slots after the command it holds the line low for 45 us after the falling edge
+*          to send a 0.
+*/
+static uint32 Test_OneWireSlaveModel(uint8 PortIndex_u8)
+{
+    uint8 init[TEST_MAX_LINES];
+    uint32 n;
+    uint32 e;
+    uint32 now = PortHwSim_g_Cycles_u32;
+    uint32 fall = 0U;
+    uint32 rise = 0U;
+    uint32 slots = 0U;
+    uint32 slot;
+    uint8 level;
+    uint8 slaveDq = 1U;
+    uint32 pdir = 0U;
+
+    if (TEST_OW_PORT == PortIndex_u8)
+    {
+        Test_RecordSample();
+        n = Test_BuildEdges(Test_OneWireLines, 1U, PortHwSim_GetTraceCount(), Test_HookEdges, init);
+        level = init[TEST_LINE_DQ];
+        for (e = 0U; e < n; e++)
+        {
+            level = Test_HookEdges[e].Level_u8;
+            if (0U == level)
+            {
+                fall = Test_HookEdges[e].Cycle_u32;
+                slots++;
+            }
+            else
+            {
+                rise = Test_HookEdges[e].Cycle_u32;
+                if ((rise - fall) >= TEST_US(480U))
+                {
+                    /* Reset pulse */
+                    slots = 0U;
+                }
+            }
+        }
+
+        if ((TRUE == Test_SlavePresent) && (1U == level))
+        {
+            if (0U == slots)
+            {
+                if (((now - rise) >= TEST_US(20U)) && ((now - rise) < TEST_US(140U)))
+                {
+                    slaveDq = 0U;
+                }
+            }
+            else if (slots > 8U)
+            {
+                slot = slots - 9U;
+                if ((slot < (8U * sizeof(Test_SlaveData))) &&
+                    (0U == (Test_SlaveData[slot / 8U] & (1U << (slot % 8U)))) &&
+                    ((now - fall) < TEST_US(45U)))
+                {
+                    slaveDq = 0U;
+                }
+            }
+            else
+            {
+                /* Command slots, written by the master */
+            }
+        }
+
+        pdir = ((0U != level) && (0U != slaveDq)) ? TEST_OW_DQ : 0U;
+    }
+
+    return pdir;
+}
+
+/**
+* @brief Check one SPI frame of the trace
+* @details One CS low frame with 16 SCK edges per byte and SCK idle at CPOL outside of it.
+*          Every SCK phase lasts at least (exact: exactly) its timing table value, MOSI is
+*          stable for a half period around every sampling edge and the bits sampled on MOSI
+*          are the transmitted bytes.
+*/
+static uint8 Test_CheckSpi(const PortHw_BitBangSpiTimingType* pTiming, boolean exact, const uint8 tx[], uint32 length)
+{
+    uint8 init[TEST_MAX_LINES];
+    uint8 decoded[16];
+    uint32 n;
+    uint32 e;
+    uint32 cycle;
+    uint32 phase;
+    uint32 minPhase;
+    uint32 csFall = 0U;
+    uint32 lastSck = 0U;
+    uint32 lastMosi = 0U;
+    uint32 lastSample = 0U;
+    uint32 sckEdges = 0U;
+    uint32 bits = 0U;
+    uint8 mosi;
+    uint8 sck;
+    boolean inFrame = FALSE;
+    boolean frameDone = FALSE;
+    boolean sampling;
+    uint8 result = TEST_PASSED;
+    const uint8 cpol = (0U != ((uint32)Test_SpiMode & 2U)) ? 1U : 0U;
+    const boolean cpha = (0U != ((uint32)Test_SpiMode & 1U)) ? TRUE : FALSE;
+
+    (void)memset(decoded, 0, sizeof(decoded));
+    n = Test_BuildEdges(Test_SpiLines, 3U, PortHwSim_GetTraceCount(), Test_Edges, init);
+    mosi = init[TEST_LINE_MOSI];
+    sck = init[TEST_LINE_SCK];
+    if ((cpol != sck) || (1U != init[TEST_LINE_CS]))
+    {
+        (void)printf("  idle levels: SCK %u CS %u\n", (unsigned)sck, (unsigned)init[TEST_LINE_CS]);
+        result = TEST_FAILED;
+    }
+
+    for (e = 0U; e < n; e++)
+    {
+        cycle = Test_Edges[e].Cycle_u32;
+        if (TEST_LINE_CS == Test_Edges[e].Line_u8)
+        {
+            if ((0U == Test_Edges[e].Level_u8) && (FALSE == frameDone))
+            {
+                inFrame = TRUE;
+                csFall = cycle;
+            }
+            else if ((1U == Test_Edges[e].Level_u8) && (TRUE == inFrame))
+            {
+                inFrame = FALSE;
+                frameDone = TRUE;
+                phase = cycle - lastSck;
+                if ((phase < pTiming->CsHold_u32) || ((TRUE == exact) && (phase != pTiming->CsHold_u32)))
+                {
+                    (void)printf("  CS hold %u cycles\n", (unsigned)phase);
+                    result = TEST_FAILED;
+                }
+            }
+            else
+            {
+                (void)printf("  unexpected CS edge at %u\n", (unsigned)cycle);
+                result = TEST_FAILED;
+            }
+        }
+        else if (TEST_LINE_MOSI == Test_Edges[e].Line_u8)
+        {
+            if ((TRUE == inFrame) && (0U != bits) && (bits < (8U * length)) && ((cycle - lastSample) < pTiming->HalfPeriod_u32))
+            {
+                (void)printf("  MOSI hold %u cycles after bit %u\n", (unsigned)(cycle - lastSample), (unsigned)bits);
+                result = TEST_FAILED;
+            }
+            mosi = Test_Edges[e].Level_u8;
+            lastMosi = cycle;
+        }
+        else
+        {
+            if (FALSE == inFrame)
+            {
+                (void)printf("  SCK edge outside CS at %u\n", (unsigned)cycle);
+                result = TEST_FAILED;
+            }
+            sckEdges++;
+            phase = cycle - ((1U == sckEdges) ? csFall : lastSck);
+            minPhase = (1U == sckEdges) ? pTiming->CsSetup_u32 : pTiming->HalfPeriod_u32;
+            if ((phase < minPhase) || ((TRUE == exact) && (phase != minPhase)))
+            {
+                (void)printf("  SCK phase %u: %u cycles, expected %u\n", (unsigned)sckEdges, (unsigned)phase, (unsigned)minPhase);
+                result = TEST_FAILED;
+            }
+            lastSck = cycle;
+            sck = Test_Edges[e].Level_u8;
+
+            /* CPHA 0 samples on the leading edge (away from CPOL), CPHA 1 on the trailing one */
+            sampling = (TRUE == cpha) ? (boolean)(cpol == sck) : (boolean)(cpol != sck);
+            if ((TRUE == sampling) && (bits < (8U * length)))
+            {
+                minPhase = ((0U == bits) && (FALSE == cpha)) ? pTiming->CsSetup_u32 : pTiming->HalfPeriod_u32;
+                if ((cycle - lastMosi) < minPhase)
+                {
+                    (void)printf("  MOSI setup %u cycles before bit %u\n", (unsigned)(cycle - lastMosi), (unsigned)bits);
+                    result = TEST_FAILED;
+                }
+                decoded[bits / 8U] |= (uint8)(mosi << (7U - (bits % 8U)));
+                bits++;
+                lastSample = cycle;
+            }
+        }
+    }
+
+    if ((FALSE == frameDone) || (sckEdges != (16U * length)) || (bits != (8U * length)) || (cpol != sck))
+    {
+        (void)printf("  frame: %u SCK edges, %u bits, SCK idle %u\n", (unsigned)sckEdges, (unsigned)bits, (unsigned)sck);
+        result = TEST_FAILED;
+    }
+    else if (0 != memcmp(decoded, tx, length))
+    {
+        (void)printf("  MOSI data differs\n");
+        result = TEST_FAILED;
+    }
+    else
+    {
+        /* Frame matches */
+    }
+
+    return result;
+}
+
+/**
+* @brief Transfer three bytes in one SPI mode and check the waveform and the received data
+*/
+static uint8 Test_RunSpi(PortHw_BitBangSpiModeType mode, const PortHw_BitBangSpiTimingType* pTiming, boolean exact)
+{
+    static const uint8 tx[3] = { 0xA5U, 0x3CU, 0x81U };
+    PortHw_BitBangSpiConfigType config;
+    uint8 rx[3];
+    uint32 count;
+    uint8 result;
+
+    config.Sck_st.GpioBase_ptr = IP_PTB;
+    config.Sck_st.PinMask_u32 = TEST_SPI_SCK;
+    config.Mosi_st.GpioBase_ptr = IP_PTB;
+    config.Mosi_st.PinMask_u32 = TEST_SPI_MOSI;
+    config.Miso_st.GpioBase_ptr = IP_PTB;
+    config.Miso_st.PinMask_u32 = TEST_SPI_MISO;
+    config.Cs_st.GpioBase_ptr = IP_PTB;
+    config.Cs_st.PinMask_u32 = TEST_SPI_CS;
+    config.Mode_en = mode;
+    config.Timing_ptr = pTiming;
+
+    PortHwSim_Reset();
+    IP_PTB->PDDR = TEST_SPI_SCK | TEST_SPI_MOSI | TEST_SPI_CS;
+    Test_SpiMode = mode;
+    PortHw_BitBangInit();
+    PortHw_BitBangSpiInit(&config);
+
+    Test_StartTrace();
+    PortHwSim_SetInputHook(Test_SpiSlaveModel);
+    (void)memset(rx, 0, sizeof(rx));
+    PortHw_BitBangSpiTransfer(&config, tx, rx, sizeof(tx));
+    result = Test_CheckSpi(pTiming, exact, tx, sizeof(tx));
+    count = PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    if (count > TEST_TRACE_SIZE)
+    {
+        (void)printf("  trace overflow\n");
+        result = TEST_FAILED;
+    }
+    if (0 != memcmp(rx, Test_SlaveData, sizeof(rx)))
+    {
+        (void)printf("  mode %u: received %02X %02X %02X\n", (unsigned)mode, rx[0], rx[1], rx[2]);
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief Decode the I2C trace into START, byte and STOP tokens and check the bus timing
+* @details The timing is checked against the standard-mode limits of the I2C-bus
+*          specification, SDA may only change while SCL is high for a START or a STOP.
+* @return Number of tokens
+*/
+static uint32 Test_DecodeI2c(uint32 endCycle, TestToken_Type tokens[], uint8* pResult)
+{
+    uint8 init[TEST_MAX_LINES];
+    uint32 n;
+    uint32 e;
+    uint32 cycle;
+    uint32 lastSclFall = 0U;
+    uint32 lastSclRise = 0U;
+    uint32 lastSdaChange = 0U;
+    uint32 lastStart = 0U;
+    uint32 lastStop = 0U;
+    uint32 bits = 0U;
+    uint32 shift = 0U;
+    uint32 numTokens = 0U;
+    boolean afterStart = FALSE;
+    uint8 scl;
+    uint8 sda;
+
+    n = Test_BuildEdges(Test_I2cLines, 2U, PortHwSim_GetTraceCount(), Test_Edges, init);
+    scl = init[TEST_LINE_SCL];
+    sda = init[TEST_LINE_SDA];
+    if ((1U != scl) || (1U != sda))
+    {
+        (void)printf("  bus not idle before the transfer\n");
+        *pResult = TEST_FAILED;
+    }
+
+    for (e = 0U; e < n; e++)
+    {
+        cycle = Test_Edges[e].Cycle_u32;
+        if (TEST_LINE_SDA == Test_Edges[e].Line_u8)
+        {
+            sda = Test_Edges[e].Level_u8;
+            if (1U == scl)
+            {
+                if (0U == sda)
+                {
+                    if ((0U != numTokens) && ((cycle - lastSclRise) < TEST_NS(4700U)))
+                    {
+                        (void)printf("  tSU;STA %u cycles\n", (unsigned)(cycle - lastSclRise));
+                        *pResult = TEST_FAILED;
+                    }
+                    /* A repeated START is preceded by one SCL rise with SDA released */
+                    if ((1U != bits) && (0U != bits))
+                    {
+                        (void)printf("  START after %u bits\n", (unsigned)bits);
+                        *pResult = TEST_FAILED;
+                    }
+                    tokens[numTokens].Kind_u8 = TEST_TOKEN_START;
+                    numTokens++;
+                    lastStart = cycle;
+                    afterStart = TRUE;
+                }
+                else
+                {
+                    if ((cycle - lastSclRise) < TEST_NS(4000U))
+                    {
+                        (void)printf("  tSU;STO %u cycles\n", (unsigned)(cycle - lastSclRise));
+                        *pResult = TEST_FAILED;
+                    }
+                    if (1U != bits)
+                    {
+                        (void)printf("  STOP after %u bits\n", (unsigned)bits);
+                        *pResult = TEST_FAILED;
+                    }
+                    tokens[numTokens].Kind_u8 = TEST_TOKEN_STOP;
+                    numTokens++;
+                    lastStop = cycle;
+                }
+                bits = 0U;
+                shift = 0U;
+            }
+            else
+            {
+                /* tHD;DAT 0 is allowed, the data must only change after SCL fell */
+                if (cycle < lastSclFall)
+                {
+                    *pResult = TEST_FAILED;
+                }
+                lastSdaChange = cycle;
+            }
+        }
+        else
+        {
+            scl = Test_Edges[e].Level_u8;
+            if (0U == scl)
+            {
+                if (TRUE == afterStart)
+                {
+                    if ((cycle - lastStart) < TEST_NS(4000U))
+                    {
+                        (void)printf("  tHD;STA %u cycles\n", (unsigned)(cycle - lastStart));
+                        *pResult = TEST_FAILED;
+                    }
+                    afterStart = FALSE;
+                }
+                else if ((cycle - lastSclRise) < TEST_NS(4000U))
+                {
+                    (void)printf("  tHIGH %u cycles\n", (unsigned)(cycle - lastSclRise));
+                    *pResult = TEST_FAILED;
+                }
+                else
+                {
+                    /* SCL high time within the limits */
+                }
+                lastSclFall = cycle;
+            }
+            else
+            {
+                if ((cycle - lastSclFall) < TEST_NS(4700U))
+                {
+                    (void)printf("  tLOW %u cycles\n", (unsigned)(cycle - lastSclFall));
+                    *pResult = TEST_FAILED;
+                }
+                if ((lastSdaChange > lastSclFall) && ((cycle - lastSdaChange) < TEST_NS(250U)))
+                {
+                    (void)printf("  tSU;DAT %u cycles\n", (unsigned)(cycle - lastSdaChange));
+                    *pResult = TEST_FAILED;
+                }
+                lastSclRise = cycle;
+                shift = (shift << 1U) | sda;
+                bits++;
+                if (9U == bits)
+                {
+                    tokens[numTokens].Kind_u8 = TEST_TOKEN_BYTE;
+                    tokens[numTokens].Value_u8 = (uint8)(shift >> 1U);
+                    tokens[numTokens].Ack_u8 = (uint8)(shift & 1U);
+                    numTokens++;
+                    bits = 0U;
+                    shift = 0U;
+                }
+            }
+        }
+        if (numTokens >= TEST_MAX_TOKENS)
+        {
+            break;
+        }
+    }
+
+    if ((endCycle - lastStop) < TEST_NS(4700U))
+    {
+        (void)printf("  tBUF %u cycles\n", (unsigned)(endCycle - lastStop));
+        *pResult = TEST_FAILED;
+    }
+
+    return numTokens;
+}
+
+/**
+* @brief Compare decoded I2C tokens with the expected sequence
+*/
+static uint8 Test_CheckTokens(const TestToken_Type tokens[], uint32 numTokens, const TestToken_Type expected[], uint32 numExpected)
+{
+    uint32 i;
+    uint8 result = TEST_PASSED;
+
+    if (numTokens != numExpected)
+    {
+        (void)printf("  %u tokens, expected %u\n", (unsigned)numTokens, (unsigned)numExpected);
+        result = TEST_FAILED;
+    }
+    for (i = 0U; (i < numTokens) && (i < numExpected); i++)
+    {
+        if ((tokens[i].Kind_u8 != expected[i].Kind_u8) ||
+            ((TEST_TOKEN_BYTE == expected[i].Kind_u8) &&
+             ((tokens[i].Value_u8 != expected[i].Value_u8) || (tokens[i].Ack_u8 != expected[i].Ack_u8))))
+        {
+            (void)printf("  token %u: kind %u value %02X ack %u\n", (unsigned)i, (unsigned)tokens[i].Kind_u8,
+                         (unsigned)tokens[i].Value_u8, (unsigned)tokens[i].Ack_u8);
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief I2C master on PTC4 (SCL) and PTC5 (SDA)
+*/
+static void Test_I2cSetup(PortHw_BitBangI2cConfigType* pConfig)
+{
+    pConfig->Scl_st.GpioBase_ptr = IP_PTC;
+    pConfig->Scl_st.PinMask_u32 = TEST_I2C_SCL;
+    pConfig->Scl_st.Pin_u8 = (uint8)TEST_I2C_SCL_PIN;
+    pConfig->Sda_st.GpioBase_ptr = IP_PTC;
+    pConfig->Sda_st.PinMask_u32 = TEST_I2C_SDA;
+    pConfig->Sda_st.Pin_u8 = (uint8)TEST_I2C_SDA_PIN;
+    pConfig->Timing_ptr = &Test_I2cTiming;
+
+    PortHwSim_Reset();
+    /* Output latches left high by a previous user, the init must clear them */
+    IP_PTC->PDOR = TEST_I2C_SCL | TEST_I2C_SDA;
+    PortHw_BitBangInit();
+    PortHw_BitBangI2cInit(pConfig);
+}
+
+/**
+* @brief 1-Wire master on PTE6
+*/
+static void Test_OneWireSetup(PortHw_BitBangOneWireConfigType* pConfig)
+{
+    pConfig->Line_st.GpioBase_ptr = IP_PTE;
+    pConfig->Line_st.PinMask_u32 = TEST_OW_DQ;
+    pConfig->Line_st.Pin_u8 = (uint8)TEST_OW_PIN;
+    pConfig->Timing_ptr = &Test_OneWireTiming;
+
+    PortHwSim_Reset();
+    IP_PTE->PDOR = TEST_OW_DQ;
+    PortHw_BitBangInit();
+    PortHw_BitBangOneWireInit(pConfig);
+}
+
+/**
+* @brief PORT_HW_BB_001 - SPI modes 0 to 3
+* @details Three bytes full duplex in every mode: SCK idle level, phase lengths exactly as
+*          the timing table, MOSI setup/hold around the sampling edges, MOSI and MISO data.
+*/
+static uint8 Test_PORT_HW_BB_001(void)
+{
+    uint8 result = TEST_PASSED;
+    uint32 mode;
+
+    for (mode = 0U; mode < 4U; mode++)
+    {
+        if (TEST_PASSED != Test_RunSpi((PortHw_BitBangSpiModeType)mode, &Test_SpiTiming, TRUE))
+        {
+            (void)printf("  SPI mode %u failed\n", (unsigned)mode);
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_002 - SPI at zero delay
+* @details With an all-zero timing table the engine runs at its maximum rate; the edge order
+*          must still give correct data in both phases.
+*/
+static uint8 Test_PORT_HW_BB_002(void)
+{
+    uint8 result = TEST_PASSED;
+
+    if (TEST_PASSED != Test_RunSpi(PORT_HW_BITBANG_SPI_MODE_0, &Test_SpiTimingZero, FALSE))
+    {
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_RunSpi(PORT_HW_BITBANG_SPI_MODE_3, &Test_SpiTimingZero, FALSE))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_003 - I2C write then read
+* @details Register read of a slave: two bytes written, repeated START, three bytes read.
+*          Checks the standard-mode timing, the framing (S, address+W, data, Sr, address+R,
+*          data, P), that the master releases SDA for the slave bits, acknowledges all read
+*          bytes but the last, and never drives a line high.
+*/
+static uint8 Test_PORT_HW_BB_003(void)
+{
+    static const uint8 tx[2] = { 0x10U, 0x20U };
+    static const TestToken_Type expected[] =
+    {
+        { TEST_TOKEN_START, 0U, 0U },
+        { TEST_TOKEN_BYTE, (uint8)(TEST_I2C_SLAVE_ADDRESS << 1U), 1U },
+        { TEST_TOKEN_BYTE, 0x10U, 1U },
+        { TEST_TOKEN_BYTE, 0x20U, 1U },
+        { TEST_TOKEN_START, 0U, 0U },
+        { TEST_TOKEN_BYTE, (uint8)((TEST_I2C_SLAVE_ADDRESS << 1U) | 1U), 1U },
+        { TEST_TOKEN_BYTE, 0xFFU, 0U },
+        { TEST_TOKEN_BYTE, 0xFFU, 0U },
+        { TEST_TOKEN_BYTE, 0xFFU, 1U },
+        { TEST_TOKEN_STOP, 0U, 0U }
+    };
+    PortHw_BitBangI2cConfigType config;
+    TestToken_Type tokens[TEST_MAX_TOKENS];
+    uint8 rx[3];
+    uint32 numTokens;
+    uint32 count;
+    uint32 i;
+    Std_ReturnType status;
+    uint8 result = TEST_PASSED;
+
+    Test_I2cSetup(&config);
+    Test_StartTrace();
+    PortHwSim_SetInputHook(Test_I2cSlaveModel);
+    (void)memset(rx, 0, sizeof(rx));
+    status = PortHw_BitBangI2cTransfer(&config, (uint8)TEST_I2C_SLAVE_ADDRESS, tx, sizeof(tx), rx, sizeof(rx));
+    numTokens = Test_DecodeI2c(PortHwSim_g_Cycles_u32, tokens, &result);
+    count = PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    if ((Std_ReturnType)E_OK != status)
+    {
+        (void)printf("  transfer not acknowledged\n");
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckTokens(tokens, numTokens, expected, sizeof(expected) / sizeof(expected[0])))
+    {
+        result = TEST_FAILED;
+    }
+    if (0 != memcmp(rx, Test_SlaveData, sizeof(rx)))
+    {
+        (void)printf("  received %02X %02X %02X\n", rx[0], rx[1], rx[2]);
+        result = TEST_FAILED;
+    }
+    for (i = 0U; (i < count) && (i < TEST_TRACE_SIZE); i++)
+    {
+        if ((TEST_I2C_PORT == Test_Trace[i].PortIndex_u8) &&
+            (0U != (Test_Trace[i].Pdor_u32 & (TEST_I2C_SCL | TEST_I2C_SDA))))
+        {
+            (void)printf("  open-drain line driven high at %u\n", (unsigned)Test_Trace[i].Cycle_u32);
+            result = TEST_FAILED;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_004 - I2C address not acknowledged
+* @details The transfer ends with STOP right after the address byte and returns E_NOT_OK.
+*/
+static uint8 Test_PORT_HW_BB_004(void)
+{
+    static const uint8 tx[1] = { 0x10U };
+    static const TestToken_Type expected[] =
+    {
+        { TEST_TOKEN_START, 0U, 0U },
+        { TEST_TOKEN_BYTE, (uint8)((TEST_I2C_SLAVE_ADDRESS + 1U) << 1U), 1U },
+        { TEST_TOKEN_STOP, 0U, 0U }
+    };
+    PortHw_BitBangI2cConfigType config;
+    TestToken_Type tokens[TEST_MAX_TOKENS];
+    uint32 numTokens;
+    Std_ReturnType status;
+    uint8 result = TEST_PASSED;
+
+    Test_I2cSetup(&config);
+    Test_StartTrace();
+    PortHwSim_SetInputHook(Test_I2cSlaveModel);
+    status = PortHw_BitBangI2cTransfer(&config, (uint8)(TEST_I2C_SLAVE_ADDRESS + 1U), tx, sizeof(tx), NULL_PTR, 0U);
+    numTokens = Test_DecodeI2c(PortHwSim_g_Cycles_u32, tokens, &result);
+    (void)PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    if ((Std_ReturnType)E_NOT_OK != status)
+    {
+        (void)printf("  missing NACK reported\n");
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckTokens(tokens, numTokens, expected, sizeof(expected) / sizeof(expected[0])))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_005 - 1-Wire reset, write and read slots
+* @details Reset with presence, Read ROM command (0x33) and eight bytes read. Checks the reset
+*          pulse and reset high time, the presence sample point, the low time of every write 0
+*          and write 1/read slot, the slot and recovery times, the read sample points, the
+*          command bits and the received bytes.
+*/
+static uint8 Test_PORT_HW_BB_005(void)
+{
+    static const uint8 command[1] = { 0x33U };
+    PortHw_BitBangOneWireConfigType config;
+    uint8 init[TEST_MAX_LINES];
+    uint8 rx[8];
+    uint32 n;
+    uint32 e;
+    uint32 endCycle;
+    uint32 fall = 0U;
+    uint32 rise = 0U;
+    uint32 low;
+    uint32 slot = 0U;
+    uint32 sample = 1U;
+    uint32 written = 0U;
+    Std_ReturnType status;
+    uint8 result = TEST_PASSED;
+
+    Test_OneWireSetup(&config);
+    Test_SlavePresent = TRUE;
+    Test_StartTrace();
+    PortHwSim_SetInputHook(Test_OneWireSlaveModel);
+    (void)memset(rx, 0, sizeof(rx));
+    status = PortHw_BitBangOneWireReset(&config);
+    PortHw_BitBangOneWireWrite(&config, command, sizeof(command));
+    PortHw_BitBangOneWireRead(&config, rx, sizeof(rx));
+    endCycle = PortHwSim_g_Cycles_u32;
+    n = Test_BuildEdges(Test_OneWireLines, 1U, PortHwSim_GetTraceCount(), Test_Edges, init);
+    (void)PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    if (((Std_ReturnType)E_OK != status) || (1U != init[TEST_LINE_DQ]) || (n != (2U * (1U + 72U))))
+    {
+        (void)printf("  presence %u, idle %u, %u edges\n", (unsigned)status, (unsigned)init[TEST_LINE_DQ], (unsigned)n);
+        result = TEST_FAILED;
+    }
+
+    for (e = 0U; (e + 1U) < n; e += 2U)
+    {
+        if ((0U != e) && ((Test_Edges[e].Cycle_u32 - rise) < ((1U == slot) ? TEST_US(480U) : TEST_US(1U))))
+        {
+            (void)printf("  slot %u: recovery %u cycles\n", (unsigned)slot, (unsigned)(Test_Edges[e].Cycle_u32 - rise));
+            result = TEST_FAILED;
+        }
+        if ((0U != e) && (1U != slot) && ((Test_Edges[e].Cycle_u32 - fall) < TEST_US(61U)))
+        {
+            (void)printf("  slot %u: %u cycles\n", (unsigned)(slot - 1U), (unsigned)(Test_Edges[e].Cycle_u32 - fall));
+            result = TEST_FAILED;
+        }
+        fall = Test_Edges[e].Cycle_u32;
+        rise = Test_Edges[e + 1U].Cycle_u32;
+        low = rise - fall;
+
+        if (0U == slot)
+        {
+            /* Reset pulse and presence sample */
+            if ((low < TEST_US(480U)) || (Test_SampleCount < 1U) ||
+                ((Test_SampleCycles[0] - rise) < TEST_US(60U)) || ((Test_SampleCycles[0] - rise) > TEST_US(75U)))
+            {
+                (void)printf("  reset low %u cycles, presence sample %u cycles after release\n",
+                             (unsigned)low, (unsigned)(Test_SampleCycles[0] - rise));
+                result = TEST_FAILED;
+            }
+        }
+        else if ((low >= TEST_US(1U)) && (low <= TEST_US(15U)))
+        {
+            /* Write 1 or read slot, sampled once before 15 us */
+            if ((sample >= Test_SampleCount) || (Test_SampleCycles[sample] < rise) ||
+                ((Test_SampleCycles[sample] - fall) > TEST_US(15U)))
+            {
+                (void)printf("  slot %u: sample point\n", (unsigned)(slot - 1U));
+                result = TEST_FAILED;
+            }
+            sample++;
+            if (slot <= 8U)
+            {
+                written |= (1UL << (slot - 1U));
+            }
+        }
+        else if ((low < TEST_US(60U)) || (low > TEST_US(120U)) || (slot > 8U))
+        {
+            (void)printf("  slot %u: low %u cycles\n", (unsigned)(slot - 1U), (unsigned)low);
+            result = TEST_FAILED;
+        }
+        else
+        {
+            /* Write 0 slot */
+        }
+        slot++;
+    }
+    if ((endCycle - fall) < TEST_US(61U))
+    {
+        (void)printf("  last slot %u cycles\n", (unsigned)(endCycle - fall));
+        result = TEST_FAILED;
+    }
+    if ((written != command[0]) || (0 != memcmp(rx, Test_SlaveData, sizeof(rx))))
+    {
+        (void)printf("  command %02X, received %02X %02X ... %02X\n", (unsigned)written, rx[0], rx[1], rx[7]);
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_006 - 1-Wire reset without slave
+*/
+static uint8 Test_PORT_HW_BB_006(void)
+{
+    PortHw_BitBangOneWireConfigType config;
+    uint8 result = TEST_PASSED;
+
+    Test_OneWireSetup(&config);
+    Test_SlavePresent = FALSE;
+    Test_StartTrace();
+    PortHwSim_SetInputHook(Test_OneWireSlaveModel);
+    if ((Std_ReturnType)E_NOT_OK != PortHw_BitBangOneWireReset(&config))
+    {
+        result = TEST_FAILED;
+    }
+    (void)PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_BB_007 - 1-Wire slot direction writes
+* @details Every slot pulls and releases the line inside exclusive area 11 with one PDDR
+*          write each (bit-band alias or register), without PortHw_SetPinsDirection() and its
+*          exclusive areas 09/10 (PIDR write on release). Also run with PORT_HW_BITBAND_PDDR
+*          and PORT_HW_PER_PORT_EXCLUSIVE_AREAS off, see the file header.
+*/
+static uint8 Test_PORT_HW_BB_007(void)
+{
+    static const uint8 command[1] = { 0xA5U };
+    PortHw_BitBangOneWireConfigType config;
+    uint8 result = TEST_PASSED;
+
+    Test_OneWireSetup(&config);
+    Test_SlavePresent = TRUE;
+    PortHwSim_SetInputHook(Test_OneWireSlaveModel);
+    Test_StartTrace();
+    PortHwSim_g_GpioWriteCount_u32 = 0U;
+    PortHw_BitBangOneWireWrite(&config, command, sizeof(command));
+    (void)PortHwSim_StopTrace();
+    PortHwSim_SetInputHook(NULL_PTR);
+
+    if ((2U * 8U) != PortHwSim_g_GpioWriteCount_u32)
+    {
+        (void)printf("  %u GPIO writes\n", (unsigned)PortHwSim_g_GpioWriteCount_u32);
+        result = TEST_FAILED;
+    }
+    if ((0U != (IP_PTE->PDDR & TEST_OW_DQ)) || (0U != (IP_PTE->PIDR & TEST_OW_DQ)))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    static const TestCase_Type testCases[] =
+    {
+        { "PORT_HW_BB_001 SPI modes 0-3 waveform", Test_PORT_HW_BB_001 },
+        { "PORT_HW_BB_002 SPI at zero delay", Test_PORT_HW_BB_002 },
+        { "PORT_HW_BB_003 I2C write then read", Test_PORT_HW_BB_003 },
+        { "PORT_HW_BB_004 I2C address NACK", Test_PORT_HW_BB_004 },
+        { "PORT_HW_BB_005 1-Wire reset, write, read", Test_PORT_HW_BB_005 },
+        { "PORT_HW_BB_006 1-Wire no presence", Test_PORT_HW_BB_006 },
+        { "PORT_HW_BB_007 1-Wire slot direction writes", Test_PORT_HW_BB_007 },
+    };
+    uint32 i;
+    uint32 failed = 0U;
+    uint8 result;
+
+    for (i = 0U; i < (sizeof(testCases) / sizeof(testCases[0])); i++)
+    {
+        (void)printf("[RUN ] %s\n", testCases[i].testName);
+        result = testCases[i].testFunc();
+        (void)printf("[%s] %s\n", (TEST_PASSED == result) ? "PASS" : "FAIL", testCases[i].testName);
+        if (TEST_PASSED != result)
+        {
+            failed++;
+        }
+    }
+
+    (void)printf("%u/%u tests passed\n", (unsigned)(i - failed), (unsigned)i);
+
+    return (0U == failed) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,675 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host tests of the Port_Hw input capture and its VCD decoder
+==================================================================================================*/
+
+/**
+*   @file    test_port_hw_capture_host.c
+*
+*   @brief   Host tests of the Port_Hw input capture and its VCD decoder
+*   @details Captures PTD0-3 and PTE15 driven by an input model of the simulated register
+*            file. Every sample reads the simulated counter once, so the model knows the
+*            index of the sample it answers. The drained runs are expanded with
+*            PortCaptureVcd_Expand() and compared sample by sample with the model, and the
+*            run count gives the compression ratio. The throughput test prints the host sample
+*            rate through the simulator (only a floor is checked) and checks the register and
+*            counter reads per sample; target cycles are measured by PORT_HW_BM_011 of
+*            bench_port_hw.c. _POSIX_C_SOURCE is given on the command line because
+*            Port_Hw_Sim.h is force-included before this file.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -O2 -D_POSIX_C_SOURCE=199309L -include Port_Hw_Sim.h -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                -ITools/Port_CaptureVcd
+*                Test/Port_Hw_Test/test_port_hw_capture_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw_Capture.c Tools/Port_CaptureVcd/Port_CaptureVcd.c
+*                -o test_port_hw_capture_host
+*            ./test_port_hw_capture_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw_Capture.h"
+#include "Port_CaptureVcd.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Test result macros
+*/
+#define TEST_PASSED                     (0U)
+#define TEST_FAILED                     (1U)
+
+/**
+* @brief Captured pins: PTD0-3 in slot 0, PTE15 in slot 1
+*/
+#define TEST_PTD_INDEX                  (3U)
+#define TEST_PTE_INDEX                  (4U)
+#define TEST_PTD_MASK                   (0x0000000FUL)
+#define TEST_PTE_MASK                   (0x00008000UL)
+
+/**
+* @brief Input model: half periods in samples of PTD2 and PTE15, PTD8 (not captured) toggles
+*        on every sample
+*/
+#define TEST_PTD2_HALF_PERIOD           (40U)
+#define TEST_PTE15_HALF_PERIOD          (1000U)
+
+/**
+* @brief Buffers
+*/
+#define TEST_MAX_SAMPLES                (10000U)
+#define TEST_RING_SIZE                  (1024U)
+#define TEST_GUARD                      (2U)
+
+/**
+* @brief Samples of the long interval test, spanning less than 2^32 ticks
+*/
+#define TEST_LONG_SAMPLES               (200U)
+
+/**
+* @brief Throughput test: samples and host rate floor in samples per second
+*/
+#define TEST_THROUGHPUT_SAMPLES         (2000000UL)
+#define TEST_THROUGHPUT_FLOOR           (1000000.0)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Test case descriptor
+*/
+typedef struct
+{
+    const char* testName;           /**< @brief Test case name */
+    uint8 (*testFunc)(void);        /**< @brief Test case function */
+} TestCase_Type;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+static const PortHw_PinMaskType Test_Ports[2] =
+{
+    { IP_PTD, TEST_PTD_MASK },
+    { IP_PTE, TEST_PTE_MASK }
+};
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Ring buffer with guard entries on both sides
+*/
+static PortHw_CaptureEntryType Test_Ring[TEST_GUARD + TEST_RING_SIZE + TEST_GUARD];
+
+/**
+* @brief Drained runs and expanded samples
+*/
+static PortHw_CaptureEntryType Test_Drained[TEST_MAX_SAMPLES + 1U];
+static uint32 Test_Samples[TEST_MAX_SAMPLES];
+
+/**
+* @brief Input model parameters: PTD0 half period, counter ticks per sample and counter value
+*        at the capture start
+*/
+static uint32 Test_Ptd0HalfPeriod;
+static uint32 Test_TicksPerSample;
+static uint32 Test_CounterStart;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static uint32 Test_Model(uint32 sample, uint8 slot);
+static uint32 Test_InputModel(uint8 PortIndex_u8);
+static void Test_Setup(PortHw_CaptureConfigType* pConfig, uint8 numPorts, uint32 ringSize, uint32 ptd0HalfPeriod);
+static uint32 Test_ExpectedRuns(uint32 numSamples, uint8 numPorts);
+static uint8 Test_CheckSamples(const PortHw_CaptureEntryType entries[], uint32 numEntries, uint32 numSamples, uint8 numPorts);
+static uint8 Test_CheckGuards(void);
+static uint8 Test_PORT_HW_CAP_001(void);   /* Lossless run-length encoding and compression ratio */
+static uint8 Test_PORT_HW_CAP_002(void);   /* Timestamps across the counter wrap */
+static uint8 Test_PORT_HW_CAP_003(void);   /* Full ring: bounded memory, drops counted, oldest runs kept */
+static uint8 Test_PORT_HW_CAP_004(void);   /* Drain while capturing */
+static uint8 Test_PORT_HW_CAP_005(void);   /* VCD export */
+static uint8 Test_PORT_HW_CAP_006(void);   /* Sample throughput */
+static uint8 Test_PORT_HW_CAP_007(void);   /* Samples further apart than a 24-bit timer period */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Captured value of a slot at a sample index
+*/
+static uint32 Test_Model(uint32 sample, uint8 slot)
+{
+    uint32 value;
+
+    if (0U == slot)
+    {
+        value = ((sample / Test_Ptd0HalfPeriod) & 1U) | (((sample / TEST_PTD2_HALF_PERIOD) & 1U) << 2U) |
+                0x2U | ((sample & 1U) << 8U);
+    }
+    else
+    {
+        value = ((sample / TEST_PTE15_HALF_PERIOD) & 1U) << 15U;
+    }
+
+    return value;
+}
+
+/**
+* @brief PDIR model: the counter was read once per sample before the PDIR reads
+*/
+static uint32 Test_InputModel(uint8 PortIndex_u8)
+{
+    uint32 sample = (PortHwSim_g_Cycles_u32 - Test_CounterStart - 1U) / Test_TicksPerSample;
+    uint32 value = 0U;
+
+    if (TEST_PTD_INDEX == PortIndex_u8)
+    {
+        value = Test_Model(sample, 0U);
+    }
+    else if (TEST_PTE_INDEX == PortIndex_u8)
+    {
+        value = Test_Model(sample, 1U);
+        /* Last read of the sample: the time to the next sample */
+        PortHwSim_g_Cycles_u32 += Test_TicksPerSample - 1U;
+    }
+    else
+    {
+        /* Port not modelled */
+    }
+
+    return value;
+}
+
+/**
+* @brief Reset the register file, install the model and fill the guard entries
+*/
+static void Test_Setup(PortHw_CaptureConfigType* pConfig, uint8 numPorts, uint32 ringSize, uint32 ptd0HalfPeriod)
+{
+    PortHwSim_Reset();
+    PortHwSim_SetInputHook(Test_InputModel);
+    Test_Ptd0HalfPeriod = ptd0HalfPeriod;
+    Test_TicksPerSample = 1U;
+    Test_CounterStart = 0U;
+    (void)memset(Test_Ring, 0xA5, sizeof(Test_Ring));
+
+    pConfig->Ports_ptr = Test_Ports;
+    pConfig->NumPorts_u8 = numPorts;
+    pConfig->Buffer_ptr = &Test_Ring[TEST_GUARD];
+    pConfig->Size_u32 = ringSize;
+}
+
+/**
+* @brief Runs the model gives for a number of samples
+*/
+static uint32 Test_ExpectedRuns(uint32 numSamples, uint8 numPorts)
+{
+    uint32 runs = 1U;
+    uint32 sample;
+    uint8 slot;
+
+    for (sample = 1U; sample < numSamples; sample++)
+    {
+        for (slot = 0U; slot < numPorts; slot++)
+        {
+            if ((Test_Model(sample, slot) & Test_Ports[slot].PinMask_u32) !=
+                (Test_Model(sample - 1U, slot) & Test_Ports[slot].PinMask_u32))
+            {
+                runs++;
+                break;
+            }
+        }
+    }
+
+    return runs;
+}
+
+/**
+* @brief Expand the runs of every slot and compare them with the model, check the timestamps
+*/
+static uint8 Test_CheckSamples(const PortHw_CaptureEntryType entries[], uint32 numEntries, uint32 numSamples, uint8 numPorts)
+{
+    uint32 count;
+    uint32 sample;
+    uint32 entry;
+    uint8 slot;
+    uint8 result = TEST_PASSED;
+
+    for (slot = 0U; slot < numPorts; slot++)
+    {
+        count = PortCaptureVcd_Expand(entries, numEntries, slot, Test_Samples, TEST_MAX_SAMPLES);
+        if (count != numSamples)
+        {
+            (void)printf("  slot %u: %u samples, expected %u\n", (unsigned)slot, (unsigned)count, (unsigned)numSamples);
+            result = TEST_FAILED;
+        }
+        for (sample = 0U; (sample < count) && (TEST_PASSED == result); sample++)
+        {
+            if (Test_Samples[sample] != (Test_Model(sample, slot) & Test_Ports[slot].PinMask_u32))
+            {
+                (void)printf("  slot %u sample %u: %08X\n", (unsigned)slot, (unsigned)sample, (unsigned)Test_Samples[sample]);
+                result = TEST_FAILED;
+            }
+        }
+    }
+
+    sample = 0U;
+    for (entry = 0U; (entry < numEntries) && (TEST_PASSED == result); entry++)
+    {
+        if (entries[entry].Timestamp_u32 != (sample * Test_TicksPerSample))
+        {
+            (void)printf("  run %u: timestamp %u, expected %u\n", (unsigned)entry,
+                         (unsigned)entries[entry].Timestamp_u32, (unsigned)(sample * Test_TicksPerSample));
+            result = TEST_FAILED;
+        }
+        sample += entries[entry].Length_u32;
+    }
+
+    return result;
+}
+
+/**
+* @brief The guard entries around the ring are untouched
+*/
+static uint8 Test_CheckGuards(void)
+{
+    uint8 expected[sizeof(PortHw_CaptureEntryType) * TEST_GUARD];
+    uint8 result = TEST_PASSED;
+
+    (void)memset(expected, 0xA5, sizeof(expected));
+    if ((0 != memcmp(&Test_Ring[0], expected, sizeof(expected))) ||
+        (0 != memcmp(&Test_Ring[TEST_GUARD + TEST_RING_SIZE], expected, sizeof(expected))))
+    {
+        (void)printf("  write outside of the ring buffer\n");
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_001 - Lossless run-length encoding and compression ratio
+* @details 10000 samples of PTD0-3 and PTE15 with PTD8 toggling on every sample outside of
+*          the mask. Every sample is restored from the runs, one run per change of the
+*          captured pins. Prints the compression ratio against raw (timestamp, values)
+*          samples and checks it is at least 8 for a PTD0 half period of 16 samples.
+*/
+static uint8 Test_PORT_HW_CAP_001(void)
+{
+    PortHw_CaptureConfigType config;
+    PortHw_CaptureStatsType stats;
+    uint32 numEntries;
+    uint32 expectedRuns;
+    uint32 rawBytes;
+    uint32 runBytes;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 2U, TEST_RING_SIZE, 16U);
+    PortHw_CaptureStart(&config);
+    PortHw_CaptureRun(TEST_MAX_SAMPLES - 1U);
+    PortHw_CaptureStop();
+    numEntries = PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES);
+    PortHw_CaptureGetStats(&stats);
+
+    expectedRuns = Test_ExpectedRuns(TEST_MAX_SAMPLES, 2U);
+    if ((numEntries != expectedRuns) || (stats.Runs_u32 != expectedRuns) || (0U != stats.Dropped_u32) ||
+        (stats.Samples_u32 != TEST_MAX_SAMPLES))
+    {
+        (void)printf("  %u runs (expected %u), %u dropped, %u samples\n", (unsigned)numEntries, (unsigned)expectedRuns,
+                     (unsigned)stats.Dropped_u32, (unsigned)stats.Samples_u32);
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckSamples(Test_Drained, numEntries, TEST_MAX_SAMPLES, 2U))
+    {
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckGuards())
+    {
+        result = TEST_FAILED;
+    }
+
+    rawBytes = TEST_MAX_SAMPLES * (uint32)sizeof(uint32) * (1U + 2U);
+    runBytes = numEntries * (uint32)sizeof(PortHw_CaptureEntryType);
+    (void)printf("  %u samples in %u runs: %u -> %u bytes, ratio %.1f\n", (unsigned)TEST_MAX_SAMPLES, (unsigned)numEntries,
+                 (unsigned)rawBytes, (unsigned)runBytes, (double)rawBytes / (double)runBytes);
+    if ((8U * runBytes) > rawBytes)
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_002 - Timestamps across the counter wrap
+* @details The capture starts 1024 ticks before the 32-bit counter wraps and a sample takes 3
+*          ticks: the run timestamps are still 3 ticks per sample from the capture start.
+*/
+static uint8 Test_PORT_HW_CAP_002(void)
+{
+    PortHw_CaptureConfigType config;
+    uint32 numEntries;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 2U, TEST_RING_SIZE, 16U);
+    Test_CounterStart = 0xFFFFFC00UL;
+    PortHwSim_g_Cycles_u32 = Test_CounterStart;
+    Test_TicksPerSample = 3U;
+    PortHw_CaptureStart(&config);
+    PortHw_CaptureRun(TEST_MAX_SAMPLES - 1U);
+    PortHw_CaptureStop();
+    numEntries = PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES);
+
+    if (TEST_PASSED != Test_CheckSamples(Test_Drained, numEntries, TEST_MAX_SAMPLES, 2U))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_003 - Full ring
+* @details PTD0 changes on every sample and nothing is drained: the ring keeps the first 8
+*          runs, the 92 later ones are dropped and counted, no entry outside the ring is
+*          written.
+*/
+static uint8 Test_PORT_HW_CAP_003(void)
+{
+    PortHw_CaptureConfigType config;
+    PortHw_CaptureStatsType stats;
+    uint32 numEntries;
+    uint32 entry;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 1U, 8U, 1U);
+    PortHw_CaptureStart(&config);
+    PortHw_CaptureRun(99U);
+    PortHw_CaptureStop();
+    PortHw_CaptureGetStats(&stats);
+    numEntries = PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES);
+
+    if ((8U != stats.Runs_u32) || (92U != stats.Dropped_u32) || (100U != stats.Samples_u32) || (8U != numEntries))
+    {
+        (void)printf("  %u runs, %u dropped, %u samples, %u drained\n", (unsigned)stats.Runs_u32,
+                     (unsigned)stats.Dropped_u32, (unsigned)stats.Samples_u32, (unsigned)numEntries);
+        result = TEST_FAILED;
+    }
+    for (entry = 0U; entry < numEntries; entry++)
+    {
+        if ((Test_Drained[entry].Timestamp_u32 != entry) || (1U != Test_Drained[entry].Length_u32) ||
+            (Test_Drained[entry].Value_au32[0] != (Test_Model(entry, 0U) & TEST_PTD_MASK)))
+        {
+            (void)printf("  run %u differs\n", (unsigned)entry);
+            result = TEST_FAILED;
+        }
+    }
+    if (TEST_PASSED != Test_CheckGuards())
+    {
+        result = TEST_FAILED;
+    }
+    if (0U != PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_004 - Drain while capturing
+* @details A 16-entry ring drained every 8 samples holds a capture of 2000 samples with a run
+*          every 2 samples: nothing is dropped and the drained runs restore every sample.
+*/
+static uint8 Test_PORT_HW_CAP_004(void)
+{
+    PortHw_CaptureConfigType config;
+    PortHw_CaptureStatsType stats;
+    uint32 numEntries = 0U;
+    uint32 block;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 2U, 16U, 2U);
+    PortHw_CaptureStart(&config);
+    PortHw_CaptureRun(7U);
+    for (block = 1U; block < 250U; block++)
+    {
+        numEntries += PortHw_CaptureDrain(&Test_Drained[numEntries], 5U);
+        PortHw_CaptureRun(8U);
+    }
+    numEntries += PortHw_CaptureDrain(&Test_Drained[numEntries], TEST_MAX_SAMPLES - numEntries);
+    PortHw_CaptureStop();
+    numEntries += PortHw_CaptureDrain(&Test_Drained[numEntries], TEST_MAX_SAMPLES - numEntries);
+    PortHw_CaptureGetStats(&stats);
+
+    if ((0U != stats.Dropped_u32) || (numEntries != stats.Runs_u32) || (numEntries != Test_ExpectedRuns(2000U, 2U)))
+    {
+        (void)printf("  %u drained, %u runs, %u dropped\n", (unsigned)numEntries, (unsigned)stats.Runs_u32,
+                     (unsigned)stats.Dropped_u32);
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckSamples(Test_Drained, numEntries, 2000U, 2U))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_005 - VCD export
+* @details Header, initial values, one time stamp per entry with changes only, unwrap of the
+*          capture time at 2^32 ticks.
+*/
+static uint8 Test_PORT_HW_CAP_005(void)
+{
+    static const PortCaptureVcd_ChannelType channels[2] =
+    {
+        { "PTD0", 0U, 0U },
+        { "PTE15", 1U, 15U }
+    };
+    static const PortHw_CaptureEntryType entries[5] =
+    {
+        { 0x00000000UL, 10U, { 0x0U, 0x8000U } },
+        { 0x0000000AUL, 1U, { 0x1U, 0x8000U } },
+        { 0xFFFFFFF0UL, 1U, { 0x1U, 0x0U } },
+        { 0x00000020UL, 1U, { 0x0U, 0x8000U } },
+        { 0x00000030UL, 1U, { 0x0U, 0x8000U } }
+    };
+    static const char expected[] =
+        "$version Port_CaptureVcd $end\n"
+        "$timescale 1 ps $end\n"
+        "$scope module port $end\n"
+        "$var wire 1 ! PTD0 $end\n"
+        "$var wire 1 \" PTE15 $end\n"
+        "$upscope $end\n"
+        "$enddefinitions $end\n"
+        "#0\n"
+        "$dumpvars\n"
+        "0!\n"
+        "1\"\n"
+        "$end\n"
+        "#10000\n"
+        "1!\n"
+        "#4294967280000\n"
+        "0\"\n"
+        "#4294967328000\n"
+        "0!\n"
+        "1\"\n";
+    char text[sizeof(expected) + 64U];
+    FILE* pFile = tmpfile();
+    size_t length = 0U;
+    uint32 changes = 0U;
+    uint8 result = TEST_PASSED;
+
+    if (NULL_PTR != pFile)
+    {
+        changes = PortCaptureVcd_Write(pFile, channels, 2U, entries, 5U, 1000U);
+        rewind(pFile);
+        length = fread(text, 1U, sizeof(text) - 1U, pFile);
+        (void)fclose(pFile);
+    }
+    text[length] = '\0';
+
+    if ((6U != changes) || (0 != strcmp(text, expected)))
+    {
+        (void)printf("  %u changes, output:\n%s", (unsigned)changes, text);
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_006 - Sample throughput
+* @details Two million back-to-back samples of a constant PTD: one run, one counter read and
+*          one PDIR read per sample. Prints the host sample rate through the simulator and
+*          checks it is above 1 Msample/s.
+*/
+static uint8 Test_PORT_HW_CAP_006(void)
+{
+    PortHw_CaptureConfigType config;
+    PortHw_CaptureStatsType stats;
+    struct timespec start;
+    struct timespec stop;
+    uint32 numEntries;
+    uint32 cycles;
+    uint32 reads;
+    double seconds;
+    double rate;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 1U, TEST_RING_SIZE, 1U);
+    PortHwSim_SetInputHook(NULL_PTR);
+    PortHwSim_SetInput((uint8)TEST_PTD_INDEX, 0x5U);
+    PortHw_CaptureStart(&config);
+    cycles = PortHwSim_g_Cycles_u32;
+    reads = PortHwSim_g_ReadCount_u32;
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    PortHw_CaptureRun(TEST_THROUGHPUT_SAMPLES);
+    (void)clock_gettime(CLOCK_MONOTONIC, &stop);
+    cycles = PortHwSim_g_Cycles_u32 - cycles;
+    reads = PortHwSim_g_ReadCount_u32 - reads;
+    PortHw_CaptureStop();
+    numEntries = PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES);
+    PortHw_CaptureGetStats(&stats);
+
+    seconds = (double)(stop.tv_sec - start.tv_sec) + ((double)(stop.tv_nsec - start.tv_nsec) * 1e-9);
+    rate = (double)TEST_THROUGHPUT_SAMPLES / seconds;
+    (void)printf("  %lu samples in %.3f ms: %.1f Msample/s (host, simulated registers)\n",
+                 (unsigned long)TEST_THROUGHPUT_SAMPLES, seconds * 1e3, rate * 1e-6);
+
+    if ((1U != numEntries) || ((TEST_THROUGHPUT_SAMPLES + 1U) != Test_Drained[0].Length_u32) ||
+        (0x5U != Test_Drained[0].Value_au32[0]) || (TEST_THROUGHPUT_SAMPLES != cycles) ||
+        (TEST_THROUGHPUT_SAMPLES != reads) || ((TEST_THROUGHPUT_SAMPLES + 1U) != stats.Samples_u32))
+    {
+        (void)printf("  %u runs, %u counter reads, %u PDIR reads\n", (unsigned)numEntries, (unsigned)cycles, (unsigned)reads);
+        result = TEST_FAILED;
+    }
+    if (rate < TEST_THROUGHPUT_FLOOR)
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_CAP_007 - Samples further apart than a 24-bit timer period
+* @details 200 samples 2^24 + 1 ticks apart, longer than the largest SysTick period, starting
+*          at half the counter range so that the counter also wraps: every run timestamp is
+*          2^24 + 1 ticks per sample from the capture start.
+*/
+static uint8 Test_PORT_HW_CAP_007(void)
+{
+    PortHw_CaptureConfigType config;
+    uint32 numEntries;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup(&config, 2U, TEST_RING_SIZE, 4U);
+    Test_CounterStart = 0x80000000UL;
+    PortHwSim_g_Cycles_u32 = Test_CounterStart;
+    Test_TicksPerSample = 0x01000001UL;
+    PortHw_CaptureStart(&config);
+    PortHw_CaptureRun(TEST_LONG_SAMPLES - 1U);
+    PortHw_CaptureStop();
+    numEntries = PortHw_CaptureDrain(Test_Drained, TEST_MAX_SAMPLES);
+
+    if ((numEntries != Test_ExpectedRuns(TEST_LONG_SAMPLES, 2U)) ||
+        (TEST_PASSED != Test_CheckSamples(Test_Drained, numEntries, TEST_LONG_SAMPLES, 2U)))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    static const TestCase_Type testCases[] =
+    {
+        { "PORT_HW_CAP_001 lossless RLE, compression ratio", Test_PORT_HW_CAP_001 },
+        { "PORT_HW_CAP_002 timestamps across the counter wrap", Test_PORT_HW_CAP_002 },
+        { "PORT_HW_CAP_003 full ring", Test_PORT_HW_CAP_003 },
+        { "PORT_HW_CAP_004 drain while capturing", Test_PORT_HW_CAP_004 },
+        { "PORT_HW_CAP_005 VCD export", Test_PORT_HW_CAP_005 },
+        { "PORT_HW_CAP_006 sample throughput", Test_PORT_HW_CAP_006 },
+        { "PORT_HW_CAP_007 samples further apart than a timer period", Test_PORT_HW_CAP_007 },
+    };
+    uint32 i;
+    uint32 failed = 0U;
+    uint8 result;
+
+    for (i = 0U; i < (sizeof(testCases) / sizeof(testCases[0])); i++)
+    {
+        (void)printf("[RUN ] %s\n", testCases[i].testName);
+        result = testCases[i].testFunc();
+        (void)printf("[%s] %s\n", (TEST_PASSED == result) ? "PASS" : "FAIL", testCases[i].testName);
+        if (TEST_PASSED != result)
+        {
+            failed++;
+        }
+    }
+
+    (void)printf("%u/%u tests passed\n", (unsigned)(i - failed), (unsigned)i);
+
+    return (0U == failed) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,2265 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host tests for Port_Hw against a simulated register file
+==================================================================================================*/
+
+/**
+*   @file    test_port_hw_host.c
+*
+*   @brief   Host test implementation for Port Hardware Abstraction Layer
+*   @details Runs Port_Hw on a PC against the simulated PORT/GPIO register file of
+*            Test/Stub_Test/Port_Hw_Sim.c and checks register contents and access counts.
+*
+*            Build (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -IBSW/MCAL/Stub/Det -ITest/Stub_Test -ITools/Port_InitScriptGen -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/test_port_hw_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                BSW/MCAL/Config/Port/Port_Hw_VS_0_PBcfg.c BSW/MCAL/Config/Port/Port_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Cfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c Tools/Port_InitScriptGen/Port_InitScriptGen.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*                Board/Driver/HW_Port/Port_Hw_Irq.c BSW/MCAL/Driver/Port/Port.c BSW/MCAL/Stub/Det/Det.c
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw.h"
+#include "Port.h"
+#include "Port_InitScriptGen.h"
+#include "Det.h"
+#include "SchM_Port.h"
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+#include "Port_Hw_Irq.h"
+#endif
+
+/*==================================================================================================
+*                              SOURCE FILE VERSION INFORMATION
+==================================================================================================*/
+#define TEST_PORT_HW_HOST_VENDOR_ID_C                    43
+#define TEST_PORT_HW_HOST_AR_RELEASE_MAJOR_VERSION_C     21
+#define TEST_PORT_HW_HOST_AR_RELEASE_MINOR_VERSION_C     11
+#define TEST_PORT_HW_HOST_AR_RELEASE_REVISION_VERSION_C  0
+#define TEST_PORT_HW_HOST_SW_MAJOR_VERSION_C             1
+#define TEST_PORT_HW_HOST_SW_MINOR_VERSION_C             0
+#define TEST_PORT_HW_HOST_SW_PATCH_VERSION_C             0
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Test result macros
+*/
+#define TEST_PASSED                     (0U)
+#define TEST_FAILED                     (1U)
+
+/**
+* @brief Number of pins of the large board configuration
+*/
+#define TEST_BOARD_PIN_COUNT            (120U)
+
+/**
+* @brief Pins configured on each port of the large board configuration
+*/
+#define TEST_BOARD_PINS_PER_PORT        (24U)
+
+/**
+* @brief Every n-th pin of the large board configuration is critical in the phased init test
+*/
+#define TEST_PHASED_CRITICAL_STRIDE     (10U)
+
+/**
+* @brief Init steps per Port_InitMainFunction() call in the phased init test
+*/
+#define TEST_PHASED_BUDGET              (4U)
+
+/**
+* @brief Slot of the Det stub error records (the stub always reports on core 1)
+*/
+#define TEST_DET_CORE_ID                (1U)
+
+/**
+* @brief Capacity of a mode profile of the board (port halves x distinct PCR values)
+*/
+#define TEST_PROFILE_MAX_CONTROLS       (32U)
+
+/**
+* @brief Fields of a pin of the large board configuration
+*/
+#define TEST_BOARD_PORT(i)              PORT_HW_GET_PORT_U32(Test_BoardPad[(i)])
+#define TEST_BOARD_PIN(i)               PORT_HW_GET_PIN_U32(Test_BoardPad[(i)])
+#define TEST_BOARD_MUX(i)               ((PortHw_MuxType)PORT_HW_PCR_MUX_U32(Test_BoardPcr[(i)]))
+#define TEST_BOARD_DIRECTION(i)         ((PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(Test_BoardFlags[(i)])) ? PORT_PIN_OUT : PORT_PIN_IN)
+#define TEST_BOARD_DIR_CHANGEABLE(i)    (0U != (Test_BoardFlags[(i)] & PORT_PIN_FLAG_DIR_CHANGEABLE_U8))
+#define TEST_BOARD_MODE_CHANGEABLE(i)   (0U != (Test_BoardFlags[(i)] & PORT_PIN_FLAG_MODE_CHANGEABLE_U8))
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Test case descriptor
+*/
+typedef struct
+{
+    const char* testName;           /**< @brief Test case name */
+    uint8 (*testFunc)(void);        /**< @brief Test case function */
+} TestCase_Type;
+
+/**
+* @brief Snapshot of the whole simulated register file
+*/
+typedef struct
+{
+    PORT_Type Port[PORT_HW_SIM_PORT_COUNT_U8];
+    GPIO_Type Gpio[PORT_HW_SIM_PORT_COUNT_U8];
+} TestRegSnapshot_Type;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Large board configuration (built at runtime)
+*/
+static uint32 Test_BoardPcr[TEST_BOARD_PIN_COUNT];
+static uint8 Test_BoardPad[TEST_BOARD_PIN_COUNT];
+static uint8 Test_BoardFlags[TEST_BOARD_PIN_COUNT];
+static const PortHw_PinTableType Test_BoardTable = { Test_BoardPcr, Test_BoardPad, Test_BoardFlags };
+
+/**
+* @brief Init script buffer
+*/
+static PortHw_InitScriptEntryType Test_ScriptEntries[PORT_INITSCRIPTGEN_MAX_ENTRIES_U32];
+
+/**
+* @brief Handles and unused pads of the board
+*/
+static Port_PinHandleType Test_BoardPinHandle[TEST_BOARD_PIN_COUNT];
+static uint32 Test_BoardUnusedMask[PORT_HW_PORT_COUNT_U8];
+
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/**
+* @brief Pin groups of the board: direction changeable pins of every port (group 0) and
+*        the same pins declared with a fixed direction (group 1)
+*/
+static PortHw_PinMaskType Test_BoardGroupMasks[PORT_HW_PORT_COUNT_U8];
+static Port_PinGroupConfigType Test_BoardPinGroup[2];
+#endif
+
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/**
+* @brief Mode profiles of the board: mode changeable GPIO pins to ALT2 (profile 0) and back
+*        to their configured mode (profile 1), at most one write per port half and PCR value
+*/
+static PortHw_GlobalPinControlType Test_BoardProfileControls[2][TEST_PROFILE_MAX_CONTROLS];
+static Port_ModeProfileConfigType Test_BoardModeProfile[2];
+#endif
+
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief Sleep profile of the board and the run/sleep switch scripts
+*/
+static uint32 Test_BoardSleepPcr[TEST_BOARD_PIN_COUNT];
+static uint8 Test_BoardSleepFlags[TEST_BOARD_PIN_COUNT];
+static const PortHw_PinTableType Test_BoardSleepTable = { Test_BoardSleepPcr, Test_BoardPad, Test_BoardSleepFlags };
+static PortHw_InitScriptEntryType Test_SwitchEntries[2][PORT_INITSCRIPTGEN_MAX_ENTRIES_U32];
+static PortHw_InitScriptType Test_SwitchScript[2];
+static Port_ProfileSwitchConfigType Test_BoardProfileSwitch[2];
+#endif
+
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/**
+* @brief Channel groups of the board: 8-bit input bus on PTB4-11, 16-bit output bus on PTC8-23
+*/
+static const PortHw_ChannelGroupType Test_BoardChannelGroup[2] =
+{
+    { IP_PTB, (uint32)0x00000FF0U, (uint8)4U },
+    { IP_PTC, (uint32)0x00FFFF00U, (uint8)8U }
+};
+#endif
+
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief Debounce ports of the board: all of PTA, 8 switches on PTE
+*/
+#define TEST_DEBOUNCE_PORTS             (2U)
+#define TEST_DEBOUNCE_TICKS             (20000U)
+#define TEST_DEBOUNCE_PINS              (40U)
+
+static const PortHw_PinMaskType Test_BoardDebounce[TEST_DEBOUNCE_PORTS] =
+{
+    { IP_PTA, (uint32)0xFFFFFFFFU },
+    { IP_PTE, (uint32)0x00FF0000U }
+};
+
+/**
+* @brief Port index of each debounce port in the simulated register file
+*/
+static const uint8 Test_DebouncePortIndex[TEST_DEBOUNCE_PORTS] = { 0U, 4U };
+
+/**
+* @brief RAM debounce state of the board
+*/
+static PortHw_DebounceStateType Test_BoardDebounceState[TEST_DEBOUNCE_PORTS];
+#endif
+
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/**
+* @brief Digital filter ports of the board: bus clock on PTB, LPO_CLK on PTD and PTE
+*/
+#define TEST_FILTER_PORTS               (3U)
+
+static const PortHw_DigitalFilterConfigType Test_BoardFilter[TEST_FILTER_PORTS] =
+{
+    { IP_PORTB, (uint32)0x000000F0U, PORT_HW_DIGITAL_FILTER_BUS_CLOCK, (uint8)5U },
+    { IP_PORTD, (uint32)0x00C00003U, PORT_HW_DIGITAL_FILTER_LPO_CLOCK, PORT_HW_DIGITAL_FILTER_WIDTH_MAX_U8 },
+    { IP_PORTE, (uint32)0x00000001U, PORT_HW_DIGITAL_FILTER_LPO_CLOCK, (uint8)0U }
+};
+
+/**
+* @brief Port index of each digital filter port in the simulated register file
+*/
+static const uint8 Test_FilterPortIndex[TEST_FILTER_PORTS] = { 1U, 3U, 4U };
+#endif
+
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+/**
+* @brief Pin notification test: port and number of random flag patterns
+*/
+#define TEST_IRQ_PORT                   (2U)
+#define TEST_IRQ_ROUNDS                 (2000U)
+
+/**
+* @brief Notifications called by the dispatcher, in call order (one per port pin)
+*/
+static uint8 Test_IrqLog[PORT_HW_PINS_PER_PORT_U8 * 2U];
+static uint32 Test_IrqLogCount;
+
+/**
+* @brief Pin whose notification flags it again (PORT_HW_PINS_PER_PORT_U8: none)
+*/
+static uint32 Test_IrqRelatchPin = PORT_HW_PINS_PER_PORT_U8;
+
+#define TEST_IRQ_NOTIFICATION(n) \
+    static void Test_IrqNotification##n(void) \
+    { \
+        if (Test_IrqLogCount < (sizeof(Test_IrqLog) / sizeof(Test_IrqLog[0]))) \
+        { \
+            Test_IrqLog[Test_IrqLogCount] = (uint8)(n); \
+        } \
+        Test_IrqLogCount++; \
+        if ((uint32)(n) == Test_IrqRelatchPin) \
+        { \
+            PortHwSim_SetInterruptFlags(TEST_IRQ_PORT, 1UL << (n)); \
+        } \
+    }
+
+TEST_IRQ_NOTIFICATION(0)  TEST_IRQ_NOTIFICATION(1)  TEST_IRQ_NOTIFICATION(2)  TEST_IRQ_NOTIFICATION(3)
+TEST_IRQ_NOTIFICATION(4)  TEST_IRQ_NOTIFICATION(5)  TEST_IRQ_NOTIFICATION(6)  TEST_IRQ_NOTIFICATION(7)
+TEST_IRQ_NOTIFICATION(8)  TEST_IRQ_NOTIFICATION(9)  TEST_IRQ_NOTIFICATION(10) TEST_IRQ_NOTIFICATION(11)
+TEST_IRQ_NOTIFICATION(12) TEST_IRQ_NOTIFICATION(13) TEST_IRQ_NOTIFICATION(14) TEST_IRQ_NOTIFICATION(15)
+TEST_IRQ_NOTIFICATION(16) TEST_IRQ_NOTIFICATION(17) TEST_IRQ_NOTIFICATION(18) TEST_IRQ_NOTIFICATION(19)
+TEST_IRQ_NOTIFICATION(20) TEST_IRQ_NOTIFICATION(21) TEST_IRQ_NOTIFICATION(22) TEST_IRQ_NOTIFICATION(23)
+TEST_IRQ_NOTIFICATION(24) TEST_IRQ_NOTIFICATION(25) TEST_IRQ_NOTIFICATION(26) TEST_IRQ_NOTIFICATION(27)
+TEST_IRQ_NOTIFICATION(28) TEST_IRQ_NOTIFICATION(29) TEST_IRQ_NOTIFICATION(30) TEST_IRQ_NOTIFICATION(31)
+
+/**
+* @brief Notification of every port pin
+*/
+static const Port_PinNotificationType Test_IrqNotification[PORT_HW_PINS_PER_PORT_U8] =
+{
+    Test_IrqNotification0,  Test_IrqNotification1,  Test_IrqNotification2,  Test_IrqNotification3,
+    Test_IrqNotification4,  Test_IrqNotification5,  Test_IrqNotification6,  Test_IrqNotification7,
+    Test_IrqNotification8,  Test_IrqNotification9,  Test_IrqNotification10, Test_IrqNotification11,
+    Test_IrqNotification12, Test_IrqNotification13, Test_IrqNotification14, Test_IrqNotification15,
+    Test_IrqNotification16, Test_IrqNotification17, Test_IrqNotification18, Test_IrqNotification19,
+    Test_IrqNotification20, Test_IrqNotification21, Test_IrqNotification22, Test_IrqNotification23,
+    Test_IrqNotification24, Test_IrqNotification25, Test_IrqNotification26, Test_IrqNotification27,
+    Test_IrqNotification28, Test_IrqNotification29, Test_IrqNotification30, Test_IrqNotification31
+};
+#endif
+
+/**
+* @brief Register snapshots for comparisons
+*/
+static TestRegSnapshot_Type Test_SnapshotRef;
+static TestRegSnapshot_Type Test_SnapshotDut;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void Test_BuildBoardConfig(void);
+static void Test_TakeSnapshot(TestRegSnapshot_Type* pSnapshot);
+static void Test_BuildBoardUnusedMask(void);
+static void Test_BuildBoardPortConfig(Port_ConfigType* pConfig, const Port_UnUsedPinConfigType* pUnused);
+static void Test_UnusedPinsPerPad(const uint32 padMask[], const PortHw_UnusedPinConfigType* pUnused);
+static boolean Test_PadSupportsMode(uint32 pad, uint32 mode);
+static uint8 Test_PORT_HW_HT_001(void);    /* Grouped PCR init: fewer writes, same state */
+static uint8 Test_PORT_HW_HT_002(void);    /* PB config carries consistent PCR words */
+static uint8 Test_PORT_HW_HT_003(void);    /* Aggregated GPIO init: one write set per port */
+static uint8 Test_PORT_HW_HT_004(void);    /* Unused pads from per-port masks */
+static uint8 Test_PORT_HW_HT_005(void);    /* Init script replay matches PortHw_Init */
+static uint8 Test_PORT_HW_HT_006(void);    /* Phased init: critical pins first, bounded slices */
+static uint8 Test_PORT_HW_HT_007(void);    /* Warm init: only mismatching registers rewritten */
+static uint8 Test_PORT_HW_HT_008(void);    /* Runtime services through the pin handle table */
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+static uint8 Test_PORT_HW_HT_009(void);    /* Bit-band direction updates: no read, no lock */
+#endif
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+static uint8 Test_PORT_HW_HT_010(void);    /* Pin group direction: one masked write per port */
+#endif
+static uint8 Test_PORT_HW_HT_011(void);    /* Pad mode validation against the pin description table */
+static uint8 Test_PORT_HW_HT_012(void);    /* Direction refresh: one masked write per port */
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+static uint8 Test_PORT_HW_HT_013(void);    /* Mode profiles: one GPCLR/GPCHR write per port half */
+static uint8 Test_AddProfileControl(PortHw_GlobalPinControlType controls[], uint8 numControls, uint32 pin, uint32 mode);
+#endif
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+static uint8 Test_PORT_HW_HT_014(void);    /* Profile switch: generated delta reaches the target profile */
+#endif
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+static uint8 Test_PORT_HW_HT_015(void);    /* Channel groups: one PDIR read, one PSOR/PCOR pair */
+#endif
+#if (STD_ON == PORT_DEBOUNCE_API)
+static uint8 Test_PORT_HW_HT_016(void);    /* Debounce: vertical counters match a per-pin reference */
+static uint32 Test_Random(uint32* pSeed);
+#endif
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+static uint8 Test_PORT_HW_HT_017(void);    /* Pin notifications: one ISFR read/write, one step per flag */
+#endif
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+static uint8 Test_PORT_HW_HT_018(void);    /* Digital filter: DFCR/DFWR/DFER from the configuration */
+#endif
+static uint8 Test_PORT_HW_HT_019(void);    /* Exclusive areas: nested entries by the holding context */
+#if (STD_ON == PORT_PIN_NOTIFICATION_API) && (STD_ON == PORT_SET_PIN_MODE_API)
+static uint8 Test_PORT_HW_HT_020(void);    /* Mode change keeps a pending pin flag */
+#endif
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Build a 120-pin configuration spread over the five ports
+* @details Pins use a handful of typical settings (GPIO out low/high, GPIO in with pull-up,
+*          ALT2/ALT3 peripheral pins) so that many pins share a PCR value.
+*/
+static void Test_BuildBoardConfig(void)
+{
+    uint32 i;
+    uint32 port;
+    PortHw_MuxType mux;
+    PortHw_DirectionType direction;
+    PortHw_PullConfigType pull;
+    PortHw_DriveStrengthType drive;
+    uint8 level;
+
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        port = i / TEST_BOARD_PINS_PER_PORT;
+        Test_BoardPad[i] = PORT_HW_PAD_ID_U8(port, (i % TEST_BOARD_PINS_PER_PORT) + (port & 1U) * 4U);
+        drive = PORT_HW_DRIVE_STRENGTH_LOW;
+        level = 0U;
+
+        switch (i % 5U)
+        {
+            case 0U:
+                mux = PORT_HW_MUX_AS_GPIO;
+                direction = PORT_HW_PIN_OUT;
+                pull = PORT_HW_PULL_NOT_ENABLED;
+                break;
+            case 1U:
+                mux = PORT_HW_MUX_AS_GPIO;
+                direction = PORT_HW_PIN_OUT;
+                pull = PORT_HW_PULL_NOT_ENABLED;
+                drive = PORT_HW_DRIVE_STRENGTH_HIGH;
+                level = 1U;
+                break;
+            case 2U:
+                mux = PORT_HW_MUX_AS_GPIO;
+                direction = PORT_HW_PIN_IN;
+                pull = PORT_HW_PULL_UP_ENABLED;
+                break;
+            case 3U:
+                mux = PORT_HW_MUX_ALT2;
+                direction = PORT_HW_PIN_DISABLED;
+                pull = PORT_HW_PULL_NOT_ENABLED;
+                break;
+            default:
+                mux = PORT_HW_MUX_ALT3;
+                direction = PORT_HW_PIN_DISABLED;
+                pull = PORT_HW_PULL_DOWN_ENABLED;
+                break;
+        }
+
+        Test_BoardPcr[i] = PORT_HW_PCR_VALUE(pull, drive, PORT_HW_LOCK_DISABLED, mux);
+        Test_BoardFlags[i] = PORT_HW_PIN_FLAGS_U8(mux, direction, level);
+    }
+}
+
+/**
+* @brief Unused pads of the large board configuration: every pad it does not configure
+*/
+static void Test_BuildBoardUnusedMask(void)
+{
+    uint32 i;
+
+    (void)memset(Test_BoardUnusedMask, 0xFF, sizeof(Test_BoardUnusedMask));
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        Test_BoardUnusedMask[i / TEST_BOARD_PINS_PER_PORT] &= ~(1UL << TEST_BOARD_PIN(i));
+    }
+}
+
+/**
+* @brief Port level configuration of the large board
+* @details Every tenth pin is critical, every third pin has a fixed direction and every
+*          fourth pin a fixed mode. All pads the board does not use are unused pads.
+*/
+static void Test_BuildBoardPortConfig(Port_ConfigType* pConfig, const Port_UnUsedPinConfigType* pUnused)
+{
+    uint32 i;
+
+    Test_BuildBoardConfig();
+    Test_BuildBoardUnusedMask();
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (0U != (i % 3U))
+        {
+            Test_BoardFlags[i] |= PORT_PIN_FLAG_DIR_CHANGEABLE_U8;
+        }
+        if (0U != (i % 4U))
+        {
+            Test_BoardFlags[i] |= PORT_PIN_FLAG_MODE_CHANGEABLE_U8;
+        }
+        Test_BoardFlags[i] |= (0U == (i % TEST_PHASED_CRITICAL_STRIDE)) ? PORT_PIN_PRIORITY_CRITICAL_U8 : PORT_PIN_PRIORITY_DEFERRED_U8;
+    }
+
+    pConfig->NumPins_u16 = (uint16)TEST_BOARD_PIN_COUNT;
+    pConfig->NumUnusedPins_u16 = (uint16)(PORT_HW_PORT_COUNT_U8 * (PORT_HW_PINS_PER_PORT_U8 - TEST_BOARD_PINS_PER_PORT));
+    pConfig->UnusedPadMask_ptr = Test_BoardUnusedMask;
+    pConfig->UnusedPadConfig_ptr = pUnused;
+    pConfig->PinTable_ptr = &Test_BoardTable;
+    pConfig->InitScript_ptr = NULL_PTR;
+    pConfig->PinHandle_ptr = Test_BoardPinHandle;
+    pConfig->NumPinGroups_u16 = 0U;
+    pConfig->PinGroupConfig_ptr = NULL_PTR;
+    pConfig->NumModeProfiles_u16 = 0U;
+    pConfig->ModeProfileConfig_ptr = NULL_PTR;
+    pConfig->NumProfileSwitches_u16 = 0U;
+    pConfig->ProfileSwitchConfig_ptr = NULL_PTR;
+    pConfig->NumChannelGroups_u16 = 0U;
+    pConfig->ChannelGroupConfig_ptr = NULL_PTR;
+    pConfig->NumDebouncePorts_u16 = 0U;
+    pConfig->DebounceConfig_ptr = NULL_PTR;
+    pConfig->DebounceState_ptr = NULL_PTR;
+    pConfig->NumDigitalFilterPorts_u8 = 0U;
+    pConfig->DigitalFilterConfig_ptr = NULL_PTR;
+}
+
+/**
+* @brief Copy the simulated register file
+*/
+static void Test_TakeSnapshot(TestRegSnapshot_Type* pSnapshot)
+{
+    (void)memcpy(pSnapshot->Port, PortHwSim_g_PortRegs_ast, sizeof(pSnapshot->Port));
+    (void)memcpy(pSnapshot->Gpio, PortHwSim_g_GpioRegs_ast, sizeof(pSnapshot->Gpio));
+}
+
+/**
+* @brief Look up a pad mode in the generated pin description table
+*/
+static boolean Test_PadSupportsMode(uint32 pad, uint32 mode)
+{
+    return (0U != (Port_au16PinDescription[mode][pad / 16U] & (1U << (pad % 16U)))) ? TRUE : FALSE;
+}
+
+/**
+* @brief Reference unused pin initialization, one pad at a time
+* @details Register sequence of the former pad-list implementation: PSOR/PCOR, PDDR and PIDR
+*          read-modify-writes and a full PCR write for every pad.
+*/
+static void Test_UnusedPinsPerPad(const uint32 padMask[], const PortHw_UnusedPinConfigType* pUnused)
+{
+    uint32 port;
+    uint32 pin;
+    uint32 mask;
+    GPIO_Type* pGpio;
+
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        pGpio = PortHw_g_GpioBaseAddr_ptr[port];
+        for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+        {
+            mask = (1UL << pin);
+            if (0U != (padMask[port] & mask))
+            {
+                if (PORT_HW_PIN_OUT == pUnused->Direction_en)
+                {
+                    PORT_HW_REG_WRITE32((1U == pUnused->OutputValue_u8) ? &pGpio->PSOR : &pGpio->PCOR, mask);
+                    PORT_HW_REG_WRITE32(&pGpio->PDDR, PORT_HW_REG_READ32(&pGpio->PDDR) | mask);
+                }
+                else
+                {
+                    PORT_HW_REG_WRITE32(&pGpio->PDDR, PORT_HW_REG_READ32(&pGpio->PDDR) & ~mask);
+                    PORT_HW_REG_WRITE32(&pGpio->PIDR, PORT_HW_REG_READ32(&pGpio->PIDR) & ~mask);
+                }
+                PORT_HW_REG_WRITE32(&PortHw_g_PortBaseAddr_ptr[port]->PCR[pin], pUnused->PinControlRegister_u32);
+            }
+        }
+    }
+}
+
+/**
+* @brief PORT_HW_HT_001 - Grouped PCR initialization
+* @details Reference: one PortHw_InitPin() call per pin, i.e. one PCR write per pin.
+*          DUT: one PortHw_Init() call for the whole board, PCRs written via GPCLR/GPCHR.
+*          End state must be identical and the DUT must need fewer register writes.
+*/
+static uint8 Test_PORT_HW_HT_001(void)
+{
+    uint32 i;
+    uint32 writesPerPin;
+    uint32 writesGrouped;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardConfig();
+
+    /* Reference: per-pin initialization */
+    PortHwSim_Reset();
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        PortHw_InitPin(&Test_BoardTable, i);
+    }
+    writesPerPin = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* DUT: grouped initialization */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardTable, 0U, NULL_PTR, NULL_PTR);
+    writesGrouped = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+
+    (void)printf("    %u pins: per-pin %u writes, grouped %u writes\n",
+                 (unsigned)TEST_BOARD_PIN_COUNT, (unsigned)writesPerPin, (unsigned)writesGrouped);
+
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+#if (STD_ON == PORT_HW_GROUPED_PCR_INIT)
+    if (writesGrouped >= writesPerPin)
+    {
+        result = TEST_FAILED;
+    }
+#endif
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_002 - Pin table of the post-build configuration
+* @details The GPIO flag of every pin of Port_Config_VS_0 must match the MUX field of its PCR
+*          word, and PortHw_Init() must copy the word unchanged to the PCR of its pad.
+*/
+static uint8 Test_PORT_HW_HT_002(void)
+{
+    uint32 i;
+    const PortHw_PinTableType* pTable = Port_Config_VS_0.PinTable_ptr;
+    uint32 pad;
+    uint8 result = TEST_PASSED;
+
+    PortHwSim_Reset();
+    PortHw_Init(NUM_OF_CONFIGURED_PINS, pTable, 0U, NULL_PTR, NULL_PTR);
+
+    for (i = 0U; i < NUM_OF_CONFIGURED_PINS; i++)
+    {
+        pad = pTable->PadId_ptr[i];
+        if (((uint32)PORT_HW_MUX_AS_GPIO == PORT_HW_PCR_MUX_U32(pTable->Pcr_ptr[i])) !=
+            (0U != (pTable->Flags_ptr[i] & PORT_HW_PIN_FLAG_GPIO_U8)))
+        {
+            result = TEST_FAILED;
+        }
+        if (pTable->Pcr_ptr[i] != PortHw_g_PortBaseAddr_ptr[PORT_HW_GET_PORT_U32(pad)]->PCR[PORT_HW_GET_PIN_U32(pad)])
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_003 - Aggregated GPIO initialization
+* @details Same reference as PORT_HW_HT_001. The whole-board init must reach the same state
+*          with at most four GPIO writes (PSOR, PCOR, PDDR, PIDR) per port.
+*/
+static uint8 Test_PORT_HW_HT_003(void)
+{
+    uint32 i;
+    uint32 gpioWritesPerPin;
+    uint32 gpioWritesAggregated;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardConfig();
+
+    /* Reference: per-pin initialization */
+    PortHwSim_Reset();
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        PortHw_InitPin(&Test_BoardTable, i);
+    }
+    gpioWritesPerPin = PortHwSim_g_GpioWriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* DUT: whole-board initialization */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardTable, 0U, NULL_PTR, NULL_PTR);
+    gpioWritesAggregated = PortHwSim_g_GpioWriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+
+    (void)printf("    %u pins: per-pin %u GPIO writes, aggregated %u GPIO writes\n",
+                 (unsigned)TEST_BOARD_PIN_COUNT, (unsigned)gpioWritesPerPin, (unsigned)gpioWritesAggregated);
+
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+#if (STD_ON == PORT_HW_AGGREGATED_GPIO_INIT)
+    if (gpioWritesAggregated > (4U * PORT_HW_PORT_COUNT_U8))
+    {
+        result = TEST_FAILED;
+    }
+#endif
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_004 - Unused pads from per-port masks
+* @details The unused pads of Port_Config_VS_0 are initialized as input and as output (high
+*          and low) and compared with the per-pad reference sequence.
+*/
+static uint8 Test_PORT_HW_HT_004(void)
+{
+    static const uint8 outputValues[2] = { 0U, 1U };
+    PortHw_UnusedPinConfigType unusedCfg;
+    uint32 writesPerPad;
+    uint32 writesMask;
+    uint32 i;
+    uint8 result = TEST_PASSED;
+
+    for (i = 0U; i < 3U; i++)
+    {
+        unusedCfg.PinControlRegister_u32 = Port_Config_VS_0.UnusedPadConfig_ptr->PinControlRegister_u32;
+        unusedCfg.Direction_en = (0U == i) ? PORT_HW_PIN_IN : PORT_HW_PIN_OUT;
+        unusedCfg.OutputValue_u8 = outputValues[i & 1U];
+
+        PortHwSim_Reset();
+        Test_UnusedPinsPerPad(Port_Config_VS_0.UnusedPadMask_ptr, &unusedCfg);
+        writesPerPad = PortHwSim_g_WriteCount_u32;
+        Test_TakeSnapshot(&Test_SnapshotRef);
+
+        PortHwSim_Reset();
+        PortHw_Init(0U, &Test_BoardTable, Port_Config_VS_0.NumUnusedPins_u16,
+                    Port_Config_VS_0.UnusedPadMask_ptr, &unusedCfg);
+        writesMask = PortHwSim_g_WriteCount_u32;
+        Test_TakeSnapshot(&Test_SnapshotDut);
+
+        (void)printf("    %u unused pads (dir %u, level %u): per-pad %u writes, masks %u writes\n",
+                     (unsigned)Port_Config_VS_0.NumUnusedPins_u16, (unsigned)unusedCfg.Direction_en,
+                     (unsigned)unusedCfg.OutputValue_u8,
+                     (unsigned)writesPerPad, (unsigned)writesMask);
+
+        if ((0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))) ||
+            (writesMask > (4U * PORT_HW_PORT_COUNT_U8)))
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_005 - Init script replay
+* @details The script generated from a configuration and replayed from reset must give the
+*          register state of PortHw_Init(). Checked for the 120-pin board (one pin with IRQC
+*          set, so it needs a PCR write) and for Port_Config_VS_0 with its committed script.
+*/
+static uint8 Test_PORT_HW_HT_005(void)
+{
+    PortHw_InitScriptType script;
+    uint32 writesInit;
+    uint32 writesScript;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardConfig();
+    Test_BoardPcr[7] |= PORT_PCR_IRQC(9U);
+
+    /* Board: PortHw_Init vs generated script */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardTable, 0U, NULL_PTR, NULL_PTR);
+    writesInit = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    script.NumEntries_u32 = PortInitScriptGen_Build(TEST_BOARD_PIN_COUNT, &Test_BoardTable, NULL_PTR, NULL_PTR, Test_ScriptEntries);
+    script.Entries_ptr = Test_ScriptEntries;
+    PortHwSim_Reset();
+    PortHw_InitScriptReplay(&script);
+    writesScript = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+
+    (void)printf("    board: PortHw_Init %u writes, script %u writes\n", (unsigned)writesInit, (unsigned)writesScript);
+    if ((0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))) || (writesScript > writesInit))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Port_Config_VS_0: PortHw_Init vs committed script */
+    PortHwSim_Reset();
+    PortHw_Init(Port_Config_VS_0.NumPins_u16, Port_Config_VS_0.PinTable_ptr, Port_Config_VS_0.NumUnusedPins_u16,
+                Port_Config_VS_0.UnusedPadMask_ptr, (const PortHw_UnusedPinConfigType*)Port_Config_VS_0.UnusedPadConfig_ptr);
+    writesInit = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    PortHwSim_Reset();
+    PortHw_InitScriptReplay(Port_Config_VS_0.InitScript_ptr);
+    writesScript = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+
+    (void)printf("    VS_0:  PortHw_Init %u writes, script %u writes\n", (unsigned)writesInit, (unsigned)writesScript);
+    if ((0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))) || (writesScript > writesInit))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_006 - Phased initialization
+* @details Every tenth pin of the 120-pin board is critical, the pads the board does not use
+*          are unused pads. After Port_InitCritical() only the critical pins are configured.
+*          Port_InitMainFunction() must then need one call per TEST_PHASED_BUDGET steps and
+*          end in the register state of a full PortHw_Init().
+*/
+static uint8 Test_PORT_HW_HT_006(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    uint32 i;
+    uint32 port;
+    uint32 pcr;
+    uint32 steps;
+    uint32 calls = 0U;
+    uint32 expectedCalls;
+    boolean done = FALSE;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    steps = PORT_HW_PORT_COUNT_U8;
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (PORT_PIN_PRIORITY_CRITICAL_U8 != (Test_BoardFlags[i] & PORT_PIN_FLAG_PRIORITY_MASK_U8))
+        {
+            steps++;
+        }
+    }
+    expectedCalls = (steps + TEST_PHASED_BUDGET - 1U) / TEST_PHASED_BUDGET;
+
+    /* Reference: full initialization */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardTable, config.NumUnusedPins_u16, Test_BoardUnusedMask,
+                (const PortHw_UnusedPinConfigType*)&unusedCfg);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* Critical pins only */
+    PortHwSim_Reset();
+    Port_InitCritical(&config);
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        port = i / TEST_BOARD_PINS_PER_PORT;
+        pcr = PortHwSim_g_PortRegs_ast[port].PCR[TEST_BOARD_PIN(i)];
+        if (((0U == (i % TEST_PHASED_CRITICAL_STRIDE)) && (pcr != Test_BoardPcr[i])) ||
+            ((0U != (i % TEST_PHASED_CRITICAL_STRIDE)) && (0U != pcr)))
+        {
+            result = TEST_FAILED;
+        }
+    }
+    (void)printf("    critical: %u writes for %u pins\n", (unsigned)PortHwSim_g_WriteCount_u32,
+                 (unsigned)(TEST_BOARD_PIN_COUNT - (steps - PORT_HW_PORT_COUNT_U8)));
+
+    /* Deferred pins and unused pads in slices */
+    while ((FALSE == done) && (calls <= expectedCalls))
+    {
+        done = Port_InitMainFunction((uint16)TEST_PHASED_BUDGET);
+        calls++;
+    }
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    (void)printf("    deferred: %u steps in %u calls of budget %u\n", (unsigned)steps, (unsigned)calls, (unsigned)TEST_PHASED_BUDGET);
+
+    if ((calls != expectedCalls) || (TRUE != Port_InitMainFunction((uint16)TEST_PHASED_BUDGET)) ||
+        (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_007 - Warm initialization
+* @details The 120-pin board with unused pads as outputs (level 1) is initialized cold. A warm
+*          init on top must write nothing and skip every write. After disturbing three PCRs
+*          (one with ISF set, which is not compared), one PDDR bit and one output level, it
+*          must write exactly the disturbed registers. From reset it must reach the cold state.
+*/
+static uint8 Test_PORT_HW_HT_007(void)
+{
+    PortHw_UnusedPinConfigType unusedCfg = { 0x00000100U, PORT_HW_PIN_OUT, 1U };
+    uint32 unusedCount = PORT_HW_PORT_COUNT_U8 * (PORT_HW_PINS_PER_PORT_U8 - TEST_BOARD_PINS_PER_PORT);
+    uint32 skipped;
+    uint32 writes;
+    uint32 allWrites;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardConfig();
+    Test_BuildBoardUnusedMask();
+
+    /* Cold reference */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardTable, (uint16)unusedCount, Test_BoardUnusedMask, &unusedCfg);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* Warm init of an already configured device */
+    PortHwSim_ClearCounters();
+    allWrites = PortHw_InitWarm(TEST_BOARD_PIN_COUNT, &Test_BoardTable, (uint16)unusedCount, Test_BoardUnusedMask, &unusedCfg);
+    writes = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    (void)printf("    unchanged: %u writes, %u skipped, %u reads\n", (unsigned)writes, (unsigned)allWrites,
+                 (unsigned)PortHwSim_g_ReadCount_u32);
+    if ((0U != writes) || (allWrites < (TEST_BOARD_PIN_COUNT + unusedCount)) ||
+        (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Disturbed registers */
+    PortHwSim_g_PortRegs_ast[0].PCR[3] ^= PORT_PCR_DSE_MASK;
+    PortHwSim_g_PortRegs_ast[2].PCR[30] = 0U;
+    PortHwSim_g_PortRegs_ast[4].PCR[5] |= PORT_PCR_ISF_MASK;
+    PortHwSim_g_GpioRegs_ast[1].PDDR &= ~(1UL << 5U);
+    PortHwSim_g_GpioRegs_ast[3].PDOR &= ~(1UL << 31U);
+    Test_SnapshotRef.Port[4].PCR[5] |= PORT_PCR_ISF_MASK;
+    PortHwSim_ClearCounters();
+    skipped = PortHw_InitWarm(TEST_BOARD_PIN_COUNT, &Test_BoardTable, (uint16)unusedCount, Test_BoardUnusedMask, &unusedCfg);
+    writes = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    (void)printf("    disturbed: %u writes, %u skipped\n", (unsigned)writes, (unsigned)skipped);
+    if ((4U != writes) || ((skipped + writes) != allWrites) ||
+        (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type))))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* From reset */
+    Test_SnapshotRef.Port[4].PCR[5] &= ~PORT_PCR_ISF_MASK;
+    PortHwSim_Reset();
+    skipped = PortHw_InitWarm(TEST_BOARD_PIN_COUNT, &Test_BoardTable, (uint16)unusedCount, Test_BoardUnusedMask, &unusedCfg);
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    (void)printf("    reset:     %u writes, %u skipped\n", (unsigned)PortHwSim_g_WriteCount_u32, (unsigned)skipped);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_008 - Runtime services through the pin handle table
+* @details After Port_Init() every handle must match its configuration. Direction and mode
+*          changes must hit exactly the pin of the handle and be refused for fixed pins, and
+*          Port_RefreshPortDirection() must restore the fixed directions.
+*/
+static uint8 Test_PORT_HW_HT_008(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    const Port_PinHandleType* pHandle;
+    uint32 i;
+    uint32 port;
+    uint32 pddr;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    PortHwSim_Reset();
+    Port_Init(&config);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        pHandle = &Test_BoardPinHandle[i];
+        if ((pHandle->GpioBase_ptr != PortHw_g_GpioBaseAddr_ptr[TEST_BOARD_PORT(i)]) ||
+            (pHandle->PortBase_ptr != PortHw_g_PortBaseAddr_ptr[TEST_BOARD_PORT(i)]) ||
+            (pHandle->PinMask_u32 != (1UL << TEST_BOARD_PIN(i))) || (pHandle->PinPortIndex_u8 != TEST_BOARD_PIN(i)) ||
+            (pHandle->InitMux_u8 != (uint8)TEST_BOARD_MUX(i)) ||
+            ((0U != (pHandle->Flags_u8 & PORT_PIN_HANDLE_DIR_CHANGEABLE_U8)) != TEST_BOARD_DIR_CHANGEABLE(i)) ||
+            ((0U != (pHandle->Flags_u8 & PORT_PIN_HANDLE_MODE_CHANGEABLE_U8)) != TEST_BOARD_MODE_CHANGEABLE(i)) ||
+            ((0U != (pHandle->Flags_u8 & PORT_PIN_HANDLE_DIR_OUT_U8)) != (PORT_PIN_OUT == TEST_BOARD_DIRECTION(i))))
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    /* Flip every direction: only changeable pins may follow */
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        port = i / TEST_BOARD_PINS_PER_PORT;
+        pddr = PortHwSim_g_GpioRegs_ast[port].PDDR;
+        Port_SetPinDirection((Port_PinType)i, (0U != (pddr & Test_BoardPinHandle[i].PinMask_u32)) ? PORT_PIN_IN : PORT_PIN_OUT);
+        if (TEST_BOARD_DIR_CHANGEABLE(i) ?
+            ((PortHwSim_g_GpioRegs_ast[port].PDDR ^ pddr) != Test_BoardPinHandle[i].PinMask_u32) :
+            (PortHwSim_g_GpioRegs_ast[port].PDDR != pddr))
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    /* Move every pin to ALT7: only changeable pins with an ALT7 function may follow */
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        Port_SetPinMode((Port_PinType)i, (Port_PinModeType)7U);
+        if (((PortHwSim_g_PortRegs_ast[i / TEST_BOARD_PINS_PER_PORT].PCR[TEST_BOARD_PIN(i)] & PORT_PCR_MUX_MASK) ==
+             PORT_PCR_MUX(7U)) != (TEST_BOARD_MODE_CHANGEABLE(i) &&
+                                   (TRUE == Test_PadSupportsMode(Test_BoardPad[i], 7U))))
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    /* Restore the modes; fixed directions are refreshed, changeable ones flipped back */
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TRUE == Test_PadSupportsMode(Test_BoardPad[i], (uint32)TEST_BOARD_MUX(i)))
+        {
+            Port_SetPinMode((Port_PinType)i, (Port_PinModeType)TEST_BOARD_MUX(i));
+        }
+        else
+        {
+            /* The synthetic board uses a mode the pad does not have: restore by hand */
+            PortHw_SetMuxModeSel(PortHw_g_PortBaseAddr_ptr[TEST_BOARD_PORT(i)], TEST_BOARD_PIN(i), TEST_BOARD_MUX(i));
+        }
+        if (TEST_BOARD_DIR_CHANGEABLE(i))
+        {
+            Port_SetPinDirection((Port_PinType)i, TEST_BOARD_DIRECTION(i));
+        }
+    }
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        PortHwSim_g_GpioRegs_ast[port].PDDR = ~PortHwSim_g_GpioRegs_ast[port].PDDR;
+    }
+    Port_RefreshPortDirection();
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TEST_BOARD_DIR_CHANGEABLE(i))
+        {
+            /* Not refreshed: put the configured direction back by hand */
+            PortHwSim_g_GpioRegs_ast[i / TEST_BOARD_PINS_PER_PORT].PDDR ^= Test_BoardPinHandle[i].PinMask_u32;
+        }
+    }
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        /* Unused pads are not refreshed either */
+        PortHwSim_g_GpioRegs_ast[port].PDDR = (PortHwSim_g_GpioRegs_ast[port].PDDR & ~Test_BoardUnusedMask[port]) |
+                                              (Test_SnapshotRef.Gpio[port].PDDR & Test_BoardUnusedMask[port]);
+    }
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+/**
+* @brief PORT_HW_HT_009 - Bit-band direction updates
+* @details The alias of PTA PDDR bit 3 must be 0x43FE028C (0x42000000 + 0xFF014 * 32 + 3 * 4).
+*          Every single pin direction change must reach the same PDDR/PIDR state as the
+*          read-modify-write reference with one alias store per register and no core read.
+*/
+static uint8 Test_PORT_HW_HT_009(void)
+{
+    uint32 port;
+    uint32 pin;
+    uint32 writes;
+    uint32 refPddr;
+    uint32 refPidr;
+    GPIO_Type* pGpio;
+    PortHw_DirectionType direction;
+    uint8 result = TEST_PASSED;
+
+    if (PORT_HW_BITBAND_ALIAS_U32(0x400FF014UL, 3U) != 0x43FE028CUL)
+    {
+        result = TEST_FAILED;
+    }
+
+    PortHwSim_Reset();
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        pGpio = PortHw_g_GpioBaseAddr_ptr[port];
+        PortHwSim_g_GpioRegs_ast[port].PIDR = 0xFFFFFFFFUL;
+        for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+        {
+            direction = (0U != ((port + pin) & 1U)) ? PORT_HW_PIN_OUT : PORT_HW_PIN_IN;
+            refPddr = PortHwSim_g_GpioRegs_ast[port].PDDR;
+            refPidr = PortHwSim_g_GpioRegs_ast[port].PIDR;
+            if (PORT_HW_PIN_OUT == direction)
+            {
+                refPddr |= (1UL << pin);
+                writes = 1U;
+            }
+            else
+            {
+                refPddr &= ~(1UL << pin);
+                refPidr &= ~(1UL << pin);
+                writes = 2U;
+            }
+
+            PortHwSim_ClearCounters();
+            PortHw_SetPinDirection(pGpio, pin, direction);
+            if ((PortHwSim_g_GpioRegs_ast[port].PDDR != refPddr) || (PortHwSim_g_GpioRegs_ast[port].PIDR != refPidr) ||
+                (PortHwSim_g_BitBandWriteCount_u32 != writes) || (PortHwSim_g_WriteCount_u32 != writes) ||
+                (PortHwSim_g_ReadCount_u32 != 0U))
+            {
+                result = TEST_FAILED;
+            }
+        }
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_HW_BITBAND_PDDR) */
+
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+/**
+* @brief PORT_HW_HT_010 - Pin group direction
+* @details Group 0 holds the direction changeable pins of the board. Port_SetPinGroupDirection()
+*          must reach the same state as Port_SetPinDirection() on every pin of the group with
+*          one PDDR write per port (plus one PIDR write per port for inputs). Wrong and fixed
+*          direction groups must be refused without register access.
+*/
+static uint8 Test_PORT_HW_HT_010(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    Port_PinDirectionType direction;
+    uint32 i;
+    uint32 pass;
+    uint32 port;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        Test_BoardGroupMasks[port].GpioBase_ptr = PortHw_g_GpioBaseAddr_ptr[port];
+        Test_BoardGroupMasks[port].PinMask_u32 = 0U;
+    }
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TEST_BOARD_DIR_CHANGEABLE(i))
+        {
+            Test_BoardGroupMasks[i / TEST_BOARD_PINS_PER_PORT].PinMask_u32 |= (1UL << TEST_BOARD_PIN(i));
+        }
+    }
+    Test_BoardPinGroup[0].PinMasks_ptr = Test_BoardGroupMasks;
+    Test_BoardPinGroup[0].NumPinMasks_u8 = (uint8)PORT_HW_PORT_COUNT_U8;
+    Test_BoardPinGroup[0].DirectionChangeable_bool = TRUE;
+    Test_BoardPinGroup[1] = Test_BoardPinGroup[0];
+    Test_BoardPinGroup[1].DirectionChangeable_bool = FALSE;
+    config.NumPinGroups_u16 = 2U;
+    config.PinGroupConfig_ptr = Test_BoardPinGroup;
+
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        direction = (0U == pass) ? PORT_PIN_OUT : PORT_PIN_IN;
+
+        /* Reference: one call per pin */
+        PortHwSim_Reset();
+        Port_Init(&config);
+        PortHwSim_g_GpioRegs_ast[0].PDDR ^= 0xFFFFFFFFUL;
+        for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+        {
+            if (TEST_BOARD_DIR_CHANGEABLE(i))
+            {
+                Port_SetPinDirection((Port_PinType)i, direction);
+            }
+        }
+        Test_TakeSnapshot(&Test_SnapshotRef);
+
+        /* DUT: one call for the group */
+        PortHwSim_Reset();
+        Port_Init(&config);
+        PortHwSim_g_GpioRegs_ast[0].PDDR ^= 0xFFFFFFFFUL;
+        PortHwSim_ClearCounters();
+        Port_SetPinGroupDirection((Port_PinGroupType)0U, direction);
+        if (PortHwSim_g_WriteCount_u32 != ((uint32)PORT_HW_PORT_COUNT_U8 * (pass + 1U)))
+        {
+            result = TEST_FAILED;
+        }
+        Test_TakeSnapshot(&Test_SnapshotDut);
+        if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    /* Wrong group and fixed direction group */
+    PortHwSim_ClearCounters();
+    Port_SetPinGroupDirection((Port_PinGroupType)2U, PORT_PIN_OUT);
+    if ((PORT_E_PARAM_GROUP != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_SETPINGROUPDIRECTION_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+    Port_SetPinGroupDirection((Port_PinGroupType)1U, PORT_PIN_OUT);
+    if ((PORT_E_DIRECTION_UNCHANGEABLE != Det_ErrorId[TEST_DET_CORE_ID]) || (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API) */
+
+/**
+* @brief PORT_HW_HT_011 - Pad mode validation
+* @details Every pad up to PORT_MAX_PIN_PACKAGE_U16 is configured alone as a mode changeable
+*          GPIO pin and moved to each of the 8 modes. Modes of Port_au16PinDescription must
+*          reach the PCR, the others must be refused with PORT_E_MODE_UNSUPPORTED and leave
+*          the PCR untouched. Mode 8 must still report PORT_E_PARAM_INVALID_MODE.
+*/
+static uint8 Test_PORT_HW_HT_011(void)
+{
+    Port_ConfigType config;
+    uint32 pad;
+    uint32 mode;
+    uint32 pcr;
+    uint32* pPcr;
+    uint8 result = TEST_PASSED;
+
+    (void)memset(&config, 0, sizeof(config));
+    config.NumPins_u16 = 1U;
+    config.PinTable_ptr = &Test_BoardTable;
+    config.PinHandle_ptr = Test_BoardPinHandle;
+    Test_BoardPcr[0] = PORT_PCR_MUX(1U);
+    Test_BoardFlags[0] = PORT_HW_PIN_FLAGS_U8(PORT_HW_MUX_AS_GPIO, PORT_HW_PIN_IN, 0U) | PORT_PIN_FLAG_MODE_CHANGEABLE_U8;
+
+    for (pad = 0U; pad <= PORT_MAX_PIN_PACKAGE_U16; pad++)
+    {
+        Test_BoardPad[0] = (uint8)pad;
+        pPcr = (uint32*)&PortHwSim_g_PortRegs_ast[pad / PORT_HW_PINS_PER_PORT_U8].PCR[pad % PORT_HW_PINS_PER_PORT_U8];
+
+        PortHwSim_Reset();
+        Port_Init(&config);
+        for (mode = 0U; mode < 8U; mode++)
+        {
+            pcr = *pPcr;
+            Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+            Port_SetPinMode((Port_PinType)0U, (Port_PinModeType)mode);
+            if (TRUE == Test_PadSupportsMode(pad, mode))
+            {
+                if (((*pPcr & PORT_PCR_MUX_MASK) != PORT_PCR_MUX(mode)) || (0U != Det_ErrorId[TEST_DET_CORE_ID]))
+                {
+                    result = TEST_FAILED;
+                }
+            }
+            else
+            {
+                if ((*pPcr != pcr) || (PORT_E_MODE_UNSUPPORTED != Det_ErrorId[TEST_DET_CORE_ID]))
+                {
+                    result = TEST_FAILED;
+                }
+            }
+        }
+
+        Port_SetPinMode((Port_PinType)0U, (Port_PinModeType)8U);
+        if (PORT_E_PARAM_INVALID_MODE != Det_ErrorId[TEST_DET_CORE_ID])
+        {
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_HT_012 - Mask-based direction refresh
+* @details With every PDDR inverted, Port_RefreshPortDirection() must restore the fixed
+*          direction pins, leave all other bits alone and use one PDDR read and write per
+*          port. Port_VerifyPortDirection() must not write while the directions are right,
+*          and rewrite only the port of a fixed pin that lost its direction.
+*/
+static uint8 Test_PORT_HW_HT_012(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    uint32 fixedMask[PORT_HW_PORT_COUNT_U8];
+    uint32 i;
+    uint32 port;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    (void)memset(fixedMask, 0, sizeof(fixedMask));
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (!TEST_BOARD_DIR_CHANGEABLE(i))
+        {
+            fixedMask[i / TEST_BOARD_PINS_PER_PORT] |= (1UL << TEST_BOARD_PIN(i));
+        }
+    }
+
+    PortHwSim_Reset();
+    Port_Init(&config);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        PortHwSim_g_GpioRegs_ast[port].PDDR = ~PortHwSim_g_GpioRegs_ast[port].PDDR;
+        Test_SnapshotRef.Gpio[port].PDDR = (Test_SnapshotRef.Gpio[port].PDDR & fixedMask[port]) |
+                                           (PortHwSim_g_GpioRegs_ast[port].PDDR & ~fixedMask[port]);
+    }
+
+    PortHwSim_ClearCounters();
+    Port_RefreshPortDirection();
+    if ((PortHwSim_g_WriteCount_u32 != PORT_HW_PORT_COUNT_U8) || (PortHwSim_g_ReadCount_u32 != PORT_HW_PORT_COUNT_U8))
+    {
+        result = TEST_FAILED;
+    }
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+#if (STD_ON == PORT_VERIFY_PORT_DIRECTION_API)
+    PortHwSim_ClearCounters();
+    if ((0U != Port_VerifyPortDirection()) || (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* A changeable pin does not count, a fixed pin does */
+    PortHwSim_g_GpioRegs_ast[2].PDDR ^= ~fixedMask[2] & (1UL << TEST_BOARD_PIN((2U * TEST_BOARD_PINS_PER_PORT) + 1U));
+    PortHwSim_g_GpioRegs_ast[3].PDDR ^= fixedMask[3] & (0U - fixedMask[3]);
+    PortHwSim_ClearCounters();
+    if ((1U != Port_VerifyPortDirection()) || (1U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+    PortHwSim_g_GpioRegs_ast[2].PDDR ^= ~fixedMask[2] & (1UL << TEST_BOARD_PIN((2U * TEST_BOARD_PINS_PER_PORT) + 1U));
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+#endif /* (STD_ON == PORT_VERIFY_PORT_DIRECTION_API) */
+
+    return result;
+}
+
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+/**
+* @brief Resolves one (pin, mode) of the board into the GPCLR/GPCHR writes of a profile
+* @details Does what the configuration tool does: the pin joins the write of its port half
+*          carrying the same PCR[15:0] value, or opens a new one.
+* @return Number of writes of the profile
+*/
+static uint8 Test_AddProfileControl(PortHw_GlobalPinControlType controls[], uint8 numControls, uint32 pin, uint32 mode)
+{
+    PORT_Type* pBase = PortHw_g_PortBaseAddr_ptr[TEST_BOARD_PORT(pin)];
+    uint32 pinIndex = TEST_BOARD_PIN(pin);
+    PortHw_GlobalControlPinsType half = (pinIndex < 16U) ? PORT_HW_GLOBAL_LOWER_HALF : PORT_HW_GLOBAL_UPPER_HALF;
+    uint16 value = (uint16)((Test_BoardPcr[pin] & 0xFFFFU & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(mode));
+    uint8 c = 0U;
+
+    while ((c < numControls) &&
+           ((controls[c].PortBase_ptr != pBase) || (controls[c].Half_en != half) || (controls[c].Value_u16 != value)))
+    {
+        c++;
+    }
+    if (c == numControls)
+    {
+        controls[c].PortBase_ptr = pBase;
+        controls[c].Pins_u16 = 0U;
+        controls[c].Value_u16 = value;
+        controls[c].Half_en = half;
+        numControls++;
+    }
+    controls[c].Pins_u16 |= (uint16)(1UL << (pinIndex & 15U));
+
+    return numControls;
+}
+
+/**
+* @brief PORT_HW_HT_013 - Mode profiles
+* @details Profile 0 moves every mode changeable GPIO pin that supports ALT2 to ALT2, profile 1
+*          moves them back. Port_ApplyModeProfile() must reach the same state as
+*          Port_SetPinMode() on every pin, with one register write per profile entry and no
+*          more entries than two per port and PCR value. A wrong profile must be refused.
+*/
+static uint8 Test_PORT_HW_HT_013(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    uint8 numControls[2] = { 0U, 0U };
+    uint32 selected[TEST_BOARD_PIN_COUNT];
+    uint32 numSelected = 0U;
+    uint32 i;
+    uint32 profile;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    (void)memset(Test_BoardProfileControls, 0, sizeof(Test_BoardProfileControls));
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TEST_BOARD_MODE_CHANGEABLE(i) && (PORT_HW_MUX_AS_GPIO == TEST_BOARD_MUX(i)) &&
+            (TRUE == Test_PadSupportsMode(Test_BoardPad[i], 2U)))
+        {
+            selected[numSelected] = i;
+            numSelected++;
+            numControls[0] = Test_AddProfileControl(Test_BoardProfileControls[0], numControls[0], i, 2U);
+            numControls[1] = Test_AddProfileControl(Test_BoardProfileControls[1], numControls[1], i, (uint32)TEST_BOARD_MUX(i));
+        }
+    }
+    for (profile = 0U; profile < 2U; profile++)
+    {
+        Test_BoardModeProfile[profile].Controls_ptr = Test_BoardProfileControls[profile];
+        Test_BoardModeProfile[profile].NumControls_u8 = numControls[profile];
+    }
+    config.NumModeProfiles_u16 = 2U;
+    config.ModeProfileConfig_ptr = Test_BoardModeProfile;
+
+    /* The board uses three GPIO PCR values per port, pins 0..27 span both halves */
+    if ((numSelected < 10U) || (numControls[0] > (uint8)(PORT_HW_PORT_COUNT_U8 * 2U * 3U)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Reference: one Port_SetPinMode() per pin */
+    PortHwSim_Reset();
+    Port_Init(&config);
+    for (i = 0U; i < numSelected; i++)
+    {
+        Port_SetPinMode((Port_PinType)selected[i], PORT_ALT2_FUNC_MODE);
+    }
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* DUT: one call for the profile */
+    PortHwSim_Reset();
+    Port_Init(&config);
+    PortHwSim_ClearCounters();
+    Port_ApplyModeProfile((Port_ModeProfileType)0U);
+    if ((PortHwSim_g_WriteCount_u32 != numControls[0]) || (0U != PortHwSim_g_ReadCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Back to the configured modes */
+    PortHwSim_Reset();
+    Port_Init(&config);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+    Port_ApplyModeProfile((Port_ModeProfileType)0U);
+    Port_ApplyModeProfile((Port_ModeProfileType)1U);
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Wrong profile */
+    PortHwSim_ClearCounters();
+    Port_ApplyModeProfile((Port_ModeProfileType)2U);
+    if ((PORT_E_PARAM_PROFILE != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_APPLYMODEPROFILE_ID != Det_ApiId[TEST_DET_CORE_ID]) ||
+        (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_APPLY_MODE_PROFILE_API) */
+
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+/**
+* @brief PORT_HW_HT_014 - Pin profile switch
+* @details The sleep profile of the board parks every pin: peripheral and input pins go to
+*          ALT0 without pull, GPIO outputs are driven low, unused pads go to ALT0. The
+*          generated run to sleep delta replayed by Port_SwitchProfile() after Port_Init()
+*          must give the registers PortHw_Init() gives for the sleep profile, with fewer writes,
+*          and the sleep to run delta must restore the Port_Init() state. Switches from
+*          another profile than the active one or between unconfigured profiles are refused.
+*/
+static uint8 Test_PORT_HW_HT_014(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    PortHw_UnusedPinConfigType sleepUnusedCfg = { 0x00000000U, PORT_HW_PIN_IN, 0U };
+    PortInitScriptGen_VariantType run;
+    PortInitScriptGen_VariantType sleep;
+    PortHw_MuxType mux;
+    PortHw_DirectionType direction;
+    PortHw_DriveStrengthType drive;
+    uint32 writesInit;
+    uint32 i;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        mux = TEST_BOARD_MUX(i);
+        direction = PORT_HW_PIN_FLAG_DIR(Test_BoardFlags[i]);
+        drive = (0U != (Test_BoardPcr[i] & PORT_PCR_DSE_MASK)) ? PORT_HW_DRIVE_STRENGTH_HIGH : PORT_HW_DRIVE_STRENGTH_LOW;
+        if (PORT_HW_PIN_OUT != direction)
+        {
+            mux = PORT_HW_MUX_ALT0;
+            direction = PORT_HW_PIN_IN;
+        }
+        Test_BoardSleepPcr[i] = PORT_HW_PCR_VALUE(PORT_HW_PULL_NOT_ENABLED, drive, PORT_HW_LOCK_DISABLED, mux);
+        Test_BoardSleepFlags[i] = PORT_HW_PIN_FLAGS_U8(mux, direction, 0U);
+    }
+
+    run.PinCount_u32 = TEST_BOARD_PIN_COUNT;
+    run.Table_ptr = &Test_BoardTable;
+    run.UnusedPadMask_ptr = Test_BoardUnusedMask;
+    run.UnusedPadConfig_ptr = (const PortHw_UnusedPinConfigType*)&unusedCfg;
+    sleep = run;
+    sleep.Table_ptr = &Test_BoardSleepTable;
+    sleep.UnusedPadConfig_ptr = &sleepUnusedCfg;
+
+    Test_SwitchScript[0].NumEntries_u32 = PortInitScriptGen_BuildDelta(&run, &sleep, Test_SwitchEntries[0]);
+    Test_SwitchScript[0].Entries_ptr = Test_SwitchEntries[0];
+    Test_SwitchScript[1].NumEntries_u32 = PortInitScriptGen_BuildDelta(&sleep, &run, Test_SwitchEntries[1]);
+    Test_SwitchScript[1].Entries_ptr = Test_SwitchEntries[1];
+    Test_BoardProfileSwitch[0].From_u8 = 0U;
+    Test_BoardProfileSwitch[0].To_u8 = 1U;
+    Test_BoardProfileSwitch[0].Script_ptr = &Test_SwitchScript[0];
+    Test_BoardProfileSwitch[1].From_u8 = 1U;
+    Test_BoardProfileSwitch[1].To_u8 = 0U;
+    Test_BoardProfileSwitch[1].Script_ptr = &Test_SwitchScript[1];
+    config.NumProfileSwitches_u16 = 2U;
+    config.ProfileSwitchConfig_ptr = Test_BoardProfileSwitch;
+
+    /* Reference: sleep profile initialized from reset */
+    PortHwSim_Reset();
+    PortHw_Init(TEST_BOARD_PIN_COUNT, &Test_BoardSleepTable, config.NumUnusedPins_u16, Test_BoardUnusedMask, &sleepUnusedCfg);
+    writesInit = PortHwSim_g_WriteCount_u32;
+    Test_TakeSnapshot(&Test_SnapshotRef);
+
+    /* DUT: run profile, then the run to sleep delta */
+    PortHwSim_Reset();
+    Port_Init(&config);
+    PortHwSim_ClearCounters();
+    Port_SwitchProfile((Port_ProfileType)0U, (Port_ProfileType)1U);
+    (void)printf("    run->sleep: PortHw_Init %u writes, delta %u writes\n",
+                 (unsigned)writesInit, (unsigned)PortHwSim_g_WriteCount_u32);
+    if ((PortHwSim_g_WriteCount_u32 != Test_SwitchScript[0].NumEntries_u32) || (PortHwSim_g_WriteCount_u32 >= writesInit) ||
+        (0U != PortHwSim_g_ReadCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Parked directions are not refreshed */
+    PortHwSim_ClearCounters();
+    Port_RefreshPortDirection();
+    if (0U != PortHwSim_g_WriteCount_u32)
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Back to the run profile */
+    PortHwSim_Reset();
+    Port_Init(&config);
+    Test_TakeSnapshot(&Test_SnapshotRef);
+    Port_SwitchProfile((Port_ProfileType)0U, (Port_ProfileType)1U);
+    Port_SwitchProfile((Port_ProfileType)1U, (Port_ProfileType)0U);
+    Test_TakeSnapshot(&Test_SnapshotDut);
+    (void)printf("    sleep->run: delta %u writes\n", (unsigned)Test_SwitchScript[1].NumEntries_u32);
+    if (0 != memcmp(&Test_SnapshotRef, &Test_SnapshotDut, sizeof(TestRegSnapshot_Type)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Not the active profile, then no switch configured */
+    PortHwSim_ClearCounters();
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_SwitchProfile((Port_ProfileType)1U, (Port_ProfileType)0U);
+    if ((PORT_E_PARAM_PROFILE_SWITCH != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_SWITCHPROFILE_ID != Det_ApiId[TEST_DET_CORE_ID]) ||
+        (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_SwitchProfile((Port_ProfileType)0U, (Port_ProfileType)2U);
+    if ((PORT_E_PARAM_PROFILE_SWITCH != Det_ErrorId[TEST_DET_CORE_ID]) || (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_SWITCH_PROFILE_API) */
+
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+/**
+* @brief PORT_HW_HT_015 - Channel groups
+* @details Port_ReadChannelGroup() must return the bus bits of PDIR shifted down with a single
+*          read (pin by pin takes one read per bit), Port_WriteChannelGroup() must change only
+*          the bus bits of PDOR with one PSOR and one PCOR write and no read. A wrong group
+*          must be refused.
+*/
+static uint8 Test_PORT_HW_HT_015(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    Port_ChannelGroupLevelType level;
+    uint32 pdorBefore;
+    uint32 pin;
+    uint32 readsPerPin;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    config.NumChannelGroups_u16 = 2U;
+    config.ChannelGroupConfig_ptr = Test_BoardChannelGroup;
+    PortHwSim_Reset();
+    Port_Init(&config);
+
+    /* Reference: the input byte pin by pin */
+    PortHwSim_SetInput(1U, 0xA5A5A5A5U);
+    PortHwSim_ClearCounters();
+    level = 0U;
+    for (pin = 0U; pin < 8U; pin++)
+    {
+        level |= (Port_ChannelGroupLevelType)PortHw_ReadPin(IP_PTB, 4U + pin) << pin;
+    }
+    readsPerPin = PortHwSim_g_ReadCount_u32;
+
+    /* DUT: one read for the byte */
+    PortHwSim_ClearCounters();
+    level = Port_ReadChannelGroup((Port_ChannelGroupType)0U);
+    (void)printf("    8-bit read: pin by pin %u reads, channel group %u reads\n",
+                 (unsigned)readsPerPin, (unsigned)PortHwSim_g_ReadCount_u32);
+    if ((0x5AU != level) || (1U != PortHwSim_g_ReadCount_u32) || (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Write the 16-bit bus, the other PTC pins keep their level */
+    PortHwSim_g_GpioRegs_ast[2].PDOR = 0x81000081U;
+    pdorBefore = PortHwSim_g_GpioRegs_ast[2].PDOR;
+    PortHwSim_ClearCounters();
+    Port_WriteChannelGroup((Port_ChannelGroupType)1U, (Port_ChannelGroupLevelType)0x3C5AU);
+    if ((((pdorBefore & ~0x00FFFF00U) | 0x003C5A00U) != PortHwSim_g_GpioRegs_ast[2].PDOR) ||
+        (2U != PortHwSim_g_WriteCount_u32) || (0U != PortHwSim_g_ReadCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Bits above the group width are ignored */
+    Port_WriteChannelGroup((Port_ChannelGroupType)1U, (Port_ChannelGroupLevelType)0xFFFF0000U);
+    if ((pdorBefore & ~0x00FFFF00U) != PortHwSim_g_GpioRegs_ast[2].PDOR)
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Wrong group */
+    PortHwSim_ClearCounters();
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_WriteChannelGroup((Port_ChannelGroupType)2U, (Port_ChannelGroupLevelType)0U);
+    if ((PORT_E_PARAM_CHANNEL_GROUP != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_WRITECHANNELGROUP_ID != Det_ApiId[TEST_DET_CORE_ID]) ||
+        (0U != PortHwSim_g_WriteCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    if ((0U != Port_ReadChannelGroup((Port_ChannelGroupType)2U)) || (PORT_E_PARAM_CHANNEL_GROUP != Det_ErrorId[TEST_DET_CORE_ID]) ||
+        (0U != PortHwSim_g_ReadCount_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_CHANNEL_GROUP_API) */
+
+#if (STD_ON == PORT_DEBOUNCE_API)
+/**
+* @brief xorshift32 pseudo random generator, fixed seed for repeatable runs
+*/
+static uint32 Test_Random(uint32* pSeed)
+{
+    uint32 x = *pSeed;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *pSeed = x;
+
+    return x;
+}
+
+/**
+* @brief PORT_HW_HT_016 - Vertical counter debounce
+* @details Every pin of the two debounce ports follows its own random switch: the true level
+*          changes now and then and the input bounces at random for up to 12 ticks after
+*          every change, so runs of 1 to 4+ equal samples all occur. After every
+*          Port_DebounceMainFunction() the debounced levels and edges must equal a per-pin
+*          counter reference (a pin takes its input after PORT_HW_DEBOUNCE_TICKS_U8 different
+*          samples in a row), pins outside the masks must stay 0, and a call must cost one
+*          PDIR read per port and no write. A wrong port must be refused.
+*/
+static uint8 Test_PORT_HW_HT_016(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    uint32 trueLevel[TEST_DEBOUNCE_PORTS];
+    uint32 input[TEST_DEBOUNCE_PORTS];
+    uint32 refState[TEST_DEBOUNCE_PORTS];
+    uint32 refEdge[TEST_DEBOUNCE_PORTS];
+    uint8 refCount[TEST_DEBOUNCE_PORTS][PORT_HW_PINS_PER_PORT_U8];
+    uint8 bounce[TEST_DEBOUNCE_PORTS][PORT_HW_PINS_PER_PORT_U8];
+    uint32 seed = 0x2545F491U;
+    uint32 tick;
+    uint32 port;
+    uint32 pin;
+    uint32 bit;
+    uint32 changes;
+    uint32 edges = 0U;
+    uint32 mismatches = 0U;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    config.NumDebouncePorts_u16 = (uint16)TEST_DEBOUNCE_PORTS;
+    config.DebounceConfig_ptr = Test_BoardDebounce;
+    config.DebounceState_ptr = Test_BoardDebounceState;
+    PortHwSim_Reset();
+
+    /* Levels at initialization are taken without edges */
+    for (port = 0U; port < TEST_DEBOUNCE_PORTS; port++)
+    {
+        trueLevel[port] = Test_Random(&seed);
+        input[port] = trueLevel[port];
+        refState[port] = trueLevel[port] & Test_BoardDebounce[port].PinMask_u32;
+        (void)memset(refCount[port], 0, sizeof(refCount[port]));
+        (void)memset(bounce[port], 0, sizeof(bounce[port]));
+        PortHwSim_SetInput(Test_DebouncePortIndex[port], input[port]);
+    }
+    Port_Init(&config);
+
+    for (tick = 0U; tick < TEST_DEBOUNCE_TICKS; tick++)
+    {
+        for (port = 0U; port < TEST_DEBOUNCE_PORTS; port++)
+        {
+            /* About one switch in 64 changes per tick, then bounces */
+            changes = Test_Random(&seed) & Test_Random(&seed) & Test_Random(&seed) &
+                      Test_Random(&seed) & Test_Random(&seed) & Test_Random(&seed);
+            trueLevel[port] ^= changes;
+            input[port] = trueLevel[port];
+            for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+            {
+                bit = 1UL << pin;
+                if (0U != (changes & bit))
+                {
+                    bounce[port][pin] = (uint8)(Test_Random(&seed) % 13U);
+                }
+                if (0U != bounce[port][pin])
+                {
+                    bounce[port][pin]--;
+                    input[port] ^= (Test_Random(&seed) & bit);
+                }
+            }
+            PortHwSim_SetInput(Test_DebouncePortIndex[port], input[port]);
+
+            /* Reference: one counter per pin */
+            refEdge[port] = 0U;
+            for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+            {
+                bit = 1UL << pin;
+                if (0U == (Test_BoardDebounce[port].PinMask_u32 & bit))
+                {
+                    /* Not debounced */
+                }
+                else if ((input[port] & bit) != (refState[port] & bit))
+                {
+                    refCount[port][pin]++;
+                    if (PORT_HW_DEBOUNCE_TICKS_U8 == refCount[port][pin])
+                    {
+                        refState[port] ^= bit;
+                        refEdge[port] |= bit;
+                        refCount[port][pin] = 0U;
+                    }
+                }
+                else
+                {
+                    refCount[port][pin] = 0U;
+                }
+            }
+        }
+
+        PortHwSim_ClearCounters();
+        Port_DebounceMainFunction();
+        if ((TEST_DEBOUNCE_PORTS != PortHwSim_g_ReadCount_u32) || (0U != PortHwSim_g_WriteCount_u32))
+        {
+            result = TEST_FAILED;
+        }
+
+        for (port = 0U; port < TEST_DEBOUNCE_PORTS; port++)
+        {
+            if ((refState[port] != Port_GetDebouncedState((Port_DebouncePortType)port)) ||
+                (refEdge[port] != Port_GetDebouncedEdges((Port_DebouncePortType)port)))
+            {
+                mismatches++;
+            }
+            for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+            {
+                edges += (refEdge[port] >> pin) & 1U;
+            }
+        }
+    }
+    (void)printf("    %u ticks, %u debounced pins, %u edges, %u mismatches\n",
+                 (unsigned)TEST_DEBOUNCE_TICKS, (unsigned)TEST_DEBOUNCE_PINS, (unsigned)edges, (unsigned)mismatches);
+    if ((0U != mismatches) || (0U == edges))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Wrong port */
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    if ((0U != Port_GetDebouncedState((Port_DebouncePortType)TEST_DEBOUNCE_PORTS)) ||
+        (PORT_E_PARAM_DEBOUNCE_PORT != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_GETDEBOUNCEDSTATE_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    if ((0U != Port_GetDebouncedEdges((Port_DebouncePortType)TEST_DEBOUNCE_PORTS)) ||
+        (PORT_E_PARAM_DEBOUNCE_PORT != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_GETDEBOUNCEDEDGES_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_DEBOUNCE_API) */
+
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+/**
+* @brief PORT_HW_HT_017 - Pin notifications
+* @details Enables the notification of every configured pin of PTC (24 pins, edges in turn)
+*          and checks that only IRQC changed in their PCRs. Then raises random ISFR flag
+*          patterns, also on pins without notification, and calls PORTC_IRQHandler(): every
+*          enabled flagged pin must be notified once, lowest pin first, with one ISFR read and
+*          one ISFR write, and no flag may be left. A flag raised again by a notification must
+*          stay pending, a disabled pin must not be notified and its pending flag must be
+*          dropped. Wrong parameters must be refused.
+*/
+static uint8 Test_PORT_HW_HT_017(void)
+{
+    static const uint32 edgeIrqc[3] = { 0x9U, 0xAU, 0xBU };
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    PORT_Type* pPort = &PortHwSim_g_PortRegs_ast[TEST_IRQ_PORT];
+    uint32 pcrBefore[PORT_HW_PINS_PER_PORT_U8];
+    uint32 enabledMask = 0U;
+    uint32 seed = 0x1B873593U;
+    uint32 flags;
+    uint32 expected;
+    uint32 round;
+    uint32 i;
+    uint32 pin;
+    uint32 n;
+    uint32 notified = 0U;
+    uint32 mismatches = 0U;
+    Port_PinType disabledPin = 0U;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    PortHwSim_Reset();
+    Port_Init(&config);
+    (void)memcpy(pcrBefore, (const void*)pPort->PCR, sizeof(pcrBefore));
+
+    /* Enable: ISFR clear plus one GICLR/GICHR write, no read */
+    n = 0U;
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TEST_IRQ_PORT == TEST_BOARD_PORT(i))
+        {
+            pin = TEST_BOARD_PIN(i);
+            PortHwSim_ClearCounters();
+            Port_EnablePinNotification((Port_PinType)i, (Port_PinNotificationEdgeType)(n % 3U), Test_IrqNotification[pin]);
+            if ((2U != PortHwSim_g_WriteCount_u32) || (0U != PortHwSim_g_ReadCount_u32) ||
+                ((pcrBefore[pin] & ~PORT_PCR_IRQC_MASK) != (pPort->PCR[pin] & ~PORT_PCR_IRQC_MASK)) ||
+                (edgeIrqc[n % 3U] != ((pPort->PCR[pin] & PORT_PCR_IRQC_MASK) >> PORT_PCR_IRQC_SHIFT)))
+            {
+                result = TEST_FAILED;
+            }
+            enabledMask |= 1UL << pin;
+            disabledPin = (Port_PinType)i;
+            n++;
+        }
+    }
+    if (TEST_BOARD_PINS_PER_PORT != n)
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Random flag patterns, pins without notification included */
+    for (round = 0U; round < TEST_IRQ_ROUNDS; round++)
+    {
+        flags = Test_Random(&seed);
+        flags &= (0U == (round & 1U)) ? Test_Random(&seed) : 0xFFFFFFFFU;
+        if (0U == (round % 97U))
+        {
+            flags = 1UL << (round % PORT_HW_PINS_PER_PORT_U8);
+        }
+        PortHwSim_SetInterruptFlags(TEST_IRQ_PORT, flags);
+        Test_IrqLogCount = 0U;
+        PortHwSim_ClearCounters();
+        PORTC_IRQHandler();
+
+        expected = flags & enabledMask;
+        if ((1U != PortHwSim_g_ReadCount_u32) || (1U != PortHwSim_g_WriteCount_u32) || (0U != pPort->ISFR))
+        {
+            mismatches++;
+        }
+        n = 0U;
+        for (pin = 0U; pin < PORT_HW_PINS_PER_PORT_U8; pin++)
+        {
+            if (0U != (expected & (1UL << pin)))
+            {
+                if ((n >= Test_IrqLogCount) || (pin != Test_IrqLog[n]))
+                {
+                    mismatches++;
+                }
+                n++;
+            }
+            if (0U != (pPort->PCR[pin] & PORT_PCR_ISF_MASK))
+            {
+                mismatches++;
+            }
+        }
+        if (n != Test_IrqLogCount)
+        {
+            mismatches++;
+        }
+        notified += Test_IrqLogCount;
+    }
+    (void)printf("    %u flag patterns, %u notifications, %u mismatches\n",
+                 (unsigned)TEST_IRQ_ROUNDS, (unsigned)notified, (unsigned)mismatches);
+    if (0U != mismatches)
+    {
+        result = TEST_FAILED;
+    }
+
+    /* An event during its notification stays pending */
+    pin = TEST_BOARD_PIN(disabledPin);
+    Test_IrqRelatchPin = pin;
+    PortHwSim_SetInterruptFlags(TEST_IRQ_PORT, 1UL << pin);
+    Test_IrqLogCount = 0U;
+    PORTC_IRQHandler();
+    Test_IrqRelatchPin = PORT_HW_PINS_PER_PORT_U8;
+    if ((1U != Test_IrqLogCount) || ((1UL << pin) != pPort->ISFR))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Disabled pin: IRQC cleared, pending flag dropped, no notification */
+    Port_DisablePinNotification(disabledPin);
+    PortHwSim_SetInterruptFlags(TEST_IRQ_PORT, 1UL << pin);
+    Port_DisablePinNotification(disabledPin);
+    Test_IrqLogCount = 0U;
+    PORTC_IRQHandler();
+    if ((0U != Test_IrqLogCount) || (0U != (pPort->PCR[pin] & PORT_PCR_IRQC_MASK)) || (0U != pPort->ISFR) ||
+        ((pcrBefore[pin] & ~PORT_PCR_IRQC_MASK) != (pPort->PCR[pin] & ~PORT_PCR_IRQC_MASK)))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Wrong parameters */
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_EnablePinNotification((Port_PinType)TEST_BOARD_PIN_COUNT, PORT_NOTIFICATION_RISING_EDGE, Test_IrqNotification[0]);
+    if ((PORT_E_PARAM_PIN != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_ENABLEPINNOTIFICATION_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_EnablePinNotification(disabledPin, (Port_PinNotificationEdgeType)3, Test_IrqNotification[0]);
+    if (PORT_E_PARAM_EDGE != Det_ErrorId[TEST_DET_CORE_ID])
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_EnablePinNotification(disabledPin, PORT_NOTIFICATION_RISING_EDGE, NULL_PTR);
+    if ((PORT_E_PARAM_POINTER != Det_ErrorId[TEST_DET_CORE_ID]) || (0U != (pPort->PCR[pin] & PORT_PCR_IRQC_MASK)))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_DisablePinNotification((Port_PinType)TEST_BOARD_PIN_COUNT);
+    if ((PORT_E_PARAM_PIN != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_DISABLEPINNOTIFICATION_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Leave no notification behind for the next tests */
+    for (i = 0U; i < TEST_BOARD_PIN_COUNT; i++)
+    {
+        if (TEST_IRQ_PORT == TEST_BOARD_PORT(i))
+        {
+            Port_DisablePinNotification((Port_PinType)i);
+        }
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) */
+
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+/**
+* @brief PORT_HW_HT_018 - Digital filter
+* @details Initializes the board with three digital filter ports, one left enabled on every pin
+*          by a previous configuration. DFCR must hold the clock source, DFWR the width and
+*          DFER the filtered pins of every filter port, the other ports must keep no filter,
+*          and DFCR/DFWR must never be written while a filter of the port is on.
+*          PortHw_SetDigitalFilter() must take four writes and no read. Then filters of pins
+*          are disabled and enabled again at runtime: only DFER of that port may change, with
+*          one read and one write. The generated configuration must program PTC12/PTC13 with
+*          31 LPO_CLK cycles. Wrong filter ports and pins must be refused.
+*/
+static uint8 Test_PORT_HW_HT_018(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    PORT_Type* pPort;
+    uint32 filterOf[PORT_HW_PORT_COUNT_U8];
+    uint32 port;
+    uint32 i;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    config.NumDigitalFilterPorts_u8 = (uint8)TEST_FILTER_PORTS;
+    config.DigitalFilterConfig_ptr = Test_BoardFilter;
+    PortHwSim_Reset();
+    /* Left on by a previous configuration */
+    PortHwSim_g_PortRegs_ast[1].DFER = 0xFFFFFFFFU;
+    PortHwSim_g_PortRegs_ast[1].DFCR = 1U;
+    PortHwSim_g_PortRegs_ast[1].DFWR = 7U;
+    Port_Init(&config);
+
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        filterOf[port] = TEST_FILTER_PORTS;
+    }
+    for (i = 0U; i < TEST_FILTER_PORTS; i++)
+    {
+        filterOf[Test_FilterPortIndex[i]] = i;
+    }
+    for (port = 0U; port < PORT_HW_PORT_COUNT_U8; port++)
+    {
+        pPort = &PortHwSim_g_PortRegs_ast[port];
+        i = filterOf[port];
+        if (TEST_FILTER_PORTS == i)
+        {
+            if ((0U != pPort->DFER) || (0U != pPort->DFCR) || (0U != pPort->DFWR))
+            {
+                result = TEST_FAILED;
+            }
+        }
+        else if ((Test_BoardFilter[i].PinMask_u32 != pPort->DFER) ||
+                 ((uint32)Test_BoardFilter[i].Clock_en != pPort->DFCR) ||
+                 ((uint32)Test_BoardFilter[i].Width_u8 != pPort->DFWR))
+        {
+            result = TEST_FAILED;
+        }
+        else
+        {
+            /* Configured as expected */
+        }
+    }
+    if (0U != PortHwSim_g_FilterConfigWhileEnabled_u32)
+    {
+        result = TEST_FAILED;
+    }
+
+    PortHwSim_ClearCounters();
+    PortHw_SetDigitalFilter(&Test_BoardFilter[0]);
+    if ((4U != PortHwSim_g_WriteCount_u32) || (0U != PortHwSim_g_ReadCount_u32) || (0U != PortHwSim_g_FilterConfigWhileEnabled_u32))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Runtime: disable then enable again pins of PTD */
+    pPort = &PortHwSim_g_PortRegs_ast[3];
+    PortHwSim_ClearCounters();
+    Port_DisableDigitalFilter(1U, (Port_DigitalFilterPinsType)0x00400001U);
+    if ((0x00800002U != pPort->DFER) || (1U != PortHwSim_g_ReadCount_u32) || (1U != PortHwSim_g_WriteCount_u32) ||
+        (1U != pPort->DFCR) || (PORT_HW_DIGITAL_FILTER_WIDTH_MAX_U8 != pPort->DFWR))
+    {
+        result = TEST_FAILED;
+    }
+    Port_EnableDigitalFilter(1U, (Port_DigitalFilterPinsType)0x00000001U);
+    Port_DisableDigitalFilter(2U, (Port_DigitalFilterPinsType)0x00000001U);
+    if ((0x00800003U != pPort->DFER) || (0U != PortHwSim_g_PortRegs_ast[4].DFER) ||
+        (Test_BoardFilter[0].PinMask_u32 != PortHwSim_g_PortRegs_ast[1].DFER))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Wrong parameters */
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_EnableDigitalFilter((Port_DigitalFilterPortType)TEST_FILTER_PORTS, (Port_DigitalFilterPinsType)0x00000001U);
+    if ((PORT_E_PARAM_DIGITAL_FILTER != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_ENABLEDIGITALFILTER_ID != Det_ApiId[TEST_DET_CORE_ID]))
+    {
+        result = TEST_FAILED;
+    }
+    Det_ErrorId[TEST_DET_CORE_ID] = 0U;
+    Port_DisableDigitalFilter(1U, (Port_DigitalFilterPinsType)0x00800004U);
+    if ((PORT_E_PARAM_DIGITAL_FILTER != Det_ErrorId[TEST_DET_CORE_ID]) || (PORT_DISABLEDIGITALFILTER_ID != Det_ApiId[TEST_DET_CORE_ID]) ||
+        (0x00800003U != pPort->DFER))
+    {
+        result = TEST_FAILED;
+    }
+
+    /* Generated configuration */
+    PortHwSim_Reset();
+    Port_Init(&Port_Config_VS_0);
+    pPort = &PortHwSim_g_PortRegs_ast[2];
+    if ((0x00003000U != pPort->DFER) || ((uint32)PORT_HW_DIGITAL_FILTER_LPO_CLOCK != pPort->DFCR) || (31U != pPort->DFWR))
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_DIGITAL_FILTER_API) */
+
+/**
+* @brief Test nested exclusive areas
+* @details The context holding a lock slot enters it again: a module area inside another one, and
+*          a port area plus the direction service of the same port inside a port area. A slot
+*          that is not re-entrant blocks here. The slots are free again after the last exit.
+* @return TEST_PASSED or TEST_FAILED
+*/
+static uint8 Test_PORT_HW_HT_019(void)
+{
+    uint8 result = TEST_PASSED;
+
+    PortHwSim_Reset();
+
+    /* Module slot: area 09 inside area 11 */
+    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_11();
+    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
+    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_11();
+
+    /* Slot of PORTC: area 09 and the direction service inside area 08 */
+    SchM_Enter_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_08, 2U);
+    SchM_Enter_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_09, 2U);
+    SchM_Exit_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_09, 2U);
+    PortHw_SetPinsDirection(IP_PTC, 0x0000F000U, PORT_HW_PIN_OUT);
+    SchM_Exit_Port_PortArea(SCHM_PORT_EXCLUSIVE_AREA_08, 2U);
+
+    /* Both slots released by the last exit */
+    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_09();
+    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_09();
+    PortHw_SetPinsDirection(IP_PTC, 0x00000F00U, PORT_HW_PIN_OUT);
+    if (0x0000FF00U != PortHwSim_g_GpioRegs_ast[2].PDDR)
+    {
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+#if (STD_ON == PORT_PIN_NOTIFICATION_API) && (STD_ON == PORT_SET_PIN_MODE_API)
+/**
+* @brief PORT_HW_HT_020 - Mode change keeps a pending pin flag
+* @details An edge is latched on a pin with an enabled notification, then the pin mode is
+*          written: through Port_SetPinMode() and through PortHw_SetMuxModeSel() to GPIO.
+*          PCR[ISF] is write-1-to-clear, so the read-modify-write of the mux field must not
+*          write it back: the flag stays pending and the port interrupt notifies the pin.
+* @return TEST_PASSED or TEST_FAILED
+*/
+static uint8 Test_PORT_HW_HT_020(void)
+{
+    Port_ConfigType config;
+    Port_UnUsedPinConfigType unusedCfg = { 0x00000100U, PORT_PIN_IN, 0U };
+    PORT_Type* pPort = &PortHwSim_g_PortRegs_ast[TEST_IRQ_PORT];
+    Port_PinType notifiedPin = (Port_PinType)TEST_BOARD_PIN_COUNT;
+    uint32 pin;
+    uint32 step;
+    uint32 i;
+    uint8 result = TEST_PASSED;
+
+    Test_BuildBoardPortConfig(&config, &unusedCfg);
+    PortHwSim_Reset();
+    Port_Init(&config);
+
+    /* Mode changeable pin of the interrupt port whose pad has its configured mode */
+    for (i = 0U; (i < TEST_BOARD_PIN_COUNT) && ((Port_PinType)TEST_BOARD_PIN_COUNT == notifiedPin); i++)
+    {
+        if ((TEST_IRQ_PORT == TEST_BOARD_PORT(i)) && (0U != (i % 4U)) &&
+            (TRUE == Test_PadSupportsMode(Test_BoardPad[i], (uint32)TEST_BOARD_MUX(i))))
+        {
+            notifiedPin = (Port_PinType)i;
+        }
+    }
+    if ((Port_PinType)TEST_BOARD_PIN_COUNT == notifiedPin)
+    {
+        result = TEST_FAILED;
+    }
+    else
+    {
+        pin = TEST_BOARD_PIN(notifiedPin);
+        Port_EnablePinNotification(notifiedPin, PORT_NOTIFICATION_RISING_EDGE, Test_IrqNotification[pin]);
+
+        for (step = 0U; step < 2U; step++)
+        {
+            PortHwSim_SetInterruptFlags(TEST_IRQ_PORT, 1UL << pin);
+            if (0U == step)
+            {
+                Port_SetPinMode(notifiedPin, (Port_PinModeType)TEST_BOARD_MUX(notifiedPin));
+            }
+            else
+            {
+                PortHw_SetMuxModeSel(PortHw_g_PortBaseAddr_ptr[TEST_IRQ_PORT], pin, PORT_HW_MUX_AS_GPIO);
+            }
+            if (0U == (pPort->ISFR & (1UL << pin)))
+            {
+                (void)printf("    step %u: pending flag cleared by the mode change\n", (unsigned)step);
+                result = TEST_FAILED;
+            }
+            Test_IrqLogCount = 0U;
+            PORTC_IRQHandler();
+            if ((1U != Test_IrqLogCount) || (pin != Test_IrqLog[0]) || (0U != pPort->ISFR))
+            {
+                result = TEST_FAILED;
+            }
+        }
+
+        Port_DisablePinNotification(notifiedPin);
+    }
+
+    return result;
+}
+#endif /* (STD_ON == PORT_PIN_NOTIFICATION_API) && (STD_ON == PORT_SET_PIN_MODE_API) */
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+/**
+* @brief Host test entry point
+* @return 0 if all tests passed, 1 otherwise
+*/
+int main(void)
+{
+    static const TestCase_Type testCases[] =
+    {
+        { "PORT_HW_HT_001 grouped PCR init", Test_PORT_HW_HT_001 },
+        { "PORT_HW_HT_002 precomputed PCR words", Test_PORT_HW_HT_002 },
+        { "PORT_HW_HT_003 aggregated GPIO init", Test_PORT_HW_HT_003 },
+        { "PORT_HW_HT_004 unused pad masks", Test_PORT_HW_HT_004 },
+        { "PORT_HW_HT_005 init script replay", Test_PORT_HW_HT_005 },
+        { "PORT_HW_HT_006 phased init", Test_PORT_HW_HT_006 },
+        { "PORT_HW_HT_007 warm init", Test_PORT_HW_HT_007 },
+        { "PORT_HW_HT_008 pin handle table", Test_PORT_HW_HT_008 },
+#if (STD_ON == PORT_HW_BITBAND_PDDR)
+        { "PORT_HW_HT_009 bit-band direction", Test_PORT_HW_HT_009 },
+#endif
+#if (STD_ON == PORT_SET_PIN_GROUP_DIRECTION_API)
+        { "PORT_HW_HT_010 pin group direction", Test_PORT_HW_HT_010 },
+#endif
+        { "PORT_HW_HT_011 pad mode validation", Test_PORT_HW_HT_011 },
+        { "PORT_HW_HT_012 mask-based direction refresh", Test_PORT_HW_HT_012 },
+#if (STD_ON == PORT_APPLY_MODE_PROFILE_API)
+        { "PORT_HW_HT_013 mode profiles", Test_PORT_HW_HT_013 },
+#endif
+#if (STD_ON == PORT_SWITCH_PROFILE_API)
+        { "PORT_HW_HT_014 pin profile switch", Test_PORT_HW_HT_014 },
+#endif
+#if (STD_ON == PORT_CHANNEL_GROUP_API)
+        { "PORT_HW_HT_015 channel groups", Test_PORT_HW_HT_015 },
+#endif
+#if (STD_ON == PORT_DEBOUNCE_API)
+        { "PORT_HW_HT_016 vertical counter debounce", Test_PORT_HW_HT_016 },
+#endif
+#if (STD_ON == PORT_PIN_NOTIFICATION_API)
+        { "PORT_HW_HT_017 pin notifications", Test_PORT_HW_HT_017 },
+#endif
+#if (STD_ON == PORT_DIGITAL_FILTER_API)
+        { "PORT_HW_HT_018 digital filter", Test_PORT_HW_HT_018 },
+#endif
+        { "PORT_HW_HT_019 nested exclusive areas", Test_PORT_HW_HT_019 },
+#if (STD_ON == PORT_PIN_NOTIFICATION_API) && (STD_ON == PORT_SET_PIN_MODE_API)
+        { "PORT_HW_HT_020 mode change keeps pending pin flag", Test_PORT_HW_HT_020 },
+#endif
+    };
+    uint32 i;
+    uint32 failed = 0U;
+    uint8 result;
+
+    for (i = 0U; i < (sizeof(testCases) / sizeof(testCases[0])); i++)
+    {
+        (void)printf("[RUN ] %s\n", testCases[i].testName);
+        result = testCases[i].testFunc();
+        (void)printf("[%s] %s\n", (TEST_PASSED == result) ? "PASS" : "FAIL", testCases[i].testName);
+        if (TEST_PASSED != result)
+        {
+            failed++;
+        }
+    }
+
+    (void)printf("%u/%u tests passed\n", (unsigned)(i - failed), (unsigned)i);
+
+    return (0U == failed) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
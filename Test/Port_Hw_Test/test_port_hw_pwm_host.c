@@ -0,0 +1,604 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host tests of the Port_Hw software PWM
+==================================================================================================*/
+
+/**
+*   @file    test_port_hw_pwm_host.c
+*
+*   @brief   Host tests of the Port_Hw software PWM
+*   @details Runs 24 channels on PTB0-7, PTC8-15 and PTD16-23 of the simulated register file
+*            with a period of 100 ticks. The level of every channel is read from PDOR after
+*            every edge and its high ticks are counted per period, for both ways of pacing
+*            (PortHw_PwmTick() every tick, PortHw_PwmEvent() at the edges only). The register
+*            writes of a period are counted and compared with the number of distinct edges.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/test_port_hw_pwm_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw_Pwm.c -o test_port_hw_pwm_host
+*            ./test_port_hw_pwm_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw_Pwm.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Test result macros
+*/
+#define TEST_PASSED                     (0U)
+#define TEST_FAILED                     (1U)
+
+/**
+* @brief Channels, ports and period
+*/
+#define TEST_CHANNELS                   (24U)
+#define TEST_PORTS                      (3U)
+#define TEST_PERIOD                     (100U)
+#define TEST_PERIODS                    (5U)
+
+/**
+* @brief Pins of the ports that are no channel, driven high to check they are never touched
+*/
+#define TEST_OTHER_PINS                 (0x80000000UL)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Test case descriptor
+*/
+typedef struct
+{
+    const char* testName;           /**< @brief Test case name */
+    uint8 (*testFunc)(void);        /**< @brief Test case function */
+} TestCase_Type;
+
+/*==================================================================================================
+*                                      LOCAL CONSTANTS
+==================================================================================================*/
+static GPIO_Type* const Test_Ports[TEST_PORTS] = { IP_PTB, IP_PTC, IP_PTD };
+static const uint8 Test_PortIndex[TEST_PORTS] = { 1U, 2U, 3U };
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Channels: 8 per port, PTB0-7, PTC8-15, PTD16-23
+*/
+static PortHw_PwmChannelConfigType Test_Channels[TEST_CHANNELS];
+static PortHw_PwmConfigType Test_Config;
+
+/**
+* @brief High ticks of every channel in the current period
+*/
+static uint32 Test_High[TEST_CHANNELS];
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void Test_Setup(void);
+static void Test_SetDuties(const uint16 duties[]);
+static uint8 Test_Level(uint32 channel);
+static void Test_Accumulate(uint32 ticks);
+static uint8 Test_CheckPeriod(const uint16 duties[], uint32 period, const char* pMode);
+static uint8 Test_CheckOtherPins(void);
+static uint32 Test_ExpectedWrites(const uint16 duties[]);
+static uint8 Test_PORT_HW_PWM_001(void);    /* Duty accuracy, PortHw_PwmTick() */
+static uint8 Test_PORT_HW_PWM_002(void);    /* Duty accuracy, PortHw_PwmEvent() */
+static uint8 Test_PORT_HW_PWM_003(void);    /* Register writes per period */
+static uint8 Test_PORT_HW_PWM_004(void);    /* Duty update at the period start only */
+static uint8 Test_PORT_HW_PWM_005(void);    /* 0 and 100 percent, stop */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Resets the simulator, drives the other pins high and starts the PWM
+*/
+static void Test_Setup(void)
+{
+    uint32 channel;
+    uint32 port;
+
+    PortHwSim_Reset();
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        Test_Channels[channel].Port_u8 = (uint8)(channel / 8U);
+        Test_Channels[channel].Pin_u8 = (uint8)(((channel / 8U) * 8U) + (channel % 8U));
+    }
+    Test_Config.Ports_ptr = Test_Ports;
+    Test_Config.NumPorts_u8 = (uint8)TEST_PORTS;
+    Test_Config.Channels_ptr = Test_Channels;
+    Test_Config.NumChannels_u8 = (uint8)TEST_CHANNELS;
+    Test_Config.Period_u16 = (uint16)TEST_PERIOD;
+    for (port = 0U; port < TEST_PORTS; port++)
+    {
+        PortHwSim_g_GpioRegs_ast[Test_PortIndex[port]].PDOR = TEST_OTHER_PINS | 0x00FFFF00UL;
+    }
+    PortHw_PwmStart(&Test_Config);
+    (void)memset(Test_High, 0, sizeof(Test_High));
+}
+
+/**
+* @brief Sets the duty of every channel and publishes them
+*/
+static void Test_SetDuties(const uint16 duties[])
+{
+    uint32 channel;
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        PortHw_PwmSetDuty((uint8)channel, duties[channel]);
+    }
+    PortHw_PwmUpdate();
+}
+
+/**
+* @brief Output level of a channel
+*/
+static uint8 Test_Level(uint32 channel)
+{
+    return (uint8)((PortHwSim_g_GpioRegs_ast[Test_PortIndex[channel / 8U]].PDOR >> Test_Channels[channel].Pin_u8) & 1U);
+}
+
+/**
+* @brief Adds the ticks to the high time of every channel that is high
+*/
+static void Test_Accumulate(uint32 ticks)
+{
+    uint32 channel;
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        Test_High[channel] += (uint32)Test_Level(channel) * ticks;
+    }
+}
+
+/**
+* @brief Compares the high ticks of a period with the duties and restarts the count
+*/
+static uint8 Test_CheckPeriod(const uint16 duties[], uint32 period, const char* pMode)
+{
+    uint32 channel;
+    uint8 result = TEST_PASSED;
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        if (Test_High[channel] != (uint32)duties[channel])
+        {
+            (void)printf("  %s period %u channel %u: %u high ticks, duty %u\n", pMode, (unsigned)period,
+                         (unsigned)channel, (unsigned)Test_High[channel], (unsigned)duties[channel]);
+            result = TEST_FAILED;
+        }
+    }
+    (void)memset(Test_High, 0, sizeof(Test_High));
+
+    return result;
+}
+
+/**
+* @brief Checks that the pins that are no channel kept their level
+*/
+static uint8 Test_CheckOtherPins(void)
+{
+    uint32 port;
+    uint8 result = TEST_PASSED;
+
+    for (port = 0U; port < TEST_PORTS; port++)
+    {
+        if (0U == (PortHwSim_g_GpioRegs_ast[Test_PortIndex[port]].PDOR & TEST_OTHER_PINS))
+        {
+            (void)printf("  port %u: pin outside the channels changed\n", (unsigned)port);
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief Register writes of one period: one PSOR per port with a channel on, one PCOR per port
+*        and distinct duty strictly between 0 and the period
+*/
+static uint32 Test_ExpectedWrites(const uint16 duties[])
+{
+    uint32 port;
+    uint32 channel;
+    uint32 other;
+    uint32 writes = 0U;
+    boolean seen;
+
+    for (port = 0U; port < TEST_PORTS; port++)
+    {
+        seen = FALSE;
+        for (channel = port * 8U; channel < ((port + 1U) * 8U); channel++)
+        {
+            if (0U != duties[channel])
+            {
+                seen = TRUE;
+            }
+            if ((0U != duties[channel]) && (TEST_PERIOD != duties[channel]))
+            {
+                /* First channel of the port with this duty */
+                for (other = port * 8U; (other < channel) && (duties[other] != duties[channel]); other++)
+                {
+                }
+                if (other == channel)
+                {
+                    writes++;
+                }
+            }
+        }
+        if (TRUE == seen)
+        {
+            writes++;
+        }
+    }
+
+    return writes;
+}
+
+/**
+* @brief PORT_HW_PWM_001 - Duty accuracy, PortHw_PwmTick()
+* @details Random duties 0..100 (0 and 100 included) on the 24 channels: in each of 5 periods
+*          every channel is high for exactly its duty in ticks. The pins outside the channels
+*          are never written.
+*/
+static uint8 Test_PORT_HW_PWM_001(void)
+{
+    uint16 duties[TEST_CHANNELS];
+    uint32 seed = 0x1234567U;
+    uint32 channel;
+    uint32 period;
+    uint32 tick;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup();
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        duties[channel] = (uint16)((seed >> 16) % (TEST_PERIOD + 1U));
+    }
+    duties[0] = 0U;
+    duties[9] = (uint16)TEST_PERIOD;
+    duties[17] = 1U;
+    duties[23] = (uint16)(TEST_PERIOD - 1U);
+    Test_SetDuties(duties);
+
+    for (period = 0U; period < TEST_PERIODS; period++)
+    {
+        for (tick = 0U; tick < TEST_PERIOD; tick++)
+        {
+            PortHw_PwmTick();
+            Test_Accumulate(1U);
+        }
+        if (TEST_PASSED != Test_CheckPeriod(duties, period, "tick"))
+        {
+            result = TEST_FAILED;
+        }
+    }
+    if (TEST_PASSED != Test_CheckOtherPins())
+    {
+        result = TEST_FAILED;
+    }
+    PortHw_PwmStop();
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_PWM_002 - Duty accuracy, PortHw_PwmEvent()
+* @details Same duties paced by a compare timer: the returned intervals add up to the period
+*          and every channel is high for exactly its duty in every period.
+*/
+static uint8 Test_PORT_HW_PWM_002(void)
+{
+    uint16 duties[TEST_CHANNELS];
+    uint32 seed = 0x7654321U;
+    uint32 channel;
+    uint32 period;
+    uint32 time;
+    uint32 ticks;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup();
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        duties[channel] = (uint16)((seed >> 16) % (TEST_PERIOD + 1U));
+    }
+    Test_SetDuties(duties);
+
+    for (period = 0U; period < TEST_PERIODS; period++)
+    {
+        time = 0U;
+        while (time < TEST_PERIOD)
+        {
+            ticks = PortHw_PwmEvent();
+            if (0U == ticks)
+            {
+                break;
+            }
+            Test_Accumulate(ticks);
+            time += ticks;
+        }
+        if (time != TEST_PERIOD)
+        {
+            (void)printf("  period %u: edges span %u ticks\n", (unsigned)period, (unsigned)time);
+            result = TEST_FAILED;
+        }
+        if (TEST_PASSED != Test_CheckPeriod(duties, period, "event"))
+        {
+            result = TEST_FAILED;
+        }
+    }
+    PortHw_PwmStop();
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_PWM_003 - Register writes per period
+* @details 24 channels with 4 distinct duties (10, 25, 50, 75 ticks): a period is 3 PSOR
+*          writes and one PCOR write per port and distinct duty of the port, 15 writes instead
+*          of 48 for a per-channel set and clear. Ticks without an edge write nothing, no
+*          register is read. Random duties match Test_ExpectedWrites() as well.
+*/
+static uint8 Test_PORT_HW_PWM_003(void)
+{
+    static const uint16 levels[4] = { 10U, 25U, 50U, 75U };
+    uint16 duties[TEST_CHANNELS];
+    uint32 seed = 0xCAFEF00DU;
+    uint32 channel;
+    uint32 tick;
+    uint32 writes;
+    uint32 edgeTicks;
+    uint32 round;
+    uint8 result = TEST_PASSED;
+
+    for (round = 0U; round < 20U; round++)
+    {
+        Test_Setup();
+        for (channel = 0U; channel < TEST_CHANNELS; channel++)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            duties[channel] = (0U == round) ? levels[(channel * 5U) % 4U] : (uint16)((seed >> 16) % (TEST_PERIOD + 1U));
+        }
+        Test_SetDuties(duties);
+        PortHwSim_ClearCounters();
+
+        edgeTicks = 0U;
+        for (tick = 0U; tick < TEST_PERIOD; tick++)
+        {
+            writes = PortHwSim_g_GpioWriteCount_u32;
+            PortHw_PwmTick();
+            if (writes != PortHwSim_g_GpioWriteCount_u32)
+            {
+                edgeTicks++;
+            }
+        }
+
+        if ((PortHwSim_g_GpioWriteCount_u32 != Test_ExpectedWrites(duties)) || (0U != PortHwSim_g_ReadCount_u32))
+        {
+            (void)printf("  round %u: %u writes (expected %u), %u reads\n", (unsigned)round,
+                         (unsigned)PortHwSim_g_GpioWriteCount_u32, (unsigned)Test_ExpectedWrites(duties),
+                         (unsigned)PortHwSim_g_ReadCount_u32);
+            result = TEST_FAILED;
+        }
+        if (0U == round)
+        {
+            (void)printf("  %u channels, 4 distinct duties: %u writes on %u of %u ticks per period (per-channel: %u)\n",
+                         (unsigned)TEST_CHANNELS, (unsigned)PortHwSim_g_GpioWriteCount_u32, (unsigned)edgeTicks,
+                         (unsigned)TEST_PERIOD, (unsigned)(2U * TEST_CHANNELS));
+            if ((15U != PortHwSim_g_GpioWriteCount_u32) || (5U != edgeTicks))
+            {
+                result = TEST_FAILED;
+            }
+        }
+        PortHw_PwmStop();
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_PWM_004 - Duty update at the period start only
+* @details Duties changed and published in the middle of a period do not change that period;
+*          the next one uses them. Two updates before a period start: the last one wins.
+*          Set duties are not played before PortHw_PwmUpdate().
+*/
+static uint8 Test_PORT_HW_PWM_004(void)
+{
+    uint16 first[TEST_CHANNELS];
+    uint16 second[TEST_CHANNELS];
+    uint16 third[TEST_CHANNELS];
+    uint32 channel;
+    uint32 tick;
+    uint8 result = TEST_PASSED;
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        first[channel] = (uint16)(channel * 4U);
+        second[channel] = (uint16)(TEST_PERIOD - (channel * 4U));
+        third[channel] = (uint16)(50U + channel);
+    }
+
+    Test_Setup();
+    Test_SetDuties(first);
+    for (tick = 0U; tick < TEST_PERIOD; tick++)
+    {
+        PortHw_PwmTick();
+        Test_Accumulate(1U);
+        if (37U == tick)
+        {
+            Test_SetDuties(third);
+            Test_SetDuties(second);
+        }
+    }
+    if (TEST_PASSED != Test_CheckPeriod(first, 0U, "update"))
+    {
+        result = TEST_FAILED;
+    }
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        PortHw_PwmSetDuty((uint8)channel, third[channel]);
+    }
+    for (tick = 0U; tick < TEST_PERIOD; tick++)
+    {
+        PortHw_PwmTick();
+        Test_Accumulate(1U);
+    }
+    if (TEST_PASSED != Test_CheckPeriod(second, 1U, "update"))
+    {
+        result = TEST_FAILED;
+    }
+    PortHw_PwmStop();
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_PWM_005 - 0 and 100 percent, stop
+* @details All channels at 0: no register write in a period. All at 100: one PSOR write per
+*          port per period and the channels stay high. PortHw_PwmStop() drives every channel
+*          low with one PCOR write per port; a stopped PWM ignores ticks and events.
+*/
+static uint8 Test_PORT_HW_PWM_005(void)
+{
+    uint16 duties[TEST_CHANNELS];
+    uint32 channel;
+    uint32 tick;
+    uint8 result = TEST_PASSED;
+
+    Test_Setup();
+    (void)memset(duties, 0, sizeof(duties));
+    Test_SetDuties(duties);
+    PortHwSim_ClearCounters();
+    for (tick = 0U; tick < TEST_PERIOD; tick++)
+    {
+        PortHw_PwmTick();
+        Test_Accumulate(1U);
+    }
+    if ((0U != PortHwSim_g_GpioWriteCount_u32) || (TEST_PASSED != Test_CheckPeriod(duties, 0U, "0%")))
+    {
+        (void)printf("  0%%: %u writes\n", (unsigned)PortHwSim_g_GpioWriteCount_u32);
+        result = TEST_FAILED;
+    }
+
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        duties[channel] = (uint16)TEST_PERIOD;
+    }
+    Test_SetDuties(duties);
+    PortHwSim_ClearCounters();
+    for (tick = 0U; tick < (2U * TEST_PERIOD); tick++)
+    {
+        PortHw_PwmTick();
+        if (TEST_PERIOD == tick)
+        {
+            (void)Test_CheckPeriod(duties, 1U, "100%");
+        }
+        Test_Accumulate(1U);
+    }
+    if ((2U * TEST_PORTS) != PortHwSim_g_GpioWriteCount_u32)
+    {
+        (void)printf("  100%%: %u writes in 2 periods\n", (unsigned)PortHwSim_g_GpioWriteCount_u32);
+        result = TEST_FAILED;
+    }
+    if (TEST_PASSED != Test_CheckPeriod(duties, 2U, "100%"))
+    {
+        result = TEST_FAILED;
+    }
+
+    PortHwSim_ClearCounters();
+    PortHw_PwmStop();
+    PortHw_PwmTick();
+    for (channel = 0U; channel < TEST_CHANNELS; channel++)
+    {
+        if (0U != Test_Level(channel))
+        {
+            (void)printf("  channel %u high after stop\n", (unsigned)channel);
+            result = TEST_FAILED;
+        }
+    }
+    if ((TEST_PORTS != PortHwSim_g_GpioWriteCount_u32) || (0U != PortHw_PwmEvent()) ||
+        (TEST_PASSED != Test_CheckOtherPins()))
+    {
+        (void)printf("  stop: %u writes\n", (unsigned)PortHwSim_g_GpioWriteCount_u32);
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    static const TestCase_Type testCases[] =
+    {
+        { "PORT_HW_PWM_001 duty accuracy, tick pacing", Test_PORT_HW_PWM_001 },
+        { "PORT_HW_PWM_002 duty accuracy, event pacing", Test_PORT_HW_PWM_002 },
+        { "PORT_HW_PWM_003 register writes per period", Test_PORT_HW_PWM_003 },
+        { "PORT_HW_PWM_004 duty update at period start", Test_PORT_HW_PWM_004 },
+        { "PORT_HW_PWM_005 0 and 100 percent, stop", Test_PORT_HW_PWM_005 },
+    };
+    uint32 i;
+    uint32 failed = 0U;
+    uint8 result;
+
+    for (i = 0U; i < (sizeof(testCases) / sizeof(testCases[0])); i++)
+    {
+        (void)printf("[RUN ] %s\n", testCases[i].testName);
+        result = testCases[i].testFunc();
+        (void)printf("[%s] %s\n", (TEST_PASSED == result) ? "PASS" : "FAIL", testCases[i].testName);
+        if (TEST_PASSED != result)
+        {
+            failed++;
+        }
+    }
+
+    (void)printf("%u/%u tests passed\n", (unsigned)(i - failed), (unsigned)i);
+
+    return (0U == failed) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,725 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   Autosar Revision     : ASR_REL_21_11_REV_0000
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host tests of the Port_Hw waveform playback
+==================================================================================================*/
+
+/**
+*   @file    test_port_hw_wave_host.c
+*
+*   @brief   Host tests of the Port_Hw waveform playback
+*   @details Plays buffers on PTD and PTE of the simulated register file. The DMA backend is
+*            stepped with PortHwSim_DmaRequest(), one call per PIT trigger, and its interrupt
+*            is delivered by the DMA interrupt hook of the simulator to
+*            PortHw_WaveDmaIrqHandler(); the CPU backend is stepped with PortHw_WaveTick().
+*            After every step PDOR is compared with a model of the target register, and the
+*            core register writes are counted to check that the DMA backend needs none per
+*            word.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Test/Port_Hw_Test/test_port_hw_wave_host.c Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw_Wave.c -o test_port_hw_wave_host
+*            ./test_port_hw_wave_host
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include "Port_Hw_Sim.h"
+#include "Port_Hw_Wave.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Test result macros
+*/
+#define TEST_PASSED                     (0U)
+#define TEST_FAILED                     (1U)
+
+/**
+* @brief Simulated port indexes
+*/
+#define TEST_PTD_INDEX                  (3U)
+#define TEST_PTE_INDEX                  (4U)
+
+/**
+* @brief Buffer half, buffer passes of the pattern tests and length of the streamed sequence
+*/
+#define TEST_HALF                       (8U)
+#define TEST_PASSES                     (3U)
+#define TEST_STREAM_HALF                (16U)
+#define TEST_SEQUENCE_LENGTH            (1000U)
+
+/**
+* @brief eDMA channels of the streams
+*/
+#define TEST_CHANNEL_0                  (0U)
+#define TEST_CHANNEL_1                  (3U)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Test case descriptor
+*/
+typedef struct
+{
+    const char* testName;           /**< @brief Test case name */
+    uint8 (*testFunc)(void);        /**< @brief Test case function */
+} TestCase_Type;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Played buffers of the streams
+*/
+static uint32 Test_Buffer[PORT_HW_WAVE_MAX_STREAMS_U8][2U * TEST_STREAM_HALF];
+
+/**
+* @brief Long sequence streamed through a buffer by refilling its halves, and its next word
+*/
+static uint32 Test_Sequence[TEST_SEQUENCE_LENGTH];
+static uint32 Test_NextFill;
+
+/**
+* @brief PDOR after every step, one row per backend
+*/
+static uint32 Test_Output[2U][TEST_SEQUENCE_LENGTH];
+
+/**
+* @brief Notifications received: count, halves in order, stream of the last one
+*/
+static uint32 Test_NotifyCount;
+static uint8 Test_NotifyHalves[2U * TEST_SEQUENCE_LENGTH];
+static uint8 Test_NotifyStream;
+
+/**
+* @brief Interrupts delivered by the simulated eDMA
+*/
+static uint32 Test_IrqCount;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static uint32 Test_Random(uint32* pSeed);
+static void Test_DmaIrq(uint8 Channel_u8);
+static void Test_Notify(uint8 Stream_u8, uint8 Half_u8);
+static void Test_Refill(uint8 Stream_u8, uint8 Half_u8);
+static void Test_Setup(void);
+static void Test_Config(PortHw_WaveConfigType* pConfig, uint8 stream, PortHw_WaveTargetType target,
+                        PortHw_WaveBackendType backend, uint16 half, boolean loop);
+static boolean Test_Step(uint8 stream, const PortHw_WaveConfigType* pConfig);
+static uint32 Test_Apply(PortHw_WaveTargetType target, uint32 pdor, uint32 word);
+static uint8 Test_PORT_HW_WAVE_001(void);   /* Pattern correctness on every target register, DMA */
+static uint8 Test_PORT_HW_WAVE_002(void);   /* Double buffering through the half notifications */
+static uint8 Test_PORT_HW_WAVE_003(void);   /* CPU fallback: same output, one write per word */
+static uint8 Test_PORT_HW_WAVE_004(void);   /* One-shot buffer */
+static uint8 Test_PORT_HW_WAVE_005(void);   /* Stop, and two streams side by side */
+static uint8 Test_PORT_HW_WAVE_006(void);   /* Late DMA interrupt: merged half and major interrupts */
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief xorshift32
+*/
+static uint32 Test_Random(uint32* pSeed)
+{
+    *pSeed ^= *pSeed << 13;
+    *pSeed ^= *pSeed >> 17;
+    *pSeed ^= *pSeed << 5;
+
+    return *pSeed;
+}
+
+/**
+* @brief DMA interrupt model: DMAn_IRQHandler of the streams
+*/
+static void Test_DmaIrq(uint8 Channel_u8)
+{
+    Test_IrqCount++;
+    PortHw_WaveDmaIrqHandler((TEST_CHANNEL_1 == Channel_u8) ? 1U : 0U);
+}
+
+/**
+* @brief Half notification recording the halves
+*/
+static void Test_Notify(uint8 Stream_u8, uint8 Half_u8)
+{
+    if (Test_NotifyCount < (uint32)sizeof(Test_NotifyHalves))
+    {
+        Test_NotifyHalves[Test_NotifyCount] = Half_u8;
+    }
+    Test_NotifyCount++;
+    Test_NotifyStream = Stream_u8;
+}
+
+/**
+* @brief Half notification refilling the played half with the next words of the sequence
+*/
+static void Test_Refill(uint8 Stream_u8, uint8 Half_u8)
+{
+    uint32 i;
+
+    Test_Notify(Stream_u8, Half_u8);
+    for (i = 0U; i < TEST_STREAM_HALF; i++)
+    {
+        Test_Buffer[Stream_u8][((uint32)Half_u8 * TEST_STREAM_HALF) + i] =
+            (Test_NextFill < TEST_SEQUENCE_LENGTH) ? Test_Sequence[Test_NextFill] : 0U;
+        Test_NextFill++;
+    }
+}
+
+/**
+* @brief Resets the simulator and the recorded notifications
+*/
+static void Test_Setup(void)
+{
+    PortHwSim_Reset();
+    PortHwSim_SetDmaIrqHook(Test_DmaIrq);
+    Test_NotifyCount = 0U;
+    Test_NotifyStream = 0xFFU;
+    Test_IrqCount = 0U;
+}
+
+/**
+* @brief Configuration of a stream: stream 0 plays on PTD with channel 0, stream 1 on PTE
+*        with channel 3
+*/
+static void Test_Config(PortHw_WaveConfigType* pConfig, uint8 stream, PortHw_WaveTargetType target,
+                        PortHw_WaveBackendType backend, uint16 half, boolean loop)
+{
+    pConfig->GpioBase_ptr = (0U == stream) ? IP_PTD : IP_PTE;
+    pConfig->Target_en = target;
+    pConfig->Buffer_ptr = Test_Buffer[stream];
+    pConfig->HalfLength_u16 = half;
+    pConfig->Backend_en = backend;
+    pConfig->DmaChannel_u8 = (0U == stream) ? TEST_CHANNEL_0 : TEST_CHANNEL_1;
+    pConfig->Loop_boo = loop;
+    pConfig->Notification = Test_Notify;
+}
+
+/**
+* @brief One timer period of a stream: a PIT trigger or a PortHw_WaveTick() call
+*/
+static boolean Test_Step(uint8 stream, const PortHw_WaveConfigType* pConfig)
+{
+    boolean moved = TRUE;
+
+    if (PORT_HW_WAVE_BACKEND_DMA == pConfig->Backend_en)
+    {
+        moved = PortHwSim_DmaRequest(pConfig->DmaChannel_u8);
+    }
+    else
+    {
+        PortHw_WaveTick(stream);
+    }
+
+    return moved;
+}
+
+/**
+* @brief Model of a write of the target register
+*/
+static uint32 Test_Apply(PortHw_WaveTargetType target, uint32 pdor, uint32 word)
+{
+    uint32 result;
+
+    switch (target)
+    {
+        case PORT_HW_WAVE_TARGET_PSOR:
+            result = pdor | word;
+            break;
+        case PORT_HW_WAVE_TARGET_PCOR:
+            result = pdor & ~word;
+            break;
+        case PORT_HW_WAVE_TARGET_PTOR:
+            result = pdor ^ word;
+            break;
+        default:
+            result = word;
+            break;
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_001 - Pattern correctness on every target register, DMA backend
+* @details A random 2 x 8 word buffer is replayed 3 times into PDOR, PSOR, PCOR and PTOR of
+*          PTD: PDOR follows the register model after every request, the TCD and the DMAMUX
+*          channel are programmed as documented, each pass raises a half and a major
+*          interrupt, and the only core writes after the start are the CINT write of each
+*          interrupt and the CDNE write of each major loop: 0 core writes per word.
+*/
+static uint8 Test_PORT_HW_WAVE_001(void)
+{
+    PortHw_WaveConfigType config;
+    PortHw_WaveTargetType target;
+    uint32 seed = 0x2545F491U;
+    uint32 expected;
+    uint32 step;
+    uint32 writes;
+    uint8 result = TEST_PASSED;
+
+    for (target = PORT_HW_WAVE_TARGET_PDOR; target <= PORT_HW_WAVE_TARGET_PTOR; target++)
+    {
+        Test_Setup();
+        for (step = 0U; step < (2U * TEST_HALF); step++)
+        {
+            Test_Buffer[0][step] = Test_Random(&seed);
+        }
+        expected = 0x5A5A5A5AU;
+        PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR = expected;
+        Test_Config(&config, 0U, target, PORT_HW_WAVE_BACKEND_DMA, TEST_HALF, TRUE);
+        PortHw_WaveStart(0U, &config);
+
+        if ((IP_DMAMUX->CHCFG[TEST_CHANNEL_0] != (uint8)(DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_TRIG_MASK | 63U)) ||
+            (IP_DMA->ERQ != (1UL << TEST_CHANNEL_0)) || (IP_DMA->TCD[TEST_CHANNEL_0].NBYTES.MLNO != 4U) ||
+            (IP_DMA->TCD[TEST_CHANNEL_0].ATTR != (uint16)0x0202U) || (IP_DMA->TCD[TEST_CHANNEL_0].DOFF != 0U) ||
+            (IP_DMA->TCD[TEST_CHANNEL_0].BITER.ELINKNO != (2U * TEST_HALF)) ||
+            (IP_DMA->TCD[TEST_CHANNEL_0].CSR != (uint16)(DMA_TCD_CSR_INTHALF_MASK | DMA_TCD_CSR_INTMAJOR_MASK)))
+        {
+            (void)printf("  target %u: CHCFG 0x%02X ERQ 0x%X CSR 0x%04X\n", (unsigned)target,
+                         (unsigned)IP_DMAMUX->CHCFG[TEST_CHANNEL_0], (unsigned)IP_DMA->ERQ,
+                         (unsigned)IP_DMA->TCD[TEST_CHANNEL_0].CSR);
+            result = TEST_FAILED;
+        }
+
+        PortHwSim_ClearCounters();
+        for (step = 0U; step < (TEST_PASSES * 2U * TEST_HALF); step++)
+        {
+            writes = PortHwSim_g_WriteCount_u32;
+            (void)Test_Step(0U, &config);
+            expected = Test_Apply(target, expected, Test_Buffer[0][step % (2U * TEST_HALF)]);
+            if (PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR != expected)
+            {
+                (void)printf("  target %u step %u: PDOR 0x%08X expected 0x%08X\n", (unsigned)target, (unsigned)step,
+                             (unsigned)PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR, (unsigned)expected);
+                result = TEST_FAILED;
+                break;
+            }
+            if ((0U != ((step + 1U) % TEST_HALF)) && (writes != PortHwSim_g_WriteCount_u32))
+            {
+                (void)printf("  target %u step %u: core write without interrupt\n", (unsigned)target, (unsigned)step);
+                result = TEST_FAILED;
+            }
+        }
+
+        if ((Test_IrqCount != (2U * TEST_PASSES)) || (PortHwSim_g_WriteCount_u32 != (Test_IrqCount + TEST_PASSES)) ||
+            (PortHwSim_g_DmaWriteCount_u32 != (TEST_PASSES * 2U * TEST_HALF)) || (0U != IP_DMA->INT) ||
+            (Test_NotifyCount != (2U * TEST_PASSES)) || (0U != Test_NotifyStream))
+        {
+            (void)printf("  target %u: %u interrupts, %u core writes, %u DMA writes, %u notifications\n",
+                         (unsigned)target, (unsigned)Test_IrqCount, (unsigned)PortHwSim_g_WriteCount_u32,
+                         (unsigned)PortHwSim_g_DmaWriteCount_u32, (unsigned)Test_NotifyCount);
+            result = TEST_FAILED;
+        }
+        for (step = 0U; step < Test_NotifyCount; step++)
+        {
+            if (Test_NotifyHalves[step] != (uint8)(step & 1U))
+            {
+                (void)printf("  target %u: notification %u reports half %u\n", (unsigned)target, (unsigned)step,
+                             (unsigned)Test_NotifyHalves[step]);
+                result = TEST_FAILED;
+            }
+        }
+        PortHw_WaveStop(0U);
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_002 - Double buffering through the half notifications
+* @details A 1000 word sequence is played through a 2 x 16 word buffer: the buffer starts
+*          with the first 32 words and every half notification refills the played half with
+*          the next 16. PDOR follows the sequence word by word on both backends.
+*/
+static uint8 Test_PORT_HW_WAVE_002(void)
+{
+    PortHw_WaveConfigType config;
+    PortHw_WaveBackendType backend;
+    uint32 seed = 0x9E3779B9U;
+    uint32 step;
+    uint8 result = TEST_PASSED;
+
+    for (step = 0U; step < TEST_SEQUENCE_LENGTH; step++)
+    {
+        Test_Sequence[step] = Test_Random(&seed);
+    }
+
+    for (backend = PORT_HW_WAVE_BACKEND_DMA; backend <= PORT_HW_WAVE_BACKEND_CPU; backend++)
+    {
+        Test_Setup();
+        (void)memcpy(Test_Buffer[0], Test_Sequence, sizeof(Test_Buffer[0]));
+        Test_NextFill = 2U * TEST_STREAM_HALF;
+        Test_Config(&config, 0U, PORT_HW_WAVE_TARGET_PDOR, backend, TEST_STREAM_HALF, TRUE);
+        config.Notification = Test_Refill;
+        PortHw_WaveStart(0U, &config);
+
+        for (step = 0U; step < TEST_SEQUENCE_LENGTH; step++)
+        {
+            (void)Test_Step(0U, &config);
+            if (PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR != Test_Sequence[step])
+            {
+                (void)printf("  backend %u word %u: PDOR 0x%08X expected 0x%08X\n", (unsigned)backend, (unsigned)step,
+                             (unsigned)PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR, (unsigned)Test_Sequence[step]);
+                result = TEST_FAILED;
+                break;
+            }
+        }
+        if (Test_NotifyCount != (TEST_SEQUENCE_LENGTH / TEST_STREAM_HALF))
+        {
+            (void)printf("  backend %u: %u notifications\n", (unsigned)backend, (unsigned)Test_NotifyCount);
+            result = TEST_FAILED;
+        }
+        PortHw_WaveStop(0U);
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_003 - CPU fallback
+* @details The same buffers played by both backends on every target register give the same
+*          PDOR after every step and the same notifications. Every PortHw_WaveTick() is one
+*          core register write and no read.
+*/
+static uint8 Test_PORT_HW_WAVE_003(void)
+{
+    PortHw_WaveConfigType config;
+    PortHw_WaveTargetType target;
+    PortHw_WaveBackendType backend;
+    uint32 seed = 0x6A09E667U;
+    uint32 notifications[2];
+    uint32 step;
+    uint8 result = TEST_PASSED;
+
+    for (target = PORT_HW_WAVE_TARGET_PDOR; target <= PORT_HW_WAVE_TARGET_PTOR; target++)
+    {
+        for (step = 0U; step < (2U * TEST_HALF); step++)
+        {
+            Test_Buffer[0][step] = Test_Random(&seed);
+        }
+        for (backend = PORT_HW_WAVE_BACKEND_DMA; backend <= PORT_HW_WAVE_BACKEND_CPU; backend++)
+        {
+            Test_Setup();
+            PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR = 0x0F0F0F0FU;
+            Test_Config(&config, 0U, target, backend, TEST_HALF, TRUE);
+            PortHw_WaveStart(0U, &config);
+            PortHwSim_ClearCounters();
+            for (step = 0U; step < (TEST_PASSES * 2U * TEST_HALF); step++)
+            {
+                (void)Test_Step(0U, &config);
+                Test_Output[backend][step] = PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR;
+            }
+            notifications[backend] = Test_NotifyCount;
+            if ((PORT_HW_WAVE_BACKEND_CPU == backend) &&
+                ((PortHwSim_g_WriteCount_u32 != (TEST_PASSES * 2U * TEST_HALF)) || (0U != PortHwSim_g_ReadCount_u32)))
+            {
+                (void)printf("  target %u: %u writes, %u reads for %u ticks\n", (unsigned)target,
+                             (unsigned)PortHwSim_g_WriteCount_u32, (unsigned)PortHwSim_g_ReadCount_u32,
+                             (unsigned)(TEST_PASSES * 2U * TEST_HALF));
+                result = TEST_FAILED;
+            }
+            PortHw_WaveStop(0U);
+        }
+
+        if ((0 != memcmp(Test_Output[PORT_HW_WAVE_BACKEND_DMA], Test_Output[PORT_HW_WAVE_BACKEND_CPU],
+                         TEST_PASSES * 2U * TEST_HALF * sizeof(uint32))) ||
+            (notifications[PORT_HW_WAVE_BACKEND_DMA] != notifications[PORT_HW_WAVE_BACKEND_CPU]))
+        {
+            (void)printf("  target %u: backends differ\n", (unsigned)target);
+            result = TEST_FAILED;
+        }
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_004 - One-shot buffer
+* @details With Loop_boo FALSE the buffer is played once on both backends: notifications for
+*          half 0 and half 1, the stream is no longer running, further timer periods do not
+*          change PDOR and the DMA request is disabled by the hardware. The check of the
+*          running state also holds before the last DMA interrupt is served.
+*/
+static uint8 Test_PORT_HW_WAVE_004(void)
+{
+    PortHw_WaveConfigType config;
+    PortHw_WaveBackendType backend;
+    uint32 step;
+    uint8 result = TEST_PASSED;
+
+    for (step = 0U; step < (2U * TEST_HALF); step++)
+    {
+        Test_Buffer[0][step] = step + 1U;
+    }
+
+    for (backend = PORT_HW_WAVE_BACKEND_DMA; backend <= PORT_HW_WAVE_BACKEND_CPU; backend++)
+    {
+        Test_Setup();
+        Test_Config(&config, 0U, PORT_HW_WAVE_TARGET_PDOR, backend, TEST_HALF, FALSE);
+        PortHw_WaveStart(0U, &config);
+        for (step = 0U; step < (4U * TEST_HALF); step++)
+        {
+            (void)Test_Step(0U, &config);
+            if ((step == ((2U * TEST_HALF) - 2U)) && (TRUE != PortHw_WaveIsRunning(0U)))
+            {
+                (void)printf("  backend %u: stopped early\n", (unsigned)backend);
+                result = TEST_FAILED;
+            }
+        }
+        if ((FALSE != PortHw_WaveIsRunning(0U)) || (PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR != (2U * TEST_HALF)) ||
+            (2U != Test_NotifyCount) || (0U != Test_NotifyHalves[0]) || (1U != Test_NotifyHalves[1]) ||
+            (0U != IP_DMA->ERQ))
+        {
+            (void)printf("  backend %u: running %u, PDOR %u, %u notifications, ERQ 0x%X\n", (unsigned)backend,
+                         (unsigned)PortHw_WaveIsRunning(0U), (unsigned)PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR,
+                         (unsigned)Test_NotifyCount, (unsigned)IP_DMA->ERQ);
+            result = TEST_FAILED;
+        }
+    }
+
+    /* DMA: the hardware ends the buffer even without the interrupt */
+    Test_Setup();
+    PortHwSim_SetDmaIrqHook(NULL_PTR);
+    Test_Config(&config, 0U, PORT_HW_WAVE_TARGET_PDOR, PORT_HW_WAVE_BACKEND_DMA, TEST_HALF, FALSE);
+    PortHw_WaveStart(0U, &config);
+    for (step = 0U; step < (2U * TEST_HALF); step++)
+    {
+        (void)Test_Step(0U, &config);
+    }
+    if ((FALSE != PortHw_WaveIsRunning(0U)) || (FALSE != Test_Step(0U, &config)))
+    {
+        (void)printf("  DMA without interrupt: still running\n");
+        result = TEST_FAILED;
+    }
+    PortHw_WaveStop(0U);
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_005 - Stop, and two streams side by side
+* @details Stream 0 (DMA channel 0, PTD PTOR) plays every timer period and stream 1 (DMA
+*          channel 3 then the CPU backend, PTE PDOR) every third one: neither disturbs the
+*          other. After PortHw_WaveStop() the DMA requests of stream 0 are ignored, its
+*          channel is unrouted, the output keeps the last word and stream 1 still plays.
+*/
+static uint8 Test_PORT_HW_WAVE_005(void)
+{
+    PortHw_WaveConfigType config[PORT_HW_WAVE_MAX_STREAMS_U8];
+    PortHw_WaveBackendType backend;
+    uint32 seed = 0xBB67AE85U;
+    uint32 expected[PORT_HW_WAVE_MAX_STREAMS_U8];
+    uint32 step;
+    uint8 stream;
+    uint8 result = TEST_PASSED;
+
+    for (stream = 0U; stream < PORT_HW_WAVE_MAX_STREAMS_U8; stream++)
+    {
+        for (step = 0U; step < (2U * TEST_STREAM_HALF); step++)
+        {
+            Test_Buffer[stream][step] = Test_Random(&seed);
+        }
+    }
+
+    for (backend = PORT_HW_WAVE_BACKEND_DMA; backend <= PORT_HW_WAVE_BACKEND_CPU; backend++)
+    {
+        Test_Setup();
+        Test_Config(&config[0], 0U, PORT_HW_WAVE_TARGET_PTOR, PORT_HW_WAVE_BACKEND_DMA, TEST_HALF, TRUE);
+        Test_Config(&config[1], 1U, PORT_HW_WAVE_TARGET_PDOR, backend, TEST_STREAM_HALF, TRUE);
+        PortHw_WaveStart(0U, &config[0]);
+        PortHw_WaveStart(1U, &config[1]);
+        expected[0] = 0U;
+        expected[1] = 0U;
+
+        for (step = 0U; step < 40U; step++)
+        {
+            (void)Test_Step(0U, &config[0]);
+            expected[0] ^= Test_Buffer[0][step % (2U * TEST_HALF)];
+            if (0U == (step % 3U))
+            {
+                (void)Test_Step(1U, &config[1]);
+                expected[1] = Test_Buffer[1][(step / 3U) % (2U * TEST_STREAM_HALF)];
+            }
+            if ((PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR != expected[0]) ||
+                (PortHwSim_g_GpioRegs_ast[TEST_PTE_INDEX].PDOR != expected[1]))
+            {
+                (void)printf("  backend %u step %u: PTD 0x%08X/0x%08X PTE 0x%08X/0x%08X\n", (unsigned)backend,
+                             (unsigned)step, (unsigned)PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR,
+                             (unsigned)expected[0], (unsigned)PortHwSim_g_GpioRegs_ast[TEST_PTE_INDEX].PDOR,
+                             (unsigned)expected[1]);
+                result = TEST_FAILED;
+                break;
+            }
+        }
+        if ((5U != Test_NotifyCount) || (0U != Test_NotifyStream))
+        {
+            /* 40 words of stream 0 (5 halves) and 14 words of stream 1 (no half yet) */
+            (void)printf("  backend %u: %u notifications\n", (unsigned)backend, (unsigned)Test_NotifyCount);
+            result = TEST_FAILED;
+        }
+
+        PortHw_WaveStop(0U);
+        if ((FALSE != PortHw_WaveIsRunning(0U)) || (TRUE != PortHw_WaveIsRunning(1U)) ||
+            (FALSE != Test_Step(0U, &config[0])) || (0U != IP_DMAMUX->CHCFG[TEST_CHANNEL_0]) ||
+            (PortHwSim_g_GpioRegs_ast[TEST_PTD_INDEX].PDOR != expected[0]))
+        {
+            (void)printf("  backend %u: stream 0 not stopped\n", (unsigned)backend);
+            result = TEST_FAILED;
+        }
+        (void)Test_Step(1U, &config[1]);
+        if (PortHwSim_g_GpioRegs_ast[TEST_PTE_INDEX].PDOR != Test_Buffer[1][14U])
+        {
+            (void)printf("  backend %u: stream 1 stopped with stream 0\n", (unsigned)backend);
+            result = TEST_FAILED;
+        }
+        PortHw_WaveStop(1U);
+    }
+
+    return result;
+}
+
+/**
+* @brief PORT_HW_WAVE_006 - Late DMA interrupt
+* @details The interrupt hook is removed and PortHw_WaveDmaIrqHandler() is called late:
+*          after a whole pass (half and major interrupt merged), after one half, after a
+*          major loop and the next half (merged), and after a major loop. Every played half
+*          is notified once and in playing order, and the interrupt and DONE flags are
+*          cleared. A one-shot buffer served only at its end gets both notifications.
+*/
+static uint8 Test_PORT_HW_WAVE_006(void)
+{
+    static const uint8 lateHalves[] = { 2U, 1U, 2U, 1U };
+    PortHw_WaveConfigType config;
+    uint32 call;
+    uint32 step;
+    uint32 played = 0U;
+    uint8 result = TEST_PASSED;
+
+    for (step = 0U; step < (2U * TEST_HALF); step++)
+    {
+        Test_Buffer[0][step] = step + 1U;
+    }
+
+    Test_Setup();
+    PortHwSim_SetDmaIrqHook(NULL_PTR);
+    Test_Config(&config, 0U, PORT_HW_WAVE_TARGET_PDOR, PORT_HW_WAVE_BACKEND_DMA, TEST_HALF, TRUE);
+    PortHw_WaveStart(0U, &config);
+    for (call = 0U; call < (uint32)sizeof(lateHalves); call++)
+    {
+        for (step = 0U; step < ((uint32)lateHalves[call] * TEST_HALF); step++)
+        {
+            (void)Test_Step(0U, &config);
+        }
+        played += lateHalves[call];
+        PortHw_WaveDmaIrqHandler(0U);
+        if ((Test_NotifyCount != played) || (0U != IP_DMA->INT) ||
+            (0U != (IP_DMA->TCD[TEST_CHANNEL_0].CSR & DMA_TCD_CSR_DONE_MASK)))
+        {
+            (void)printf("  call %u: %u notifications for %u halves, INT 0x%X, CSR 0x%04X\n", (unsigned)call,
+                         (unsigned)Test_NotifyCount, (unsigned)played, (unsigned)IP_DMA->INT,
+                         (unsigned)IP_DMA->TCD[TEST_CHANNEL_0].CSR);
+            result = TEST_FAILED;
+        }
+    }
+    for (step = 0U; step < Test_NotifyCount; step++)
+    {
+        if (Test_NotifyHalves[step] != (uint8)(step & 1U))
+        {
+            (void)printf("  notification %u reports half %u\n", (unsigned)step, (unsigned)Test_NotifyHalves[step]);
+            result = TEST_FAILED;
+        }
+    }
+    PortHw_WaveStop(0U);
+
+    /* One-shot buffer, interrupt served after the last word */
+    Test_Setup();
+    PortHwSim_SetDmaIrqHook(NULL_PTR);
+    Test_Config(&config, 0U, PORT_HW_WAVE_TARGET_PDOR, PORT_HW_WAVE_BACKEND_DMA, TEST_HALF, FALSE);
+    PortHw_WaveStart(0U, &config);
+    for (step = 0U; step < (2U * TEST_HALF); step++)
+    {
+        (void)Test_Step(0U, &config);
+    }
+    PortHw_WaveDmaIrqHandler(0U);
+    if ((2U != Test_NotifyCount) || (0U != Test_NotifyHalves[0]) || (1U != Test_NotifyHalves[1]) ||
+        (FALSE != PortHw_WaveIsRunning(0U)))
+    {
+        (void)printf("  one-shot: %u notifications, running %u\n", (unsigned)Test_NotifyCount,
+                     (unsigned)PortHw_WaveIsRunning(0U));
+        result = TEST_FAILED;
+    }
+
+    return result;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+int main(void)
+{
+    static const TestCase_Type testCases[] =
+    {
+        { "PORT_HW_WAVE_001 pattern on PDOR/PSOR/PCOR/PTOR, DMA", Test_PORT_HW_WAVE_001 },
+        { "PORT_HW_WAVE_002 double buffering", Test_PORT_HW_WAVE_002 },
+        { "PORT_HW_WAVE_003 CPU fallback", Test_PORT_HW_WAVE_003 },
+        { "PORT_HW_WAVE_004 one-shot buffer", Test_PORT_HW_WAVE_004 },
+        { "PORT_HW_WAVE_005 stop, two streams", Test_PORT_HW_WAVE_005 },
+        { "PORT_HW_WAVE_006 late DMA interrupt", Test_PORT_HW_WAVE_006 },
+    };
+    uint32 i;
+    uint32 failed = 0U;
+    uint8 result;
+
+    for (i = 0U; i < (sizeof(testCases) / sizeof(testCases[0])); i++)
+    {
+        (void)printf("[RUN ] %s\n", testCases[i].testName);
+        result = testCases[i].testFunc();
+        (void)printf("[%s] %s\n", (TEST_PASSED == result) ? "PASS" : "FAIL", testCases[i].testName);
+        if (TEST_PASSED != result)
+        {
+            failed++;
+        }
+    }
+
+    (void)printf("%u/%u tests passed\n", (unsigned)(i - failed), (unsigned)i);
+
+    return (0U == failed) ? 0 : 1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,599 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Simulated PORT/GPIO register file for host testing of Port_Hw
+==================================================================================================*/
+
+/**
+*   @file    Port_Hw_Sim.c
+*
+*   @brief   Simulated PORT/GPIO register file stub
+*   @details Models the register side effects of the S32K144 PORT and GPIO blocks that the
+*            Port_Hw layer relies on, and counts every register access. The eDMA channels of
+*            Port_Hw_Wave are stepped one hardware request at a time.
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <string.h>
+#include "Port_Hw_Sim.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Number of pins covered by one Global Pin/Interrupt Control register
+*/
+#define PORT_HW_SIM_HALF_PINS_U32           (16U)
+
+/**
+* @brief PCR bits controlled by GPCLR/GPCHR and locked by PCR[LK]
+*/
+#define PORT_HW_SIM_PCR_LOW_MASK_U32        (0x0000FFFFU)
+
+/**
+* @brief PCR bits controlled by GICLR/GICHR
+*/
+#define PORT_HW_SIM_PCR_HIGH_MASK_U32       (0xFFFF0000U)
+
+/**
+* @brief Simulated eDMA address regions: count and position of the region number
+*/
+#define PORT_HW_SIM_DMA_REGIONS_U32         (16U)
+#define PORT_HW_SIM_DMA_REGION_SHIFT_U32    (20U)
+#define PORT_HW_SIM_DMA_OFFSET_MASK_U32     ((1UL << PORT_HW_SIM_DMA_REGION_SHIFT_U32) - 1U)
+
+/**
+* @brief eDMA channel selected by a SERQ/CERQ/CINT/CDNE write
+*/
+#define PORT_HW_SIM_DMA_CHANNEL_MASK_U8     ((uint8)0x0FU)
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+PORT_Type PortHwSim_g_PortRegs_ast[PORT_HW_SIM_PORT_COUNT_U8];
+GPIO_Type PortHwSim_g_GpioRegs_ast[PORT_HW_SIM_PORT_COUNT_U8];
+uint32 PortHwSim_g_WriteCount_u32 = 0U;
+uint32 PortHwSim_g_GpioWriteCount_u32 = 0U;
+uint32 PortHwSim_g_ReadCount_u32 = 0U;
+uint32 PortHwSim_g_BitBandWriteCount_u32 = 0U;
+uint32 PortHwSim_g_Cycles_u32 = 0U;
+uint32 PortHwSim_g_FilterConfigWhileEnabled_u32 = 0U;
+DMA_Type PortHwSim_g_DmaRegs_st;
+DMAMUX_Type PortHwSim_g_DmamuxRegs_st;
+uint32 PortHwSim_g_DmaWriteCount_u32 = 0U;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Trace buffer, its size and the number of writes since the trace was started
+*/
+static PortHwSim_TraceEntryType* PortHwSim_Trace_ptr = NULL_PTR;
+static uint32 PortHwSim_TraceSize_u32 = 0U;
+static uint32 PortHwSim_TraceCount_u32 = 0U;
+
+/**
+* @brief Input model
+*/
+static PortHwSim_InputHookType PortHwSim_InputHook = NULL_PTR;
+
+/**
+* @brief Objects behind the simulated eDMA addresses
+*/
+static const volatile void* PortHwSim_DmaRegion_ptr[PORT_HW_SIM_DMA_REGIONS_U32];
+
+/**
+* @brief DMA interrupt model
+*/
+static PortHwSim_DmaIrqHookType PortHwSim_DmaIrqHook = NULL_PTR;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void PortHwSim_WritePcr(PORT_Type* Port_ptr, uint32 Pin_u32, uint32 Value_u32);
+static void PortHwSim_WriteGlobal(PORT_Type* Port_ptr, uint32 FirstPin_u32, uint32 Value_u32, uint32 FieldMask_u32);
+static boolean PortHwSim_WritePort(volatile uint32* Address_ptr, uint32 Value_u32);
+static boolean PortHwSim_WriteGpio(volatile uint32* Address_ptr, uint32 Value_u32);
+static volatile uint32* PortHwSim_DmaPointer(uint32 Address_u32);
+static void PortHwSim_DmaStore(volatile uint32* Address_ptr, uint32 Value_u32);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Write a PCR honouring LK (bits 15:0 locked) and ISF (write-1-to-clear, mirrored in ISFR)
+*/
+static void PortHwSim_WritePcr(PORT_Type* Port_ptr, uint32 Pin_u32, uint32 Value_u32)
+{
+    volatile uint32* Pcr_ptr = &Port_ptr->PCR[Pin_u32];
+    uint32 f_Old_u32 = *Pcr_ptr;
+    uint32 f_New_u32;
+
+    f_New_u32 = Value_u32 & ~PORT_PCR_ISF_MASK;
+    f_New_u32 |= (f_Old_u32 & PORT_PCR_ISF_MASK) & ~(Value_u32 & PORT_PCR_ISF_MASK);
+    if (0U != (f_Old_u32 & PORT_PCR_LK_MASK))
+    {
+        f_New_u32 = (f_New_u32 & ~PORT_HW_SIM_PCR_LOW_MASK_U32) | (f_Old_u32 & PORT_HW_SIM_PCR_LOW_MASK_U32);
+    }
+    else
+    {
+        /* Unlocked pin, whole value accepted */
+    }
+    *Pcr_ptr = f_New_u32;
+    if (0U == (f_New_u32 & PORT_PCR_ISF_MASK))
+    {
+        Port_ptr->ISFR &= ~(1UL << Pin_u32);
+    }
+}
+
+/**
+* @brief Apply a Global Pin/Interrupt Control register write to 16 PCRs
+* @details GPCLR/GPCHR carry the pin select in bits 31:16 and the data in bits 15:0,
+*          GICLR/GICHR the other way round.
+*/
+static void PortHwSim_WriteGlobal(PORT_Type* Port_ptr, uint32 FirstPin_u32, uint32 Value_u32, uint32 FieldMask_u32)
+{
+    uint32 f_Pin_u32;
+    uint32 f_Data_u32;
+    uint32 f_Select_u32;
+    uint32 f_Old_u32;
+
+    if (PORT_HW_SIM_PCR_LOW_MASK_U32 == FieldMask_u32)
+    {
+        f_Data_u32 = Value_u32 & 0xFFFFU;
+        f_Select_u32 = Value_u32 >> 16U;
+    }
+    else
+    {
+        f_Data_u32 = Value_u32 & 0xFFFF0000U;
+        f_Select_u32 = Value_u32 & 0xFFFFU;
+    }
+
+    for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_SIM_HALF_PINS_U32; f_Pin_u32++)
+    {
+        if (0U != (f_Select_u32 & (1UL << f_Pin_u32)))
+        {
+            f_Old_u32 = Port_ptr->PCR[FirstPin_u32 + f_Pin_u32];
+            if ((PORT_HW_SIM_PCR_LOW_MASK_U32 == FieldMask_u32) && (0U != (f_Old_u32 & PORT_PCR_LK_MASK)))
+            {
+                /* Locked pin, GPCLR/GPCHR write ignored */
+            }
+            else
+            {
+                /* ISF is never set through the global registers and stays set when written 0 */
+                Port_ptr->PCR[FirstPin_u32 + f_Pin_u32] = (f_Old_u32 & ~FieldMask_u32) | (f_Data_u32 & FieldMask_u32 & ~PORT_PCR_ISF_MASK) |
+                                                          (f_Old_u32 & FieldMask_u32 & PORT_PCR_ISF_MASK & ~f_Data_u32);
+            }
+        }
+    }
+}
+
+/**
+* @brief Dispatch a write that targets one of the simulated PORT blocks
+* @return TRUE if the address belongs to a PORT block
+*/
+static boolean PortHwSim_WritePort(volatile uint32* Address_ptr, uint32 Value_u32)
+{
+    uint8 f_Port_u8;
+    uint32 f_Pin_u32;
+    PORT_Type* f_Port_ptr;
+    boolean f_Found_boo = FALSE;
+
+    for (f_Port_u8 = 0U; (f_Port_u8 < PORT_HW_SIM_PORT_COUNT_U8) && (FALSE == f_Found_boo); f_Port_u8++)
+    {
+        f_Port_ptr = &PortHwSim_g_PortRegs_ast[f_Port_u8];
+        if ((Address_ptr >= (volatile uint32*)f_Port_ptr) && (Address_ptr < (volatile uint32*)(f_Port_ptr + 1)))
+        {
+            f_Found_boo = TRUE;
+            if ((Address_ptr >= &f_Port_ptr->PCR[0]) && (Address_ptr <= &f_Port_ptr->PCR[PORT_PCR_COUNT - 1U]))
+            {
+                PortHwSim_WritePcr(f_Port_ptr, (uint32)(Address_ptr - &f_Port_ptr->PCR[0]), Value_u32);
+            }
+            else if (Address_ptr == &f_Port_ptr->GPCLR)
+            {
+                PortHwSim_WriteGlobal(f_Port_ptr, 0U, Value_u32, PORT_HW_SIM_PCR_LOW_MASK_U32);
+            }
+            else if (Address_ptr == &f_Port_ptr->GPCHR)
+            {
+                PortHwSim_WriteGlobal(f_Port_ptr, PORT_HW_SIM_HALF_PINS_U32, Value_u32, PORT_HW_SIM_PCR_LOW_MASK_U32);
+            }
+            else if (Address_ptr == &f_Port_ptr->GICLR)
+            {
+                PortHwSim_WriteGlobal(f_Port_ptr, 0U, Value_u32, PORT_HW_SIM_PCR_HIGH_MASK_U32);
+            }
+            else if (Address_ptr == &f_Port_ptr->GICHR)
+            {
+                PortHwSim_WriteGlobal(f_Port_ptr, PORT_HW_SIM_HALF_PINS_U32, Value_u32, PORT_HW_SIM_PCR_HIGH_MASK_U32);
+            }
+            else if (Address_ptr == &f_Port_ptr->ISFR)
+            {
+                /* ISFR is write-1-to-clear and mirrors PCR[ISF] */
+                for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_PCR_COUNT; f_Pin_u32++)
+                {
+                    if (0U != (Value_u32 & (1UL << f_Pin_u32)))
+                    {
+                        f_Port_ptr->PCR[f_Pin_u32] &= ~PORT_PCR_ISF_MASK;
+                    }
+                }
+                f_Port_ptr->ISFR &= ~Value_u32;
+            }
+            else if ((Address_ptr == &f_Port_ptr->DFCR) || (Address_ptr == &f_Port_ptr->DFWR))
+            {
+                /* The filter clock and width may only change while all filters of the port are off */
+                if (0U != f_Port_ptr->DFER)
+                {
+                    PortHwSim_g_FilterConfigWhileEnabled_u32++;
+                }
+                *Address_ptr = Value_u32 & ((Address_ptr == &f_Port_ptr->DFCR) ? PORT_DFCR_CS_MASK : PORT_DFWR_FILT_MASK);
+            }
+            else
+            {
+                /* DFER: plain register */
+                *Address_ptr = Value_u32;
+            }
+        }
+    }
+
+    return f_Found_boo;
+}
+
+/**
+* @brief Dispatch a write that targets one of the simulated GPIO blocks
+* @return TRUE if the address belongs to a GPIO block
+*/
+static boolean PortHwSim_WriteGpio(volatile uint32* Address_ptr, uint32 Value_u32)
+{
+    uint8 f_Port_u8;
+    GPIO_Type* f_Gpio_ptr;
+    boolean f_Found_boo = FALSE;
+
+    for (f_Port_u8 = 0U; (f_Port_u8 < PORT_HW_SIM_PORT_COUNT_U8) && (FALSE == f_Found_boo); f_Port_u8++)
+    {
+        f_Gpio_ptr = &PortHwSim_g_GpioRegs_ast[f_Port_u8];
+        if ((Address_ptr >= (volatile uint32*)f_Gpio_ptr) && (Address_ptr < (volatile uint32*)(f_Gpio_ptr + 1)))
+        {
+            f_Found_boo = TRUE;
+            PortHwSim_g_GpioWriteCount_u32++;
+            if (Address_ptr == &f_Gpio_ptr->PSOR)
+            {
+                f_Gpio_ptr->PDOR |= Value_u32;
+            }
+            else if (Address_ptr == &f_Gpio_ptr->PCOR)
+            {
+                f_Gpio_ptr->PDOR &= ~Value_u32;
+            }
+            else if (Address_ptr == &f_Gpio_ptr->PTOR)
+            {
+                f_Gpio_ptr->PDOR ^= Value_u32;
+            }
+            else if (Address_ptr == (volatile uint32*)&f_Gpio_ptr->PDIR)
+            {
+                /* Read-only register, write ignored */
+            }
+            else
+            {
+                /* PDOR, PDDR, PIDR: plain registers */
+                *Address_ptr = Value_u32;
+            }
+
+            if (NULL_PTR != PortHwSim_Trace_ptr)
+            {
+                if (PortHwSim_TraceCount_u32 < PortHwSim_TraceSize_u32)
+                {
+                    PortHwSim_Trace_ptr[PortHwSim_TraceCount_u32].Cycle_u32 = PortHwSim_g_Cycles_u32;
+                    PortHwSim_Trace_ptr[PortHwSim_TraceCount_u32].PortIndex_u8 = f_Port_u8;
+                    PortHwSim_Trace_ptr[PortHwSim_TraceCount_u32].Pdor_u32 = f_Gpio_ptr->PDOR;
+                    PortHwSim_Trace_ptr[PortHwSim_TraceCount_u32].Pddr_u32 = f_Gpio_ptr->PDDR;
+                }
+                PortHwSim_TraceCount_u32++;
+            }
+        }
+    }
+
+    return f_Found_boo;
+}
+
+/**
+* @brief Host pointer behind a simulated eDMA address
+*/
+static volatile uint32* PortHwSim_DmaPointer(uint32 Address_u32)
+{
+    uint32 f_Region_u32 = (Address_u32 >> PORT_HW_SIM_DMA_REGION_SHIFT_U32) - 1U;
+
+    return (volatile uint32*)((volatile uint8*)PortHwSim_DmaRegion_ptr[f_Region_u32] +
+                              (Address_u32 & PORT_HW_SIM_DMA_OFFSET_MASK_U32));
+}
+
+/**
+* @brief Register write of the eDMA: side effects of a core write, counted apart
+*/
+static void PortHwSim_DmaStore(volatile uint32* Address_ptr, uint32 Value_u32)
+{
+    PortHwSim_g_DmaWriteCount_u32++;
+
+    if (FALSE == PortHwSim_WritePort(Address_ptr, Value_u32))
+    {
+        if (FALSE == PortHwSim_WriteGpio(Address_ptr, Value_u32))
+        {
+            *Address_ptr = Value_u32;
+        }
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+void PortHwSim_Reset(void)
+{
+    (void)memset((void*)PortHwSim_g_PortRegs_ast, 0, sizeof(PortHwSim_g_PortRegs_ast));
+    (void)memset((void*)PortHwSim_g_GpioRegs_ast, 0, sizeof(PortHwSim_g_GpioRegs_ast));
+    PortHwSim_ClearCounters();
+    PortHwSim_g_Cycles_u32 = 0U;
+    PortHwSim_g_FilterConfigWhileEnabled_u32 = 0U;
+    (void)memset((void*)&PortHwSim_g_DmaRegs_st, 0, sizeof(PortHwSim_g_DmaRegs_st));
+    (void)memset((void*)&PortHwSim_g_DmamuxRegs_st, 0, sizeof(PortHwSim_g_DmamuxRegs_st));
+    (void)memset((void*)PortHwSim_DmaRegion_ptr, 0, sizeof(PortHwSim_DmaRegion_ptr));
+    PortHwSim_Trace_ptr = NULL_PTR;
+    PortHwSim_InputHook = NULL_PTR;
+    PortHwSim_DmaIrqHook = NULL_PTR;
+}
+
+void PortHwSim_ClearCounters(void)
+{
+    PortHwSim_g_WriteCount_u32 = 0U;
+    PortHwSim_g_GpioWriteCount_u32 = 0U;
+    PortHwSim_g_ReadCount_u32 = 0U;
+    PortHwSim_g_BitBandWriteCount_u32 = 0U;
+    PortHwSim_g_DmaWriteCount_u32 = 0U;
+}
+
+void PortHwSim_Write32(volatile uint32* Address_ptr, uint32 Value_u32)
+{
+    PortHwSim_g_WriteCount_u32++;
+
+    if (FALSE == PortHwSim_WritePort(Address_ptr, Value_u32))
+    {
+        if (FALSE == PortHwSim_WriteGpio(Address_ptr, Value_u32))
+        {
+            /* Not a simulated peripheral register (e.g. test RAM), plain write */
+            *Address_ptr = Value_u32;
+        }
+    }
+}
+
+void PortHwSim_BitBandWrite32(volatile uint32* Address_ptr, uint32 Bit_u32, uint32 Value_u32)
+{
+    uint32 f_Word_u32 = *Address_ptr;
+
+    /* The bus performs the read-modify-write, it is not a read of the core */
+    if (0U != (Value_u32 & 1U))
+    {
+        f_Word_u32 |= (1UL << Bit_u32);
+    }
+    else
+    {
+        f_Word_u32 &= ~(1UL << Bit_u32);
+    }
+    PortHwSim_g_BitBandWriteCount_u32++;
+    PortHwSim_Write32(Address_ptr, f_Word_u32);
+}
+
+uint32 PortHwSim_Read32(const volatile uint32* Address_ptr)
+{
+    uint8 f_Port_u8;
+
+    PortHwSim_g_ReadCount_u32++;
+
+    if (NULL_PTR != PortHwSim_InputHook)
+    {
+        for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_SIM_PORT_COUNT_U8; f_Port_u8++)
+        {
+            if (Address_ptr == &PortHwSim_g_GpioRegs_ast[f_Port_u8].PDIR)
+            {
+                PortHwSim_SetInput(f_Port_u8, PortHwSim_InputHook(f_Port_u8));
+            }
+        }
+    }
+
+    return *Address_ptr;
+}
+
+void PortHwSim_SetInput(uint8 PortIndex_u8, uint32 Value_u32)
+{
+    *(volatile uint32*)&PortHwSim_g_GpioRegs_ast[PortIndex_u8].PDIR = Value_u32;
+}
+
+void PortHwSim_SetInterruptFlags(uint8 PortIndex_u8, uint32 Flags_u32)
+{
+    uint32 f_Pin_u32;
+
+    for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_PCR_COUNT; f_Pin_u32++)
+    {
+        if (0U != (Flags_u32 & (1UL << f_Pin_u32)))
+        {
+            PortHwSim_g_PortRegs_ast[PortIndex_u8].PCR[f_Pin_u32] |= PORT_PCR_ISF_MASK;
+        }
+    }
+    PortHwSim_g_PortRegs_ast[PortIndex_u8].ISFR |= Flags_u32;
+}
+
+uint32 PortHwSim_GetCycles(void)
+{
+    return PortHwSim_g_Cycles_u32++;
+}
+
+void PortHwSim_StartTrace(PortHwSim_TraceEntryType Buffer_ptr[], uint32 Size_u32)
+{
+    PortHwSim_Trace_ptr = Buffer_ptr;
+    PortHwSim_TraceSize_u32 = Size_u32;
+    PortHwSim_TraceCount_u32 = 0U;
+}
+
+uint32 PortHwSim_StopTrace(void)
+{
+    PortHwSim_Trace_ptr = NULL_PTR;
+
+    return PortHwSim_TraceCount_u32;
+}
+
+uint32 PortHwSim_GetTraceCount(void)
+{
+    return PortHwSim_TraceCount_u32;
+}
+
+void PortHwSim_SetInputHook(PortHwSim_InputHookType Hook)
+{
+    PortHwSim_InputHook = Hook;
+}
+
+void PortHwSim_Write16(volatile uint16* Address_ptr, uint16 Value_u16)
+{
+    PortHwSim_g_WriteCount_u32++;
+    *Address_ptr = Value_u16;
+}
+
+uint16 PortHwSim_Read16(const volatile uint16* Address_ptr)
+{
+    PortHwSim_g_ReadCount_u32++;
+
+    return *Address_ptr;
+}
+
+void PortHwSim_Write8(volatile uint8* Address_ptr, uint8 Value_u8)
+{
+    uint32 f_Bit_u32 = 1UL << (Value_u8 & PORT_HW_SIM_DMA_CHANNEL_MASK_U8);
+
+    PortHwSim_g_WriteCount_u32++;
+
+    if (Address_ptr == &PortHwSim_g_DmaRegs_st.SERQ)
+    {
+        PortHwSim_g_DmaRegs_st.ERQ |= f_Bit_u32;
+    }
+    else if (Address_ptr == &PortHwSim_g_DmaRegs_st.CERQ)
+    {
+        PortHwSim_g_DmaRegs_st.ERQ &= ~f_Bit_u32;
+    }
+    else if (Address_ptr == &PortHwSim_g_DmaRegs_st.CINT)
+    {
+        PortHwSim_g_DmaRegs_st.INT &= ~f_Bit_u32;
+    }
+    else if (Address_ptr == &PortHwSim_g_DmaRegs_st.CDNE)
+    {
+        PortHwSim_g_DmaRegs_st.TCD[Value_u8 & PORT_HW_SIM_DMA_CHANNEL_MASK_U8].CSR &= (uint16)~DMA_TCD_CSR_DONE_MASK;
+    }
+    else
+    {
+        *Address_ptr = Value_u8;
+    }
+}
+
+uint32 PortHwSim_DmaAddress(const volatile void* Address_ptr)
+{
+    uint32 f_Region_u32;
+    uint32 f_Address_u32 = 0U;
+
+    for (f_Region_u32 = 0U; (f_Region_u32 < PORT_HW_SIM_DMA_REGIONS_U32) && (0U == f_Address_u32); f_Region_u32++)
+    {
+        if (NULL_PTR == PortHwSim_DmaRegion_ptr[f_Region_u32])
+        {
+            PortHwSim_DmaRegion_ptr[f_Region_u32] = Address_ptr;
+        }
+        if (Address_ptr == PortHwSim_DmaRegion_ptr[f_Region_u32])
+        {
+            f_Address_u32 = (f_Region_u32 + 1U) << PORT_HW_SIM_DMA_REGION_SHIFT_U32;
+        }
+    }
+
+    return f_Address_u32;
+}
+
+boolean PortHwSim_DmaRequest(uint8 Channel_u8)
+{
+    volatile uint32* f_Source_ptr;
+    uint32 f_Bit_u32 = 1UL << Channel_u8;
+    uint32 f_Bytes_u32;
+    uint16 f_Count_u16;
+    boolean f_Interrupt_boo = FALSE;
+    boolean f_Moved_boo = FALSE;
+
+    if ((0U != (PortHwSim_g_DmaRegs_st.ERQ & f_Bit_u32)) &&
+        (0U != (PortHwSim_g_DmamuxRegs_st.CHCFG[Channel_u8] & DMAMUX_CHCFG_ENBL_MASK)))
+    {
+        /* Minor loop */
+        for (f_Bytes_u32 = 0U; f_Bytes_u32 < PortHwSim_g_DmaRegs_st.TCD[Channel_u8].NBYTES.MLNO; f_Bytes_u32 += 4U)
+        {
+            f_Source_ptr = PortHwSim_DmaPointer(PortHwSim_g_DmaRegs_st.TCD[Channel_u8].SADDR);
+            PortHwSim_DmaStore(PortHwSim_DmaPointer(PortHwSim_g_DmaRegs_st.TCD[Channel_u8].DADDR), *f_Source_ptr);
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].SADDR += (uint32)(sint32)(sint16)PortHwSim_g_DmaRegs_st.TCD[Channel_u8].SOFF;
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].DADDR += (uint32)(sint32)(sint16)PortHwSim_g_DmaRegs_st.TCD[Channel_u8].DOFF;
+        }
+
+        /* Major loop */
+        f_Count_u16 = (uint16)((PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK) - 1U);
+        PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CITER.ELINKNO = f_Count_u16;
+        if (0U == f_Count_u16)
+        {
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].SADDR += PortHwSim_g_DmaRegs_st.TCD[Channel_u8].SLAST;
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].DADDR += PortHwSim_g_DmaRegs_st.TCD[Channel_u8].DLASTSGA;
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CITER.ELINKNO = PortHwSim_g_DmaRegs_st.TCD[Channel_u8].BITER.ELINKNO;
+            PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CSR |= (uint16)DMA_TCD_CSR_DONE_MASK;
+            if (0U != (PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CSR & DMA_TCD_CSR_DREQ_MASK))
+            {
+                PortHwSim_g_DmaRegs_st.ERQ &= ~f_Bit_u32;
+            }
+            f_Interrupt_boo = (0U != (PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CSR & DMA_TCD_CSR_INTMAJOR_MASK));
+        }
+        else if (f_Count_u16 == ((PortHwSim_g_DmaRegs_st.TCD[Channel_u8].BITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK) >> 1U))
+        {
+            f_Interrupt_boo = (0U != (PortHwSim_g_DmaRegs_st.TCD[Channel_u8].CSR & DMA_TCD_CSR_INTHALF_MASK));
+        }
+        else
+        {
+            /* No interrupt point */
+        }
+
+        if (TRUE == f_Interrupt_boo)
+        {
+            PortHwSim_g_DmaRegs_st.INT |= f_Bit_u32;
+            if (NULL_PTR != PortHwSim_DmaIrqHook)
+            {
+                PortHwSim_DmaIrqHook(Channel_u8);
+            }
+        }
+        f_Moved_boo = TRUE;
+    }
+
+    return f_Moved_boo;
+}
+
+void PortHwSim_SetDmaIrqHook(PortHwSim_DmaIrqHookType Hook)
+{
+    PortHwSim_DmaIrqHook = Hook;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
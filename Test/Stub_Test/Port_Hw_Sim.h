@@ -0,0 +1,335 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Simulated PORT/GPIO register file for host testing of Port_Hw
+==================================================================================================*/
+
+#ifndef PORT_HW_SIM_H
+#define PORT_HW_SIM_H
+
+/**
+*   @file    Port_Hw_Sim.h
+*
+*   @brief   Simulated PORT/GPIO register file stub header
+*   @details Redirects the IP_PORTx / IP_PTx base pointers and the Port_Hw register access
+*            macros to a RAM register file so that Port_Hw can be executed on a host PC.
+*            This header must be force-included before any other header, e.g.:
+*
+*            gcc -std=c99 -include Port_Hw_Sim.h <include paths> Port_Hw.c Port_Hw_Sim.c ...
+*
+*   @addtogroup Port_HW_Test
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include "S32K144.h"
+#include "Std_Types.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Number of simulated PORT/GPIO instances
+*/
+#define PORT_HW_SIM_PORT_COUNT_U8           ((uint8)5U)
+
+/**
+* @brief Simulated base pointers used instead of the device memory map
+*/
+#undef IP_PORTA
+#undef IP_PORTB
+#undef IP_PORTC
+#undef IP_PORTD
+#undef IP_PORTE
+#undef IP_PTA
+#undef IP_PTB
+#undef IP_PTC
+#undef IP_PTD
+#undef IP_PTE
+#define IP_PORTA                            (&PortHwSim_g_PortRegs_ast[0])
+#define IP_PORTB                            (&PortHwSim_g_PortRegs_ast[1])
+#define IP_PORTC                            (&PortHwSim_g_PortRegs_ast[2])
+#define IP_PORTD                            (&PortHwSim_g_PortRegs_ast[3])
+#define IP_PORTE                            (&PortHwSim_g_PortRegs_ast[4])
+#define IP_PTA                              (&PortHwSim_g_GpioRegs_ast[0])
+#define IP_PTB                              (&PortHwSim_g_GpioRegs_ast[1])
+#define IP_PTC                              (&PortHwSim_g_GpioRegs_ast[2])
+#define IP_PTD                              (&PortHwSim_g_GpioRegs_ast[3])
+#define IP_PTE                              (&PortHwSim_g_GpioRegs_ast[4])
+#undef IP_DMA
+#undef IP_DMAMUX
+#define IP_DMA                              (&PortHwSim_g_DmaRegs_st)
+#define IP_DMAMUX                           (&PortHwSim_g_DmamuxRegs_st)
+
+/**
+* @brief Port_Hw register access hooks routed to the simulator
+*/
+#define PORT_HW_REG_WRITE32(address, value) PortHwSim_Write32((volatile uint32*)(address), (uint32)(value))
+#define PORT_HW_REG_READ32(address)         PortHwSim_Read32((const volatile uint32*)(address))
+#define PORT_HW_BITBAND_WRITE32(address, bit, value) \
+                                            PortHwSim_BitBandWrite32((volatile uint32*)(address), (uint32)(bit), (uint32)(value))
+#define PORT_HW_REG_WRITE16(address, value) PortHwSim_Write16((volatile uint16*)(address), (uint16)(value))
+#define PORT_HW_REG_READ16(address)         PortHwSim_Read16((const volatile uint16*)(address))
+#define PORT_HW_REG_WRITE8(address, value)  PortHwSim_Write8((volatile uint8*)(address), (uint8)(value))
+
+/**
+* @brief Waveform DMA addresses routed to 32-bit tokens of the simulated eDMA
+*/
+#define PORT_HW_WAVE_DMA_ADDRESS(address)   PortHwSim_DmaAddress((const volatile void*)(address))
+
+/**
+* @brief Bit-bang engine cycle counter routed to the simulated cycle count
+*/
+#define PORT_HW_BITBANG_GET_CYCLES()        PortHwSim_GetCycles()
+#define PORT_HW_BITBANG_START_CYCLES()      ((void)0)
+
+/**
+* @brief Capture timestamp counter routed to the simulated cycle count
+*/
+#define PORT_HW_CAPTURE_GET_COUNTER()       PortHwSim_GetCycles()
+#define PORT_HW_CAPTURE_START_COUNTER()     ((void)0)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief One GPIO register write of the trace, with the port outputs after the write
+*/
+typedef struct
+{
+    uint32 Cycle_u32;           /**< @brief Simulated cycle of the write */
+    uint8 PortIndex_u8;         /**< @brief Port written (0 = A ... 4 = E) */
+    uint32 Pdor_u32;            /**< @brief PDOR after the write */
+    uint32 Pddr_u32;            /**< @brief PDDR after the write */
+} PortHwSim_TraceEntryType;
+
+/**
+* @brief Input model, returns the PDIR value of a port when it is read
+*/
+typedef uint32 (*PortHwSim_InputHookType)(uint8 PortIndex_u8);
+
+/**
+* @brief DMA interrupt model, called when a channel raises its interrupt request (DMA INT)
+*/
+typedef void (*PortHwSim_DmaIrqHookType)(uint8 Channel_u8);
+
+/*==================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+==================================================================================================*/
+/**
+* @brief Simulated PORT register blocks (PORTA..PORTE)
+*/
+extern PORT_Type PortHwSim_g_PortRegs_ast[PORT_HW_SIM_PORT_COUNT_U8];
+
+/**
+* @brief Simulated GPIO register blocks (PTA..PTE)
+*/
+extern GPIO_Type PortHwSim_g_GpioRegs_ast[PORT_HW_SIM_PORT_COUNT_U8];
+
+/**
+* @brief Number of register writes performed through PORT_HW_REG_WRITE32
+*/
+extern uint32 PortHwSim_g_WriteCount_u32;
+
+/**
+* @brief Number of register writes that targeted a GPIO block
+*/
+extern uint32 PortHwSim_g_GpioWriteCount_u32;
+
+/**
+* @brief Number of register reads performed through PORT_HW_REG_READ32
+*/
+extern uint32 PortHwSim_g_ReadCount_u32;
+
+/**
+* @brief Number of single bit writes performed through PORT_HW_BITBAND_WRITE32
+*/
+extern uint32 PortHwSim_g_BitBandWriteCount_u32;
+
+/**
+* @brief Simulated cycle count, advanced by one on every PortHwSim_GetCycles() call
+*/
+extern uint32 PortHwSim_g_Cycles_u32;
+
+/**
+* @brief Number of DFCR/DFWR writes while a filter of the port was enabled (DFER != 0)
+*/
+extern uint32 PortHwSim_g_FilterConfigWhileEnabled_u32;
+
+/**
+* @brief Simulated eDMA and DMAMUX register blocks
+*/
+extern DMA_Type PortHwSim_g_DmaRegs_st;
+extern DMAMUX_Type PortHwSim_g_DmamuxRegs_st;
+
+/**
+* @brief Number of register writes performed by the simulated eDMA (not counted as core writes)
+*/
+extern uint32 PortHwSim_g_DmaWriteCount_u32;
+
+/*==================================================================================================
+*                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief Clear the register file and the access counters
+*/
+void PortHwSim_Reset(void);
+
+/**
+* @brief Clear only the access counters
+*/
+void PortHwSim_ClearCounters(void);
+
+/**
+* @brief Simulated 32-bit register write
+* @details Applies the side effects of write-only registers:
+*          PSOR/PCOR/PTOR update PDOR, GPCLR/GPCHR/GICLR/GICHR update the selected PCRs,
+*          ISFR and PCR[ISF] are write-1-to-clear and locked PCRs ignore their lower 16 bits.
+* @param Address_ptr Register address
+* @param Value_u32 Value to write
+*/
+void PortHwSim_Write32(volatile uint32* Address_ptr, uint32 Value_u32);
+
+/**
+* @brief Simulated 32-bit register read
+* @param Address_ptr Register address
+* @return Current register value
+*/
+uint32 PortHwSim_Read32(const volatile uint32* Address_ptr);
+
+/**
+* @brief Simulated bit-band alias write
+* @details Models the bus read-modify-write of a bit-band store: the register word is read
+*          without counting a core read, the bit is changed and the word is written back
+*          through PortHwSim_Write32() (one write).
+* @param Address_ptr Register address (not the alias address)
+* @param Bit_u32 Bit number in the register
+* @param Value_u32 New bit value (bit 0 is used)
+*/
+void PortHwSim_BitBandWrite32(volatile uint32* Address_ptr, uint32 Bit_u32, uint32 Value_u32);
+
+/**
+* @brief Drive the simulated input pins of a port (PDIR)
+* @param PortIndex_u8 Port index (0 = A ... 4 = E)
+* @param Value_u32 Input level of the 32 pins
+*/
+void PortHwSim_SetInput(uint8 PortIndex_u8, uint32 Value_u32);
+
+/**
+* @brief Simulated cycle counter read
+* @details Returns the current simulated cycle and advances it by one, so a busy wait on the
+*          counter ends exactly at its deadline.
+* @return Simulated cycle before the read
+*/
+uint32 PortHwSim_GetCycles(void);
+
+/**
+* @brief Latch pin interrupt flags of a port as the pin detect logic does
+* @details Sets the pins in ISFR and their PCR[ISF]; cleared again by write-1-to-clear.
+* @param PortIndex_u8 Port index (0 = A ... 4 = E)
+* @param Flags_u32 Pins to flag
+*/
+void PortHwSim_SetInterruptFlags(uint8 PortIndex_u8, uint32 Flags_u32);
+
+/**
+* @brief Record every following GPIO register write with its simulated cycle
+* @param Buffer_ptr Trace buffer
+* @param Size_u32 Number of entries of the buffer, further writes are not recorded
+*/
+void PortHwSim_StartTrace(PortHwSim_TraceEntryType Buffer_ptr[], uint32 Size_u32);
+
+/**
+* @brief Stop recording GPIO register writes
+* @return Number of writes that occurred since PortHwSim_StartTrace(), more than the buffer
+*         size if writes were lost
+*/
+uint32 PortHwSim_StopTrace(void);
+
+/**
+* @brief Number of GPIO register writes since PortHwSim_StartTrace(), the trace keeps running
+*/
+uint32 PortHwSim_GetTraceCount(void);
+
+/**
+* @brief Install an input model called on every PDIR read, NULL_PTR removes it
+* @param Hook Input model
+*/
+void PortHwSim_SetInputHook(PortHwSim_InputHookType Hook);
+
+/**
+* @brief Simulated 16-bit register write
+* @param Address_ptr Register address
+* @param Value_u16 Value to write
+*/
+void PortHwSim_Write16(volatile uint16* Address_ptr, uint16 Value_u16);
+
+/**
+* @brief Simulated 16-bit register read
+* @param Address_ptr Register address
+* @return Current register value
+*/
+uint16 PortHwSim_Read16(const volatile uint16* Address_ptr);
+
+/**
+* @brief Simulated 8-bit register write
+* @details Applies the side effects of the eDMA SERQ, CERQ, CINT and CDNE registers (one
+*          channel per write, the "all channels" bit is not modelled).
+* @param Address_ptr Register address
+* @param Value_u8 Value to write
+*/
+void PortHwSim_Write8(volatile uint8* Address_ptr, uint8 Value_u8);
+
+/**
+* @brief 32-bit bus address of a host object for a simulated TCD
+* @details Host pointers do not fit a TCD address, so every distinct object gets a region:
+*          the address is (region + 1) << 20, address arithmetic of the eDMA stays inside the
+*          object. The regions are released by PortHwSim_Reset().
+* @param Address_ptr Buffer or register
+* @return Simulated bus address, 0 when all regions are used
+*/
+uint32 PortHwSim_DmaAddress(const volatile void* Address_ptr);
+
+/**
+* @brief One hardware request to a simulated eDMA channel
+* @details Ignored unless the channel request is enabled (ERQ) and its DMAMUX channel too.
+*          Runs one minor loop of 32-bit transfers (only the 32-bit transfer size is modelled)
+*          through the register side effects of PortHwSim_Write32() without counting core
+*          writes, then counts down the major loop: half and major interrupts per TCD CSR,
+*          SLAST/DLASTSGA adjustment and CITER reload at the end of the major loop, DONE, and
+*          the request disable of CSR[DREQ]. The interrupt hook runs inside the call.
+* @param Channel_u8 eDMA channel
+* @return TRUE when the request moved data
+*/
+boolean PortHwSim_DmaRequest(uint8 Channel_u8);
+
+/**
+* @brief Install a DMA interrupt model, NULL_PTR removes it
+* @param Hook DMA interrupt model
+*/
+void PortHwSim_SetDmaIrqHook(PortHwSim_DmaIrqHookType Hook);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_HW_SIM_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,185 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host decoder of Port input captures
+==================================================================================================*/
+
+/**
+*   @file    Port_CaptureVcd.c
+*
+*   @brief   Host decoder of Port input captures
+*   @details Run expansion and VCD writer for the entries of PortHw_CaptureDrain().
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include "Port_CaptureVcd.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Printable characters of VCD identifier codes ('!' to '~')
+*/
+#define PORT_CAPTUREVCD_ID_FIRST_U32        (33U)
+#define PORT_CAPTUREVCD_ID_CHARS_U32        (94U)
+
+/**
+* @brief Longest identifier code (94^4 wires)
+*/
+#define PORT_CAPTUREVCD_ID_LENGTH_U32       (4U)
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void PortCaptureVcd_Id(uint32 Index_u32, char Id_ptr[]);
+static uint8 PortCaptureVcd_Level(const PortHw_CaptureEntryType* Entry_ptr, const PortCaptureVcd_ChannelType* Channel_ptr);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Identifier code of a wire: its index in base 94, least significant character first
+*/
+static void PortCaptureVcd_Id(uint32 Index_u32, char Id_ptr[])
+{
+    uint32 f_Index_u32 = Index_u32;
+    uint32 f_Length_u32 = 0U;
+
+    do
+    {
+        Id_ptr[f_Length_u32] = (char)(PORT_CAPTUREVCD_ID_FIRST_U32 + (f_Index_u32 % PORT_CAPTUREVCD_ID_CHARS_U32));
+        f_Index_u32 /= PORT_CAPTUREVCD_ID_CHARS_U32;
+        f_Length_u32++;
+    } while ((0U != f_Index_u32) && (f_Length_u32 < PORT_CAPTUREVCD_ID_LENGTH_U32));
+    Id_ptr[f_Length_u32] = '\0';
+}
+
+/**
+* @brief Level of a channel in an entry
+*/
+static uint8 PortCaptureVcd_Level(const PortHw_CaptureEntryType* Entry_ptr, const PortCaptureVcd_ChannelType* Channel_ptr)
+{
+    return (uint8)((Entry_ptr->Value_au32[Channel_ptr->Slot_u8] >> Channel_ptr->Pin_u8) & 1U);
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+uint32 PortCaptureVcd_Expand(
+    const PortHw_CaptureEntryType Entries_ptr[],
+    uint32 NumEntries_u32,
+    uint8 Slot_u8,
+    uint32 Samples_ptr[],
+    uint32 MaxSamples_u32
+)
+{
+    uint32 f_Entry_u32;
+    uint32 f_Sample_u32;
+    uint32 f_Count_u32 = 0U;
+
+    for (f_Entry_u32 = 0U; f_Entry_u32 < NumEntries_u32; f_Entry_u32++)
+    {
+        for (f_Sample_u32 = 0U; (f_Sample_u32 < Entries_ptr[f_Entry_u32].Length_u32) && (f_Count_u32 < MaxSamples_u32); f_Sample_u32++)
+        {
+            Samples_ptr[f_Count_u32] = Entries_ptr[f_Entry_u32].Value_au32[Slot_u8];
+            f_Count_u32++;
+        }
+    }
+
+    return f_Count_u32;
+}
+
+uint32 PortCaptureVcd_Write(
+    FILE* File_ptr,
+    const PortCaptureVcd_ChannelType Channels_ptr[],
+    uint32 NumChannels_u32,
+    const PortHw_CaptureEntryType Entries_ptr[],
+    uint32 NumEntries_u32,
+    uint32 TickPs_u32
+)
+{
+    char f_Id_ac[PORT_CAPTUREVCD_ID_LENGTH_U32 + 1U];
+    unsigned long long f_Base_u64 = 0ULL;
+    unsigned long long f_Time_u64;
+    uint32 f_Entry_u32;
+    uint32 f_Channel_u32;
+    uint32 f_Changes_u32 = 0U;
+    boolean f_Stamped_boo;
+    uint8 f_Level_u8;
+
+    (void)fprintf(File_ptr, "$version Port_CaptureVcd $end\n");
+    (void)fprintf(File_ptr, "$timescale 1 ps $end\n");
+    (void)fprintf(File_ptr, "$scope module port $end\n");
+    for (f_Channel_u32 = 0U; f_Channel_u32 < NumChannels_u32; f_Channel_u32++)
+    {
+        PortCaptureVcd_Id(f_Channel_u32, f_Id_ac);
+        (void)fprintf(File_ptr, "$var wire 1 %s %s $end\n", f_Id_ac, Channels_ptr[f_Channel_u32].Name_ptr);
+    }
+    (void)fprintf(File_ptr, "$upscope $end\n");
+    (void)fprintf(File_ptr, "$enddefinitions $end\n");
+
+    for (f_Entry_u32 = 0U; f_Entry_u32 < NumEntries_u32; f_Entry_u32++)
+    {
+        if ((0U != f_Entry_u32) && (Entries_ptr[f_Entry_u32].Timestamp_u32 < Entries_ptr[f_Entry_u32 - 1U].Timestamp_u32))
+        {
+            /* Capture time wrapped at 2^32 ticks */
+            f_Base_u64 += 0x100000000ULL;
+        }
+        f_Time_u64 = (f_Base_u64 + Entries_ptr[f_Entry_u32].Timestamp_u32) * TickPs_u32;
+
+        if (0U == f_Entry_u32)
+        {
+            (void)fprintf(File_ptr, "#%llu\n$dumpvars\n", f_Time_u64);
+        }
+        f_Stamped_boo = (0U == f_Entry_u32) ? TRUE : FALSE;
+        for (f_Channel_u32 = 0U; f_Channel_u32 < NumChannels_u32; f_Channel_u32++)
+        {
+            f_Level_u8 = PortCaptureVcd_Level(&Entries_ptr[f_Entry_u32], &Channels_ptr[f_Channel_u32]);
+            if ((0U == f_Entry_u32) ||
+                (f_Level_u8 != PortCaptureVcd_Level(&Entries_ptr[f_Entry_u32 - 1U], &Channels_ptr[f_Channel_u32])))
+            {
+                if (FALSE == f_Stamped_boo)
+                {
+                    (void)fprintf(File_ptr, "#%llu\n", f_Time_u64);
+                    f_Stamped_boo = TRUE;
+                }
+                PortCaptureVcd_Id(f_Channel_u32, f_Id_ac);
+                (void)fprintf(File_ptr, "%u%s\n", (unsigned)f_Level_u8, f_Id_ac);
+                f_Changes_u32++;
+            }
+        }
+        if (0U == f_Entry_u32)
+        {
+            (void)fprintf(File_ptr, "$end\n");
+        }
+    }
+
+    return f_Changes_u32;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
@@ -0,0 +1,110 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host decoder of Port input captures
+==================================================================================================*/
+
+#ifndef PORT_CAPTUREVCD_H
+#define PORT_CAPTUREVCD_H
+
+/**
+*   @file    Port_CaptureVcd.h
+*
+*   @brief   Host decoder of Port input captures
+*   @details Turns the run-length encoded entries drained with PortHw_CaptureDrain() back into
+*            samples, or into a Value Change Dump (IEEE 1364 VCD) with one 1-bit wire per
+*            captured pin for a waveform viewer.
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include "Port_Hw_Capture.h"
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Captured pin written as a VCD wire
+*/
+typedef struct
+{
+    const char* Name_ptr;                               /**< @brief Wire name, e.g. "PTD0" */
+    uint8 Slot_u8;                                      /**< @brief Index of the port in the capture configuration */
+    uint8 Pin_u8;                                       /**< @brief Pin number in the port */
+} PortCaptureVcd_ChannelType;
+
+/*==================================================================================================
+*                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief       Expands runs into samples
+*
+* @param[in]   Entries_ptr     Drained entries, in capture order
+* @param[in]   NumEntries_u32  Number of entries
+* @param[in]   Slot_u8         Port of the capture configuration to expand
+* @param[out]  Samples_ptr     Masked PDIR value of every sample
+* @param[in]   MaxSamples_u32  Size of @p Samples_ptr
+*
+* @return      uint32  Number of samples written to @p Samples_ptr
+*/
+uint32 PortCaptureVcd_Expand(
+    const PortHw_CaptureEntryType Entries_ptr[],
+    uint32 NumEntries_u32,
+    uint8 Slot_u8,
+    uint32 Samples_ptr[],
+    uint32 MaxSamples_u32
+);
+
+/**
+* @brief       Writes entries as a VCD file
+*
+* @details     Header with a 1 ps timescale and one wire per channel, the levels of the first
+*              entry in $dumpvars, then a time stamp and the changed wires for every later
+*              entry. Entry timestamps are unwrapped at 2^32 ticks.
+*
+* @param[in]   File_ptr         Output stream
+* @param[in]   Channels_ptr     Pins to write
+* @param[in]   NumChannels_u32  Number of pins
+* @param[in]   Entries_ptr      Drained entries, in capture order
+* @param[in]   NumEntries_u32   Number of entries
+* @param[in]   TickPs_u32       Counter tick in ps, e.g. 12500 for the 80 MHz core cycle counter
+*
+* @return      uint32  Number of value changes written, initial values included
+*/
+uint32 PortCaptureVcd_Write(
+    FILE* File_ptr,
+    const PortCaptureVcd_ChannelType Channels_ptr[],
+    uint32 NumChannels_u32,
+    const PortHw_CaptureEntryType Entries_ptr[],
+    uint32 NumEntries_u32,
+    uint32 TickPs_u32
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_CAPTUREVCD_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
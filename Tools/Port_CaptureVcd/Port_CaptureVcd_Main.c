@@ -0,0 +1,156 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Command line front end of the Port capture decoder
+==================================================================================================*/
+
+/**
+*   @file    Port_CaptureVcd_Main.c
+*
+*   @brief   Command line front end of the Port capture decoder
+*   @details Reads the entries drained with PortHw_CaptureDrain() from a raw memory dump
+*            (e.g. "dump binary memory capture.bin &entries[0] &entries[n]" in GDB) and writes
+*            them as VCD to stdout. The decoder must be built with the
+*            PORT_HW_CAPTURE_MAX_PORTS_U8 of the target.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -ITools/Port_CaptureVcd -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Tools/Port_CaptureVcd/Port_CaptureVcd.c Tools/Port_CaptureVcd/Port_CaptureVcd_Main.c
+*                -o port_capturevcd
+*            ./port_capturevcd capture.bin 12500 0:0:PTD0 0:1:PTD1 1:15:PTE15 > capture.vcd
+*
+*            Arguments: dump file, counter tick in ps, then one slot:pin:name per wire.
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Port_CaptureVcd.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief Upper bound of the dump size in entries
+*/
+#define PORT_CAPTUREVCD_MAX_ENTRIES_U32     ((uint32)65536U)
+
+/**
+* @brief Upper bound of the number of wires and of a wire name
+*/
+#define PORT_CAPTUREVCD_MAX_CHANNELS_U32    ((uint32)PORT_HW_CAPTURE_MAX_PORTS_U8 * PORT_HW_PINS_PER_PORT_U8)
+#define PORT_CAPTUREVCD_MAX_NAME_U32        (32U)
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Dump buffer
+*/
+static PortHw_CaptureEntryType PortCaptureVcd_aEntries[PORT_CAPTUREVCD_MAX_ENTRIES_U32];
+
+/**
+* @brief Wires and their names
+*/
+static PortCaptureVcd_ChannelType PortCaptureVcd_aChannels[PORT_CAPTUREVCD_MAX_CHANNELS_U32];
+static char PortCaptureVcd_aNames[PORT_CAPTUREVCD_MAX_CHANNELS_U32][PORT_CAPTUREVCD_MAX_NAME_U32];
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+/**
+* @brief Decoder entry point
+* @param argc Argument count
+* @param argv argv[1]: dump file, argv[2]: tick in ps, argv[3..]: slot:pin:name
+* @return 0 on success
+*/
+int main(int argc, char* argv[])
+{
+    FILE* pFile;
+    unsigned slot;
+    unsigned pin;
+    uint32 numEntries = 0U;
+    uint32 numChannels = 0U;
+    uint32 changes;
+    int arg;
+    int status = 0;
+
+    if (argc < 4)
+    {
+        (void)fprintf(stderr, "usage: %s dump.bin tick_ps slot:pin:name...\n", argv[0]);
+        status = 1;
+    }
+
+    for (arg = 3; (0 == status) && (arg < argc); arg++)
+    {
+        if ((numChannels >= PORT_CAPTUREVCD_MAX_CHANNELS_U32) ||
+            (3 != sscanf(argv[arg], "%u:%u:%31s", &slot, &pin, PortCaptureVcd_aNames[numChannels])) ||
+            (slot >= PORT_HW_CAPTURE_MAX_PORTS_U8) || (pin >= PORT_HW_PINS_PER_PORT_U8))
+        {
+            (void)fprintf(stderr, "bad wire %s\n", argv[arg]);
+            status = 1;
+        }
+        else
+        {
+            PortCaptureVcd_aChannels[numChannels].Name_ptr = PortCaptureVcd_aNames[numChannels];
+            PortCaptureVcd_aChannels[numChannels].Slot_u8 = (uint8)slot;
+            PortCaptureVcd_aChannels[numChannels].Pin_u8 = (uint8)pin;
+            numChannels++;
+        }
+    }
+
+    if (0 == status)
+    {
+        pFile = fopen(argv[1], "rb");
+        if (NULL_PTR == pFile)
+        {
+            (void)fprintf(stderr, "cannot open %s\n", argv[1]);
+            status = 1;
+        }
+        else
+        {
+            numEntries = (uint32)fread(PortCaptureVcd_aEntries, sizeof(PortHw_CaptureEntryType),
+                                       PORT_CAPTUREVCD_MAX_ENTRIES_U32, pFile);
+            (void)fclose(pFile);
+        }
+    }
+
+    if (0 == status)
+    {
+        changes = PortCaptureVcd_Write(stdout, PortCaptureVcd_aChannels, numChannels, PortCaptureVcd_aEntries,
+                                       numEntries, (uint32)strtoul(argv[2], NULL_PTR, 0));
+        (void)fprintf(stderr, "%lu runs, %lu value changes\n", (unsigned long)numEntries, (unsigned long)changes);
+    }
+
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
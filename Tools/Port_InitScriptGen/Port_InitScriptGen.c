@@ -0,0 +1,595 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host generator of the Port init script
+==================================================================================================*/
+
+/**
+*   @file    Port_InitScriptGen.c
+*
+*   @brief   Host generator of the Port init script
+*   @details Builds the (register address, value) table replayed by PortHw_InitScriptReplay()
+*            and writes it as a configuration source file. The same tables describe the
+*            register delta between two pin profiles of a configuration.
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "Port_InitScriptGen.h"
+
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/**
+* @brief PCR bits forwarded by PortHw_SetGlobalPinControl()
+*/
+#define PORT_INITSCRIPTGEN_GPC_MASK_U32     ((uint32)(PORT_PCR_PS_MASK | PORT_PCR_PE_MASK | PORT_PCR_PFE_MASK | \
+                                                      PORT_PCR_DSE_MASK | PORT_PCR_MUX_MASK | PORT_PCR_LK_MASK))
+
+/**
+* @brief Pins of one port half
+*/
+#define PORT_INITSCRIPTGEN_HALF_PINS_U32    (16U)
+
+/**
+* @brief Lower half of a port / of a PCR
+*/
+#define PORT_INITSCRIPTGEN_LOWER_MASK_U32   ((uint32)0x0000FFFFU)
+
+/*==================================================================================================
+*                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
+==================================================================================================*/
+/**
+* @brief Register state of one port reached by PortHw_Init() from reset
+*/
+typedef struct
+{
+    uint32 Pdor_u32;                                /**< @brief Output data */
+    uint32 Pddr_u32;                                /**< @brief Data direction */
+    uint32 Touched_u32;                             /**< @brief Pins whose PCR is written */
+    uint32 Pcr_au32[PORT_HW_PINS_PER_PORT_U8];      /**< @brief PCR values */
+} PortInitScriptGen_PortStateType;
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Register state of a port out of reset
+*/
+static const PortInitScriptGen_PortStateType PortInitScriptGen_ResetState;
+
+/*==================================================================================================
+*                                   LOCAL FUNCTION PROTOTYPES
+==================================================================================================*/
+static void PortInitScriptGen_ComputePort(
+    uint8 PortIndex_u8,
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr,
+    PortInitScriptGen_PortStateType* State_ptr
+);
+
+static uint32 PortInitScriptGen_EmitPort(
+    uint8 PortIndex_u8,
+    const PortInitScriptGen_PortStateType* State_ptr,
+    const PortInitScriptGen_PortStateType* Current_ptr,
+    uint32 PcrMask_u32,
+    PortHw_InitScriptEntryType Entries_ptr[]
+);
+
+static void PortInitScriptGen_GetName(const volatile uint32* Address_ptr, char* Name_ptr, size_t Size);
+
+static void PortInitScriptGen_EmitEntries(FILE* File_ptr, const PortHw_InitScriptEntryType Entries_ptr[], uint32 NumEntries_u32);
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Computes the state PortHw_Init() leaves in one port, starting from reset
+*/
+static void PortInitScriptGen_ComputePort(
+    uint8 PortIndex_u8,
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr,
+    PortInitScriptGen_PortStateType* State_ptr
+)
+{
+    uint32 f_Index_u32;
+    uint32 f_Mask_u32;
+    uint32 f_Pin_u32;
+    uint32 f_Pad_u32;
+    uint8 f_Flags_u8;
+
+    (void)memset(State_ptr, 0, sizeof(*State_ptr));
+
+    /* Configured pins: output level and direction of GPIO pins, then the full PCR word */
+    for (f_Index_u32 = 0U; f_Index_u32 < PinCount_u32; f_Index_u32++)
+    {
+        f_Pad_u32 = Table_ptr->PadId_ptr[f_Index_u32];
+        if (PortIndex_u8 == PORT_HW_GET_PORT_U32(f_Pad_u32))
+        {
+            f_Pin_u32 = PORT_HW_GET_PIN_U32(f_Pad_u32);
+            f_Flags_u8 = Table_ptr->Flags_ptr[f_Index_u32];
+            f_Mask_u32 = (1UL << f_Pin_u32);
+            if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_GPIO_U8))
+            {
+                if (PORT_HW_PIN_OUT == PORT_HW_PIN_FLAG_DIR(f_Flags_u8))
+                {
+                    State_ptr->Pddr_u32 |= f_Mask_u32;
+                    if (0U != (f_Flags_u8 & PORT_HW_PIN_FLAG_LEVEL_HIGH_U8))
+                    {
+                        State_ptr->Pdor_u32 |= f_Mask_u32;
+                    }
+                    else
+                    {
+                        State_ptr->Pdor_u32 &= ~f_Mask_u32;
+                    }
+                }
+                else
+                {
+                    State_ptr->Pddr_u32 &= ~f_Mask_u32;
+                }
+            }
+            State_ptr->Pcr_au32[f_Pin_u32] = Table_ptr->Pcr_ptr[f_Index_u32];
+            State_ptr->Touched_u32 |= f_Mask_u32;
+        }
+    }
+
+    /* Unused pads: shared direction and level, lower PCR half through GPCLR/GPCHR */
+    if ((NULL_PTR != UnusedPadMask_ptr) && (NULL_PTR != UnusedPadConfig_ptr) && (0U != UnusedPadMask_ptr[PortIndex_u8]))
+    {
+        f_Mask_u32 = UnusedPadMask_ptr[PortIndex_u8];
+        if (PORT_HW_PIN_OUT == UnusedPadConfig_ptr->Direction_en)
+        {
+            if ((uint8)1U == UnusedPadConfig_ptr->OutputValue_u8)
+            {
+                State_ptr->Pdor_u32 |= f_Mask_u32;
+            }
+            else if ((uint8)0U == UnusedPadConfig_ptr->OutputValue_u8)
+            {
+                State_ptr->Pdor_u32 &= ~f_Mask_u32;
+            }
+            else
+            {
+                /* Level unchanged */
+            }
+            State_ptr->Pddr_u32 |= f_Mask_u32;
+        }
+        else
+        {
+            State_ptr->Pddr_u32 &= ~f_Mask_u32;
+        }
+
+        for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+        {
+            if (0U != (f_Mask_u32 & (1UL << f_Pin_u32)))
+            {
+                State_ptr->Pcr_au32[f_Pin_u32] = (State_ptr->Pcr_au32[f_Pin_u32] & ~PORT_INITSCRIPTGEN_LOWER_MASK_U32) |
+                                                 (UnusedPadConfig_ptr->PinControlRegister_u32 & PORT_INITSCRIPTGEN_GPC_MASK_U32);
+            }
+        }
+        State_ptr->Touched_u32 |= f_Mask_u32;
+    }
+}
+
+/**
+* @brief Emits the writes taking one port from @p Current_ptr to @p State_ptr: PDOR and PDDR
+*        when they differ, then the PCRs of @p PcrMask_u32 grouped by value
+* @return Number of entries emitted
+*/
+static uint32 PortInitScriptGen_EmitPort(
+    uint8 PortIndex_u8,
+    const PortInitScriptGen_PortStateType* State_ptr,
+    const PortInitScriptGen_PortStateType* Current_ptr,
+    uint32 PcrMask_u32,
+    PortHw_InitScriptEntryType Entries_ptr[]
+)
+{
+    uint32 f_Count_u32 = 0U;
+    uint32 f_Pending_u32;
+    uint32 f_Global_u32 = 0U;
+    uint32 f_Group_u32;
+    uint32 f_Value_u32;
+    uint32 f_Pin_u32;
+    uint32 f_Other_u32;
+    GPIO_Type* f_Gpio_ptr = PortHw_g_GpioBaseAddr_ptr[PortIndex_u8];
+    PORT_Type* f_Port_ptr = PortHw_g_PortBaseAddr_ptr[PortIndex_u8];
+
+    /* Output level before direction, direction before mux */
+    if (Current_ptr->Pdor_u32 != State_ptr->Pdor_u32)
+    {
+        Entries_ptr[f_Count_u32].Address_ptr = &f_Gpio_ptr->PDOR;
+        Entries_ptr[f_Count_u32].Value_u32 = State_ptr->Pdor_u32;
+        f_Count_u32++;
+    }
+    if (Current_ptr->Pddr_u32 != State_ptr->Pddr_u32)
+    {
+        Entries_ptr[f_Count_u32].Address_ptr = &f_Gpio_ptr->PDDR;
+        Entries_ptr[f_Count_u32].Value_u32 = State_ptr->Pddr_u32;
+        f_Count_u32++;
+    }
+
+    /* Global control writes reach the lower PCR half only: the upper half must already match */
+    f_Pending_u32 = PcrMask_u32;
+    for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+    {
+        f_Value_u32 = State_ptr->Pcr_au32[f_Pin_u32];
+        if (((f_Value_u32 >> PORT_INITSCRIPTGEN_HALF_PINS_U32) == (Current_ptr->Pcr_au32[f_Pin_u32] >> PORT_INITSCRIPTGEN_HALF_PINS_U32)) &&
+            ((f_Value_u32 & PORT_INITSCRIPTGEN_LOWER_MASK_U32) == (f_Value_u32 & PORT_INITSCRIPTGEN_GPC_MASK_U32)))
+        {
+            f_Global_u32 |= (1UL << f_Pin_u32);
+        }
+    }
+
+    for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+    {
+        if (0U != (f_Pending_u32 & (1UL << f_Pin_u32)))
+        {
+            f_Value_u32 = State_ptr->Pcr_au32[f_Pin_u32];
+            if (0U != (f_Global_u32 & (1UL << f_Pin_u32)))
+            {
+                /* Group every pending pin sharing this value */
+                f_Group_u32 = 0U;
+                for (f_Other_u32 = f_Pin_u32; f_Other_u32 < PORT_HW_PINS_PER_PORT_U8; f_Other_u32++)
+                {
+                    if ((0U != (f_Pending_u32 & f_Global_u32 & (1UL << f_Other_u32))) && (f_Value_u32 == State_ptr->Pcr_au32[f_Other_u32]))
+                    {
+                        f_Group_u32 |= (1UL << f_Other_u32);
+                    }
+                }
+                f_Pending_u32 &= ~f_Group_u32;
+
+                if (0U != (f_Group_u32 & PORT_INITSCRIPTGEN_LOWER_MASK_U32))
+                {
+                    Entries_ptr[f_Count_u32].Address_ptr = &f_Port_ptr->GPCLR;
+                    Entries_ptr[f_Count_u32].Value_u32 = ((f_Group_u32 & PORT_INITSCRIPTGEN_LOWER_MASK_U32) << PORT_GPCLR_GPWE_SHIFT) |
+                                                         (f_Value_u32 & PORT_INITSCRIPTGEN_LOWER_MASK_U32);
+                    f_Count_u32++;
+                }
+                if (0U != (f_Group_u32 >> PORT_INITSCRIPTGEN_HALF_PINS_U32))
+                {
+                    Entries_ptr[f_Count_u32].Address_ptr = &f_Port_ptr->GPCHR;
+                    Entries_ptr[f_Count_u32].Value_u32 = ((f_Group_u32 >> PORT_INITSCRIPTGEN_HALF_PINS_U32) << PORT_GPCHR_GPWE_SHIFT) |
+                                                         (f_Value_u32 & PORT_INITSCRIPTGEN_LOWER_MASK_U32);
+                    f_Count_u32++;
+                }
+            }
+            else
+            {
+                /* Upper PCR half needed, only reachable through the PCR itself */
+                f_Pending_u32 &= ~(1UL << f_Pin_u32);
+                Entries_ptr[f_Count_u32].Address_ptr = &f_Port_ptr->PCR[f_Pin_u32];
+                Entries_ptr[f_Count_u32].Value_u32 = f_Value_u32;
+                f_Count_u32++;
+            }
+        }
+    }
+
+    return f_Count_u32;
+}
+
+/**
+* @brief Maps a register address back to its symbolic name, e.g. "&IP_PORTA->PCR[3]"
+*/
+static void PortInitScriptGen_GetName(const volatile uint32* Address_ptr, char* Name_ptr, size_t Size)
+{
+    static const char* const f_PortNames_apc[PORT_HW_PORT_COUNT_U8] = { "A", "B", "C", "D", "E" };
+    static const char* const f_GpioRegs_apc[] = { "PDOR", "PSOR", "PCOR", "PTOR", "PDIR", "PDDR", "PIDR" };
+    static const char* const f_PortRegs_apc[] = { "GPCLR", "GPCHR", "GICLR", "GICHR" };
+    uint8 f_Port_u8;
+    const volatile uint32* f_Base_ptr;
+    ptrdiff_t f_Offset;
+
+    (void)snprintf(Name_ptr, Size, "0x%08lXUL", (unsigned long)(uintptr_t)Address_ptr);
+    for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_PORT_COUNT_U8; f_Port_u8++)
+    {
+        f_Base_ptr = (const volatile uint32*)PortHw_g_PortBaseAddr_ptr[f_Port_u8];
+        f_Offset = Address_ptr - f_Base_ptr;
+        if ((f_Offset >= 0) && (f_Offset < (ptrdiff_t)PORT_PCR_COUNT))
+        {
+            (void)snprintf(Name_ptr, Size, "&IP_PORT%s->PCR[%ld]", f_PortNames_apc[f_Port_u8], (long)f_Offset);
+        }
+        else if ((f_Offset >= (ptrdiff_t)PORT_PCR_COUNT) && (f_Offset < ((ptrdiff_t)PORT_PCR_COUNT + 4)))
+        {
+            (void)snprintf(Name_ptr, Size, "&IP_PORT%s->%s", f_PortNames_apc[f_Port_u8], f_PortRegs_apc[f_Offset - (ptrdiff_t)PORT_PCR_COUNT]);
+        }
+        else
+        {
+            f_Base_ptr = (const volatile uint32*)PortHw_g_GpioBaseAddr_ptr[f_Port_u8];
+            f_Offset = Address_ptr - f_Base_ptr;
+            if ((f_Offset >= 0) && (f_Offset < 7))
+            {
+                (void)snprintf(Name_ptr, Size, "&IP_PT%s->%s", f_PortNames_apc[f_Port_u8], f_GpioRegs_apc[f_Offset]);
+            }
+        }
+    }
+}
+
+/**
+* @brief Prints the initializer lines of a script table
+*/
+static void PortInitScriptGen_EmitEntries(FILE* File_ptr, const PortHw_InitScriptEntryType Entries_ptr[], uint32 NumEntries_u32)
+{
+    uint32 f_Index_u32;
+    char f_Name_ac[48];
+
+    for (f_Index_u32 = 0U; f_Index_u32 < NumEntries_u32; f_Index_u32++)
+    {
+        PortInitScriptGen_GetName(Entries_ptr[f_Index_u32].Address_ptr, f_Name_ac, sizeof(f_Name_ac));
+        (void)fprintf(File_ptr, "    { (volatile uint32*)%s, (uint32)0x%08lXU }%s\n",
+                      f_Name_ac, (unsigned long)Entries_ptr[f_Index_u32].Value_u32,
+                      ((f_Index_u32 + 1U) < NumEntries_u32) ? "," : "");
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+uint32 PortInitScriptGen_Build(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr,
+    PortHw_InitScriptEntryType Entries_ptr[]
+)
+{
+    PortInitScriptGen_PortStateType f_State_st;
+    uint32 f_Count_u32 = 0U;
+    uint8 f_Port_u8;
+
+    for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_PORT_COUNT_U8; f_Port_u8++)
+    {
+        PortInitScriptGen_ComputePort(f_Port_u8, PinCount_u32, Table_ptr, UnusedPadMask_ptr, UnusedPadConfig_ptr, &f_State_st);
+        f_Count_u32 += PortInitScriptGen_EmitPort(f_Port_u8, &f_State_st, &PortInitScriptGen_ResetState,
+                                                  f_State_st.Touched_u32, &Entries_ptr[f_Count_u32]);
+    }
+
+    return f_Count_u32;
+}
+
+uint32 PortInitScriptGen_BuildDelta(
+    const PortInitScriptGen_VariantType* From_ptr,
+    const PortInitScriptGen_VariantType* To_ptr,
+    PortHw_InitScriptEntryType Entries_ptr[]
+)
+{
+    PortInitScriptGen_PortStateType f_From_st;
+    PortInitScriptGen_PortStateType f_To_st;
+    uint32 f_Count_u32 = 0U;
+    uint32 f_Changed_u32;
+    uint32 f_Pin_u32;
+    uint8 f_Port_u8;
+
+    for (f_Port_u8 = 0U; f_Port_u8 < PORT_HW_PORT_COUNT_U8; f_Port_u8++)
+    {
+        PortInitScriptGen_ComputePort(f_Port_u8, From_ptr->PinCount_u32, From_ptr->Table_ptr, From_ptr->UnusedPadMask_ptr,
+                                      From_ptr->UnusedPadConfig_ptr, &f_From_st);
+        PortInitScriptGen_ComputePort(f_Port_u8, To_ptr->PinCount_u32, To_ptr->Table_ptr, To_ptr->UnusedPadMask_ptr,
+                                      To_ptr->UnusedPadConfig_ptr, &f_To_st);
+
+        /* Only the PCRs the target variant configures and that hold another value */
+        f_Changed_u32 = 0U;
+        for (f_Pin_u32 = 0U; f_Pin_u32 < PORT_HW_PINS_PER_PORT_U8; f_Pin_u32++)
+        {
+            if (f_From_st.Pcr_au32[f_Pin_u32] != f_To_st.Pcr_au32[f_Pin_u32])
+            {
+                f_Changed_u32 |= (1UL << f_Pin_u32);
+            }
+        }
+        f_Count_u32 += PortInitScriptGen_EmitPort(f_Port_u8, &f_To_st, &f_From_st, f_To_st.Touched_u32 & f_Changed_u32,
+                                                  &Entries_ptr[f_Count_u32]);
+    }
+
+    return f_Count_u32;
+}
+
+void PortInitScriptGen_Emit(
+    FILE* File_ptr,
+    const char* Variant_ptr,
+    const PortHw_InitScriptEntryType Entries_ptr[],
+    uint32 NumEntries_u32
+)
+{
+    (void)fprintf(File_ptr,
+        "/*==================================================================================================\n"
+        "*   Project              : MCAL_PORT_S32K144\n"
+        "*   Platform             : CORTEXM\n"
+        "*   Peripheral           : PORT\n"
+        "*   Dependencies         : none\n"
+        "*\n"
+        "*   Autosar Version      : 21.11.0\n"
+        "*   SW Version           : 1.0.0\n"
+        "*\n"
+        "*   Generated by Tools/Port_InitScriptGen, do not edit.\n"
+        "==================================================================================================*/\n"
+        "\n"
+        "/**\n"
+        "*   @file    Port_Hw_InitScript_%s_PBcfg.c\n"
+        "*\n"
+        "*   @brief   Register write sequence equivalent to PortHw_Init() for Port_Config_%s\n"
+        "*   @details Replayed by PortHw_InitScriptReplay() when PORT_INIT_SCRIPT_REPLAY is STD_ON.\n"
+        "*\n"
+        "*   @addtogroup Port_CFG\n"
+        "*   @{\n"
+        "*/\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "extern \"C\"{\n"
+        "#endif\n"
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                          INCLUDE FILES\n"
+        "==================================================================================================*/\n"
+        "#include \"Port_Hw.h\"\n"
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                         LOCAL CONSTANTS\n"
+        "==================================================================================================*/\n"
+        "#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED\n"
+        "#include \"Port_MemMap.h\"\n"
+        "\n"
+        "/**\n"
+        "* @brief Register writes, in order (PDOR, PDDR, then PCRs of each port)\n"
+        "*/\n"
+        "static const PortHw_InitScriptEntryType PortHw_aInitScriptEntries_%s[%lu] =\n"
+        "{\n",
+        Variant_ptr, Variant_ptr, Variant_ptr, (unsigned long)NumEntries_u32);
+
+    PortInitScriptGen_EmitEntries(File_ptr, Entries_ptr, NumEntries_u32);
+
+    (void)fprintf(File_ptr,
+        "};\n"
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                        GLOBAL CONSTANTS\n"
+        "==================================================================================================*/\n"
+        "/**\n"
+        "* @brief Init script of Port_Config_%s\n"
+        "*/\n"
+        "const PortHw_InitScriptType PortHw_g_InitScript_%s =\n"
+        "{\n"
+        "    (uint32)%luU,\n"
+        "    PortHw_aInitScriptEntries_%s\n"
+        "};\n"
+        "\n"
+        "#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED\n"
+        "#include \"Port_MemMap.h\"\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "}\n"
+        "#endif\n"
+        "\n"
+        "/** @} */\n",
+        Variant_ptr, Variant_ptr, (unsigned long)NumEntries_u32, Variant_ptr);
+}
+
+void PortInitScriptGen_EmitProfileSwitches(
+    FILE* File_ptr,
+    const char* Variant_ptr,
+    const PortInitScriptGen_ScriptType Scripts_ptr[],
+    uint32 NumScripts_u32
+)
+{
+    uint32 f_Script_u32;
+    const PortInitScriptGen_ScriptType* f_Script_ptr;
+
+    (void)fprintf(File_ptr,
+        "/*==================================================================================================\n"
+        "*   Project              : MCAL_PORT_S32K144\n"
+        "*   Platform             : CORTEXM\n"
+        "*   Peripheral           : PORT\n"
+        "*   Dependencies         : none\n"
+        "*\n"
+        "*   Autosar Version      : 21.11.0\n"
+        "*   SW Version           : 1.0.0\n"
+        "*\n"
+        "*   Generated by Tools/Port_InitScriptGen, do not edit.\n"
+        "==================================================================================================*/\n"
+        "\n"
+        "/**\n"
+        "*   @file    Port_Hw_ProfileSwitch_%s_PBcfg.c\n"
+        "*\n"
+        "*   @brief   Register write deltas between the pin profiles of Port_Config_%s\n"
+        "*   @details Each script holds only the PDOR, PDDR and PCR writes that differ between two\n"
+        "*            profiles and is replayed by Port_SwitchProfile().\n"
+        "*\n"
+        "*   @addtogroup Port_CFG\n"
+        "*   @{\n"
+        "*/\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "extern \"C\"{\n"
+        "#endif\n"
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                          INCLUDE FILES\n"
+        "==================================================================================================*/\n"
+        "#include \"Port_Hw.h\"\n"
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                         LOCAL CONSTANTS\n"
+        "==================================================================================================*/\n"
+        "#define PORT_START_SEC_CONFIG_DATA_UNSPECIFIED\n"
+        "#include \"Port_MemMap.h\"\n",
+        Variant_ptr, Variant_ptr);
+
+    for (f_Script_u32 = 0U; f_Script_u32 < NumScripts_u32; f_Script_u32++)
+    {
+        f_Script_ptr = &Scripts_ptr[f_Script_u32];
+        (void)fprintf(File_ptr,
+            "\n"
+            "/**\n"
+            "* @brief Register writes of %s, in order (PDOR, PDDR, then PCRs of each port)\n"
+            "*/\n"
+            "static const PortHw_InitScriptEntryType PortHw_aProfileSwitchEntries_%s_%s[%lu] =\n"
+            "{\n",
+            f_Script_ptr->Name_ptr, Variant_ptr, f_Script_ptr->Name_ptr, (unsigned long)f_Script_ptr->NumEntries_u32);
+        PortInitScriptGen_EmitEntries(File_ptr, f_Script_ptr->Entries_ptr, f_Script_ptr->NumEntries_u32);
+        (void)fprintf(File_ptr, "};\n");
+    }
+
+    (void)fprintf(File_ptr,
+        "\n"
+        "/*==================================================================================================\n"
+        "*                                        GLOBAL CONSTANTS\n"
+        "==================================================================================================*/\n");
+
+    for (f_Script_u32 = 0U; f_Script_u32 < NumScripts_u32; f_Script_u32++)
+    {
+        f_Script_ptr = &Scripts_ptr[f_Script_u32];
+        (void)fprintf(File_ptr,
+            "/**\n"
+            "* @brief Profile switch %s of Port_Config_%s\n"
+            "*/\n"
+            "const PortHw_InitScriptType PortHw_g_ProfileSwitch_%s_%s =\n"
+            "{\n"
+            "    (uint32)%luU,\n"
+            "    PortHw_aProfileSwitchEntries_%s_%s\n"
+            "};\n"
+            "\n",
+            f_Script_ptr->Name_ptr, Variant_ptr, Variant_ptr, f_Script_ptr->Name_ptr,
+            (unsigned long)f_Script_ptr->NumEntries_u32, Variant_ptr, f_Script_ptr->Name_ptr);
+    }
+
+    (void)fprintf(File_ptr,
+        "#define PORT_STOP_SEC_CONFIG_DATA_UNSPECIFIED\n"
+        "#include \"Port_MemMap.h\"\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "}\n"
+        "#endif\n"
+        "\n"
+        "/** @} */\n");
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
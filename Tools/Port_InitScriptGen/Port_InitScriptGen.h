@@ -0,0 +1,172 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Host generator of the Port init script
+==================================================================================================*/
+
+#ifndef PORT_INITSCRIPTGEN_H
+#define PORT_INITSCRIPTGEN_H
+
+/**
+*   @file    Port_InitScriptGen.h
+*
+*   @brief   Host generator of the Port init script
+*   @details Turns a configuration set, or the difference between two pin profiles of it,
+*            into the ordered (register address, value) table replayed by
+*            PortHw_InitScriptReplay(). The generator runs on the host with the
+*            simulated register file (Test/Stub_Test/Port_Hw_Sim.h force-included) so that the
+*            register addresses can be mapped back to their symbolic names.
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include "Port_Hw.h"
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/**
+* @brief Upper bound of the script length
+* @details Per port: PDOR and PDDR, at most one global control write per pin and port half
+*          and at most one PCR write per pin.
+*/
+#define PORT_INITSCRIPTGEN_MAX_ENTRIES_U32  ((uint32)PORT_HW_PORT_COUNT_U8 * (2U + (2U * PORT_HW_PINS_PER_PORT_U8)))
+
+/*==================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+==================================================================================================*/
+/**
+* @brief Pin profile of a configuration set, as passed to PortHw_Init()
+*/
+typedef struct
+{
+    uint32 PinCount_u32;                                /**< @brief Number of configured pins */
+    const PortHw_PinTableType* Table_ptr;               /**< @brief Configured pins */
+    const uint32* UnusedPadMask_ptr;                    /**< @brief Unused pads, one mask per port (may be NULL_PTR) */
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr; /**< @brief Unused pad configuration (may be NULL_PTR) */
+} PortInitScriptGen_VariantType;
+
+/**
+* @brief Named script written by PortInitScriptGen_EmitProfileSwitches()
+*/
+typedef struct
+{
+    const char* Name_ptr;                               /**< @brief Name suffix, e.g. "RunToSleep" */
+    const PortHw_InitScriptEntryType* Entries_ptr;      /**< @brief Script entries */
+    uint32 NumEntries_u32;                              /**< @brief Number of script entries */
+} PortInitScriptGen_ScriptType;
+
+/*==================================================================================================
+*                                     FUNCTION PROTOTYPES
+==================================================================================================*/
+/**
+* @brief       Builds the init script of a configuration set
+*
+* @details     Computes the register state PortHw_Init() reaches from reset and emits the
+*              shortest glitch-free write sequence for it, port by port:
+*              PDOR, PDDR, then the PCRs. PCR values without an upper half are written per
+*              value group through GPCLR/GPCHR, the others through their PCR.
+*
+* @param[in]   PinCount_u32        Number of configured pins
+* @param[in]   Table_ptr           Configured pins
+* @param[in]   UnusedPadMask_ptr   Unused pads, one mask per port (may be NULL_PTR)
+* @param[in]   UnusedPadConfig_ptr Unused pad configuration (may be NULL_PTR)
+* @param[out]  Entries_ptr         Script buffer, PORT_INITSCRIPTGEN_MAX_ENTRIES_U32 entries
+*
+* @return      uint32  Number of entries written to @p Entries_ptr
+*/
+uint32 PortInitScriptGen_Build(
+    uint32 PinCount_u32,
+    const PortHw_PinTableType* Table_ptr,
+    const uint32* UnusedPadMask_ptr,
+    const PortHw_UnusedPinConfigType* UnusedPadConfig_ptr,
+    PortHw_InitScriptEntryType Entries_ptr[]
+);
+
+/**
+* @brief       Builds the profile switch script between two variants
+*
+* @details     Computes the register state PortHw_Init() reaches for both variants and emits
+*              only the writes that take the first state to the second one, port by port:
+*              PDOR and PDDR when they differ, then the PCRs the target variant configures
+*              with another value, grouped through GPCLR/GPCHR as in PortInitScriptGen_Build().
+*              Replayed on a port set in @p From_ptr, it gives the registers PortHw_Init() gives
+*              for @p To_ptr.
+*
+* @param[in]   From_ptr      Variant the registers hold
+* @param[in]   To_ptr        Variant to switch to
+* @param[out]  Entries_ptr   Script buffer, PORT_INITSCRIPTGEN_MAX_ENTRIES_U32 entries
+*
+* @return      uint32  Number of entries written to @p Entries_ptr
+*/
+uint32 PortInitScriptGen_BuildDelta(
+    const PortInitScriptGen_VariantType* From_ptr,
+    const PortInitScriptGen_VariantType* To_ptr,
+    PortHw_InitScriptEntryType Entries_ptr[]
+);
+
+/**
+* @brief       Writes the init script as a configuration source file
+*
+* @param[in]   File_ptr      Output stream
+* @param[in]   Variant_ptr   Variant suffix, e.g. "VS_0"
+* @param[in]   Entries_ptr   Script entries
+* @param[in]   NumEntries_u32 Number of script entries
+*
+* @return      void
+*/
+void PortInitScriptGen_Emit(
+    FILE* File_ptr,
+    const char* Variant_ptr,
+    const PortHw_InitScriptEntryType Entries_ptr[],
+    uint32 NumEntries_u32
+);
+
+/**
+* @brief       Writes profile switch scripts as a configuration source file
+*
+* @details     Each script becomes a PortHw_InitScriptType named
+*              PortHw_g_ProfileSwitch_<Variant>_<Name>.
+*
+* @param[in]   File_ptr       Output stream
+* @param[in]   Variant_ptr    Variant suffix, e.g. "VS_0"
+* @param[in]   Scripts_ptr    Scripts to write
+* @param[in]   NumScripts_u32 Number of scripts
+*
+* @return      void
+*/
+void PortInitScriptGen_EmitProfileSwitches(
+    FILE* File_ptr,
+    const char* Variant_ptr,
+    const PortInitScriptGen_ScriptType Scripts_ptr[],
+    uint32 NumScripts_u32
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* PORT_INITSCRIPTGEN_H */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/
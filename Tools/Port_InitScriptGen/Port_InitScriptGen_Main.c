@@ -0,0 +1,174 @@
+/*==================================================================================================
+*   Project              : MCAL_PORT_S32K144
+*   Platform             : CORTEXM
+*   Peripheral           : PORT
+*   Dependencies         : none
+*
+*   Autosar Version      : 21.11.0
+*   SW Version           : 1.0.0
+*
+*   Author               : PhucPH32
+*
+*   Description          : Command line front end of the Port init script generator
+==================================================================================================*/
+
+/**
+*   @file    Port_InitScriptGen_Main.c
+*
+*   @brief   Command line front end of the Port init script generator
+*   @details Generates BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c from Port_Config_VS_0
+*            and, when a second file is given, the run/sleep profile switch deltas in
+*            BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c.
+*
+*            Build and run (from repository root):
+*            gcc -std=c99 -include Port_Hw_Sim.h -ITools/Port_InitScriptGen -ITest/Stub_Test -Iinclude
+*                -IBSW/MCAL/Config/Common -IBSW/MCAL/Config/Port -IBSW/MCAL/Driver/Base
+*                -IBSW/MCAL/Driver/Port -IBSW/MCAL/Driver/SchM -IBoard/Driver/HW_Port
+*                Tools/Port_InitScriptGen/Port_InitScriptGen.c Tools/Port_InitScriptGen/Port_InitScriptGen_Main.c
+*                Test/Stub_Test/Port_Hw_Sim.c
+*                Board/Driver/HW_Port/Port_Hw.c BSW/MCAL/Driver/SchM/SchM_Port.c
+*                BSW/MCAL/Config/Port/Port_Hw_VS_0_PBcfg.c BSW/MCAL/Config/Port/Port_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c -o port_initscriptgen
+*            ./port_initscriptgen BSW/MCAL/Config/Port/Port_Hw_InitScript_VS_0_PBcfg.c
+*                BSW/MCAL/Config/Port/Port_Hw_ProfileSwitch_VS_0_PBcfg.c
+*
+*            The previous scripts are linked only to satisfy Port_Config_VS_0, they are not read.
+*
+*   @addtogroup Port_Tools
+*   @{
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+==================================================================================================*/
+#include <stdio.h>
+#include "Port.h"
+#include "Port_InitScriptGen.h"
+
+/*==================================================================================================
+*                                      LOCAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Script buffer
+*/
+static PortHw_InitScriptEntryType PortInitScriptGen_aEntries[PORT_INITSCRIPTGEN_MAX_ENTRIES_U32];
+
+/**
+* @brief Profile switch script buffers: run to sleep, sleep to run
+*/
+static PortHw_InitScriptEntryType PortInitScriptGen_aSwitchEntries[2][PORT_INITSCRIPTGEN_MAX_ENTRIES_U32];
+
+/*==================================================================================================
+*                                      LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief Writes the run/sleep profile switch deltas of Port_Config_VS_0
+* @return 0 on success
+*/
+static int PortInitScriptGen_GenerateProfileSwitches(const char* FileName_ptr)
+{
+    const Port_ConfigType* pConfig = &Port_Config_VS_0;
+    const uint32* pUnusedMask = (0U != pConfig->NumUnusedPins_u16) ? pConfig->UnusedPadMask_ptr : NULL_PTR;
+    PortInitScriptGen_VariantType run;
+    PortInitScriptGen_VariantType sleep;
+    PortInitScriptGen_ScriptType scripts[2];
+    FILE* pFile;
+    int status = 0;
+
+    run.PinCount_u32 = pConfig->NumPins_u16;
+    run.Table_ptr = pConfig->PinTable_ptr;
+    run.UnusedPadMask_ptr = pUnusedMask;
+    run.UnusedPadConfig_ptr = (const PortHw_UnusedPinConfigType*)pConfig->UnusedPadConfig_ptr;
+
+    sleep.PinCount_u32 = pConfig->NumPins_u16;
+    sleep.Table_ptr = &PortHw_g_PinSleepTable_VS_0;
+    sleep.UnusedPadMask_ptr = pUnusedMask;
+    sleep.UnusedPadConfig_ptr = &PortHw_g_UnusedPinSleepConfig_VS_0;
+
+    scripts[0].Name_ptr = "RunToSleep";
+    scripts[0].Entries_ptr = PortInitScriptGen_aSwitchEntries[0];
+    scripts[0].NumEntries_u32 = PortInitScriptGen_BuildDelta(&run, &sleep, PortInitScriptGen_aSwitchEntries[0]);
+    scripts[1].Name_ptr = "SleepToRun";
+    scripts[1].Entries_ptr = PortInitScriptGen_aSwitchEntries[1];
+    scripts[1].NumEntries_u32 = PortInitScriptGen_BuildDelta(&sleep, &run, PortInitScriptGen_aSwitchEntries[1]);
+
+    pFile = fopen(FileName_ptr, "w");
+    if (NULL_PTR == pFile)
+    {
+        (void)fprintf(stderr, "cannot open %s\n", FileName_ptr);
+        status = 1;
+    }
+    else
+    {
+        PortInitScriptGen_EmitProfileSwitches(pFile, "VS_0", scripts, 2U);
+        (void)fclose(pFile);
+        (void)fprintf(stderr, "profile switches: %lu / %lu register writes\n",
+                      (unsigned long)scripts[0].NumEntries_u32, (unsigned long)scripts[1].NumEntries_u32);
+    }
+
+    return status;
+}
+
+/*==================================================================================================
+*                                       MAIN FUNCTION
+==================================================================================================*/
+/**
+* @brief Generator entry point
+* @param argc Argument count
+* @param argv argv[1]: output file (stdout if omitted), argv[2]: profile switch output file (optional)
+* @return 0 on success
+*/
+int main(int argc, char* argv[])
+{
+    const Port_ConfigType* pConfig = &Port_Config_VS_0;
+    FILE* pFile = stdout;
+    uint32 numEntries;
+    int status = 0;
+
+    numEntries = PortInitScriptGen_Build(pConfig->NumPins_u16, pConfig->PinTable_ptr,
+                                         (0U != pConfig->NumUnusedPins_u16) ? pConfig->UnusedPadMask_ptr : NULL_PTR,
+                                         (const PortHw_UnusedPinConfigType*)pConfig->UnusedPadConfig_ptr,
+                                         PortInitScriptGen_aEntries);
+
+    if (argc > 1)
+    {
+        pFile = fopen(argv[1], "w");
+    }
+
+    if (NULL_PTR == pFile)
+    {
+        (void)fprintf(stderr, "cannot open %s\n", argv[1]);
+        status = 1;
+    }
+    else
+    {
+        PortInitScriptGen_Emit(pFile, "VS_0", PortInitScriptGen_aEntries, numEntries);
+        if (stdout != pFile)
+        {
+            (void)fclose(pFile);
+        }
+        (void)fprintf(stderr, "%lu register writes\n", (unsigned long)numEntries);
+    }
+
+    if ((0 == status) && (argc > 2))
+    {
+        status = PortInitScriptGen_GenerateProfileSwitches(argv[2]);
+    }
+
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/*==================================================================================================
+*                                      END OF FILE
+==================================================================================================*/